@@ -0,0 +1,377 @@
+// FastestJSONInTheWest - Unified Benchmark Harness
+// Consolidates the standalone benchmark mains into one target with warm-up
+// control, CPU pinning, median-of-N reporting, and machine-readable JSON
+// output (same shape as openmp_scaling_results.json), so CI can diff two runs
+// and fail on regressions automatically:
+//
+//   ./benchmark_harness --out new.json
+//   ./benchmark_harness --out new.json --baseline old.json --threshold 2.0
+//
+// Options:
+//   --warmup N       warm-up runs per scenario, not measured   (default 3)
+//   --repeats N      measured runs per scenario, median wins   (default 11)
+//   --pin-cpu C      pin the process to CPU C before timing    (default off)
+//   --size-mb M      generated input size in MB                (default 10)
+//   --input FILE     benchmark FILE instead of generated input
+//   --ndjson         treat the input as NDJSON (one document per line)
+//   --out FILE       write JSON results to FILE
+//   --baseline FILE  compare against FILE; exit 1 on regression
+//   --threshold P    regression tolerance in percent           (default 2.0)
+// ============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+    #include <sched.h>
+#endif
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+using namespace std::chrono;
+
+namespace {
+
+// ============================================================================
+// Options
+// ============================================================================
+
+struct harness_options {
+    int warmup = 3;
+    int repeats = 11;
+    int pin_cpu = -1;
+    size_t size_mb = 10;
+    bool ndjson = false;
+    std::string input_file;
+    std::string out_file;
+    std::string baseline_file;
+    double threshold_pct = 2.0;
+};
+
+auto parse_options(int argc, char** argv) -> harness_options {
+    harness_options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--warmup") opts.warmup = std::stoi(next());
+        else if (arg == "--repeats") opts.repeats = std::stoi(next());
+        else if (arg == "--pin-cpu") opts.pin_cpu = std::stoi(next());
+        else if (arg == "--size-mb") opts.size_mb = std::stoul(next());
+        else if (arg == "--input") opts.input_file = next();
+        else if (arg == "--ndjson") opts.ndjson = true;
+        else if (arg == "--out") opts.out_file = next();
+        else if (arg == "--baseline") opts.baseline_file = next();
+        else if (arg == "--threshold") opts.threshold_pct = std::stod(next());
+        else std::cerr << "Unknown option: " << arg << "\n";
+    }
+    return opts;
+}
+
+auto pin_to_cpu(int cpu) -> bool {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+// ============================================================================
+// Test Data Generation
+// ============================================================================
+// Same record-array shape as the scaling benchmarks: realistic key repetition
+// and a mix of numbers, strings, booleans, and small nested containers.
+
+auto generate_input(size_t target_size_mb) -> std::string {
+    std::ostringstream json;
+    json << "{\"metadata\":{\"version\":\"1.0\",\"generated\":true},\"data\":[";
+
+    size_t target_bytes = target_size_mb * 1024 * 1024;
+    size_t item_count = 0;
+    size_t written = 64;
+
+    while (written < target_bytes) {
+        std::ostringstream item;
+        if (item_count > 0) item << ",";
+        item << "{\"id\":" << item_count << ",\"name\":\"Item " << item_count
+             << "\",\"value\":" << (static_cast<double>(item_count) * 3.14159)
+             << ",\"active\":" << (item_count % 2 == 0 ? "true" : "false")
+             << ",\"tags\":[\"tag1\",\"tag2\",\"tag3\"]"
+             << ",\"metadata\":{\"created\":\"2025-01-01T00:00:00Z\",\"version\":1}}";
+        written += item.str().size();
+        json << item.str();
+        item_count++;
+    }
+
+    json << "]}";
+    return json.str();
+}
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+struct scenario_result {
+    std::string name;
+    double median_ms = 0.0;
+    double min_ms = 0.0;
+    double throughput_mbs = 0.0;
+};
+
+// Runs one scenario warmup+repeats times and reports the median (robust to
+// scheduler noise in a way mean-of-N is not) plus the min (the "speed of
+// light" number for this machine).
+auto measure(const std::string& name, const std::string& input, int warmup, int repeats,
+             const std::function<void(const std::string&)>& body) -> scenario_result {
+    for (int i = 0; i < warmup; ++i) {
+        body(input);
+    }
+
+    std::vector<double> times_ms;
+    times_ms.reserve(static_cast<size_t>(repeats));
+    for (int i = 0; i < repeats; ++i) {
+        auto start = high_resolution_clock::now();
+        body(input);
+        auto end = high_resolution_clock::now();
+        times_ms.push_back(duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(times_ms.begin(), times_ms.end());
+    scenario_result result;
+    result.name = name;
+    result.median_ms = times_ms[times_ms.size() / 2];
+    result.min_ms = times_ms.front();
+    double input_mb = static_cast<double>(input.size()) / (1024.0 * 1024.0);
+    result.throughput_mbs = result.median_ms > 0.0 ? input_mb / (result.median_ms / 1000.0) : 0.0;
+
+    std::cout << std::left << std::setw(20) << name << std::right << std::fixed
+              << std::setprecision(3) << std::setw(12) << result.median_ms << " ms (median)"
+              << std::setw(12) << result.min_ms << " ms (min)" << std::setw(12)
+              << std::setprecision(1) << result.throughput_mbs << " MB/s\n";
+    return result;
+}
+
+// ============================================================================
+// Result I/O and Regression Comparison
+// ============================================================================
+
+auto write_results(const std::string& path, const harness_options& opts, size_t input_bytes,
+                   const std::vector<scenario_result>& results) -> void {
+    std::ofstream out(path);
+    out << std::fixed << std::setprecision(4);
+    out << "{\n";
+    out << "  \"benchmark\": \"Unified Benchmark Harness\",\n";
+    out << "  \"input_size_mb\": " << (static_cast<double>(input_bytes) / (1024.0 * 1024.0))
+        << ",\n";
+    out << "  \"warmup_runs\": " << opts.warmup << ",\n";
+    out << "  \"measured_runs\": " << opts.repeats << ",\n";
+    out << "  \"pinned_cpu\": " << opts.pin_cpu << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << "    {\n";
+        out << "      \"scenario\": \"" << r.name << "\",\n";
+        out << "      \"median_ms\": " << r.median_ms << ",\n";
+        out << "      \"min_ms\": " << r.min_ms << ",\n";
+        out << "      \"throughput_mbs\": " << r.throughput_mbs << "\n";
+        out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+// Compares this run's medians against a baseline file written by an earlier
+// run (parsed with the library itself). Returns the number of scenarios that
+// regressed by more than threshold_pct.
+auto compare_against_baseline(const std::string& path, double threshold_pct,
+                              const std::vector<scenario_result>& results) -> int {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "baseline: cannot open " << path << "\n";
+        return 1;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+
+    auto parsed = parse(text);
+    if (!parsed) {
+        std::cerr << "baseline: parse failed: " << parsed.error().message << "\n";
+        return 1;
+    }
+
+    const json_value* baseline_results = parsed->find("results");
+    if (baseline_results == nullptr || !baseline_results->is_array()) {
+        std::cerr << "baseline: missing results array\n";
+        return 1;
+    }
+
+    int regressions = 0;
+    std::cout << "\nRegression check vs " << path << " (threshold " << threshold_pct << "%):\n";
+    for (const auto& r : results) {
+        double baseline_ms = -1.0;
+        for (const auto& entry : baseline_results->as_array()) {
+            const json_value* name = entry.find("scenario");
+            const json_value* median = entry.find("median_ms");
+            if (name != nullptr && median != nullptr && name->is_string()
+                && name->as_string() == r.name) {
+                baseline_ms = median->as_number();
+                break;
+            }
+        }
+        if (baseline_ms <= 0.0) {
+            std::cout << "  " << r.name << ": no baseline entry (new scenario)\n";
+            continue;
+        }
+        double delta_pct = (r.median_ms - baseline_ms) / baseline_ms * 100.0;
+        bool regressed = delta_pct > threshold_pct;
+        std::cout << "  " << std::left << std::setw(20) << r.name << std::right << std::fixed
+                  << std::setprecision(2) << std::showpos << delta_pct << "%" << std::noshowpos
+                  << (regressed ? "  REGRESSION" : "") << "\n";
+        if (regressed) {
+            regressions++;
+        }
+    }
+    return regressions;
+}
+
+}  // namespace
+
+// ============================================================================
+// Scenarios
+// ============================================================================
+
+int main(int argc, char** argv) {
+    harness_options opts = parse_options(argc, argv);
+
+    if (opts.pin_cpu >= 0 && !pin_to_cpu(opts.pin_cpu)) {
+        std::cerr << "warning: failed to pin to CPU " << opts.pin_cpu << "\n";
+    }
+
+    std::string input;
+    if (!opts.input_file.empty()) {
+        std::ifstream in(opts.input_file, std::ios::binary);
+        if (!in) {
+            std::cerr << "cannot open input file " << opts.input_file << "\n";
+            return 1;
+        }
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        input = buffer.str();
+    } else {
+        input = generate_input(opts.size_mb);
+    }
+
+    std::cout << "Input: " << (static_cast<double>(input.size()) / (1024.0 * 1024.0))
+              << " MB, warmup " << opts.warmup << ", repeats " << opts.repeats << "\n\n";
+
+    std::vector<scenario_result> results;
+
+    // NDJSON corpora are one document per line with no enclosing array; the
+    // single-document scenarios would reject them at the pre-parse below, so
+    // they route through the batch parser as their own scenario set.
+    if (opts.ndjson) {
+        auto docs = parse_ndjson(input);
+        for (const auto& d : docs) {
+            if (!d) {
+                std::cerr << "input line does not parse: " << d.error().message << "\n";
+                return 1;
+            }
+        }
+
+        results.push_back(measure("ndjson_parse", input, opts.warmup, opts.repeats,
+                                  [](const std::string& in) {
+                                      auto rs = parse_ndjson(in);
+                                      for (const auto& r : rs) {
+                                          if (!r) std::abort();
+                                      }
+                                  }));
+
+        if (!opts.out_file.empty()) {
+            write_results(opts.out_file, opts, input.size(), results);
+            std::cout << "\nResults written to " << opts.out_file << "\n";
+        }
+        if (!opts.baseline_file.empty()) {
+            int regressions = compare_against_baseline(opts.baseline_file, opts.threshold_pct,
+                                                       results);
+            if (regressions > 0) {
+                std::cerr << regressions << " scenario(s) regressed beyond "
+                          << opts.threshold_pct << "%\n";
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    // Parsed once outside the timed region for the serialization scenarios
+    auto tree = parse(input);
+    if (!tree) {
+        std::cerr << "input does not parse: " << tree.error().message << "\n";
+        return 1;
+    }
+
+    results.push_back(measure("dom_parse", input, opts.warmup, opts.repeats,
+                              [](const std::string& in) {
+                                  auto r = parse(in);
+                                  if (!r) std::abort();
+                              }));
+
+    results.push_back(measure("tape_parse", input, opts.warmup, opts.repeats,
+                              [](const std::string& in) {
+                                  auto r = parse_tape(in);
+                                  if (!r) std::abort();
+                              }));
+
+    results.push_back(measure("ondemand_index", input, opts.warmup, opts.repeats,
+                              [](const std::string& in) {
+                                  auto doc = parse_ondemand(in);
+                                  if (!doc.root().valid()) std::abort();
+                              }));
+
+    results.push_back(measure("validate", input, opts.warmup, opts.repeats,
+                              [](const std::string& in) {
+                                  auto r = validate(in);
+                                  if (!r) std::abort();
+                              }));
+
+    results.push_back(measure("minify", input, opts.warmup, opts.repeats,
+                              [](const std::string& in) {
+                                  auto out = minify(in);
+                                  if (out.empty() && !in.empty()) std::abort();
+                              }));
+
+    results.push_back(measure("stringify", input, opts.warmup, opts.repeats,
+                              [&tree](const std::string&) {
+                                  auto out = stringify(*tree);
+                                  if (out.empty()) std::abort();
+                              }));
+
+    if (!opts.out_file.empty()) {
+        write_results(opts.out_file, opts, input.size(), results);
+        std::cout << "\nResults written to " << opts.out_file << "\n";
+    }
+
+    if (!opts.baseline_file.empty()) {
+        int regressions = compare_against_baseline(opts.baseline_file, opts.threshold_pct,
+                                                   results);
+        if (regressions > 0) {
+            std::cerr << regressions << " scenario(s) regressed beyond " << opts.threshold_pct
+                      << "%\n";
+            return 1;
+        }
+    }
+
+    return 0;
+}
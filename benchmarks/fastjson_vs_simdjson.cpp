@@ -27,9 +27,30 @@
 #include <simdjson.h>
 
 #include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
 #include <string>
 #include <vector>
 
+// Optional baselines for the standard-corpora section: each competitor
+// registers only when its headers are visible at build time, so the target
+// still builds on machines that have none of them installed.
+#if __has_include(<yyjson.h>)
+    #include <yyjson.h>
+    #define FASTJSON_BENCH_HAVE_YYJSON 1
+#endif
+#if __has_include(<rapidjson/document.h>)
+    #include <rapidjson/document.h>
+    #include <rapidjson/stringbuffer.h>
+    #include <rapidjson/writer.h>
+    #define FASTJSON_BENCH_HAVE_RAPIDJSON 1
+#endif
+#if __has_include(<glaze/glaze.hpp>)
+    #include <glaze/glaze.hpp>
+    #define FASTJSON_BENCH_HAVE_GLAZE 1
+#endif
+
 // Forward-declare fastjson types (from the module)
 // The build system compiles this with -fprebuilt-module-path pointing to fastjson.pcm
 import fastjson;
@@ -367,6 +388,303 @@ void BM_Throughput_SimdJSON(benchmark::State& state) {
 }
 BENCHMARK(BM_Throughput_SimdJSON);
 
+// ============================================================================
+// Standard Corpora (twitter / canada / citm_catalog / gsoc-2018)
+// ============================================================================
+// The synthetic payloads above measure our trading shapes; the canonical
+// corpora are what every other JSON library publishes numbers on, so the
+// internal "why this library" argument needs them from this tree. Files are
+// looked up in $FASTJSON_CORPUS_DIR (default benchmarks/data); corpora not on
+// disk are skipped at startup. Each library gets a parse, iterate (visit
+// every scalar), and serialize row per corpus, where the library supports the
+// operation.
+
+struct corpus {
+    std::string name;
+    std::string text;
+    simdjson::padded_string padded;
+};
+
+auto corpus_dir() -> std::string {
+    if (const char* dir = std::getenv("FASTJSON_CORPUS_DIR")) {
+        return dir;
+    }
+    return "benchmarks/data";
+}
+
+auto load_corpora() -> const std::vector<corpus>& {
+    static const std::vector<corpus> corpora = [] {
+        std::vector<corpus> loaded;
+        for (const char* file :
+             {"twitter.json", "canada.json", "citm_catalog.json", "gsoc-2018.json"}) {
+            std::ifstream in(corpus_dir() + "/" + file, std::ios::binary);
+            if (!in) {
+                continue;
+            }
+            std::ostringstream buffer;
+            buffer << in.rdbuf();
+            corpus c;
+            c.name = std::string(file);
+            c.name = c.name.substr(0, c.name.find('.'));
+            c.text = buffer.str();
+            c.padded = simdjson::padded_string(c.text);
+            loaded.push_back(std::move(c));
+        }
+        return loaded;
+    }();
+    return corpora;
+}
+
+// Scalar-visit recursion for the iterate rows: touches every value once, the
+// canonical "walk the whole document" access pattern
+template <typename V>
+auto count_scalars_fastjson(const V& value) -> size_t {
+    if (const auto* arr = value.as_array()) {
+        size_t n = 0;
+        for (const auto& child : *arr) {
+            n += count_scalars_fastjson(child);
+        }
+        return n;
+    }
+    if (const auto* obj = value.as_object()) {
+        size_t n = 0;
+        for (const auto& [key, child] : *obj) {
+            n += count_scalars_fastjson(child);
+        }
+        return n;
+    }
+    return 1;
+}
+
+auto count_scalars_simdjson(const simdjson::dom::element& element) -> size_t {
+    if (element.is_array()) {
+        size_t n = 0;
+        for (simdjson::dom::element child : element.get_array().value()) {
+            n += count_scalars_simdjson(child);
+        }
+        return n;
+    }
+    if (element.is_object()) {
+        size_t n = 0;
+        for (auto field : element.get_object().value()) {
+            n += count_scalars_simdjson(field.value);
+        }
+        return n;
+    }
+    return 1;
+}
+
+#ifdef FASTJSON_BENCH_HAVE_YYJSON
+auto count_scalars_yyjson(yyjson_val* value) -> size_t {
+    if (yyjson_is_arr(value)) {
+        size_t n = 0;
+        yyjson_val* child = nullptr;
+        yyjson_arr_iter iter;
+        yyjson_arr_iter_init(value, &iter);
+        while ((child = yyjson_arr_iter_next(&iter)) != nullptr) {
+            n += count_scalars_yyjson(child);
+        }
+        return n;
+    }
+    if (yyjson_is_obj(value)) {
+        size_t n = 0;
+        yyjson_val* key = nullptr;
+        yyjson_obj_iter iter;
+        yyjson_obj_iter_init(value, &iter);
+        while ((key = yyjson_obj_iter_next(&iter)) != nullptr) {
+            n += count_scalars_yyjson(yyjson_obj_iter_get_val(key));
+        }
+        return n;
+    }
+    return 1;
+}
+#endif
+
+#ifdef FASTJSON_BENCH_HAVE_RAPIDJSON
+auto count_scalars_rapidjson(const rapidjson::Value& value) -> size_t {
+    if (value.IsArray()) {
+        size_t n = 0;
+        for (const auto& child : value.GetArray()) {
+            n += count_scalars_rapidjson(child);
+        }
+        return n;
+    }
+    if (value.IsObject()) {
+        size_t n = 0;
+        for (const auto& member : value.GetObject()) {
+            n += count_scalars_rapidjson(member.value);
+        }
+        return n;
+    }
+    return 1;
+}
+#endif
+
+auto register_corpus_benchmarks() -> bool {
+    for (const corpus& c : load_corpora()) {
+        const corpus* cp = &c;
+        const auto bytes = static_cast<int64_t>(c.text.size());
+        auto name = [cp](const char* op, const char* lib) {
+            return cp->name + "/" + op + "/" + lib;
+        };
+
+        // --- fastjson ---
+        benchmark::RegisterBenchmark(name("parse", "fastjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         for (auto _ : state) {
+                                             auto result = fastjson::mr::parse(cp->text);
+                                             benchmark::DoNotOptimize(result);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+        benchmark::RegisterBenchmark(name("iterate", "fastjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         auto doc = fastjson::mr::parse(cp->text).value();
+                                         for (auto _ : state) {
+                                             benchmark::DoNotOptimize(count_scalars_fastjson(doc));
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+        benchmark::RegisterBenchmark(name("serialize", "fastjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         auto doc = fastjson::mr::parse(cp->text).value();
+                                         for (auto _ : state) {
+                                             auto s = doc.to_string();
+                                             benchmark::DoNotOptimize(s);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+
+        // --- simdjson (ondemand for parse, dom for iterate/serialize) ---
+        benchmark::RegisterBenchmark(name("parse", "simdjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         simdjson::ondemand::parser parser;
+                                         for (auto _ : state) {
+                                             auto doc = parser.iterate(cp->padded);
+                                             benchmark::DoNotOptimize(doc);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+        benchmark::RegisterBenchmark(name("iterate", "simdjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         simdjson::dom::parser parser;
+                                         simdjson::dom::element doc = parser.parse(cp->padded);
+                                         for (auto _ : state) {
+                                             benchmark::DoNotOptimize(count_scalars_simdjson(doc));
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+        benchmark::RegisterBenchmark(name("serialize", "simdjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         simdjson::dom::parser parser;
+                                         simdjson::dom::element doc = parser.parse(cp->padded);
+                                         for (auto _ : state) {
+                                             std::ostringstream out;
+                                             out << doc;
+                                             benchmark::DoNotOptimize(out);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+
+#ifdef FASTJSON_BENCH_HAVE_YYJSON
+        benchmark::RegisterBenchmark(name("parse", "yyjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         for (auto _ : state) {
+                                             yyjson_doc* doc =
+                                                 yyjson_read(cp->text.data(), cp->text.size(), 0);
+                                             benchmark::DoNotOptimize(doc);
+                                             yyjson_doc_free(doc);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+        benchmark::RegisterBenchmark(name("iterate", "yyjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         yyjson_doc* doc =
+                                             yyjson_read(cp->text.data(), cp->text.size(), 0);
+                                         for (auto _ : state) {
+                                             benchmark::DoNotOptimize(
+                                                 count_scalars_yyjson(yyjson_doc_get_root(doc)));
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                         yyjson_doc_free(doc);
+                                     });
+        benchmark::RegisterBenchmark(name("serialize", "yyjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         yyjson_doc* doc =
+                                             yyjson_read(cp->text.data(), cp->text.size(), 0);
+                                         for (auto _ : state) {
+                                             size_t len = 0;
+                                             char* s = yyjson_write(doc, 0, &len);
+                                             benchmark::DoNotOptimize(s);
+                                             std::free(s);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                         yyjson_doc_free(doc);
+                                     });
+#endif
+
+#ifdef FASTJSON_BENCH_HAVE_RAPIDJSON
+        benchmark::RegisterBenchmark(name("parse", "rapidjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         for (auto _ : state) {
+                                             rapidjson::Document doc;
+                                             doc.Parse(cp->text.c_str());
+                                             benchmark::DoNotOptimize(doc);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+        benchmark::RegisterBenchmark(name("iterate", "rapidjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         rapidjson::Document doc;
+                                         doc.Parse(cp->text.c_str());
+                                         for (auto _ : state) {
+                                             benchmark::DoNotOptimize(count_scalars_rapidjson(doc));
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+        benchmark::RegisterBenchmark(name("serialize", "rapidjson"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         rapidjson::Document doc;
+                                         doc.Parse(cp->text.c_str());
+                                         for (auto _ : state) {
+                                             rapidjson::StringBuffer buffer;
+                                             rapidjson::Writer<rapidjson::StringBuffer> writer(
+                                                 buffer);
+                                             doc.Accept(writer);
+                                             benchmark::DoNotOptimize(buffer);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+#endif
+
+#ifdef FASTJSON_BENCH_HAVE_GLAZE
+        benchmark::RegisterBenchmark(name("parse", "glaze"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         for (auto _ : state) {
+                                             glz::json_t doc{};
+                                             auto ec = glz::read_json(doc, cp->text);
+                                             benchmark::DoNotOptimize(ec);
+                                             benchmark::DoNotOptimize(doc);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+        benchmark::RegisterBenchmark(name("serialize", "glaze"),
+                                     [cp, bytes](benchmark::State& state) {
+                                         glz::json_t doc{};
+                                         (void)glz::read_json(doc, cp->text);
+                                         for (auto _ : state) {
+                                             auto s = glz::write_json(doc);
+                                             benchmark::DoNotOptimize(s);
+                                         }
+                                         state.SetBytesProcessed(state.iterations() * bytes);
+                                     });
+#endif
+    }
+    return true;
+}
+
+const bool g_corpora_registered = register_corpus_benchmarks();
+
 }  // namespace
 
 BENCHMARK_MAIN();
@@ -31,6 +31,10 @@
     #include <cpuid.h>
     #include <immintrin.h>
     #include <x86intrin.h>
+    #ifdef __linux__
+        #include <sys/syscall.h>
+        #include <unistd.h>
+    #endif
 #endif
 
 #ifdef __ARM_NEON
@@ -68,8 +72,36 @@ constexpr uint32_t SIMD_AVX512VNNI = 0x1000;
 constexpr uint32_t SIMD_AMX_TILE = 0x2000;
 constexpr uint32_t SIMD_AMX_INT8 = 0x4000;
 
+        #if defined(HAVE_AMX_TILE) && defined(__linux__)
+// AMX tile state is permission-gated: the kernel traps the first tile
+// instruction via XFD unless the process requests the XTILEDATA component
+// first. Request it once and confirm the OS actually context-switches tile
+// registers (XCR0 bits 17/18) before advertising the capability, otherwise
+// the "available" path would fault on first use.
+static auto request_amx_permission() noexcept -> bool {
+    constexpr long ARCH_REQ_XCOMP_PERM = 0x1023;
+    constexpr long XFEATURE_XTILEDATA = 18;
+    if (syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA) != 0) {
+        return false;
+    }
+    uint32_t xcr0_lo, xcr0_hi;
+    __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    return (xcr0_lo & (1u << 17)) != 0 && (xcr0_lo & (1u << 18)) != 0;
+}
+        #endif
+
 // Thread-safe SIMD capability detection
 auto detect_simd_capabilities() noexcept -> uint32_t {
+    // Static dispatch builds pin the capability mask at compile time so every
+    // tier check below constant-folds; the fleet is assumed homogeneous.
+#if defined(FASTJSON_STATIC_SIMD_AVX512)
+    return SIMD_SSE2 | SIMD_SSE3 | SIMD_SSSE3 | SIMD_SSE41 | SIMD_SSE42 | SIMD_AVX | SIMD_AVX2 |
+           SIMD_AVX512F | SIMD_AVX512BW;
+#elif defined(FASTJSON_STATIC_SIMD_AVX2)
+    return SIMD_SSE2 | SIMD_SSE3 | SIMD_SSSE3 | SIMD_SSE41 | SIMD_SSE42 | SIMD_AVX | SIMD_AVX2;
+#elif defined(FASTJSON_STATIC_SIMD_SCALAR)
+    return 0;
+#else
     static std::atomic<uint32_t> cached_caps{0};
     static std::once_flag init_flag;
 
@@ -137,12 +169,12 @@ auto detect_simd_capabilities() noexcept -> uint32_t {
             if (ecx & (1 << 11))
                 caps |= SIMD_AVX512VNNI;
         #endif
-        #ifdef HAVE_AMX_TILE
-            if (edx & (1 << 24))
+        #if defined(HAVE_AMX_TILE) && defined(__linux__)
+            if ((edx & (1 << 24)) && request_amx_permission())
                 caps |= SIMD_AMX_TILE;
         #endif
         #ifdef HAVE_AMX_INT8
-            if (edx & (1 << 25))
+            if ((edx & (1 << 25)) && (caps & SIMD_AMX_TILE))
                 caps |= SIMD_AMX_INT8;
         #endif
         }
@@ -151,17 +183,31 @@ auto detect_simd_capabilities() noexcept -> uint32_t {
     });
 
     return cached_caps.load(std::memory_order_acquire);
+#endif  // FASTJSON_STATIC_SIMD
 }
 
         #ifdef HAVE_AMX_TILE
 // AMX-TMUL implementation for advanced matrix operations on JSON data
 class amx_context {
 private:
-    static thread_local bool tiles_configured;
+    // Tile configuration is per logical CPU context and _tile_loadconfig is
+    // expensive enough to dominate small scans, so each thread loads the
+    // palette once and releases its tile state at thread exit. The guard is
+    // thread_local: releasing from another thread would be a no-op at best.
+    struct tile_guard {
+        bool configured = false;
+
+        ~tile_guard() {
+            if (configured) {
+                _tile_release();
+            }
+        }
+    };
 
 public:
     static auto configure_tiles() noexcept -> bool {
-        if (!tiles_configured) {
+        static thread_local tile_guard guard;
+        if (!guard.configured) {
             // Configure AMX tiles for 8-bit integer operations
             struct tile_config {
                 uint8_t palette_id;
@@ -178,21 +224,12 @@ public:
                 config.rows[i] = 16;
             }
             _tile_loadconfig(&config);
-            tiles_configured = true;
-        }
-        return tiles_configured;
-    }
-
-    ~amx_context() {
-        if (tiles_configured) {
-            _tile_release();
-            tiles_configured = false;
+            guard.configured = true;
         }
+        return guard.configured;
     }
 };
 
-thread_local bool amx_context::tiles_configured = false;
-
 __attribute__((target("amx-tile,amx-int8"))) auto
 classify_json_chars_amx(const char* data, size_t size, uint8_t* classifications) -> size_t {
     if (!amx_context::configure_tiles())
@@ -223,6 +260,93 @@ classify_json_chars_amx(const char* data, size_t size, uint8_t* classifications)
 }
         #endif  // HAVE_AMX_TILE
 
+        #ifdef HAVE_AVX512BW
+// AVX-512 classification tier: two nibble-indexed shuffles whose AND yields a
+// unique bit per character group, then mask-selects map the bits onto the
+// class codes (1 = whitespace, 2 = structural, 3 = quote). 64 bytes per
+// iteration; the bit assignments are chosen so no byte outside the JSON
+// character set produces a non-zero AND.
+__attribute__((target("avx512f,avx512bw"))) auto
+classify_json_chars_avx512(const char* data, size_t size, uint8_t* classifications) -> size_t {
+    // Low-nibble bits:  0x01 ' ', 0x08 '"', 0x04 \t \n \r, 0x02 {}[],
+    //                   0x10 ',', 0x20 ':'
+    alignas(64) static constexpr uint8_t lut_lo_table[16] = {
+        0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0x24, 0x02, 0x10, 0x06, 0x00, 0x00};
+    alignas(64) static constexpr uint8_t lut_hi_table[16] = {
+        0x04, 0x00, 0x19, 0x20, 0x00, 0x02, 0x00, 0x02,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+    const __m512i lut_lo = _mm512_broadcast_i32x4(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(lut_lo_table)));
+    const __m512i lut_hi = _mm512_broadcast_i32x4(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(lut_hi_table)));
+    const __m512i nibble_mask = _mm512_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        __m512i chunk = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(data + i));
+        __m512i lo = _mm512_and_si512(chunk, nibble_mask);
+        __m512i hi = _mm512_and_si512(_mm512_srli_epi16(chunk, 4), nibble_mask);
+        __m512i raw = _mm512_and_si512(_mm512_shuffle_epi8(lut_lo, lo),
+                                       _mm512_shuffle_epi8(lut_hi, hi));
+
+        __mmask64 ws_mask = _mm512_test_epi8_mask(raw, _mm512_set1_epi8(0x05));
+        __mmask64 structural_mask = _mm512_test_epi8_mask(raw, _mm512_set1_epi8(0x32));
+        __mmask64 quote_mask = _mm512_test_epi8_mask(raw, _mm512_set1_epi8(0x08));
+
+        __m512i classes = _mm512_maskz_mov_epi8(ws_mask, _mm512_set1_epi8(1));
+        classes = _mm512_mask_mov_epi8(classes, structural_mask, _mm512_set1_epi8(2));
+        classes = _mm512_mask_mov_epi8(classes, quote_mask, _mm512_set1_epi8(3));
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(classifications + i), classes);
+    }
+
+    for (; i < size; ++i) {
+        char c = data[i];
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+            classifications[i] = 1;
+        else if (c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',')
+            classifications[i] = 2;
+        else if (c == '"')
+            classifications[i] = 3;
+        else
+            classifications[i] = 0;
+    }
+    return size;
+}
+        #endif  // HAVE_AVX512BW
+
+// Stage-1 character classification dispatch. AMX ranks above AVX-512: the
+// tile path walks the input in 1KB tile-sized chunks versus 64B per AVX-512
+// iteration, and only engages once detect_simd_capabilities() has confirmed
+// the kernel granted tile state (so this never faults on a fleet where
+// XTILEDATA permission is denied).
+auto classify_json_chars(const char* data, size_t size, uint8_t* classifications) -> size_t {
+    static const uint32_t simd_caps = detect_simd_capabilities();
+        #ifdef HAVE_AMX_TILE
+    if ((simd_caps & SIMD_AMX_TILE) && (simd_caps & SIMD_AMX_INT8) && size >= 1024) {
+        return classify_json_chars_amx(data, size, classifications);
+    }
+        #endif
+        #ifdef HAVE_AVX512BW
+    if ((simd_caps & SIMD_AVX512F) && (simd_caps & SIMD_AVX512BW)) {
+        return classify_json_chars_avx512(data, size, classifications);
+    }
+        #endif
+    for (size_t i = 0; i < size; ++i) {
+        char c = data[i];
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+            classifications[i] = 1;
+        else if (c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',')
+            classifications[i] = 2;
+        else if (c == '"')
+            classifications[i] = 3;
+        else
+            classifications[i] = 0;
+    }
+    return size;
+}
+
         #ifdef HAVE_AVX512VNNI
 __attribute__((target("avx512f,avx512vnni"))) auto process_json_tokens_vnni(const char* data,
                                                                             size_t size)
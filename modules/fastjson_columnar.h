@@ -0,0 +1,138 @@
+// FastestJSONInTheWest - Columnar Field Extraction
+// Turns an array-of-objects document into a struct-of-arrays column: one walk
+// over the structural tape pulls a single numeric field out of every element
+// and writes it into a contiguous 64-byte-aligned buffer. Downstream
+// sum/min/max over the column is then memory-bandwidth-bound SIMD over dense
+// data instead of a pointer chase across scattered json_value nodes.
+// ============================================================================
+
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "fastjson_pointer.h"
+#include "fastjson_simd_api.h"
+
+namespace fastjson {
+namespace columnar {
+
+// ============================================================================
+// Column Result
+// ============================================================================
+// Owns the aligned storage for one extracted column. values() is the typed
+// view analytics code iterates or hands to SIMD kernels.
+
+template <typename T> struct column_result {
+    simd::AlignedBuffer<64> buffer;
+    size_t count;
+
+    [[nodiscard]] auto values() const noexcept -> std::span<const T> {
+        return {reinterpret_cast<const T*>(buffer.data()), count};
+    }
+
+    [[nodiscard]] auto values() noexcept -> std::span<T> {
+        return {reinterpret_cast<T*>(buffer.data()), count};
+    }
+};
+
+namespace detail {
+
+// Value a column slot takes when the element lacks the field or holds a
+// non-numeric value: NaN for floating columns, zero for integral ones.
+template <typename T> constexpr auto missing_value() -> T {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::numeric_limits<T>::quiet_NaN();
+    } else {
+        return T{};
+    }
+}
+
+template <typename T>
+inline auto parse_field_number(std::span<const char> source,
+                               const std::vector<structural_index>& tape, size_t value_idx)
+    -> T {
+    if (tape[value_idx].type != structural_type::number_start) {
+        return missing_value<T>();
+    }
+    auto raw = pointer::detail::value_span(source, tape, value_idx);
+    T out{};
+    auto [ptr, ec] = std::from_chars(raw.data(), raw.data() + raw.size(), out);
+    if (ec != std::errc{}) {
+        return missing_value<T>();
+    }
+    return out;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+// Extract `field` from every object of the top-level array in `json` into a
+// contiguous aligned column. Returns std::nullopt if the document's root is
+// not an array. Elements that are not objects, lack the field, or hold a
+// non-numeric value contribute NaN (floating T) or zero (integral T), so the
+// column length always equals the array length.
+template <typename T>
+[[nodiscard]] auto extract_column(std::string_view json, std::string_view field)
+    -> std::optional<column_result<T>> {
+    static_assert(std::is_arithmetic_v<T>, "extract_column requires a numeric column type");
+
+    auto source = std::span<const char>(json.data(), json.size());
+    auto tape = build_structural_index(source);
+    if (tape.empty() || tape[0].type != structural_type::left_bracket) {
+        return std::nullopt;
+    }
+
+    // Pass 1: count elements on the tape alone to size the buffer exactly.
+    size_t count = 0;
+    {
+        size_t i = 1;
+        if (i < tape.size() && tape[i].type != structural_type::right_bracket) {
+            while (i < tape.size() && tape[i].type != structural_type::right_bracket) {
+                ++count;
+                i = pointer::detail::skip_value(tape, i);
+                if (i < tape.size() && tape[i].type == structural_type::comma) {
+                    ++i;
+                }
+            }
+        }
+    }
+
+    // AlignedBuffer rejects zero-byte allocations; keep one slot for the
+    // empty-array case and report count = 0.
+    column_result<T> result{
+        simd::AlignedBuffer<64>(std::max<size_t>(count, 1) * sizeof(T)), count};
+    auto out = result.values();
+
+    // Pass 2: resolve the field inside each element and decode its number.
+    size_t i = 1;
+    for (size_t n = 0; n < count; ++n) {
+        T value = detail::missing_value<T>();
+        if (tape[i].type == structural_type::left_brace) {
+            auto field_idx = pointer::detail::find_field(source, tape, i, field);
+            if (field_idx) {
+                value = detail::parse_field_number<T>(source, tape, *field_idx);
+            }
+        }
+        out[n] = value;
+
+        i = pointer::detail::skip_value(tape, i);
+        if (i < tape.size() && tape[i].type == structural_type::comma) {
+            ++i;
+        }
+    }
+
+    return result;
+}
+
+}  // namespace columnar
+}  // namespace fastjson
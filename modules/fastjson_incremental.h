@@ -0,0 +1,423 @@
+// FastestJSONInTheWest - Incremental Re-Parse for Mostly-Unchanged Documents
+// Periodic re-parses of large, slowly-mutating documents (config watchers,
+// reference datasets refreshed in place) pay full stage-1 cost for bytes that
+// did not change. This module retains the previous input and its structural
+// index, diffs each new revision at the byte level with SIMD compares, and
+// re-scans only the top-level subtrees the change touches, splicing the fresh
+// entries into the retained index. The tape is then rebuilt from the spliced
+// index - string-offset words after an insertion or deletion all need
+// rebasing anyway, so word-level tape surgery would save nothing over
+// parse_with_index, which skips stage 1 entirely.
+//
+// The splice path is a fast path, never a correctness boundary: any change it
+// cannot attribute to complete top-level subtrees (edits touching the root
+// braces, edits that leave a string or container open at a subtree boundary,
+// non-container roots) falls back to a full rebuild, so update() always
+// leaves the same index a from-scratch build would produce.
+// ============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <immintrin.h>
+
+#include "fastjson_simd_index.h"
+#include "fastjson_tape.h"
+
+namespace fastjson {
+
+// ============================================================================
+// SIMD Byte Diff
+// ============================================================================
+// Longest common prefix/suffix of two buffers, 32 bytes per compare. The
+// suffix is clamped by the caller so prefix and suffix never overlap.
+
+#if defined(__AVX2__)
+__attribute__((target("avx2"))) inline auto
+common_prefix_avx2(const char* a, const char* b, size_t len) -> size_t {
+    size_t pos = 0;
+    while (pos + 32 <= len) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + pos));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + pos));
+        uint32_t eq = _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+        if (eq != 0xFFFFFFFFu) {
+            return pos + static_cast<size_t>(__builtin_ctz(~eq));
+        }
+        pos += 32;
+    }
+    while (pos < len && a[pos] == b[pos]) {
+        pos++;
+    }
+    return pos;
+}
+
+__attribute__((target("avx2"))) inline auto
+common_suffix_avx2(const char* a, size_t a_len, const char* b, size_t b_len, size_t max_len)
+    -> size_t {
+    size_t matched = 0;
+    while (matched + 32 <= max_len) {
+        __m256i va =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + a_len - matched - 32));
+        __m256i vb =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + b_len - matched - 32));
+        uint32_t eq = _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+        if (eq != 0xFFFFFFFFu) {
+            // Bit 31 is the last byte of the block; matching tail length is
+            // the run of set bits from the top
+            return matched + static_cast<size_t>(__builtin_clz(~eq));
+        }
+        matched += 32;
+    }
+    while (matched < max_len && a[a_len - 1 - matched] == b[b_len - 1 - matched]) {
+        matched++;
+    }
+    return matched;
+}
+#endif  // __AVX2__
+
+inline auto common_prefix_scalar(const char* a, const char* b, size_t len) -> size_t {
+    size_t pos = 0;
+    while (pos < len && a[pos] == b[pos]) {
+        pos++;
+    }
+    return pos;
+}
+
+inline auto common_suffix_scalar(const char* a, size_t a_len, const char* b, size_t b_len,
+                                 size_t max_len) -> size_t {
+    size_t matched = 0;
+    while (matched < max_len && a[a_len - 1 - matched] == b[b_len - 1 - matched]) {
+        matched++;
+    }
+    return matched;
+}
+
+inline auto common_prefix_length(std::string_view a, std::string_view b) -> size_t {
+    size_t len = std::min(a.size(), b.size());
+#if defined(__AVX2__)
+    return common_prefix_avx2(a.data(), b.data(), len);
+#else
+    return common_prefix_scalar(a.data(), b.data(), len);
+#endif
+}
+
+inline auto common_suffix_length(std::string_view a, std::string_view b, size_t max_len)
+    -> size_t {
+#if defined(__AVX2__)
+    return common_suffix_avx2(a.data(), a.size(), b.data(), b.size(), max_len);
+#else
+    return common_suffix_scalar(a.data(), a.size(), b.data(), b.size(), max_len);
+#endif
+}
+
+// ============================================================================
+// Incremental Index
+// ============================================================================
+
+struct incremental_stats {
+    size_t updates = 0;             // update() calls since construction
+    size_t unchanged = 0;           // Revisions byte-identical to the retained one
+    size_t incremental_splices = 0; // Revisions handled by subtree re-scan
+    size_t full_rebuilds = 0;       // Revisions that fell back to a full scan
+    size_t last_rescanned_bytes = 0;
+};
+
+class incremental_index {
+public:
+    incremental_index() = default;
+
+    // Full parse of the first revision; retains the input and its index.
+    explicit incremental_index(std::string input) { rebuild(std::move(input)); }
+
+    // Adopt a new revision of the document. Splices when the change is
+    // confined to complete top-level subtrees, rebuilds from scratch
+    // otherwise; either way the retained index matches a fresh
+    // build_structural_index of new_input afterwards.
+    auto update(std::string new_input) -> void {
+        stats_.updates++;
+        if (input_.empty() && indices_.empty()) {
+            rebuild(std::move(new_input));
+            return;
+        }
+        if (new_input.size() == input_.size() &&
+            common_prefix_length(input_, new_input) == input_.size()) {
+            stats_.unchanged++;
+            return;
+        }
+        if (!try_splice(new_input)) {
+            rebuild(std::move(new_input));
+            return;
+        }
+        input_ = std::move(new_input);
+        stats_.incremental_splices++;
+    }
+
+    auto input() const noexcept -> std::string_view { return input_; }
+
+    auto indices() const noexcept -> const std::vector<structural_index>& { return indices_; }
+
+    auto stats() const noexcept -> const incremental_stats& { return stats_; }
+
+    // Tape rebuilt from the retained index - stage 1 skipped entirely. The
+    // returned document references input(); it is invalidated by the next
+    // update().
+    auto tape() const -> std::optional<tape::tape_document> {
+        return tape::tape_document::parse_with_index(input_, indices_);
+    }
+
+private:
+    auto rebuild(std::string input) -> void {
+        input_ = std::move(input);
+        indices_ = build_structural_index(std::span<const char>(input_.data(), input_.size()));
+        depth1_seps_ = derive_depth1_seps(indices_);
+        stats_.full_rebuilds++;
+        stats_.last_rescanned_bytes = input_.size();
+    }
+
+    // Positions of the depth-1 subtree separators of a container root: the
+    // root open bracket/brace, every comma at depth 1, and the root close.
+    // Subtree k occupies [seps[k], seps[k+1]); every index entry belonging to
+    // it (including primitive starts) falls in that byte range. Empty when
+    // the root is not a container - update() then always rebuilds.
+    static auto derive_depth1_seps(const std::vector<structural_index>& indices)
+        -> std::vector<size_t> {
+        std::vector<size_t> seps;
+        int depth = 0;
+        for (const auto& entry : indices) {
+            switch (entry.type) {
+                case structural_type::left_brace:
+                case structural_type::left_bracket:
+                    if (depth == 0) {
+                        seps.push_back(entry.position);
+                    }
+                    depth++;
+                    break;
+                case structural_type::right_brace:
+                case structural_type::right_bracket:
+                    depth--;
+                    if (depth == 0) {
+                        seps.push_back(entry.position);
+                        return seps;
+                    }
+                    break;
+                case structural_type::comma:
+                    if (depth == 1) {
+                        seps.push_back(entry.position);
+                    }
+                    break;
+                default:
+                    if (depth == 0) {
+                        return {};  // Primitive or string root
+                    }
+                    break;
+            }
+        }
+        return {};  // Never saw the root close
+    }
+
+    // Attempt the splice path; returns false whenever the change cannot be
+    // pinned to complete top-level subtrees, leaving state untouched so the
+    // caller can rebuild.
+    auto try_splice(const std::string& new_input) -> bool {
+        if (depth1_seps_.size() < 2) {
+            return false;  // Non-container root, incremental mode disabled
+        }
+
+        const size_t old_len = input_.size();
+        const size_t new_len = new_input.size();
+
+        size_t prefix = common_prefix_length(input_, new_input);
+        size_t max_suffix = std::min(old_len, new_len) - prefix;
+        size_t suffix = common_suffix_length(input_, new_input, max_suffix);
+        const size_t old_change_end = old_len - suffix;  // Exclusive
+        const ptrdiff_t delta = static_cast<ptrdiff_t>(new_len) - static_cast<ptrdiff_t>(old_len);
+
+        const size_t root_open = depth1_seps_.front();
+        const size_t root_close = depth1_seps_.back();
+
+        // Change entirely after the root close: structure is untouched, only
+        // the trailing bytes need to stay whitespace (and must have been
+        // whitespace before - trailing junk would carry entries of its own)
+        if (prefix > root_close) {
+            if (!indices_.empty() && indices_.back().position > root_close) {
+                return false;
+            }
+            for (size_t p = prefix; p < new_len - suffix; ++p) {
+                if (!is_json_ws(new_input[p])) {
+                    return false;
+                }
+            }
+            stats_.last_rescanned_bytes = (new_len - suffix) - prefix;
+            return true;
+        }
+
+        // Change entirely in leading whitespace: every position shifts by
+        // delta but no entry changes
+        if (old_change_end <= root_open) {
+            for (size_t p = prefix; p < new_len - suffix; ++p) {
+                if (!is_json_ws(new_input[p])) {
+                    return false;
+                }
+            }
+            rebase(indices_, 0, delta);
+            for (auto& sep : depth1_seps_) {
+                sep = static_cast<size_t>(static_cast<ptrdiff_t>(sep) + delta);
+            }
+            stats_.last_rescanned_bytes = (new_len - suffix) - prefix;
+            return true;
+        }
+
+        // Window: from the last separator strictly before the change to the
+        // first separator at or past its end. Both separator bytes are
+        // unchanged, so the window covers complete subtrees.
+        auto lo = std::lower_bound(depth1_seps_.begin(), depth1_seps_.end(), prefix);
+        if (lo == depth1_seps_.begin()) {
+            return false;  // Change touches the root open bracket
+        }
+        size_t i = static_cast<size_t>(lo - depth1_seps_.begin()) - 1;
+        auto hi = std::lower_bound(depth1_seps_.begin(), depth1_seps_.end(), old_change_end);
+        if (hi == depth1_seps_.end()) {
+            return false;  // Change touches the root close or beyond
+        }
+        size_t j = static_cast<size_t>(hi - depth1_seps_.begin());
+
+        const size_t win_start = depth1_seps_[i];  // Same position in both revisions
+        const size_t win_end_old = depth1_seps_[j];
+        const size_t win_end_new =
+            static_cast<size_t>(static_cast<ptrdiff_t>(win_end_old) + delta);
+
+        // Re-scan the window against the new text. The window starts at a
+        // separator outside any string (the unchanged prefix guarantees the
+        // scanner state there), so the stateful chunk kernel applies directly.
+        std::vector<structural_index> region;
+        bool end_in_string = scan_structural_chunk(
+            std::span<const char>(new_input.data() + win_start, win_end_new - win_start),
+            win_start, false, region);
+        if (end_in_string || region.empty() || region.front().position != win_start) {
+            return false;  // Edit leaks a string across the window boundary
+        }
+
+        // Structural validation + fresh depth-1 separators for the window.
+        // The window must stay inside the root container (depth never drops
+        // below 1 after the root open) and end at depth 1, otherwise the edit
+        // changed structure beyond the window and only a full scan is safe.
+        std::vector<size_t> region_seps;
+        int depth = (i == 0) ? 0 : 1;
+        for (const auto& entry : region) {
+            switch (entry.type) {
+                case structural_type::left_brace:
+                case structural_type::left_bracket:
+                    if (depth == 0) {
+                        region_seps.push_back(entry.position);
+                    }
+                    depth++;
+                    break;
+                case structural_type::right_brace:
+                case structural_type::right_bracket:
+                    depth--;
+                    if (depth < 1) {
+                        return false;
+                    }
+                    break;
+                case structural_type::comma:
+                    if (depth == 1) {
+                        region_seps.push_back(entry.position);
+                    }
+                    break;
+                default:
+                    if (depth == 0) {
+                        return false;  // Content before the root open
+                    }
+                    break;
+            }
+        }
+        if (depth != 1) {
+            return false;
+        }
+        if (i > 0) {
+            // First region entry is the unchanged separator comma itself
+            if (region.front().type != structural_type::comma) {
+                return false;
+            }
+        }
+
+        // Primitive starts for the window. Triggers (colon, comma, open
+        // bracket) and their primitives both live inside complete subtrees,
+        // so the window is self-contained; the full input span is passed for
+        // the whitespace skip after a trigger.
+        insert_primitive_starts(std::span<const char>(new_input.data(), new_input.size()),
+                                region);
+
+        // Splice entries: [first_idx, last_idx) in the retained index covers
+        // exactly the window's byte range
+        auto pos_less = [](const structural_index& e, size_t pos) { return e.position < pos; };
+        size_t first_idx = static_cast<size_t>(
+            std::lower_bound(indices_.begin(), indices_.end(), win_start, pos_less) -
+            indices_.begin());
+        size_t last_idx = static_cast<size_t>(
+            std::lower_bound(indices_.begin(), indices_.end(), win_end_old, pos_less) -
+            indices_.begin());
+
+        if (delta == 0 && region.size() == last_idx - first_idx) {
+            // Same-size edit with the same entry count: overwrite in place,
+            // nothing after the window moves
+            std::copy(region.begin(), region.end(), indices_.begin() + first_idx);
+        } else {
+            std::vector<structural_index> updated;
+            updated.reserve(first_idx + region.size() + (indices_.size() - last_idx));
+            updated.insert(updated.end(), indices_.begin(),
+                           indices_.begin() + static_cast<ptrdiff_t>(first_idx));
+            updated.insert(updated.end(), region.begin(), region.end());
+            size_t tail_start = updated.size();
+            updated.insert(updated.end(), indices_.begin() + static_cast<ptrdiff_t>(last_idx),
+                           indices_.end());
+            rebase(updated, tail_start, delta);
+            indices_ = std::move(updated);
+        }
+
+        // Splice separators the same way: prefix kept, window recomputed,
+        // tail rebased
+        std::vector<size_t> seps;
+        seps.reserve(i + region_seps.size() + (depth1_seps_.size() - j));
+        seps.insert(seps.end(), depth1_seps_.begin(),
+                    depth1_seps_.begin() + static_cast<ptrdiff_t>(i));
+        seps.insert(seps.end(), region_seps.begin(), region_seps.end());
+        for (size_t k = j; k < depth1_seps_.size(); ++k) {
+            seps.push_back(static_cast<size_t>(static_cast<ptrdiff_t>(depth1_seps_[k]) + delta));
+        }
+        depth1_seps_ = std::move(seps);
+
+        stats_.last_rescanned_bytes = win_end_new - win_start;
+        return true;
+    }
+
+    static auto is_json_ws(char c) -> bool {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static auto rebase(std::vector<structural_index>& indices, size_t from, ptrdiff_t delta)
+        -> void {
+        if (delta == 0) {
+            return;
+        }
+        for (size_t k = from; k < indices.size(); ++k) {
+            indices[k].position =
+                static_cast<size_t>(static_cast<ptrdiff_t>(indices[k].position) + delta);
+        }
+    }
+
+    std::string input_;
+    std::vector<structural_index> indices_;
+    std::vector<size_t> depth1_seps_;
+    incremental_stats stats_;
+};
+
+}  // namespace fastjson
@@ -0,0 +1,318 @@
+// FastestJSONInTheWest - Memory-Mapped File Input
+// Zero-copy file access for the parser: the kernel page cache backs the
+// mapping directly, so multi-GB inputs are never staged through a heap buffer.
+// ============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#if defined(FASTJSON_HAS_LIBURING)
+    #include <liburing.h>
+#endif
+
+namespace fastjson {
+namespace io {
+
+// ============================================================================
+// Memory-Mapped File
+// ============================================================================
+// RAII wrapper around a read-only, private file mapping. Move-only: the
+// mapping is unmapped exactly once when the last owner goes out of scope.
+// Documents parsed from the mapping must not outlive it.
+
+class mapped_file {
+public:
+    mapped_file() = default;
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ~mapped_file() { unmap(); }
+
+    // Map the file read-only. Returns false on open/stat/mmap failure; the
+    // caller inspects errno for the specific reason. Mappings at or above
+    // huge_page_threshold bytes are advised MADV_HUGEPAGE so the kernel backs
+    // them with 2MB pages where it can (file-backed THP; a no-op on kernels
+    // without it), cutting dTLB misses on multi-GB inputs. 0 disables.
+    auto open(const std::string& path, size_t huge_page_threshold = 0) -> bool {
+#if defined(__linux__) || defined(__APPLE__)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+
+        size_ = static_cast<size_t>(st.st_size);
+
+        if (size_ == 0) {
+            // Empty file: valid mapping of nothing; parse reports empty_input
+            ::close(fd);
+            data_ = nullptr;
+            return true;
+        }
+
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // Mapping keeps the file alive; fd no longer needed
+
+        if (addr == MAP_FAILED) {
+            size_ = 0;
+            return false;
+        }
+
+        data_ = static_cast<const char*>(addr);
+
+        // Parsing is a single forward pass; tell the kernel to read ahead
+        ::madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+        if (huge_page_threshold != 0 && size_ >= huge_page_threshold) {
+            ::madvise(const_cast<char*>(data_), size_, MADV_HUGEPAGE);
+        }
+#endif
+        return true;
+#else
+        (void)path;
+        (void)huge_page_threshold;
+        return false;  // No mmap support on this platform
+#endif
+    }
+
+    auto is_open() const noexcept -> bool { return data_ != nullptr || size_ == 0; }
+
+    auto view() const noexcept -> std::string_view {
+        return std::string_view(data_, size_);
+    }
+
+    auto data() const noexcept -> const char* { return data_; }
+    auto size() const noexcept -> size_t { return size_; }
+
+private:
+    auto unmap() noexcept -> void {
+#if defined(__linux__) || defined(__APPLE__)
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// ============================================================================
+// Asynchronous Chunked File Reader
+// ============================================================================
+// Double-buffered read-ahead for cold-cache ingest: the read of chunk N+1 is
+// always in flight while the caller consumes chunk N, so disk latency hides
+// behind parse/copy time instead of serializing with it. The backend is
+// io_uring when built with FASTJSON_HAS_LIBURING (one SQE per chunk, no
+// thread); otherwise each read-ahead is a pread on a std::async worker.
+// Move-disabled: in-flight operations reference the buffers by address.
+
+class async_file_reader {
+public:
+    static constexpr size_t default_chunk_size = 4 * 1024 * 1024;
+
+    async_file_reader() = default;
+    async_file_reader(const async_file_reader&) = delete;
+    async_file_reader& operator=(const async_file_reader&) = delete;
+
+    ~async_file_reader() { close(); }
+
+    // Opens the file and submits the read for the first chunk. Returns false
+    // on open/stat (or ring setup) failure; caller inspects errno.
+    auto open(const std::string& path, size_t chunk_size = default_chunk_size) -> bool {
+#if defined(__linux__) || defined(__APPLE__)
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            return false;
+        }
+
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0) {
+            close();
+            return false;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        chunk_size_ = chunk_size == 0 ? default_chunk_size : chunk_size;
+        buffers_[0].resize(chunk_size_);
+        buffers_[1].resize(chunk_size_);
+
+    #if defined(FASTJSON_HAS_LIBURING)
+        if (io_uring_queue_init(2, &ring_, 0) == 0) {
+            ring_ready_ = true;
+        }
+        // Ring setup failure (e.g. io_uring disabled by seccomp) is not
+        // fatal: reads fall back to the pread worker below
+    #endif
+
+        submit_read(0);
+        return true;
+#else
+        (void)path;
+        (void)chunk_size;
+        return false;
+#endif
+    }
+
+    // Blocks until the current chunk's read completes, submits the read for
+    // the following chunk into the other buffer, and returns the completed
+    // chunk. An empty view means EOF (or a read error; check failed()).
+    auto next_chunk() -> std::string_view {
+#if defined(__linux__) || defined(__APPLE__)
+        if (fd_ < 0 || error_ || read_offset_ >= size_) {
+            return {};
+        }
+
+        ssize_t got = wait_read();
+        if (got < 0) {
+            error_ = true;
+            return {};
+        }
+
+        size_t chunk_index = current_;
+        size_t chunk_len = static_cast<size_t>(got);
+        read_offset_ += chunk_len;
+        current_ ^= 1;
+
+        if (read_offset_ < size_) {
+            submit_read(current_);
+        }
+
+        return std::string_view(buffers_[chunk_index].data(), chunk_len);
+#else
+        return {};
+#endif
+    }
+
+    auto file_size() const noexcept -> size_t { return size_; }
+    auto failed() const noexcept -> bool { return error_; }
+
+    auto close() -> void {
+#if defined(__linux__) || defined(__APPLE__)
+        if (pending_.valid()) {
+            pending_.wait();  // Never orphan a read into a freed buffer
+        }
+    #if defined(FASTJSON_HAS_LIBURING)
+        if (in_flight_) {
+            struct io_uring_cqe* cqe = nullptr;
+            io_uring_wait_cqe(&ring_, &cqe);
+            if (cqe != nullptr) {
+                io_uring_cqe_seen(&ring_, cqe);
+            }
+            in_flight_ = false;
+        }
+        if (ring_ready_) {
+            io_uring_queue_exit(&ring_);
+            ring_ready_ = false;
+        }
+    #endif
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+    }
+
+private:
+#if defined(__linux__) || defined(__APPLE__)
+    auto submit_read(size_t buffer_index) -> void {
+        size_t offset = submit_offset_;
+        size_t want = std::min(chunk_size_, size_ - offset);
+        submit_offset_ += want;
+
+    #if defined(FASTJSON_HAS_LIBURING)
+        if (ring_ready_) {
+            struct io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+            io_uring_prep_read(sqe, fd_, buffers_[buffer_index].data(),
+                               static_cast<unsigned>(want), offset);
+            io_uring_submit(&ring_);
+            in_flight_ = true;
+            return;
+        }
+    #endif
+        pending_ = std::async(std::launch::async, [this, buffer_index, offset, want]() -> ssize_t {
+            // pread may return short on signals or near EOF; fill the chunk
+            size_t done = 0;
+            while (done < want) {
+                ssize_t r = ::pread(fd_, buffers_[buffer_index].data() + done, want - done,
+                                    static_cast<off_t>(offset + done));
+                if (r < 0) {
+                    return -1;
+                }
+                if (r == 0) {
+                    break;
+                }
+                done += static_cast<size_t>(r);
+            }
+            return static_cast<ssize_t>(done);
+        });
+    }
+
+    auto wait_read() -> ssize_t {
+    #if defined(FASTJSON_HAS_LIBURING)
+        if (ring_ready_) {
+            struct io_uring_cqe* cqe = nullptr;
+            if (io_uring_wait_cqe(&ring_, &cqe) != 0) {
+                return -1;
+            }
+            ssize_t got = cqe->res;
+            io_uring_cqe_seen(&ring_, cqe);
+            in_flight_ = false;
+            return got;
+        }
+    #endif
+        return pending_.get();
+    }
+#endif
+
+    int fd_ = -1;
+    size_t size_ = 0;
+    size_t chunk_size_ = default_chunk_size;
+    size_t submit_offset_ = 0;  // Next byte to submit a read for
+    size_t read_offset_ = 0;    // Next byte the caller will receive
+    size_t current_ = 0;        // Buffer holding the in-flight/ready chunk
+    bool error_ = false;
+    std::vector<char> buffers_[2];
+    std::future<ssize_t> pending_;
+#if defined(FASTJSON_HAS_LIBURING)
+    struct io_uring ring_{};
+    bool ring_ready_ = false;
+    bool in_flight_ = false;
+#endif
+};
+
+}  // namespace io
+}  // namespace fastjson
@@ -0,0 +1,436 @@
+// FastestJSONInTheWest - On-Demand Two-Stage Parser
+// Phase 2 of parallel JSON parsing: lazy navigation over the structural tape
+// Stage 1 builds the structural index (fastjson_simd_index.h); values are
+// materialized only when navigation actually touches them.
+// ============================================================================
+
+#pragma once
+
+#include <cstdlib>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fastjson_simd_index.h"
+
+namespace fastjson {
+namespace ondemand {
+
+// ============================================================================
+// Value Kinds
+// ============================================================================
+
+enum class value_kind : uint8_t {
+    invalid = 0,
+    object,
+    array,
+    string,
+    number,
+    boolean,
+    null
+};
+
+class ondemand_document;
+
+// ============================================================================
+// Lazy Value Handle
+// ============================================================================
+// A value is a (document, tape-index) pair. Nothing is decoded until one of
+// the get_* accessors is called; navigation skips siblings by walking the
+// tape, never the raw text.
+
+class ondemand_value {
+public:
+    ondemand_value() : doc_(nullptr), tape_pos_(0) {}
+
+    ondemand_value(const ondemand_document* doc, size_t tape_pos)
+        : doc_(doc), tape_pos_(tape_pos) {}
+
+    auto valid() const noexcept -> bool { return doc_ != nullptr; }
+
+    auto kind() const noexcept -> value_kind;
+
+    auto is_object() const noexcept -> bool { return kind() == value_kind::object; }
+    auto is_array() const noexcept -> bool { return kind() == value_kind::array; }
+    auto is_string() const noexcept -> bool { return kind() == value_kind::string; }
+    auto is_number() const noexcept -> bool { return kind() == value_kind::number; }
+    auto is_bool() const noexcept -> bool { return kind() == value_kind::boolean; }
+    auto is_null() const noexcept -> bool { return kind() == value_kind::null; }
+
+    // Object navigation: linear scan over the keys at this nesting level.
+    // Siblings are skipped via the tape, so the cost is proportional to the
+    // number of keys, not the byte size of the sibling subtrees.
+    auto find_field(std::string_view key) const -> std::optional<ondemand_value>;
+
+    // Array navigation
+    auto at(size_t index) const -> std::optional<ondemand_value>;
+    auto count_elements() const -> size_t;
+
+    // Scalar materialization (lazy - only touches the raw bytes of this value)
+    auto get_string() const -> std::optional<std::string>;
+    auto get_raw_string() const -> std::optional<std::string_view>;  // No unescape
+    auto get_double() const -> std::optional<double>;
+    auto get_bool() const -> std::optional<bool>;
+
+    // Raw text span of this value (useful for re-parsing a subtree with the
+    // full DOM parser when lazy access is not enough)
+    auto raw_json() const -> std::string_view;
+
+private:
+    auto skip_value(size_t tape_pos) const -> size_t;
+    auto value_end_position(size_t tape_pos) const -> size_t;
+
+    const ondemand_document* doc_;
+    size_t tape_pos_;  // Index into the structural tape
+};
+
+// ============================================================================
+// On-Demand Document
+// ============================================================================
+// Owns the structural tape; the input text is referenced, not copied, so the
+// caller must keep the input alive for the lifetime of the document (same
+// contract as the zero-copy string_view parse path).
+
+class ondemand_document {
+public:
+    explicit ondemand_document(std::string_view input)
+        : input_(input),
+          tape_(build_structural_index(std::span<const char>(input.data(), input.size()))) {}
+
+    // Adopt an externally supplied tape and skip stage 1 (e.g. one loaded from
+    // a sidecar cache or produced by the GPU scan). The tape must have been
+    // built from exactly this input; mirrors tape_document::parse_with_index.
+    ondemand_document(std::string_view input, std::vector<structural_index> tape)
+        : input_(input), tape_(std::move(tape)) {}
+
+    auto root() const -> ondemand_value {
+        // Locate the first non-whitespace byte; for container/string roots it
+        // coincides with tape_[0], for primitive roots there is no tape entry
+        // and we synthesize one lazily through root_primitive_pos_.
+        return ondemand_value(this, 0);
+    }
+
+    auto input() const noexcept -> std::string_view { return input_; }
+    auto tape() const noexcept -> const std::vector<structural_index>& { return tape_; }
+
+private:
+    std::string_view input_;
+    std::vector<structural_index> tape_;
+};
+
+// ============================================================================
+// ondemand_value Implementation
+// ============================================================================
+
+inline auto ondemand_value::kind() const noexcept -> value_kind {
+    if (!doc_ || tape_pos_ >= doc_->tape().size()) {
+        // Primitive root documents produce an empty tape; classify from text.
+        if (doc_ && tape_pos_ == 0) {
+            std::string_view in = doc_->input();
+            size_t p = 0;
+            while (p < in.size() && (in[p] == ' ' || in[p] == '\t' || in[p] == '\n' || in[p] == '\r')) {
+                ++p;
+            }
+            if (p >= in.size()) return value_kind::invalid;
+            char c = in[p];
+            if (c == 't' || c == 'f') return value_kind::boolean;
+            if (c == 'n') return value_kind::null;
+            if (c == '-' || (c >= '0' && c <= '9')) return value_kind::number;
+        }
+        return value_kind::invalid;
+    }
+
+    switch (doc_->tape()[tape_pos_].type) {
+        case structural_type::left_brace:
+            return value_kind::object;
+        case structural_type::left_bracket:
+            return value_kind::array;
+        case structural_type::quote:
+            return value_kind::string;
+        case structural_type::true_start:
+        case structural_type::false_start:
+            return value_kind::boolean;
+        case structural_type::null_start:
+            return value_kind::null;
+        case structural_type::number_start:
+            return value_kind::number;
+        default:
+            return value_kind::invalid;
+    }
+}
+
+// Return the tape index one past the value starting at tape_pos
+inline auto ondemand_value::skip_value(size_t tape_pos) const -> size_t {
+    const auto& tape = doc_->tape();
+    if (tape_pos >= tape.size()) {
+        return tape.size();
+    }
+
+    switch (tape[tape_pos].type) {
+        case structural_type::left_brace:
+        case structural_type::left_bracket: {
+            int depth = 0;
+            size_t i = tape_pos;
+            for (; i < tape.size(); ++i) {
+                auto t = tape[i].type;
+                if (t == structural_type::left_brace || t == structural_type::left_bracket) {
+                    ++depth;
+                } else if (t == structural_type::right_brace
+                           || t == structural_type::right_bracket) {
+                    --depth;
+                    if (depth == 0) {
+                        return i + 1;
+                    }
+                }
+            }
+            return tape.size();
+        }
+        case structural_type::quote:
+            // Strings index as an open-quote / close-quote entry pair
+            return tape_pos + 2;
+        default:
+            // Primitive entries occupy a single tape slot
+            return tape_pos + 1;
+    }
+}
+
+// Byte offset one past the end of the value starting at tape_pos
+inline auto ondemand_value::value_end_position(size_t tape_pos) const -> size_t {
+    const auto& tape = doc_->tape();
+    size_t next = skip_value(tape_pos);
+
+    if (tape[tape_pos].type == structural_type::quote
+        || tape[tape_pos].type == structural_type::left_brace
+        || tape[tape_pos].type == structural_type::left_bracket) {
+        // Closing structural char is the last tape entry of the value
+        return tape[next - 1].position + 1;
+    }
+
+    // Primitive: extends to the next structural character (or end of input)
+    if (next < tape.size()) {
+        return tape[next].position;
+    }
+    return doc_->input().size();
+}
+
+inline auto ondemand_value::raw_json() const -> std::string_view {
+    const auto& tape = doc_->tape();
+    if (tape_pos_ >= tape.size()) {
+        return doc_->input();
+    }
+    size_t start = tape[tape_pos_].position;
+    size_t end = value_end_position(tape_pos_);
+    // Trim trailing whitespace from the primitive span
+    std::string_view raw = doc_->input().substr(start, end - start);
+    while (!raw.empty()
+           && (raw.back() == ' ' || raw.back() == '\t' || raw.back() == '\n'
+               || raw.back() == '\r')) {
+        raw.remove_suffix(1);
+    }
+    return raw;
+}
+
+inline auto ondemand_value::find_field(std::string_view key) const -> std::optional<ondemand_value> {
+    const auto& tape = doc_->tape();
+    if (tape_pos_ >= tape.size() || tape[tape_pos_].type != structural_type::left_brace) {
+        return std::nullopt;
+    }
+
+    std::string_view in = doc_->input();
+    size_t i = tape_pos_ + 1;
+
+    while (i < tape.size() && tape[i].type != structural_type::right_brace) {
+        // Expect: quote quote colon value
+        if (tape[i].type != structural_type::quote || i + 2 >= tape.size()) {
+            return std::nullopt;  // Malformed object
+        }
+        size_t key_start = tape[i].position + 1;
+        size_t key_end = tape[i + 1].position;
+        std::string_view candidate = in.substr(key_start, key_end - key_start);
+
+        size_t colon = i + 2;
+        if (tape[colon].type != structural_type::colon || colon + 1 >= tape.size()) {
+            return std::nullopt;
+        }
+
+        size_t value_pos = colon + 1;
+        if (candidate == key) {
+            return ondemand_value(doc_, value_pos);
+        }
+
+        // Skip the value and the separating comma, if any
+        i = skip_value(value_pos);
+        if (i < tape.size() && tape[i].type == structural_type::comma) {
+            ++i;
+        }
+    }
+
+    return std::nullopt;
+}
+
+inline auto ondemand_value::at(size_t index) const -> std::optional<ondemand_value> {
+    const auto& tape = doc_->tape();
+    if (tape_pos_ >= tape.size() || tape[tape_pos_].type != structural_type::left_bracket) {
+        return std::nullopt;
+    }
+
+    size_t i = tape_pos_ + 1;
+    size_t current = 0;
+
+    while (i < tape.size() && tape[i].type != structural_type::right_bracket) {
+        if (current == index) {
+            return ondemand_value(doc_, i);
+        }
+        i = skip_value(i);
+        if (i < tape.size() && tape[i].type == structural_type::comma) {
+            ++i;
+        }
+        ++current;
+    }
+
+    return std::nullopt;
+}
+
+inline auto ondemand_value::count_elements() const -> size_t {
+    const auto& tape = doc_->tape();
+    if (tape_pos_ >= tape.size() || tape[tape_pos_].type != structural_type::left_bracket) {
+        return 0;
+    }
+
+    size_t i = tape_pos_ + 1;
+    size_t count = 0;
+
+    while (i < tape.size() && tape[i].type != structural_type::right_bracket) {
+        ++count;
+        i = skip_value(i);
+        if (i < tape.size() && tape[i].type == structural_type::comma) {
+            ++i;
+        }
+    }
+
+    return count;
+}
+
+inline auto ondemand_value::get_raw_string() const -> std::optional<std::string_view> {
+    const auto& tape = doc_->tape();
+    if (tape_pos_ + 1 >= tape.size() || tape[tape_pos_].type != structural_type::quote) {
+        return std::nullopt;
+    }
+    size_t start = tape[tape_pos_].position + 1;
+    size_t end = tape[tape_pos_ + 1].position;
+    return doc_->input().substr(start, end - start);
+}
+
+inline auto ondemand_value::get_string() const -> std::optional<std::string> {
+    auto raw = get_raw_string();
+    if (!raw) {
+        return std::nullopt;
+    }
+
+    // Fast path: no escapes, return a direct copy
+    if (raw->find('\\') == std::string_view::npos) {
+        return std::string(*raw);
+    }
+
+    // Scalar unescape for escaped strings (rare on the lazy access path)
+    std::string out;
+    out.reserve(raw->size());
+    for (size_t i = 0; i < raw->size(); ++i) {
+        char c = (*raw)[i];
+        if (c != '\\' || i + 1 >= raw->size()) {
+            out += c;
+            continue;
+        }
+        char escaped = (*raw)[++i];
+        switch (escaped) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                // Minimal \uXXXX handling: decode BMP code points; surrogate
+                // pairs fall back to the full parser (parse raw_json()).
+                if (i + 4 >= raw->size()) return std::nullopt;
+                unsigned cp = 0;
+                for (int d = 0; d < 4; ++d) {
+                    char h = (*raw)[i + 1 + d];
+                    cp <<= 4;
+                    if (h >= '0' && h <= '9') cp |= static_cast<unsigned>(h - '0');
+                    else if (h >= 'a' && h <= 'f') cp |= static_cast<unsigned>(h - 'a' + 10);
+                    else if (h >= 'A' && h <= 'F') cp |= static_cast<unsigned>(h - 'A' + 10);
+                    else return std::nullopt;
+                }
+                i += 4;
+                if (cp < 0x80) {
+                    out += static_cast<char>(cp);
+                } else if (cp < 0x800) {
+                    out += static_cast<char>(0xC0 | (cp >> 6));
+                    out += static_cast<char>(0x80 | (cp & 0x3F));
+                } else {
+                    out += static_cast<char>(0xE0 | (cp >> 12));
+                    out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (cp & 0x3F));
+                }
+                break;
+            }
+            default:
+                return std::nullopt;
+        }
+    }
+    return out;
+}
+
+inline auto ondemand_value::get_double() const -> std::optional<double> {
+    if (kind() != value_kind::number) {
+        return std::nullopt;
+    }
+
+    std::string_view raw = raw_json();
+    if (raw.empty()) {
+        return std::nullopt;
+    }
+
+    // strtod needs NUL termination; numbers are short so a stack copy is fine
+    char buffer[64];
+    size_t len = raw.size() < sizeof(buffer) - 1 ? raw.size() : sizeof(buffer) - 1;
+    for (size_t i = 0; i < len; ++i) {
+        buffer[i] = raw[i];
+    }
+    buffer[len] = '\0';
+
+    char* end_ptr = nullptr;
+    double value = std::strtod(buffer, &end_ptr);
+    if (end_ptr == buffer) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+inline auto ondemand_value::get_bool() const -> std::optional<bool> {
+    if (kind() != value_kind::boolean) {
+        return std::nullopt;
+    }
+    std::string_view raw = raw_json();
+    if (raw.starts_with("true")) return true;
+    if (raw.starts_with("false")) return false;
+    return std::nullopt;
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+
+// Build only the structural tape (stage 1); values materialize on navigation.
+// The input must outlive the returned document.
+inline auto parse(std::string_view input) -> ondemand_document {
+    return ondemand_document(input);
+}
+
+}  // namespace ondemand
+}  // namespace fastjson
@@ -8,26 +8,48 @@ module;
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 #include <cctype>
+#include <charconv>
 #include <cmath>
+#include <chrono>
+#include <coroutine>
+#include <cstdio>
 #include <cstring>
 #include <expected>
+#include <future>
 #include <iostream>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
 #include "unicode.h"
 #include "fastjson_simd_index.h"
+#include "fastjson_ondemand.h"
+#include "fastjson_io.h"
+#include "fastjson_tape.h"
+#include "fastjson_pointer.h"
 #include "numa_allocator.h"
+#include "fastjson_eisel_lemire.h"
 
 #ifdef _OPENMP
     #include <omp.h>
 #endif
 
+#ifdef FASTJSON_USE_PARALLEL_STL
+    #include <execution>
+    #include <numeric>
+#endif
+
 // SIMD intrinsics
 #if defined(__x86_64__) || defined(_M_X64)
     #include <cpuid.h>
@@ -43,6 +65,18 @@ module;
     #include <sys/auxv.h>
 #endif
 
+#if __has_include(<nlohmann/json.hpp>)
+    #include <nlohmann/json.hpp>
+    #define FASTJSON_HAVE_NLOHMANN 1
+#endif
+
+#if defined(FASTJSON_PERF_COUNTERS) && defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 export module fastjson_parallel;
 
 export namespace fastjson_parallel {
@@ -59,10 +93,17 @@ export struct parse_config {
 
     size_t parallel_threshold = 1000;  // Minimum array/object size for parallel parsing
 
+    bool use_work_stealing = true;  // Prefer the TBB work-stealing pool (Parallel STL)
+                                    // over OpenMP chunking when built with
+                                    // FASTJSON_USE_PARALLEL_STL; load-balances the
+                                    // skewed-element case where one chunk holds a
+                                    // deeply nested subtree
+
     // SIMD control
     bool enable_simd = true;    // Enable SIMD optimizations
     bool enable_avx512 = true;  // Enable AVX-512 if available
     bool enable_neon = true;    // Enable ARM NEON if available
+    bool enable_sve = true;     // Enable ARM SVE/SVE2 if available
 
     // NUMA control
     bool enable_numa = true;            // Enable NUMA-aware allocations
@@ -82,6 +123,61 @@ export struct parse_config {
     // Performance tuning
     size_t chunk_size = 100;      // Elements per thread chunk in parallel parsing
     bool use_memory_pool = true;  // Use memory pooling for allocations
+
+    // Inputs/arenas at or above this size get huge-page (2MB) backing to cut
+    // dTLB misses on multi-GB documents; 0 disables huge pages entirely
+    size_t huge_page_threshold = 4 * 1024 * 1024;
+
+    // Object representation
+    bool use_flat_objects = false;  // Sorted-vector objects instead of unordered_map
+                                    // (cache-friendly for small read-mostly objects)
+
+    // Number representation: store raw tokens in the DOM and materialize at
+    // first access (memoized). Wins when most numbers are never read.
+    bool lazy_numbers = false;
+
+    // Capacity pre-sizing: count separators at the container's depth before
+    // parsing its elements so unordered_map/vector can reserve() exactly and
+    // skip the incremental rehash/reallocate cycles
+    bool presize_containers = true;
+
+    // Key interning: canonicalize repeated object keys ("id", "timestamp", ...)
+    // through a per-thread pool so record arrays stop re-unescaping and
+    // re-validating the same key text millions of times
+    bool intern_keys = true;
+    size_t intern_pool_max_keys = 4096;  // Pool reset threshold (pathological inputs)
+
+    // Document cache: parse_cached() keeps up to this many recently parsed
+    // documents keyed by content hash, so byte-identical repeats (retries,
+    // polling clients) skip the parse entirely; 0 bypasses the cache
+    size_t document_cache_entries = 256;
+
+    // Duplicate-key rejection: fail the parse with duplicate_key when an
+    // object repeats a key (JSON smuggling defense). Detection rides the
+    // existing map insert result / flat-object finalize sort, so it replaces
+    // the post-parse set-building tree walk at no extra cost.
+    bool reject_duplicate_keys = false;
+
+    // Iterative engine: drive container nesting from an explicit heap-backed
+    // state stack instead of parse_object/parse_array recursion, so max_depth
+    // bounds memory rather than guarding the call stack and deeply nested
+    // payloads can raise it safely. Sequential only - the parallel container
+    // splitters are not used on this path.
+    bool use_iterative_parser = false;
+
+    // Software prefetch: stage-1 scan kernels and the tape builder fetch this
+    // many bytes ahead of the block being processed so 500MB+ documents that
+    // parse entirely out of DRAM hide the access latency; 0 disables all
+    // software prefetch. prefetch_spans_ahead is the element lookahead the
+    // parallel DOM builders use when prefetching upcoming source spans.
+    size_t prefetch_distance = 512;
+    size_t prefetch_spans_ahead = 3;
+
+    // Thread auto-tuning: learn the best worker count per (size-bucket,
+    // shape-class) from recent parse timings instead of the fixed 30%-of-
+    // hardware rule. The learned table is process-global; persist it across
+    // runs with thread_tuner_snapshot()/thread_tuner_restore().
+    bool auto_tune_threads = false;
 };
 
 // Global configuration (thread-local for safety)
@@ -91,9 +187,15 @@ thread_local parse_config g_config;
 static numa::numa_topology g_numa_topo;
 static std::atomic<bool> g_numa_initialized{false};
 
+// Re-resolves the SIMD kernel dispatch table after a config change
+// (defined after the kernels below)
+static auto refresh_kernel_table() -> void;
+
 // Configuration API
 export auto set_parse_config(const parse_config& config) -> void {
     g_config = config;
+    fastjson::g_prefetch_distance = config.prefetch_distance;
+    refresh_kernel_table();
 }
 
 export auto get_parse_config() -> const parse_config& {
@@ -136,6 +238,209 @@ inline auto get_effective_num_threads(size_t data_size) -> int {
     return std::max(1, effective);
 }
 
+// ============================================================================
+// Adaptive Thread-Count Auto-Tuner
+// ============================================================================
+// The 30%-of-hardware rule above is a single compromise across very different
+// workloads: flat numeric arrays are memory-bound and oversubscribe quickly,
+// wide object trees are compute-bound and can use far more workers. With
+// parse_config::auto_tune_threads the parallel array parser instead consults
+// a small learned table keyed by (log2 size bucket, element-width shape
+// class). Each cell hill-climbs online: most parses reuse the cell's current
+// best count, every probe_interval-th parse tries one step up or down, and a
+// probe that beats the running throughput estimate by adopt_margin becomes
+// the new best. The table is process-global (workload knowledge is worth
+// sharing across threads) and can be persisted across runs via the
+// snapshot/restore exports below.
+
+namespace tuner {
+
+inline constexpr int size_buckets = 8;    // log2(elements / 1024), clamped
+inline constexpr int shape_classes = 3;   // Narrow / record / wide elements
+inline constexpr int probe_interval = 8;  // Every Nth parse explores a neighbor
+inline constexpr double adopt_margin = 1.05;
+
+struct cell {
+    int threads = 0;         // 0 = unseeded (seed from the static heuristic)
+    double ewma_mbps = 0.0;  // Running throughput estimate at `threads`
+    int probe_dir = 1;       // Direction of the next exploration step
+    uint32_t trials = 0;
+};
+
+struct table {
+    std::mutex mutex;
+    cell cells[size_buckets][shape_classes];
+};
+
+inline table g_table;
+
+inline auto size_bucket(size_t element_count) -> int {
+    int bucket = 0;
+    for (size_t n = element_count / 1024; n > 1 && bucket < size_buckets - 1; n >>= 1) {
+        bucket++;
+    }
+    return bucket;
+}
+
+inline auto shape_class(size_t input_bytes, size_t element_count) -> int {
+    size_t avg = input_bytes / std::max<size_t>(1, element_count);
+    if (avg < 64) {
+        return 0;  // Flat scalars: memory-bound, fewer threads win
+    }
+    if (avg < 1024) {
+        return 1;  // Typical record arrays
+    }
+    return 2;  // Wide subtrees per element: compute-bound
+}
+
+// The tuner may exceed the 30% rule - that cap is exactly what it replaces -
+// but an explicit user thread count still wins
+inline auto thread_limit() -> int {
+    if (g_config.num_threads > 0) {
+        return g_config.num_threads;
+    }
+#ifdef _OPENMP
+    return std::max(1, omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+struct decision {
+    int threads = 1;
+    int bucket = 0;
+    int shape = 0;
+    bool probing = false;
+};
+
+inline auto now_ns() -> uint64_t {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+inline auto pick(size_t input_bytes, size_t element_count) -> decision {
+    decision d;
+    d.bucket = size_bucket(element_count);
+    d.shape = shape_class(input_bytes, element_count);
+    int limit = thread_limit();
+
+    std::lock_guard lock(g_table.mutex);
+    cell& c = g_table.cells[d.bucket][d.shape];
+    if (c.threads == 0) {
+        c.threads = std::clamp(static_cast<int>(element_count / g_config.chunk_size), 1, limit);
+    }
+    c.threads = std::clamp(c.threads, 1, limit);
+    c.trials++;
+    d.threads = c.threads;
+
+    if (limit > 1 && c.trials % probe_interval == 0) {
+        int probe = std::clamp(c.threads + c.probe_dir, 1, limit);
+        if (probe == c.threads) {
+            // Pinned against a bound; the only way to explore is the other way
+            c.probe_dir = -c.probe_dir;
+            probe = std::clamp(c.threads + c.probe_dir, 1, limit);
+        }
+        if (probe != c.threads) {
+            d.threads = probe;
+            d.probing = true;
+        }
+    }
+    return d;
+}
+
+inline auto record(const decision& d, size_t input_bytes, uint64_t elapsed_ns) -> void {
+    if (elapsed_ns == 0) {
+        return;
+    }
+    double mbps = (static_cast<double>(input_bytes) / (1024.0 * 1024.0))
+                  / (static_cast<double>(elapsed_ns) / 1e9);
+
+    std::lock_guard lock(g_table.mutex);
+    cell& c = g_table.cells[d.bucket][d.shape];
+    if (d.probing) {
+        if (mbps > c.ewma_mbps * adopt_margin) {
+            c.threads = d.threads;
+            c.ewma_mbps = mbps;
+        } else {
+            c.probe_dir = -c.probe_dir;  // That way was worse; try the other next
+        }
+    } else if (d.threads == c.threads) {
+        c.ewma_mbps = c.ewma_mbps == 0.0 ? mbps : c.ewma_mbps * 0.8 + mbps * 0.2;
+    }
+}
+
+}  // namespace tuner
+
+// Serializes the learned table as JSON so callers can persist it across runs
+// (only seeded cells are emitted)
+export auto thread_tuner_snapshot() -> std::string {
+    std::string out = "{\"cells\":[";
+    bool first = true;
+    std::lock_guard lock(tuner::g_table.mutex);
+    for (int b = 0; b < tuner::size_buckets; ++b) {
+        for (int s = 0; s < tuner::shape_classes; ++s) {
+            const tuner::cell& c = tuner::g_table.cells[b][s];
+            if (c.threads == 0) {
+                continue;
+            }
+            char buffer[128];
+            std::snprintf(buffer, sizeof(buffer),
+                          "%s{\"bucket\":%d,\"shape\":%d,\"threads\":%d,\"mbps\":%.3f}",
+                          first ? "" : ",", b, s, c.threads, c.ewma_mbps);
+            out += buffer;
+            first = false;
+        }
+    }
+    out += "]}";
+    return out;
+}
+
+// Restores a table written by thread_tuner_snapshot(). Lenient field scan
+// rather than a full parse - this runs before the parser exists in this TU.
+// Returns false when no cell could be restored.
+export auto thread_tuner_restore(std::string_view snapshot) -> bool {
+    size_t restored = 0;
+    size_t pos = 0;
+    std::lock_guard lock(tuner::g_table.mutex);
+    while ((pos = snapshot.find("\"bucket\":", pos)) != std::string_view::npos) {
+        auto field = [&](const char* name) -> double {
+            size_t at = snapshot.find(name, pos);
+            if (at == std::string_view::npos) {
+                return -1.0;
+            }
+            at += std::char_traits<char>::length(name);
+            return std::atof(std::string(snapshot.substr(at, 32)).c_str());
+        };
+        int bucket = static_cast<int>(field("\"bucket\":"));
+        int shape = static_cast<int>(field("\"shape\":"));
+        int threads = static_cast<int>(field("\"threads\":"));
+        double mbps = field("\"mbps\":");
+        pos += 1;
+        if (bucket < 0 || bucket >= tuner::size_buckets || shape < 0
+            || shape >= tuner::shape_classes || threads < 1) {
+            continue;
+        }
+        tuner::cell& c = tuner::g_table.cells[bucket][shape];
+        c.threads = threads;
+        c.ewma_mbps = mbps > 0.0 ? mbps : 0.0;
+        c.probe_dir = 1;
+        c.trials = 0;
+        restored++;
+    }
+    return restored > 0;
+}
+
+// Forgets everything learned (cells reseed from the static heuristic)
+export auto thread_tuner_reset() -> void {
+    std::lock_guard lock(tuner::g_table.mutex);
+    for (auto& row : tuner::g_table.cells) {
+        for (auto& c : row) {
+            c = tuner::cell{};
+        }
+    }
+}
+
 // ============================================================================
 // JSON Type System
 // ============================================================================
@@ -150,16 +455,52 @@ export enum class json_error_code {
     invalid_number,
     invalid_string,
     invalid_escape,
-    invalid_unicode
+    invalid_unicode,
+    duplicate_key,
+    io_error
 };
 
+export constexpr auto error_code_name(json_error_code code) -> const char* {
+    switch (code) {
+        case json_error_code::empty_input: return "empty_input";
+        case json_error_code::extra_tokens: return "extra_tokens";
+        case json_error_code::max_depth_exceeded: return "max_depth_exceeded";
+        case json_error_code::unexpected_end: return "unexpected_end";
+        case json_error_code::invalid_syntax: return "invalid_syntax";
+        case json_error_code::invalid_literal: return "invalid_literal";
+        case json_error_code::invalid_number: return "invalid_number";
+        case json_error_code::invalid_string: return "invalid_string";
+        case json_error_code::invalid_escape: return "invalid_escape";
+        case json_error_code::invalid_unicode: return "invalid_unicode";
+        case json_error_code::duplicate_key: return "duplicate_key";
+        case json_error_code::io_error: return "io_error";
+    }
+    return "unknown";
+}
+
+// Trivially copyable error record: reject paths that only inspect `code`
+// never touch the heap. `message` points at a static string; the formatted
+// rendering is deferred to to_string(), the one place an error allocates.
 export struct json_error {
     json_error_code code;
-    std::string message;
+    const char* message;
     size_t line;
     size_t column;
+
+    [[nodiscard]] auto to_string() const -> std::string {
+        std::string out = error_code_name(code);
+        out += ": ";
+        out += message;
+        out += " at line ";
+        out += std::to_string(line);
+        out += ", column ";
+        out += std::to_string(column);
+        return out;
+    }
 };
 
+static_assert(std::is_trivially_copyable_v<json_error>);
+
 template <typename T> using json_result = std::expected<T, json_error>;
 
 using json_string = std::string;
@@ -175,7 +516,130 @@ using json_null = std::nullptr_t;
 
 export class json_value;
 using json_array = std::vector<json_value>;
-using json_object = std::unordered_map<std::string, json_value>;
+
+// Transparent hashing so object lookups by string_view (find/get/contains)
+// hash the caller's bytes directly instead of constructing a temporary
+// std::string key - field access is the hottest operation on parsed trees,
+// and keys past the SSO limit were paying an allocation per lookup
+export struct json_key_hash {
+    using is_transparent = void;
+    auto operator()(std::string_view s) const noexcept -> size_t {
+        return std::hash<std::string_view>{}(s);
+    }
+};
+
+using json_object = std::unordered_map<std::string, json_value, json_key_hash, std::equal_to<>>;
+
+// ============================================================================
+// Flat Object Representation
+// ============================================================================
+// Cache-friendly alternative to the unordered_map object: entries live in one
+// contiguous sorted vector, lookup is a binary search over adjacent memory
+// instead of a pointer-chase through hash buckets. Selected at parse time via
+// parse_config::use_flat_objects; best for the common 5-30 key, read-mostly
+// object shape. Method bodies are defined after json_value is complete.
+
+export class flat_json_object {
+public:
+    using value_type = std::pair<std::string, json_value>;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    flat_json_object() = default;
+
+    auto reserve(size_t n) -> void;
+
+    // Build phase: append unsorted, then finalize() once to sort by key.
+    // Lookups before finalize() fall back to linear scan.
+    auto emplace(std::string key, json_value value) -> void;
+    auto finalize() -> void;
+
+    // After finalize(): true when two entries share a key. Duplicates are
+    // adjacent once sorted, so this is one linear pass over the entries.
+    auto has_duplicate_key() const -> bool;
+
+    auto find(std::string_view key) const -> const json_value*;
+    auto contains(std::string_view key) const -> bool { return find(key) != nullptr; }
+    auto at(std::string_view key) const -> const json_value&;
+
+    auto size() const noexcept -> size_t;
+    auto empty() const noexcept -> bool;
+    auto begin() const noexcept -> const_iterator;
+    auto end() const noexcept -> const_iterator;
+
+private:
+    // Above this size the binary search wins over the linear SIMD prefix
+    // scan; below it the scan is branch-predictable and touches contiguous
+    // memory instead of log2(n) scattered nodes
+    static constexpr size_t simd_scan_max_entries = 64;
+
+    std::vector<value_type> entries_;
+    // Packed 16-byte zero-padded key prefixes (one slot per entry, built by
+    // finalize) so the lookup kernel compares several candidates per vector
+    // load instead of chasing one std::string at a time
+    std::vector<char> key_prefixes_;
+    bool sorted_ = false;
+};
+
+// ============================================================================
+// Lazy Raw Number
+// ============================================================================
+// Stores the validated number token instead of eagerly deciding precision at
+// parse time (opt-in via parse_config::lazy_numbers). SSO keeps typical
+// tokens off the heap; first access materializes through the same tiers as
+// eager parsing and memoizes the result, so documents where most numbers are
+// never read skip nearly all number-parsing cost.
+
+export class json_raw_number {
+public:
+    explicit json_raw_number(std::string token) : token_(std::move(token)) {}
+
+    auto token() const -> std::string_view { return token_; }
+
+    // True when the token has no fraction or exponent
+    auto is_integral() const -> bool {
+        return token_.find_first_of(".eE") == std::string::npos;
+    }
+
+    auto as_double() const -> double {
+        if (!(state_ & materialized_double)) {
+            if (auto fast = fastjson::numbers::parse_double(token_)) {
+                double_value_ = *fast;
+            } else {
+                double_value_ = std::strtod(token_.c_str(), nullptr);
+            }
+            state_ |= materialized_double;
+        }
+        return double_value_;
+    }
+
+    auto as_int128() const -> __int128 {
+        if (!(state_ & materialized_int)) {
+            const char* p = token_.data();
+            const char* end = p + token_.size();
+            bool neg = (p != end && *p == '-');
+            if (neg) {
+                p++;
+            }
+            unsigned __int128 magnitude = 0;
+            while (p < end && *p >= '0' && *p <= '9') {
+                magnitude = magnitude * 10 + static_cast<unsigned>(*p++ - '0');
+            }
+            int_value_ =
+                neg ? -static_cast<__int128>(magnitude) : static_cast<__int128>(magnitude);
+            state_ |= materialized_int;
+        }
+        return int_value_;
+    }
+
+private:
+    static constexpr uint8_t materialized_double = 1;
+    static constexpr uint8_t materialized_int = 2;
+
+    std::string token_;
+    mutable double double_value_ = 0.0;
+    mutable __int128 int_value_ = 0;
+    mutable uint8_t state_ = 0;
+};
 
 export class json_value {
 public:
@@ -217,6 +681,10 @@ public:
 
     json_value(json_object&& o) : data_(std::move(o)) {}
 
+    json_value(flat_json_object&& o) : data_(std::move(o)) {}
+
+    json_value(json_raw_number&& n) : data_(std::move(n)) {}
+
     // Destructor must be explicitly defined to handle recursive cleanup
     ~json_value() {
 #if defined(DEBUG_DESTRUCTOR) && !defined(FASTJSON_NO_LOGGER)
@@ -240,17 +708,32 @@ public:
 
     auto is_bool() const -> bool { return std::holds_alternative<json_boolean>(data_); }
 
-    auto is_number() const -> bool { return std::holds_alternative<json_number>(data_); }
+    auto is_number() const -> bool {
+        return std::holds_alternative<json_number>(data_)
+               || std::holds_alternative<json_raw_number>(data_);
+    }
 
     auto is_string() const -> bool { return std::holds_alternative<json_string>(data_); }
 
     auto is_array() const -> bool { return std::holds_alternative<json_array>(data_); }
 
-    auto is_object() const -> bool { return std::holds_alternative<json_object>(data_); }
+    auto is_object() const -> bool {
+        return std::holds_alternative<json_object>(data_)
+               || std::holds_alternative<flat_json_object>(data_);
+    }
+
+    auto is_flat_object() const -> bool {
+        return std::holds_alternative<flat_json_object>(data_);
+    }
 
     auto as_bool() const -> bool { return std::get<json_boolean>(data_); }
 
-    auto as_number() const -> double { return std::get<json_number>(data_); }
+    auto as_number() const -> double {
+        if (auto* raw = std::get_if<json_raw_number>(&data_)) {
+            return raw->as_double();
+        }
+        return std::get<json_number>(data_);
+    }
 
     auto as_string() const -> const std::string& { return std::get<json_string>(data_); }
 
@@ -258,10 +741,196 @@ public:
 
     auto as_object() const -> const json_object& { return std::get<json_object>(data_); }
 
+    // Extended-precision accessors (128-bit alternatives used by parse_number)
+    auto is_int128() const -> bool { return std::holds_alternative<json_int_128>(data_); }
+    auto is_uint128() const -> bool { return std::holds_alternative<json_uint_128>(data_); }
+    auto is_float128() const -> bool { return std::holds_alternative<json_number_128>(data_); }
+    auto as_int128() const -> json_int_128 { return std::get<json_int_128>(data_); }
+    auto as_uint128() const -> json_uint_128 { return std::get<json_uint_128>(data_); }
+    auto as_float128() const -> json_number_128 { return std::get<json_number_128>(data_); }
+
+    // Native 64-bit integer access without a double round-trip: 64-bit IDs
+    // above 2^53 come back exactly. is_int64() is true only when the stored
+    // integer fits int64_t.
+    // Lazy raw-number access (parse_config::lazy_numbers)
+    auto is_raw_number() const -> bool {
+        return std::holds_alternative<json_raw_number>(data_);
+    }
+    auto as_raw_number() const -> const json_raw_number& {
+        return std::get<json_raw_number>(data_);
+    }
+
+    auto is_int64() const -> bool {
+        if (auto* raw = std::get_if<json_raw_number>(&data_)) {
+            if (!raw->is_integral()) {
+                return false;
+            }
+            __int128 value = raw->as_int128();
+            return value >= static_cast<__int128>(std::numeric_limits<int64_t>::min()) &&
+                   value <= static_cast<__int128>(std::numeric_limits<int64_t>::max());
+        }
+        if (auto* i = std::get_if<json_int_128>(&data_)) {
+            return *i >= static_cast<json_int_128>(std::numeric_limits<int64_t>::min()) &&
+                   *i <= static_cast<json_int_128>(std::numeric_limits<int64_t>::max());
+        }
+        if (auto* u = std::get_if<json_uint_128>(&data_)) {
+            return *u <= static_cast<json_uint_128>(std::numeric_limits<int64_t>::max());
+        }
+        return false;
+    }
+    auto as_int64() const -> int64_t {
+        if (auto* raw = std::get_if<json_raw_number>(&data_)) {
+            return static_cast<int64_t>(raw->as_int128());
+        }
+        if (auto* i = std::get_if<json_int_128>(&data_)) {
+            return static_cast<int64_t>(*i);
+        }
+        if (auto* u = std::get_if<json_uint_128>(&data_)) {
+            return static_cast<int64_t>(*u);
+        }
+        return static_cast<int64_t>(std::get<json_number>(data_));
+    }
+
+    auto as_flat_object() const -> const flat_json_object& {
+        return std::get<flat_json_object>(data_);
+    }
+
+    // Representation-agnostic field lookup: works for both the hash-map and
+    // the flat sorted-vector object. Returns nullptr when absent.
+    auto find(std::string_view key) const -> const json_value*;
+
+    // Reference-returning variant of find() for call sites that treat a
+    // missing field as a bug; throws std::out_of_range (mirrors
+    // flat_json_object::at) when the key is absent or this is not an object
+    auto get(std::string_view key) const -> const json_value&;
+
 private:
-    std::variant<json_null, json_boolean, json_number, json_number_128, json_int_128, json_uint_128, json_string, json_array, json_object> data_;
+    std::variant<json_null, json_boolean, json_number, json_number_128, json_int_128, json_uint_128, json_string, json_array, json_object, flat_json_object, json_raw_number> data_;
 };
 
+// ============================================================================
+// flat_json_object Implementation (json_value is complete here)
+// ============================================================================
+
+namespace detail {
+
+// Scans the packed prefix table for the next entry at or after `from` whose
+// 16-byte prefix equals `probe`; returns entry_count when none remains.
+// Defined with the SIMD kernels below (dispatch needs g_simd_caps).
+auto flat_key_prefix_scan(const char* prefixes, size_t entry_count, const char* probe,
+                          size_t from) -> size_t;
+
+}  // namespace detail
+
+inline auto flat_json_object::reserve(size_t n) -> void {
+    entries_.reserve(n);
+}
+
+inline auto flat_json_object::emplace(std::string key, json_value value) -> void {
+    entries_.emplace_back(std::move(key), std::move(value));
+    sorted_ = false;
+}
+
+inline auto flat_json_object::finalize() -> void {
+    std::sort(entries_.begin(), entries_.end(),
+              [](const value_type& a, const value_type& b) { return a.first < b.first; });
+    sorted_ = true;
+
+    key_prefixes_.assign(entries_.size() * 16, '\0');
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const std::string& k = entries_[i].first;
+        std::memcpy(key_prefixes_.data() + i * 16, k.data(), std::min<size_t>(k.size(), 16));
+    }
+}
+
+inline auto flat_json_object::has_duplicate_key() const -> bool {
+    for (size_t i = 1; i < entries_.size(); ++i) {
+        if (entries_[i - 1].first == entries_[i].first) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline auto flat_json_object::find(std::string_view key) const -> const json_value* {
+    if (sorted_) {
+        if (entries_.size() <= simd_scan_max_entries && !key_prefixes_.empty()) {
+            // SIMD prefix scan: several candidate keys are compared per
+            // vector load; the full string compare runs only on prefix hits
+            // (for keys up to 16 bytes that is just a length confirmation)
+            char probe[16] = {};
+            std::memcpy(probe, key.data(), std::min<size_t>(key.size(), 16));
+            size_t i = detail::flat_key_prefix_scan(key_prefixes_.data(), entries_.size(),
+                                                    probe, 0);
+            while (i < entries_.size()) {
+                if (entries_[i].first == key) {
+                    return &entries_[i].second;
+                }
+                i = detail::flat_key_prefix_scan(key_prefixes_.data(), entries_.size(), probe,
+                                                 i + 1);
+            }
+            return nullptr;
+        }
+        auto it = std::lower_bound(
+            entries_.begin(), entries_.end(), key,
+            [](const value_type& entry, std::string_view k) { return entry.first < k; });
+        if (it != entries_.end() && it->first == key) {
+            return &it->second;
+        }
+        return nullptr;
+    }
+    // Unfinalized build-phase lookup
+    for (const auto& entry : entries_) {
+        if (entry.first == key) {
+            return &entry.second;
+        }
+    }
+    return nullptr;
+}
+
+inline auto flat_json_object::at(std::string_view key) const -> const json_value& {
+    const json_value* value = find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("flat_json_object::at: key not found");
+    }
+    return *value;
+}
+
+inline auto flat_json_object::size() const noexcept -> size_t {
+    return entries_.size();
+}
+
+inline auto flat_json_object::empty() const noexcept -> bool {
+    return entries_.empty();
+}
+
+inline auto flat_json_object::begin() const noexcept -> const_iterator {
+    return entries_.begin();
+}
+
+inline auto flat_json_object::end() const noexcept -> const_iterator {
+    return entries_.end();
+}
+
+inline auto json_value::find(std::string_view key) const -> const json_value* {
+    if (auto* flat = std::get_if<flat_json_object>(&data_)) {
+        return flat->find(key);
+    }
+    if (auto* map = std::get_if<json_object>(&data_)) {
+        auto it = map->find(key);  // Heterogeneous: no temporary key string
+        return it != map->end() ? &it->second : nullptr;
+    }
+    return nullptr;
+}
+
+inline auto json_value::get(std::string_view key) const -> const json_value& {
+    const json_value* value = find(key);
+    if (value == nullptr) {
+        throw std::out_of_range("json_value::get: key not found");
+    }
+    return *value;
+}
+
 // Destructor was moved inline to the class definition above since this is a header-only library
 
 // ============================================================================
@@ -545,32 +1214,34 @@ static auto skip_whitespace_neon(std::span<const char> data, size_t start_pos) -
 
 #endif
 
-static auto skip_whitespace_simd(std::span<const char> data, size_t start_pos) -> size_t {
-    if (!g_config.enable_simd) {
-        goto scalar_fallback;
-    }
-
-#if defined(__x86_64__) || defined(_M_X64)
-    if (g_config.enable_avx512 && g_simd_caps.avx512f && g_simd_caps.avx512bw) {
-        return skip_whitespace_avx512(data, start_pos);
-    } else if (g_config.enable_avx2 && g_simd_caps.avx2) {
-        return skip_whitespace_avx2(data, start_pos);
-    } else if (g_config.enable_sse42 && g_simd_caps.sse2) {
-        return skip_whitespace_sse2(data, start_pos);
-    }
-#elif defined(__aarch64__) || defined(_M_ARM64)
-    if (g_config.enable_neon && g_simd_caps.neon) {
-        return skip_whitespace_neon(data, start_pos);
-    }
-#endif
-
-scalar_fallback:
-    size_t pos = start_pos;
-    while (pos < data.size()
-           && (data[pos] == ' ' || data[pos] == '\t' || data[pos] == '\n' || data[pos] == '\r')) {
-        pos++;
-    }
-    return pos;
+// ============================================================================
+// Escape-Aware Quote Scanning (odd-backslash carry)
+// ============================================================================
+// find_string_end_* stops at every backslash and hands the escape back to the
+// caller, so escape-dense strings pay one vector restart per escape. For
+// consumers that only need the closing quote (extent scans, not decoding),
+// the escaped positions can be resolved inside the vector pass instead:
+// characters preceded by an odd-length backslash run are masked out of the
+// quote bitmap with pure 64-bit arithmetic, carrying run parity across block
+// boundaries in one state bit. This is the simdjson stage-1 escape technique.
+
+// Positions escaped by an odd-length backslash run. `next_is_escaped` is the
+// single carry bit: set when bit 63 holds a still-escaping backslash.
+static inline auto escaped_positions_mask(uint64_t backslash, uint64_t& next_is_escaped)
+    -> uint64_t {
+    constexpr uint64_t odd_bits = 0xAAAAAAAAAAAAAAAAULL;
+    // A backslash that is itself escaped starts nothing
+    uint64_t potential_escape = backslash & ~next_is_escaped;
+    // Runs starting on an even bit escape odd bits and vice versa; the
+    // subtraction propagates each run to its terminal (escaped) position
+    uint64_t maybe_escaped = potential_escape << 1;
+    uint64_t maybe_escaped_and_odd = maybe_escaped | odd_bits;
+    uint64_t even_series_and_odd = maybe_escaped_and_odd - potential_escape;
+    uint64_t escape_and_terminal = even_series_and_odd ^ odd_bits;
+    uint64_t escaped = escape_and_terminal ^ (backslash | next_is_escaped);
+    uint64_t escape = escape_and_terminal & backslash;
+    next_is_escaped = escape >> 63;
+    return escaped;
 }
 
 #if defined(__x86_64__) || defined(_M_X64)
@@ -617,6 +1288,121 @@ __attribute__((target("avx2"))) static auto find_string_end_avx2(std::span<const
     return pos;
 }
 
+// First unescaped '"' (or control character) from start_pos, resolving
+// escaped quotes in-vector via the odd-backslash carry. saw_escape reports
+// whether any backslash was crossed, so extent consumers know whether the
+// raw span can be used verbatim.
+__attribute__((target("avx2"))) static auto
+find_closing_quote_avx2(std::span<const char> data, size_t start_pos, bool& saw_escape) -> size_t {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i control_bound = _mm256_set1_epi8(0x1F);
+
+    size_t pos = start_pos;
+    uint64_t next_is_escaped = 0;
+
+    while (pos + 64 <= data.size()) {
+        __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + pos));
+        __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + pos + 32));
+
+        uint64_t quote_mask =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, quote)))
+            | (static_cast<uint64_t>(static_cast<uint32_t>(
+                   _mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, quote))))
+               << 32);
+        uint64_t backslash_mask =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, backslash)))
+            | (static_cast<uint64_t>(static_cast<uint32_t>(
+                   _mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, backslash))))
+               << 32);
+        uint64_t control_mask =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                _mm256_subs_epu8(lo, control_bound), _mm256_setzero_si256())))
+            | (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(
+                   _mm256_cmpeq_epi8(_mm256_subs_epu8(hi, control_bound),
+                                     _mm256_setzero_si256()))))
+               << 32);
+
+        uint64_t escaped = escaped_positions_mask(backslash_mask, next_is_escaped);
+
+        // Escaped positions are consumed whole - even control characters;
+        // the escape validity itself is the decoder's concern
+        uint64_t hits = (quote_mask | control_mask) & ~escaped;
+        if (hits != 0) {
+            int first_hit = __builtin_ctzll(hits);
+            // Only backslashes before the hit belong to this string
+            saw_escape =
+                saw_escape || (backslash_mask & ((uint64_t{1} << first_hit) - 1)) != 0;
+            return pos + static_cast<size_t>(first_hit);
+        }
+        saw_escape = saw_escape || backslash_mask != 0;
+        pos += 64;
+    }
+
+    // Scalar tail, continuing the carried escape state
+    bool escape_next = next_is_escaped != 0;
+    while (pos < data.size()) {
+        char c = data[pos];
+        if (escape_next) {
+            escape_next = false;
+        } else if (c == '\\') {
+            saw_escape = true;
+            escape_next = true;
+        } else if (c == '"' || static_cast<unsigned char>(c) < 0x20) {
+            return pos;
+        }
+        pos++;
+    }
+    return pos;
+}
+
+// 64-byte blocks with native mask registers: the compare results are already
+// the uint64_t bitmaps the carry arithmetic wants
+__attribute__((target("avx512f,avx512bw"))) static auto
+find_closing_quote_avx512(std::span<const char> data, size_t start_pos, bool& saw_escape)
+    -> size_t {
+    size_t pos = start_pos;
+    uint64_t next_is_escaped = 0;
+
+    while (pos + 64 <= data.size()) {
+        __m512i chunk = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(data.data() + pos));
+        uint64_t quote_mask = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('"'));
+        uint64_t backslash_mask = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('\\'));
+        uint64_t control_mask =
+            _mm512_cmplt_epu8_mask(chunk, _mm512_set1_epi8(0x20));
+
+        uint64_t escaped = escaped_positions_mask(backslash_mask, next_is_escaped);
+
+        // Escaped positions are consumed whole - even control characters;
+        // the escape validity itself is the decoder's concern
+        uint64_t hits = (quote_mask | control_mask) & ~escaped;
+        if (hits != 0) {
+            int first_hit = __builtin_ctzll(hits);
+            // Only backslashes before the hit belong to this string
+            saw_escape =
+                saw_escape || (backslash_mask & ((uint64_t{1} << first_hit) - 1)) != 0;
+            return pos + static_cast<size_t>(first_hit);
+        }
+        saw_escape = saw_escape || backslash_mask != 0;
+        pos += 64;
+    }
+
+    bool escape_next = next_is_escaped != 0;
+    while (pos < data.size()) {
+        char c = data[pos];
+        if (escape_next) {
+            escape_next = false;
+        } else if (c == '\\') {
+            saw_escape = true;
+            escape_next = true;
+        } else if (c == '"' || static_cast<unsigned char>(c) < 0x20) {
+            return pos;
+        }
+        pos++;
+    }
+    return pos;
+}
+
 #elif defined(__aarch64__) || defined(_M_ARM64)
 
 // ARM NEON string scanning - find end quote or escape
@@ -668,20 +1454,593 @@ static auto find_string_end_neon(std::span<const char> data, size_t start_pos) -
     return pos;
 }
 
-#endif
-
-#if defined(__x86_64__) || defined(_M_X64)
-
-// SIMD number validation - check if all digits/valid number chars
-__attribute__((target("avx2"))) static auto
-validate_number_chars_avx2(std::span<const char> data, size_t start_pos, size_t end_pos) -> bool {
-    const __m256i digit_0 = _mm256_set1_epi8('0' - 1);
-    const __m256i digit_9 = _mm256_set1_epi8('9' + 1);
-    const __m256i minus = _mm256_set1_epi8('-');
-    const __m256i plus = _mm256_set1_epi8('+');
-    const __m256i dot = _mm256_set1_epi8('.');
-    const __m256i e_lower = _mm256_set1_epi8('e');
-    const __m256i e_upper = _mm256_set1_epi8('E');
+// NEON movemask emulation: one bit per byte so the odd-backslash carry
+// arithmetic runs on the same uint64_t bitmaps as the x86 kernels
+static inline auto neon_movemask_u16(uint8x16_t input) -> uint16_t {
+    const uint8x16_t bit_select = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+                                   0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+    uint8x16_t selected = vandq_u8(input, bit_select);
+    return static_cast<uint16_t>(vaddv_u8(vget_low_u8(selected)))
+           | static_cast<uint16_t>(vaddv_u8(vget_high_u8(selected)) << 8);
+}
+
+// First unescaped '"' (or control character) from start_pos; escaped quotes
+// are resolved inside the vector pass (see the x86 variant for the contract)
+static auto find_closing_quote_neon(std::span<const char> data, size_t start_pos,
+                                    bool& saw_escape) -> size_t {
+    size_t pos = start_pos;
+    uint64_t next_is_escaped = 0;
+
+    while (pos + 64 <= data.size()) {
+        uint64_t quote_mask = 0;
+        uint64_t backslash_mask = 0;
+        uint64_t control_mask = 0;
+        for (size_t lane = 0; lane < 4; ++lane) {
+            uint8x16_t chunk =
+                vld1q_u8(reinterpret_cast<const uint8_t*>(data.data() + pos + lane * 16));
+            quote_mask |= static_cast<uint64_t>(neon_movemask_u16(vceqq_u8(chunk, vdupq_n_u8('"'))))
+                          << (lane * 16);
+            backslash_mask |=
+                static_cast<uint64_t>(neon_movemask_u16(vceqq_u8(chunk, vdupq_n_u8('\\'))))
+                << (lane * 16);
+            control_mask |=
+                static_cast<uint64_t>(neon_movemask_u16(vcltq_u8(chunk, vdupq_n_u8(0x20))))
+                << (lane * 16);
+        }
+
+        uint64_t escaped = escaped_positions_mask(backslash_mask, next_is_escaped);
+
+        // Escaped positions are consumed whole - even control characters;
+        // the escape validity itself is the decoder's concern
+        uint64_t hits = (quote_mask | control_mask) & ~escaped;
+        if (hits != 0) {
+            int first_hit = __builtin_ctzll(hits);
+            // Only backslashes before the hit belong to this string
+            saw_escape =
+                saw_escape || (backslash_mask & ((uint64_t{1} << first_hit) - 1)) != 0;
+            return pos + static_cast<size_t>(first_hit);
+        }
+        saw_escape = saw_escape || backslash_mask != 0;
+        pos += 64;
+    }
+
+    bool escape_next = next_is_escaped != 0;
+    while (pos < data.size()) {
+        char c = data[pos];
+        if (escape_next) {
+            escape_next = false;
+        } else if (c == '\\') {
+            saw_escape = true;
+            escape_next = true;
+        } else if (c == '"' || static_cast<unsigned char>(c) < 0x20) {
+            return pos;
+        }
+        pos++;
+    }
+    return pos;
+}
+
+#endif
+
+#if (defined(__aarch64__) || defined(_M_ARM64)) && defined(__ARM_FEATURE_SVE)
+
+    // ARM SVE/SVE2 kernels
+    #include <arm_sve.h>
+
+// SVE kernels are vector-length agnostic (256-bit on Graviton3/4, up to
+// 2048-bit elsewhere) and fully predicated: svwhilelt masks the final
+// partial vector, so unlike the NEON kernels there is no scalar tail loop.
+
+static auto skip_whitespace_sve(std::span<const char> data, size_t start_pos) -> size_t {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data.data());
+    const size_t size = data.size();
+    size_t pos = start_pos;
+
+    while (pos < size) {
+        svbool_t pg = svwhilelt_b8(static_cast<uint64_t>(pos), static_cast<uint64_t>(size));
+        svuint8_t chunk = svld1_u8(pg, bytes + pos);
+
+        svbool_t is_ws = svorr_b_z(
+            pg, svorr_b_z(pg, svcmpeq_n_u8(pg, chunk, ' '), svcmpeq_n_u8(pg, chunk, '\t')),
+            svorr_b_z(pg, svcmpeq_n_u8(pg, chunk, '\n'), svcmpeq_n_u8(pg, chunk, '\r')));
+
+        svbool_t non_ws = svbic_b_z(pg, pg, is_ws);
+        if (svptest_any(pg, non_ws)) {
+            // Count the whitespace lanes before the first hit
+            return pos + svcntp_b8(pg, svbrkb_b_z(pg, non_ws));
+        }
+        pos += svcntp_b8(pg, pg);
+    }
+    return size;
+}
+
+static auto find_string_end_sve(std::span<const char> data, size_t start_pos) -> size_t {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data.data());
+    const size_t size = data.size();
+    size_t pos = start_pos;
+
+    while (pos < size) {
+        svbool_t pg = svwhilelt_b8(static_cast<uint64_t>(pos), static_cast<uint64_t>(size));
+        svuint8_t chunk = svld1_u8(pg, bytes + pos);
+
+        svbool_t special = svorr_b_z(
+            pg, svorr_b_z(pg, svcmpeq_n_u8(pg, chunk, '"'), svcmpeq_n_u8(pg, chunk, '\\')),
+            svcmplt_n_u8(pg, chunk, 0x20));
+
+        if (svptest_any(pg, special)) {
+            return pos + svcntp_b8(pg, svbrkb_b_z(pg, special));
+        }
+        pos += svcntp_b8(pg, pg);
+    }
+    return size;
+}
+
+// Structural literal match (true/false/null) in one predicated compare
+static auto match_literal_sve(std::span<const char> data, size_t pos, const char* literal,
+                              size_t len) -> bool {
+    if (pos + len > data.size()) {
+        return false;
+    }
+    size_t i = 0;
+    while (i < len) {
+        svbool_t pg = svwhilelt_b8(static_cast<uint64_t>(i), static_cast<uint64_t>(len));
+        svuint8_t a = svld1_u8(pg, reinterpret_cast<const uint8_t*>(data.data() + pos + i));
+        svuint8_t b = svld1_u8(pg, reinterpret_cast<const uint8_t*>(literal + i));
+        if (svptest_any(pg, svcmpne_u8(pg, a, b))) {
+            return false;
+        }
+        i += svcntp_b8(pg, pg);
+    }
+    return true;
+}
+
+#endif  // __aarch64__ && __ARM_FEATURE_SVE
+
+// ============================================================================
+// SIMD String Unescape
+// ============================================================================
+// Decodes the body of a JSON string starting just after the opening quote.
+// Clean runs are found with a single movemask scan per 32 bytes and copied
+// in bulk; the code drops to scalar only for the escape sequences themselves,
+// with a tight inner loop for escape-dense stretches (stringified-JSON-in-
+// JSON payloads). Returns the position one past the closing quote.
+
+// Shared scalar escape decoder: consumes one escape sequence at input[pos]
+// (pos points at the backslash), appends the decoded bytes, returns the new
+// position or an error. Templated on the output string so the arena-backed
+// pmr scratch works alongside plain std::string.
+template <typename String>
+static auto decode_one_escape(std::string_view input, size_t pos, String& value)
+    -> std::expected<size_t, json_error> {
+    pos++;  // Skip backslash
+    if (pos >= input.size()) {
+        return std::unexpected(json_error{json_error_code::invalid_string,
+                                          "Unterminated escape sequence", 0, pos});
+    }
+    char escaped = input[pos++];
+    switch (escaped) {
+        case '"': value += '"'; break;
+        case '\\': value += '\\'; break;
+        case '/': value += '/'; break;
+        case 'b': value += '\b'; break;
+        case 'f': value += '\f'; break;
+        case 'n': value += '\n'; break;
+        case 'r': value += '\r'; break;
+        case 't': value += '\t'; break;
+        case 'u': {
+            if constexpr (std::is_same_v<String, std::string>) {
+                auto result = unicode::decode_json_unicode_escape(input.data() + pos,
+                                                                  input.size() - pos, value);
+                if (!result.has_value()) {
+                    return std::unexpected(
+                        json_error{json_error_code::invalid_unicode, result.error(), 0, pos});
+                }
+                pos += result.value();
+            } else {
+                // The unicode helper appends to std::string; decode into a
+                // recycled staging buffer and copy into the arena-backed string
+                thread_local std::string utf8_staging;
+                utf8_staging.clear();
+                auto result = unicode::decode_json_unicode_escape(input.data() + pos,
+                                                                  input.size() - pos, utf8_staging);
+                if (!result.has_value()) {
+                    return std::unexpected(
+                        json_error{json_error_code::invalid_unicode, result.error(), 0, pos});
+                }
+                pos += result.value();
+                value.append(utf8_staging.data(), utf8_staging.size());
+            }
+            break;
+        }
+        default:
+            return std::unexpected(json_error{json_error_code::invalid_escape,
+                                              "Invalid escape sequence", 0, pos});
+    }
+    return pos;
+}
+
+template <typename String>
+static auto unescape_string_scalar(std::string_view input, size_t pos, String& value)
+    -> std::expected<size_t, json_error> {
+    while (pos < input.size()) {
+        char c = input[pos];
+        if (c == '"') {
+            return pos + 1;
+        }
+        if (c == '\\') {
+            auto next = decode_one_escape(input, pos, value);
+            if (!next) {
+                return std::unexpected(next.error());
+            }
+            pos = *next;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            return std::unexpected(json_error{json_error_code::invalid_string,
+                                              "Control character in string", 0, pos});
+        } else {
+            value += c;
+            pos++;
+        }
+        if (value.size() > g_config.max_string_length) {
+            return std::unexpected(json_error{json_error_code::invalid_string,
+                                              "String exceeds maximum length", 0, pos});
+        }
+    }
+    return std::unexpected(
+        json_error{json_error_code::invalid_string, "Unterminated string", 0, pos});
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// Streaming UTF-8 validator implementing the lookup-table range algorithm from
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser & Lemire),
+// as shipped in simdjson's utf8_lookup4. Each 32-byte block costs three nibble
+// table shuffles plus two saturating subtractions - there is no per-byte
+// fallback inside a block. State carries across contiguous blocks so
+// multi-byte sequences may straddle block boundaries; check_final() flushes a
+// run that ends at an ASCII byte or at end of input (the zero padding is
+// ASCII, so a sequence truncated at the boundary surfaces as TOO_SHORT).
+struct utf8_checker_avx2 {
+    // Error classes for the nibble lookups. The tables are built so that
+    // (byte_1_high & byte_1_low & byte_2_high) is non-zero exactly when the
+    // two-byte window (previous byte, current byte) is structurally invalid.
+    static constexpr uint8_t TOO_SHORT = 1 << 0;   // lead byte not followed by continuation
+    static constexpr uint8_t TOO_LONG = 1 << 1;    // continuation after ASCII / finished sequence
+    static constexpr uint8_t OVERLONG_3 = 1 << 2;  // E0 followed by 80..9F
+    static constexpr uint8_t TOO_LARGE = 1 << 3;   // above U+10FFFF (F4 90.., F5..)
+    static constexpr uint8_t SURROGATE = 1 << 4;   // ED followed by A0..BF
+    static constexpr uint8_t OVERLONG_2 = 1 << 5;  // C0/C1 lead
+    static constexpr uint8_t TOO_LARGE_1000 = 1 << 6;
+    static constexpr uint8_t OVERLONG_4 = 1 << 6;  // F0 followed by 80..8F (shares a bit)
+    static constexpr uint8_t TWO_CONTS = 1 << 7;   // continuation positions, checked via lengths
+    static constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+    __m256i error;
+    __m256i prev_input;
+    __m256i prev_incomplete;
+
+    __attribute__((target("avx2"))) void init() {
+        error = _mm256_setzero_si256();
+        prev_input = _mm256_setzero_si256();
+        prev_incomplete = _mm256_setzero_si256();
+    }
+
+    // Each lane of the result holds the byte N positions earlier in the
+    // stream, pulling from prev_input across the block boundary.
+    template <int N>
+    __attribute__((target("avx2"))) auto prev(__m256i input) const -> __m256i {
+        __m256i joined = _mm256_permute2x128_si256(prev_input, input, 0x21);
+        return _mm256_alignr_epi8(input, joined, 16 - N);
+    }
+
+    __attribute__((target("avx2"))) auto check_special_cases(__m256i input, __m256i prev1) const
+        -> __m256i {
+        const __m256i byte_1_high_tbl = _mm256_setr_epi8(
+            // 0_______ ________ <ASCII in byte 1>
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            // 10______ ________ <continuation in byte 1>
+            static_cast<char>(TWO_CONTS), static_cast<char>(TWO_CONTS),
+            static_cast<char>(TWO_CONTS), static_cast<char>(TWO_CONTS),
+            // 1100____ ________ <two byte lead>
+            TOO_SHORT | OVERLONG_2,
+            // 1101____ ________
+            TOO_SHORT,
+            // 1110____ ________ <three byte lead>
+            TOO_SHORT | OVERLONG_3 | SURROGATE,
+            // 1111____ ________ <four+ byte lead>
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+            // (repeated for the high 128-bit lane)
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            static_cast<char>(TWO_CONTS), static_cast<char>(TWO_CONTS),
+            static_cast<char>(TWO_CONTS), static_cast<char>(TWO_CONTS), TOO_SHORT | OVERLONG_2,
+            TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE,
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+        constexpr uint8_t C = CARRY;
+        const __m256i byte_1_low_tbl = _mm256_setr_epi8(
+            // ____0000 ________
+            static_cast<char>(C | OVERLONG_3 | OVERLONG_2 | OVERLONG_4),
+            // ____0001 ________
+            static_cast<char>(C | OVERLONG_2),
+            // ____001_ ________
+            static_cast<char>(C), static_cast<char>(C),
+            // ____0100 ________
+            static_cast<char>(C | TOO_LARGE),
+            // ____0101 ________ and everything above
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            // ____1101 ________ <ED: surrogate range>
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000 | SURROGATE),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            // (repeated for the high 128-bit lane)
+            static_cast<char>(C | OVERLONG_3 | OVERLONG_2 | OVERLONG_4),
+            static_cast<char>(C | OVERLONG_2), static_cast<char>(C), static_cast<char>(C),
+            static_cast<char>(C | TOO_LARGE), static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000 | SURROGATE),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000),
+            static_cast<char>(C | TOO_LARGE | TOO_LARGE_1000));
+        const __m256i byte_2_high_tbl = _mm256_setr_epi8(
+            // ________ 0_______ <ASCII in byte 2>
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            TOO_SHORT,
+            // ________ 1000____
+            static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 |
+                              OVERLONG_4),
+            // ________ 1001____
+            static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE),
+            // ________ 101_____
+            static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+            static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+            // ________ 11______ <lead byte in byte 2>
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            // (repeated for the high 128-bit lane)
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            TOO_SHORT,
+            static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 |
+                              OVERLONG_4),
+            static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE),
+            static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+            static_cast<char>(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+
+        const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+        __m256i byte_1_high = _mm256_shuffle_epi8(
+            byte_1_high_tbl, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble));
+        __m256i byte_1_low =
+            _mm256_shuffle_epi8(byte_1_low_tbl, _mm256_and_si256(prev1, low_nibble));
+        __m256i byte_2_high = _mm256_shuffle_epi8(
+            byte_2_high_tbl, _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+        return _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+    }
+
+    // The special-case tables only see two-byte windows; cross-check that
+    // positions flagged as 3rd/4th continuation bytes agree with the lead
+    // bytes two and three positions back.
+    __attribute__((target("avx2"))) auto check_multibyte_lengths(__m256i input, __m256i sc) const
+        -> __m256i {
+        __m256i prev2 = prev<2>(input);
+        __m256i prev3 = prev<3>(input);
+        __m256i is_third_byte =
+            _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+        __m256i is_fourth_byte =
+            _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+        __m256i must23 = _mm256_or_si256(is_third_byte, is_fourth_byte);
+        __m256i must23_80 = _mm256_and_si256(must23, _mm256_set1_epi8(static_cast<char>(0x80)));
+        return _mm256_xor_si256(must23_80, sc);
+    }
+
+    __attribute__((target("avx2"))) void check_block(__m256i input) {
+        if (_mm256_movemask_epi8(input) == 0) {
+            // Pure ASCII: only a sequence left dangling by the previous block
+            // can be wrong.
+            error = _mm256_or_si256(error, prev_incomplete);
+            prev_incomplete = _mm256_setzero_si256();
+        } else {
+            __m256i prev1 = prev<1>(input);
+            __m256i sc = check_special_cases(input, prev1);
+            error = _mm256_or_si256(error, check_multibyte_lengths(input, sc));
+            // Lead bytes too close to the block end to finish their sequence;
+            // resolved by the next block (or flagged by check_final).
+            const __m256i max_value = _mm256_setr_epi8(
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xF0 - 1),
+                static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+            prev_incomplete = _mm256_subs_epu8(input, max_value);
+        }
+        prev_input = input;
+    }
+
+    // Flush a run that ends here (next source byte is ASCII, or end of input).
+    // len must be < 32; the zero padding is ASCII, so an unfinished sequence
+    // is reported as TOO_SHORT.
+    __attribute__((target("avx2"))) void check_final(const char* data, size_t len) {
+        if (len > 0) {
+            alignas(32) char padded[32] = {};
+            std::memcpy(padded, data, len);
+            check_block(_mm256_load_si256(reinterpret_cast<const __m256i*>(padded)));
+        }
+        error = _mm256_or_si256(error, prev_incomplete);
+        prev_input = _mm256_setzero_si256();
+        prev_incomplete = _mm256_setzero_si256();
+    }
+
+    __attribute__((target("avx2"))) auto has_error() const -> bool {
+        return _mm256_testz_si256(error, error) == 0;
+    }
+};
+
+// Vectorized unescape fused with UTF-8 validation: every literal byte run is
+// fed to the range validator as it is bulk-copied, so non-ASCII-heavy strings
+// do not pay a second full pass after the copy. Escape-decoded output is valid
+// UTF-8 by construction (decode_one_escape emits ASCII or encodes a validated
+// codepoint), and runs always break at an ASCII byte (quote/backslash), so a
+// multi-byte sequence can never straddle a run boundary.
+template <typename String>
+__attribute__((target("avx2"))) static auto
+unescape_string_avx2(std::string_view input, size_t pos, String& value)
+    -> std::expected<size_t, json_error> {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+
+    utf8_checker_avx2 utf8;
+    utf8.init();
+
+    while (pos + 32 <= input.size()) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
+
+        __m256i is_quote = _mm256_cmpeq_epi8(chunk, quote);
+        __m256i is_backslash = _mm256_cmpeq_epi8(chunk, backslash);
+        __m256i sub_result = _mm256_subs_epu8(chunk, _mm256_set1_epi8(0x1F));
+        __m256i is_control = _mm256_cmpeq_epi8(sub_result, _mm256_setzero_si256());
+        __m256i special = _mm256_or_si256(_mm256_or_si256(is_quote, is_backslash), is_control);
+
+        uint32_t mask = _mm256_movemask_epi8(special);
+
+        if (mask == 0) {
+            // Entire chunk is clean string body - one bulk copy, validated in
+            // the same pass
+            utf8.check_block(chunk);
+            value.append(input.data() + pos, 32);
+            pos += 32;
+            if (value.size() > g_config.max_string_length) {
+                return std::unexpected(json_error{json_error_code::invalid_string,
+                                                  "String exceeds maximum length", 0, pos});
+            }
+            continue;
+        }
+
+        int first_special = __builtin_ctz(mask);
+        // The literal run ends at the special byte (always ASCII), so the
+        // zero-padded final check is exact here.
+        utf8.check_final(input.data() + pos, static_cast<size_t>(first_special));
+        if (first_special > 0) {
+            value.append(input.data() + pos, first_special);
+            pos += first_special;
+        }
+
+        char c = input[pos];
+        if (c == '"') {
+            if (utf8.has_error()) {
+                return std::unexpected(json_error{json_error_code::invalid_string,
+                                                  "Invalid UTF-8 encoding in string", 0, pos});
+            }
+            return pos + 1;
+        }
+        if (static_cast<unsigned char>(c) < 0x20) {
+            return std::unexpected(json_error{json_error_code::invalid_string,
+                                              "Control character in string", 0, pos});
+        }
+
+        // Escape-dense inner loop: consume consecutive escapes without
+        // re-entering the vector scan per sequence
+        while (pos < input.size() && input[pos] == '\\') {
+            auto next = decode_one_escape(input, pos, value);
+            if (!next) {
+                return std::unexpected(next.error());
+            }
+            pos = *next;
+        }
+        if (value.size() > g_config.max_string_length) {
+            return std::unexpected(json_error{json_error_code::invalid_string,
+                                              "String exceeds maximum length", 0, pos});
+        }
+    }
+
+    // Tail (< 32 bytes): scalar scan, but literal runs still go through the
+    // checker so the whole string leaves here validated. A run that began in
+    // the vector loop continues seamlessly - check_final carries the block
+    // state across the boundary.
+    size_t run_start = pos;
+    while (true) {
+        if (pos >= input.size()) {
+            return std::unexpected(
+                json_error{json_error_code::invalid_string, "Unterminated string", 0, pos});
+        }
+        char c = input[pos];
+        if (c != '"' && c != '\\' && static_cast<unsigned char>(c) >= 0x20) {
+            pos++;
+            continue;
+        }
+        utf8.check_final(input.data() + run_start, pos - run_start);
+        if (pos > run_start) {
+            value.append(input.data() + run_start, pos - run_start);
+        }
+        if (value.size() > g_config.max_string_length) {
+            return std::unexpected(json_error{json_error_code::invalid_string,
+                                              "String exceeds maximum length", 0, pos});
+        }
+        if (c == '"') {
+            if (utf8.has_error()) {
+                return std::unexpected(json_error{json_error_code::invalid_string,
+                                                  "Invalid UTF-8 encoding in string", 0, pos});
+            }
+            return pos + 1;
+        }
+        if (static_cast<unsigned char>(c) < 0x20) {
+            return std::unexpected(json_error{json_error_code::invalid_string,
+                                              "Control character in string", 0, pos});
+        }
+        while (pos < input.size() && input[pos] == '\\') {
+            auto next = decode_one_escape(input, pos, value);
+            if (!next) {
+                return std::unexpected(next.error());
+            }
+            pos = *next;
+        }
+        run_start = pos;
+    }
+}
+
+#endif
+
+// utf8_validated reports whether the chosen path already validated the string
+// (the fused AVX2 path does); the caller only needs a separate validation pass
+// when it comes back false.
+template <typename String>
+static auto unescape_string_simd(std::string_view input, size_t pos, String& value,
+                                 bool& utf8_validated) -> std::expected<size_t, json_error> {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
+        utf8_validated = true;
+        return unescape_string_avx2(input, pos, value);
+    }
+#endif
+    utf8_validated = false;
+    return unescape_string_scalar(input, pos, value);
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// SIMD number validation - check if all digits/valid number chars
+__attribute__((target("avx2"))) static auto
+validate_number_chars_avx2(std::span<const char> data, size_t start_pos, size_t end_pos) -> bool {
+    const __m256i digit_0 = _mm256_set1_epi8('0' - 1);
+    const __m256i digit_9 = _mm256_set1_epi8('9' + 1);
+    const __m256i minus = _mm256_set1_epi8('-');
+    const __m256i plus = _mm256_set1_epi8('+');
+    const __m256i dot = _mm256_set1_epi8('.');
+    const __m256i e_lower = _mm256_set1_epi8('e');
+    const __m256i e_upper = _mm256_set1_epi8('E');
 
     size_t pos = start_pos;
 
@@ -750,6 +2109,65 @@ __attribute__((target("sse2"))) static auto match_literal_sse2(std::span<const c
     return std::memcmp(data.data() + pos, literal, len) == 0;
 }
 
+// Key-prefix scan over flat_json_object's packed 16-byte prefix table: the
+// probe is broadcast to both 128-bit lanes, so each 256-bit compare tests two
+// candidate keys, four per iteration. Full string comparison happens only on
+// prefix hits, so a 20-key object resolves a miss in ~3 vector compares
+// instead of up to 20 sequential std::string compares.
+__attribute__((target("avx2"))) static auto flat_key_scan_avx2(const char* prefixes,
+                                                               size_t entry_count,
+                                                               const char* probe, size_t from)
+    -> size_t {
+    const __m128i probe128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(probe));
+    const __m256i probe256 = _mm256_broadcastsi128_si256(probe128);
+
+    size_t i = from;
+    while (i + 4 <= entry_count) {
+        __m256i pair_a =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prefixes + i * 16));
+        __m256i pair_b =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prefixes + (i + 2) * 16));
+        uint32_t eq_a =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(pair_a, probe256)));
+        uint32_t eq_b =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(pair_b, probe256)));
+        if ((eq_a & 0xFFFFu) == 0xFFFFu) return i;
+        if ((eq_a >> 16) == 0xFFFFu) return i + 1;
+        if ((eq_b & 0xFFFFu) == 0xFFFFu) return i + 2;
+        if ((eq_b >> 16) == 0xFFFFu) return i + 3;
+        i += 4;
+    }
+    while (i + 2 <= entry_count) {
+        __m256i pair = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prefixes + i * 16));
+        uint32_t eq =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(pair, probe256)));
+        if ((eq & 0xFFFFu) == 0xFFFFu) return i;
+        if ((eq >> 16) == 0xFFFFu) return i + 1;
+        i += 2;
+    }
+    if (i < entry_count) {
+        __m128i one = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prefixes + i * 16));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(one, probe128)) == 0xFFFF) return i;
+        ++i;
+    }
+    return entry_count;
+}
+
+__attribute__((target("sse2"))) static auto flat_key_scan_sse2(const char* prefixes,
+                                                               size_t entry_count,
+                                                               const char* probe, size_t from)
+    -> size_t {
+    const __m128i probe128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(probe));
+    for (size_t i = from; i < entry_count; ++i) {
+        __m128i candidate =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(prefixes + i * 16));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(candidate, probe128)) == 0xFFFF) {
+            return i;
+        }
+    }
+    return entry_count;
+}
+
 // FMA-accelerated number parsing for simple integers
 // Uses FMA for fast digit accumulation in chunks of 8 digits
 // Based on techniques from lemire/fast_double_parser
@@ -873,104 +2291,92 @@ __attribute__((target("fma,avx2"))) static auto parse_number_fma(std::string_vie
 }
 
 // SIMD UTF-8 validation using AVX2
-// Based on the algorithm from "Validating UTF-8 In Less Than One Instruction Per Byte"
+// Implements the lookup-table range algorithm from "Validating UTF-8 In Less
+// Than One Instruction Per Byte":
 // https://github.com/simdjson/simdjson/blob/master/src/generic/stage1/utf8_lookup4_algorithm.h
+// Every 32-byte block is classified with three nibble shuffles - no per-byte
+// fallback when high bits are set, so CJK-heavy payloads validate at the same
+// rate as ASCII.
 __attribute__((target("avx2"))) static auto validate_utf8_avx2(std::span<const char> data,
                                                                size_t start_pos, size_t end_pos)
     -> bool {
-    size_t pos = start_pos;
+    utf8_checker_avx2 checker;
+    checker.init();
 
-    // Process 32 bytes at a time with AVX2
+    size_t pos = start_pos;
     while (pos + 32 <= end_pos) {
-        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + pos));
+        checker.check_block(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + pos)));
+        pos += 32;
+    }
+    // Zero-padded tail; also flags a sequence left unfinished at end of input
+    checker.check_final(data.data() + pos, end_pos - pos);
 
-        // Check for ASCII (high bit clear)
-        __m256i high_bit = _mm256_and_si256(chunk, _mm256_set1_epi8(static_cast<char>(0x80)));
-        uint32_t ascii_mask =
-            _mm256_movemask_epi8(_mm256_cmpeq_epi8(high_bit, _mm256_setzero_si256()));
+    return !checker.has_error();
+}
 
-        if (ascii_mask == 0xFFFFFFFF) {
-            // All ASCII, continue
-            pos += 32;
-            continue;
-        }
+#else  // Non-x86 platforms
 
-        // Need to check multi-byte sequences - fall back to scalar for this chunk
-        for (size_t i = 0; i < 32 && pos < end_pos; ++i, ++pos) {
-            unsigned char c = static_cast<unsigned char>(data[pos]);
+static auto find_string_end_avx2(std::span<const char> data, size_t start_pos) -> size_t {
+    size_t pos = start_pos;
+    while (pos < data.size()) {
+        char c = data[pos];
+        if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+            return pos;
+        }
+        pos++;
+    }
+    return pos;
+}
 
-            if (c < 0x80) {
-                // ASCII
-                continue;
-            } else if ((c & 0xE0) == 0xC0) {
-                // 2-byte sequence: 110xxxxx 10xxxxxx
-                if (pos + 1 >= end_pos)
-                    return false;
-                unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
-                if ((c2 & 0xC0) != 0x80)
-                    return false;
-                // Check for overlong encoding
-                if (c < 0xC2)
-                    return false;
-                pos += 1;
-            } else if ((c & 0xF0) == 0xE0) {
-                // 3-byte sequence: 1110xxxx 10xxxxxx 10xxxxxx
-                if (pos + 2 >= end_pos)
-                    return false;
-                unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
-                unsigned char c3 = static_cast<unsigned char>(data[pos + 2]);
-                if ((c2 & 0xC0) != 0x80 || (c3 & 0xC0) != 0x80)
-                    return false;
-                // Check for overlong encodings and surrogates
-                if (c == 0xE0 && c2 < 0xA0)
-                    return false;  // Overlong
-                if (c == 0xED && c2 >= 0xA0)
-                    return false;  // Surrogate
-                pos += 2;
-            } else if ((c & 0xF8) == 0xF0) {
-                // 4-byte sequence: 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-                if (pos + 3 >= end_pos)
-                    return false;
-                unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
-                unsigned char c3 = static_cast<unsigned char>(data[pos + 2]);
-                unsigned char c4 = static_cast<unsigned char>(data[pos + 3]);
-                if ((c2 & 0xC0) != 0x80 || (c3 & 0xC0) != 0x80 || (c4 & 0xC0) != 0x80)
-                    return false;
-                // Check for overlong and out-of-range
-                if (c == 0xF0 && c2 < 0x90)
-                    return false;  // Overlong
-                if (c == 0xF4 && c2 >= 0x90)
-                    return false;  // > U+10FFFF
-                if (c > 0xF4)
-                    return false;  // > U+10FFFF
-                pos += 3;
-            } else {
-                // Invalid UTF-8
-                return false;
-            }
+static auto validate_number_chars_avx2(std::span<const char> data, size_t start_pos, size_t end_pos)
+    -> bool {
+    for (size_t pos = start_pos; pos < end_pos; ++pos) {
+        char c = data[pos];
+        if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
+            return false;
         }
-        continue;
     }
+    return true;
+}
+
+static auto match_literal_sse2(std::span<const char> data, size_t pos, const char* literal,
+                               size_t len) -> bool {
+    if (pos + len > data.size()) {
+        return false;
+    }
+    return std::memcmp(data.data() + pos, literal, len) == 0;
+}
+
+#endif
+
+// ============================================================================
+// Kernel Dispatch Table
+// ============================================================================
+// The hot scanning kernels were selected by if-chains over g_config and
+// g_simd_caps on every call; on the small-payload path those branches sit in
+// the parser's innermost loops and pollute the predictor. Resolve each kernel
+// once into a per-thread function-pointer table instead (g_config is
+// thread_local, so resolution must be too); set_parse_config re-resolves.
+
+// Scalar UTF-8 validation fallback
+static auto validate_utf8_scalar(std::span<const char> data, size_t start_pos, size_t end_pos)
+    -> bool {
+    size_t pos = start_pos;
 
-    // Scalar validation for remaining bytes
     while (pos < end_pos) {
         unsigned char c = static_cast<unsigned char>(data[pos]);
 
         if (c < 0x80) {
-            // ASCII
             pos++;
         } else if ((c & 0xE0) == 0xC0) {
-            // 2-byte sequence
             if (pos + 1 >= end_pos)
                 return false;
             unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
-            if ((c2 & 0xC0) != 0x80)
+            if ((c2 & 0xC0) != 0x80 || c < 0xC2)
                 return false;
-            if (c < 0xC2)
-                return false;  // Overlong
             pos += 2;
         } else if ((c & 0xF0) == 0xE0) {
-            // 3-byte sequence
             if (pos + 2 >= end_pos)
                 return false;
             unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
@@ -978,12 +2384,11 @@ __attribute__((target("avx2"))) static auto validate_utf8_avx2(std::span<const c
             if ((c2 & 0xC0) != 0x80 || (c3 & 0xC0) != 0x80)
                 return false;
             if (c == 0xE0 && c2 < 0xA0)
-                return false;  // Overlong
+                return false;
             if (c == 0xED && c2 >= 0xA0)
-                return false;  // Surrogate
+                return false;
             pos += 3;
         } else if ((c & 0xF8) == 0xF0) {
-            // 4-byte sequence
             if (pos + 3 >= end_pos)
                 return false;
             unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
@@ -992,11 +2397,11 @@ __attribute__((target("avx2"))) static auto validate_utf8_avx2(std::span<const c
             if ((c2 & 0xC0) != 0x80 || (c3 & 0xC0) != 0x80 || (c4 & 0xC0) != 0x80)
                 return false;
             if (c == 0xF0 && c2 < 0x90)
-                return false;  // Overlong
+                return false;
             if (c == 0xF4 && c2 >= 0x90)
-                return false;  // > U+10FFFF
+                return false;
             if (c > 0xF4)
-                return false;  // > U+10FFFF
+                return false;
             pos += 4;
         } else {
             return false;
@@ -1006,61 +2411,8 @@ __attribute__((target("avx2"))) static auto validate_utf8_avx2(std::span<const c
     return true;
 }
 
-// Scalar UTF-8 validation fallback
-static auto validate_utf8_scalar(std::span<const char> data, size_t start_pos, size_t end_pos)
-    -> bool {
-    size_t pos = start_pos;
-
-    while (pos < end_pos) {
-        unsigned char c = static_cast<unsigned char>(data[pos]);
-
-        if (c < 0x80) {
-            pos++;
-        } else if ((c & 0xE0) == 0xC0) {
-            if (pos + 1 >= end_pos)
-                return false;
-            unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
-            if ((c2 & 0xC0) != 0x80 || c < 0xC2)
-                return false;
-            pos += 2;
-        } else if ((c & 0xF0) == 0xE0) {
-            if (pos + 2 >= end_pos)
-                return false;
-            unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
-            unsigned char c3 = static_cast<unsigned char>(data[pos + 2]);
-            if ((c2 & 0xC0) != 0x80 || (c3 & 0xC0) != 0x80)
-                return false;
-            if (c == 0xE0 && c2 < 0xA0)
-                return false;
-            if (c == 0xED && c2 >= 0xA0)
-                return false;
-            pos += 3;
-        } else if ((c & 0xF8) == 0xF0) {
-            if (pos + 3 >= end_pos)
-                return false;
-            unsigned char c2 = static_cast<unsigned char>(data[pos + 1]);
-            unsigned char c3 = static_cast<unsigned char>(data[pos + 2]);
-            unsigned char c4 = static_cast<unsigned char>(data[pos + 3]);
-            if ((c2 & 0xC0) != 0x80 || (c3 & 0xC0) != 0x80 || (c4 & 0xC0) != 0x80)
-                return false;
-            if (c == 0xF0 && c2 < 0x90)
-                return false;
-            if (c == 0xF4 && c2 >= 0x90)
-                return false;
-            if (c > 0xF4)
-                return false;
-            pos += 4;
-        } else {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-#else  // Non-x86 platforms
-
-static auto skip_whitespace_simd(std::span<const char> data, size_t start_pos) -> size_t {
+// Scalar fallbacks shared by every build so the table always has a target
+static auto skip_whitespace_scalar(std::span<const char> data, size_t start_pos) -> size_t {
     size_t pos = start_pos;
     while (pos < data.size()
            && (data[pos] == ' ' || data[pos] == '\t' || data[pos] == '\n' || data[pos] == '\r')) {
@@ -1069,7 +2421,7 @@ static auto skip_whitespace_simd(std::span<const char> data, size_t start_pos) -
     return pos;
 }
 
-static auto find_string_end_avx2(std::span<const char> data, size_t start_pos) -> size_t {
+static auto find_string_end_scalar(std::span<const char> data, size_t start_pos) -> size_t {
     size_t pos = start_pos;
     while (pos < data.size()) {
         char c = data[pos];
@@ -1081,34 +2433,627 @@ static auto find_string_end_avx2(std::span<const char> data, size_t start_pos) -
     return pos;
 }
 
-static auto validate_number_chars_avx2(std::span<const char> data, size_t start_pos, size_t end_pos)
-    -> bool {
-    for (size_t pos = start_pos; pos < end_pos; ++pos) {
+static auto match_literal_scalar(std::span<const char> data, size_t pos, const char* literal,
+                                 size_t len) -> bool {
+    if (pos + len > data.size()) {
+        return false;
+    }
+    return std::memcmp(data.data() + pos, literal, len) == 0;
+}
+
+static auto flat_key_scan_scalar(const char* prefixes, size_t entry_count, const char* probe,
+                                 size_t from) -> size_t {
+    for (size_t i = from; i < entry_count; ++i) {
+        if (std::memcmp(prefixes + i * 16, probe, 16) == 0) {
+            return i;
+        }
+    }
+    return entry_count;
+}
+
+static auto find_closing_quote_scalar(std::span<const char> data, size_t start_pos,
+                                      bool& saw_escape) -> size_t {
+    size_t pos = start_pos;
+    bool escape_next = false;
+    while (pos < data.size()) {
         char c = data[pos];
-        if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
-            return false;
+        if (escape_next) {
+            escape_next = false;
+        } else if (c == '\\') {
+            saw_escape = true;
+            escape_next = true;
+        } else if (c == '"' || static_cast<unsigned char>(c) < 0x20) {
+            return pos;
         }
+        pos++;
     }
-    return true;
+    return pos;
 }
 
-static auto match_literal_sse2(std::span<const char> data, size_t pos, const char* literal,
-                               size_t len) -> bool {
-    if (pos + len > data.size()) {
+// ============================================================================
+// Hot-Path Performance Counters (FASTJSON_PERF_COUNTERS)
+// ============================================================================
+// Opt-in build-time instrumentation for attributing cost to parse phases
+// without attaching perf externally. With the macro off (the default) every
+// probe expands to nothing, so the dispatched wrappers below are identical to
+// the uninstrumented build. With it on, each kernel wrapper records an
+// invocation count plus a log2 cycle histogram (rdtscp), and parse() samples
+// cache misses and branch misses through perf_event_open around the whole
+// document. perf_counters_snapshot() exports everything as JSON; both entry
+// points exist in every build so callers need no #ifdefs of their own.
+
+#if defined(FASTJSON_PERF_COUNTERS)
+
+namespace perf {
+
+enum class probe : size_t {
+    skip_whitespace = 0,
+    find_string_end,
+    find_closing_quote,
+    match_literal,
+    flat_key_scan,
+    parse_document,
+    count
+};
+
+inline constexpr const char* probe_names[] = {
+    "skip_whitespace", "find_string_end", "find_closing_quote",
+    "match_literal",   "flat_key_scan",   "parse_document"};
+
+struct probe_stat {
+    uint64_t calls = 0;
+    uint64_t total_cycles = 0;
+    std::array<uint64_t, 32> cycle_hist{};  // Bucket i counts durations in [2^i, 2^(i+1))
+};
+
+inline auto cycle_now() -> uint64_t {
+#if defined(__x86_64__) || defined(_M_X64)
+    unsigned int aux = 0;
+    return __rdtscp(&aux);
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// Per-thread hardware counter pair, opened lazily and reused by every parse
+// on the thread. Open failure (no perf permissions, no PMU in the container)
+// just zeroes the hardware rows in the snapshot.
+struct hw_counters {
+    int cache_fd = -1;
+    int branch_fd = -1;
+    bool tried = false;
+
+    static auto open_counter(uint64_t config) -> int {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+        (void)config;
+        return -1;
+#endif
+    }
+
+    auto ensure_open() -> void {
+        if (tried) {
+            return;
+        }
+        tried = true;
+#if defined(__linux__)
+        cache_fd = open_counter(PERF_COUNT_HW_CACHE_MISSES);
+        branch_fd = open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+    }
+
+    ~hw_counters() {
+#if defined(__linux__)
+        if (cache_fd >= 0) close(cache_fd);
+        if (branch_fd >= 0) close(branch_fd);
+#endif
+    }
+};
+
+struct counters {
+    std::array<probe_stat, static_cast<size_t>(probe::count)> probes{};
+    uint64_t cache_misses = 0;
+    uint64_t branch_misses = 0;
+    hw_counters hw;
+};
+
+inline thread_local counters g_counters;
+
+struct scoped_probe {
+    probe id;
+    uint64_t start;
+    explicit scoped_probe(probe p) : id(p), start(cycle_now()) {}
+    ~scoped_probe() {
+        uint64_t cycles = cycle_now() - start;
+        auto& stat = g_counters.probes[static_cast<size_t>(id)];
+        stat.calls++;
+        stat.total_cycles += cycles;
+        int bucket = 63 - std::countl_zero(cycles | 1);
+        stat.cycle_hist[static_cast<size_t>(std::min(bucket, 31))]++;
+    }
+};
+
+// Wraps one document parse: enables the counters on entry, accumulates on
+// exit (destructors run in reverse order, so this closes after the probe)
+struct scoped_hw_sample {
+    scoped_hw_sample() {
+        g_counters.hw.ensure_open();
+#if defined(__linux__)
+        for (int fd : {g_counters.hw.cache_fd, g_counters.hw.branch_fd}) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+    ~scoped_hw_sample() {
+#if defined(__linux__)
+        auto accumulate = [](int fd, uint64_t& total) {
+            if (fd < 0) {
+                return;
+            }
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            uint64_t value = 0;
+            if (read(fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+                total += value;
+            }
+        };
+        accumulate(g_counters.hw.cache_fd, g_counters.cache_misses);
+        accumulate(g_counters.hw.branch_fd, g_counters.branch_misses);
+#endif
+    }
+};
+
+}  // namespace perf
+
+    #define FASTJSON_PERF_SCOPE(id) perf::scoped_probe fastjson_perf_scope_ { perf::probe::id }
+    #define FASTJSON_PERF_HW_SAMPLE() perf::scoped_hw_sample fastjson_perf_hw_
+#else
+    #define FASTJSON_PERF_SCOPE(id)
+    #define FASTJSON_PERF_HW_SAMPLE()
+#endif  // FASTJSON_PERF_COUNTERS
+
+// Clears this thread's counters (e.g. between measurement windows)
+export auto perf_counters_reset() -> void {
+#if defined(FASTJSON_PERF_COUNTERS)
+    for (auto& stat : perf::g_counters.probes) {
+        stat = {};
+    }
+    perf::g_counters.cache_misses = 0;
+    perf::g_counters.branch_misses = 0;
+#endif
+}
+
+// JSON snapshot of this thread's counters; {"enabled":false} in builds
+// without FASTJSON_PERF_COUNTERS
+export auto perf_counters_snapshot() -> std::string {
+#if defined(FASTJSON_PERF_COUNTERS)
+    const auto& c = perf::g_counters;
+    std::string out = "{\"enabled\":true,\"probes\":[";
+    for (size_t i = 0; i < static_cast<size_t>(perf::probe::count); ++i) {
+        const auto& stat = c.probes[i];
+        if (i) out += ',';
+        out += "{\"name\":\"";
+        out += perf::probe_names[i];
+        out += "\",\"calls\":" + std::to_string(stat.calls);
+        out += ",\"total_cycles\":" + std::to_string(stat.total_cycles);
+        out += ",\"cycle_hist_log2\":[";
+        for (size_t b = 0; b < stat.cycle_hist.size(); ++b) {
+            if (b) out += ',';
+            out += std::to_string(stat.cycle_hist[b]);
+        }
+        out += "]}";
+    }
+    out += "],\"cache_misses\":" + std::to_string(c.cache_misses);
+    out += ",\"branch_misses\":" + std::to_string(c.branch_misses);
+    out += ",\"hw_counters_available\":";
+    out += (c.hw.cache_fd >= 0 ? "true" : "false");
+    out += "}";
+    return out;
+#else
+    return "{\"enabled\":false}";
+#endif
+}
+
+// ============================================================================
+// Sampling Trace Facility (FASTJSON_TRACE)
+// ============================================================================
+// Answers "where did this one slow parse go?" without an instrumentation
+// rebuild cycle: builds with FASTJSON_TRACE record phase-boundary events
+// (pre-scan, string decode, number parse, container build, whole document)
+// into fixed per-thread ring buffers - no allocation, no locks on the record
+// path, oldest events overwritten - and trace_dump() writes them out in
+// chrome://tracing JSON for the about:tracing / Perfetto viewers. Without the
+// macro every probe expands to nothing; the dump entry points exist in every
+// build and simply report the facility as disabled.
+
+#if defined(FASTJSON_TRACE)
+
+namespace trace {
+
+enum class phase : uint8_t {
+    stage1_scan = 0,
+    string_decode,
+    number_parse,
+    container_build,
+    document,
+    count
+};
+
+inline constexpr const char* phase_names[] = {"stage1_scan", "string_decode", "number_parse",
+                                              "container_build", "document"};
+
+// 16 bytes/event, 64K events/thread: ~1 MB per recording thread, enough to
+// hold the tail of a multi-hundred-millisecond parse
+struct event {
+    uint64_t start_ns;
+    uint32_t duration_ns;  // Saturated; single events >4s are not a tracing shape
+    uint8_t id;
+    uint8_t padding[3];
+};
+
+inline constexpr size_t ring_capacity = 1 << 16;
+
+struct ring {
+    std::array<event, ring_capacity> events{};
+    size_t head = 0;        // Next write slot
+    uint64_t recorded = 0;  // Total events ever written (wrap detection)
+    uint32_t thread_tag = 0;
+};
+
+// Dump-time registry of every thread's ring. shared_ptr keeps rings readable
+// after their threads exit; recording itself never touches the mutex.
+inline std::mutex g_ring_registry_mutex;
+inline std::vector<std::shared_ptr<ring>> g_ring_registry;
+
+inline auto local_ring() -> ring& {
+    thread_local std::shared_ptr<ring> r = [] {
+        auto created = std::make_shared<ring>();
+        std::lock_guard lock(g_ring_registry_mutex);
+        created->thread_tag = static_cast<uint32_t>(g_ring_registry.size() + 1);
+        g_ring_registry.push_back(created);
+        return created;
+    }();
+    return *r;
+}
+
+inline auto now_ns() -> uint64_t {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+struct scoped_trace {
+    phase id;
+    uint64_t start;
+    explicit scoped_trace(phase p) : id(p), start(now_ns()) {}
+    ~scoped_trace() {
+        uint64_t duration = now_ns() - start;
+        ring& r = local_ring();
+        event& e = r.events[r.head];
+        e.start_ns = start;
+        e.duration_ns = static_cast<uint32_t>(
+            std::min<uint64_t>(duration, std::numeric_limits<uint32_t>::max()));
+        e.id = static_cast<uint8_t>(id);
+        r.head = (r.head + 1) % ring_capacity;
+        r.recorded++;
+    }
+};
+
+}  // namespace trace
+
+    #define FASTJSON_TRACE_SCOPE(p) trace::scoped_trace fastjson_trace_scope_ { trace::phase::p }
+#else
+    #define FASTJSON_TRACE_SCOPE(p)
+#endif  // FASTJSON_TRACE
+
+// Writes every thread's recorded events to `path` in chrome://tracing JSON
+// ("traceEvents" with complete "X" events, microsecond timestamps). Call it
+// after the parse of interest has finished - recording threads still running
+// can tear the events they are concurrently overwriting. Returns false when
+// tracing is compiled out or the file cannot be written.
+export auto trace_dump(const std::string& path) -> bool {
+#if defined(FASTJSON_TRACE)
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (file == nullptr) {
         return false;
     }
-    return std::memcmp(data.data() + pos, literal, len) == 0;
+
+    std::fputs("{\"traceEvents\":[", file);
+    bool first = true;
+    std::lock_guard lock(trace::g_ring_registry_mutex);
+    for (const auto& r : trace::g_ring_registry) {
+        size_t count = static_cast<size_t>(
+            std::min<uint64_t>(r->recorded, trace::ring_capacity));
+        // Oldest surviving event first
+        size_t start = r->recorded > trace::ring_capacity ? r->head : 0;
+        for (size_t i = 0; i < count; ++i) {
+            const trace::event& e = r->events[(start + i) % trace::ring_capacity];
+            std::fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                               "\"pid\":1,\"tid\":%u}",
+                         first ? "" : ",", trace::phase_names[e.id],
+                         static_cast<double>(e.start_ns) / 1000.0,
+                         static_cast<double>(e.duration_ns) / 1000.0, r->thread_tag);
+            first = false;
+        }
+    }
+    std::fputs("]}\n", file);
+    return std::fclose(file) == 0;
+#else
+    (void)path;
+    return false;
+#endif
 }
 
+// Drops all recorded events (every thread's ring)
+export auto trace_clear() -> void {
+#if defined(FASTJSON_TRACE)
+    std::lock_guard lock(trace::g_ring_registry_mutex);
+    for (const auto& r : trace::g_ring_registry) {
+        r->head = 0;
+        r->recorded = 0;
+    }
+#endif
+}
+
+struct kernel_table {
+    size_t (*skip_whitespace)(std::span<const char>, size_t) = skip_whitespace_scalar;
+    size_t (*find_string_end)(std::span<const char>, size_t) = find_string_end_scalar;
+    size_t (*find_closing_quote)(std::span<const char>, size_t, bool&) =
+        find_closing_quote_scalar;
+    bool (*match_literal)(std::span<const char>, size_t, const char*, size_t) =
+        match_literal_scalar;
+    bool (*validate_utf8)(std::span<const char>, size_t, size_t) = validate_utf8_scalar;
+    size_t (*flat_key_scan)(const char*, size_t, const char*, size_t) = flat_key_scan_scalar;
+};
+
+static auto resolve_kernel_table() -> kernel_table {
+    kernel_table table;
+    if (!g_config.enable_simd) {
+        return table;
+    }
+
+#if defined(__x86_64__) || defined(_M_X64)
+    if (g_config.enable_avx512 && g_simd_caps.avx512f && g_simd_caps.avx512bw) {
+        table.skip_whitespace = skip_whitespace_avx512;
+    } else if (g_config.enable_avx2 && g_simd_caps.avx2) {
+        table.skip_whitespace = skip_whitespace_avx2;
+    } else if (g_config.enable_sse42 && g_simd_caps.sse2) {
+        table.skip_whitespace = skip_whitespace_sse2;
+    }
+    if (g_config.enable_avx2 && g_simd_caps.avx2) {
+        table.find_string_end = find_string_end_avx2;
+        table.validate_utf8 = validate_utf8_avx2;
+    }
+    if (g_config.enable_avx512 && g_simd_caps.avx512f && g_simd_caps.avx512bw) {
+        table.find_closing_quote = find_closing_quote_avx512;
+    } else if (g_config.enable_avx2 && g_simd_caps.avx2) {
+        table.find_closing_quote = find_closing_quote_avx2;
+    }
+    if (g_simd_caps.sse2) {
+        table.match_literal = match_literal_sse2;
+    }
+    if (g_config.enable_avx2 && g_simd_caps.avx2) {
+        table.flat_key_scan = flat_key_scan_avx2;
+    } else if (g_simd_caps.sse2) {
+        table.flat_key_scan = flat_key_scan_sse2;
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (g_config.enable_neon && g_simd_caps.neon) {
+        table.skip_whitespace = skip_whitespace_neon;
+        table.find_string_end = find_string_end_neon;
+        table.find_closing_quote = find_closing_quote_neon;
+    }
+    #ifdef __ARM_FEATURE_SVE
+    // SVE beats fixed 128-bit NEON when the hardware has it: wider vectors
+    // on server cores and predicated loads instead of scalar tail handling
+    if (g_config.enable_sve && g_simd_caps.sve) {
+        table.skip_whitespace = skip_whitespace_sve;
+        table.find_string_end = find_string_end_sve;
+        table.match_literal = match_literal_sve;
+    }
+    #endif
 #endif
 
+    return table;
+}
+
+static thread_local kernel_table g_kernels = resolve_kernel_table();
+
+static auto refresh_kernel_table() -> void {
+    g_kernels = resolve_kernel_table();
+}
+
+// Thin wrappers keep the historical call-site names; each is now a single
+// indirect call through the resolved table
+static auto skip_whitespace_simd(std::span<const char> data, size_t start_pos) -> size_t {
+    FASTJSON_PERF_SCOPE(skip_whitespace);
+    return g_kernels.skip_whitespace(data, start_pos);
+}
+
+static auto match_literal_simd(std::span<const char> data, size_t pos, const char* literal,
+                               size_t len) -> bool {
+    FASTJSON_PERF_SCOPE(match_literal);
+    return g_kernels.match_literal(data, pos, literal, len);
+}
+
+namespace detail {
+
+
+// Dispatch to the best string-end scanner for this build/CPU
+inline auto find_string_end_dispatch(std::span<const char> data, size_t pos) -> size_t {
+    FASTJSON_PERF_SCOPE(find_string_end);
+    return g_kernels.find_string_end(data, pos);
+}
+
+// Closing-quote extent scan: unlike find_string_end_dispatch this does not
+// stop at backslashes - escaped quotes are resolved in-vector
+inline auto find_closing_quote(std::span<const char> data, size_t pos, bool& saw_escape)
+    -> size_t {
+    FASTJSON_PERF_SCOPE(find_closing_quote);
+    return g_kernels.find_closing_quote(data, pos, saw_escape);
+}
+
+// Out-of-line definition for the declaration next to flat_json_object: the
+// class is complete long before g_kernels exists, so the dispatch lands here
+auto flat_key_prefix_scan(const char* prefixes, size_t entry_count, const char* probe,
+                          size_t from) -> size_t {
+    FASTJSON_PERF_SCOPE(flat_key_scan);
+    return g_kernels.flat_key_scan(prefixes, entry_count, probe, from);
+}
+
+// ============================================================================
+// Key Interning Pool
+// ============================================================================
+// Arrays of records repeat the same handful of object keys millions of times;
+// each repeat used to pay the full parse_string path (copy, escape handling,
+// UTF-8 validation). The pool canonicalizes escape-free keys by raw span so
+// every repeat after the first is a single hash lookup. Per-thread: parallel
+// object workers each keep their own pool, no synchronization needed.
+
+class key_intern_pool {
+public:
+    // Returns the canonical string for a raw (escape-free, already-validated
+    // span between quotes) key.
+    auto intern(std::string_view raw) -> const std::string& {
+        if (keys_.size() >= g_config.intern_pool_max_keys) {
+            keys_.clear();  // Pathological input with unbounded unique keys
+        }
+        auto it = keys_.find(raw);
+        if (it != keys_.end()) {
+            return *it;
+        }
+        return *keys_.emplace(raw).first;
+    }
+
+private:
+    // Transparent hashing so lookups by raw span never allocate
+    struct sv_hash {
+        using is_transparent = void;
+        auto operator()(std::string_view s) const noexcept -> size_t {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
+    std::unordered_set<std::string, sv_hash, std::equal_to<>> keys_;
+};
+
+inline thread_local key_intern_pool g_key_pool;
+
+// ============================================================================
+// Thread-Local Scratch Arena
+// ============================================================================
+// Per-worker grow-only bump allocator for parser temporaries. The parallel
+// container parsers construct a parser per element, and every string that
+// element contains stages its unescape output through a freshly allocated
+// buffer - under load that is one malloc/free pair per value, all threads
+// hammering the same allocator. Routing the scratch through a thread-local
+// arena turns those into pointer bumps: blocks come from the thread's NUMA
+// allocator (numa::get_thread_local_allocator), so scratch pages fault on the
+// worker's own node, and reset() rewinds between elements without releasing
+// anything. Capacity is grow-only for the life of the thread, sized by the
+// largest element it has seen; buffers handed out before a rewind stay
+// mapped, so a recycled pmr string may safely keep its capacity across one
+// (it clears before reuse).
+
+class scratch_arena : public std::pmr::memory_resource {
+public:
+    scratch_arena() : upstream_(numa::get_thread_local_allocator()) {}
+
+    ~scratch_arena() override {
+        for (auto& b : blocks_) {
+            upstream_.deallocate(b.data, b.size);
+        }
+    }
+
+    scratch_arena(const scratch_arena&) = delete;
+    scratch_arena& operator=(const scratch_arena&) = delete;
+
+    // Rewind to empty, keeping every block for reuse
+    auto reset() -> void {
+        current_ = 0;
+        used_ = 0;
+    }
+
+private:
+    struct block {
+        char* data;
+        size_t size;
+    };
+
+    static constexpr size_t min_block_size = 4096;
+
+    auto do_allocate(size_t bytes, size_t alignment) -> void* override {
+        // Bump through the retained chain first; only touch the upstream
+        // allocator when the whole chain is exhausted
+        while (current_ < blocks_.size()) {
+            block& b = blocks_[current_];
+            size_t aligned = (used_ + alignment - 1) & ~(alignment - 1);
+            if (aligned + bytes <= b.size) {
+                used_ = aligned + bytes;
+                return b.data + aligned;
+            }
+            ++current_;
+            used_ = 0;
+        }
+
+        size_t block_size =
+            std::max(bytes, blocks_.empty() ? min_block_size : blocks_.back().size * 2);
+        char* data = static_cast<char*>(upstream_.allocate_local(block_size));
+        if (data == nullptr) {
+            throw std::bad_alloc{};
+        }
+        blocks_.push_back({data, block_size});
+        current_ = blocks_.size() - 1;
+        used_ = bytes;
+        return data;
+    }
+
+    auto do_deallocate(void*, size_t, size_t) -> void override {
+        // Individual frees are no-ops; reset() reclaims wholesale
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+        return this == &other;
+    }
+
+    // Bound during construction so the thread-local allocator outlives the
+    // thread-local arena (reverse destruction order at thread exit)
+    numa::numa_allocator& upstream_;
+    std::vector<block> blocks_;
+    size_t current_ = 0;
+    size_t used_ = 0;
+};
+
+inline auto thread_scratch_arena() -> scratch_arena& {
+    static thread_local scratch_arena arena;
+    return arena;
+}
+
+}  // namespace detail
+
 // ============================================================================
 // Parser Implementation
 // ============================================================================
 
 class parser {
 public:
+    parser() = default;
     parser(std::string_view input);
+
+    // Rebind the parser to a new document while keeping grown scratch
+    // buffers, so a reused parser stops paying per-document allocator churn
+    auto reset(std::string_view input) -> void;
+
     auto parse() -> json_result<json_value>;
 
 private:
@@ -1121,31 +3066,47 @@ private:
     auto parse_array_parallel(size_t estimated_size) -> json_result<json_value>;
     auto parse_object() -> json_result<json_value>;
     auto parse_object_parallel(size_t estimated_size) -> json_result<json_value>;
+    auto parse_object_key() -> json_result<std::string>;
+    auto parse_value_iterative() -> json_result<json_value>;
 
     auto skip_whitespace() -> void;
     auto peek() const noexcept -> char;
     auto advance() noexcept -> char;
     auto match(char expected) noexcept -> bool;
     auto is_at_end() const noexcept -> bool;
-    auto make_error(json_error_code code, std::string message) const -> json_error;
+    auto make_error(json_error_code code, const char* message) const -> json_error;
     auto current_ptr() const noexcept -> const char*;
 
     std::string_view input_;
-    size_t pos_;
-    size_t line_;
-    size_t column_;
-    size_t depth_;
+    size_t pos_{0};
+    size_t line_{1};
+    size_t column_{1};
+    size_t depth_{0};
+    // Recycled across parse_string calls and reset(); storage bump-allocates
+    // from the constructing thread's scratch arena, so the per-element parsers
+    // of the parallel container paths never touch the global allocator for it
+    std::pmr::string string_scratch_{&detail::thread_scratch_arena()};
 };
 
 parser::parser(std::string_view input) : input_(input), pos_(0), line_(1), column_(1), depth_(0) {}
 
+auto parser::reset(std::string_view input) -> void {
+    input_ = input;
+    pos_ = 0;
+    line_ = 1;
+    column_ = 1;
+    depth_ = 0;
+    // string_scratch_ intentionally keeps its capacity
+}
+
 auto parser::parse() -> json_result<json_value> {
+    FASTJSON_TRACE_SCOPE(document);
     skip_whitespace();
     if (is_at_end()) {
         return std::unexpected(make_error(json_error_code::empty_input, "Empty input"));
     }
 
-    auto result = parse_value();
+    auto result = g_config.use_iterative_parser ? parse_value_iterative() : parse_value();
     if (!result) {
         return result;
     }
@@ -1195,8 +3156,8 @@ auto parser::is_at_end() const noexcept -> bool {
     return pos_ >= input_.size();
 }
 
-auto parser::make_error(json_error_code code, std::string message) const -> json_error {
-    return json_error{code, std::move(message), line_, column_};
+auto parser::make_error(json_error_code code, const char* message) const -> json_error {
+    return json_error{code, message, line_, column_};
 }
 
 auto parser::parse_value() -> json_result<json_value> {
@@ -1240,14 +3201,14 @@ auto parser::parse_value() -> json_result<json_value> {
             return parse_number();
         default:
             return std::unexpected(make_error(json_error_code::invalid_syntax,
-                                              "Unexpected character: " + std::string(1, c)));
+                                              "Unexpected character"));
     }
 }
 
 auto parser::parse_null() -> json_result<json_value> {
     // SIMD literal matching for "null"
     if (g_config.enable_simd && g_config.enable_sse42 && g_simd_caps.sse2) {
-        if (match_literal_sse2(input_, pos_, "null", 4)) {
+        if (match_literal_simd(input_, pos_, "null", 4)) {
             pos_ += 4;
             return json_value{};
         }
@@ -1267,14 +3228,14 @@ auto parser::parse_boolean() -> json_result<json_value> {
     // SIMD literal matching for "true" and "false"
     if (g_config.enable_simd && g_config.enable_sse42 && g_simd_caps.sse2) {
         if (peek() == 't') {
-            if (match_literal_sse2(input_, pos_, "true", 4)) {
+            if (match_literal_simd(input_, pos_, "true", 4)) {
                 pos_ += 4;
                 return json_value{true};
             }
             return std::unexpected(
                 make_error(json_error_code::invalid_literal, "Invalid true literal"));
         } else if (peek() == 'f') {
-            if (match_literal_sse2(input_, pos_, "false", 5)) {
+            if (match_literal_simd(input_, pos_, "false", 5)) {
                 pos_ += 5;
                 return json_value{false};
             }
@@ -1303,7 +3264,20 @@ auto parser::parse_boolean() -> json_result<json_value> {
     return std::unexpected(make_error(json_error_code::invalid_literal, "Invalid boolean literal"));
 }
 
+// SWAR 8-digit parse (SIMD within a 64-bit register): three multiply-shift
+// steps combine eight ASCII digits into a uint32_t, no per-digit loop and no
+// arch-specific intrinsics. The caller guarantees the eight bytes are digits
+// (the number grammar was already validated).
+static inline auto parse_eight_digits_swar(const char* chars) -> uint32_t {
+    uint64_t val;
+    std::memcpy(&val, chars, sizeof(val));
+    val = (val & 0x0F0F0F0F0F0F0F0FULL) * 2561 >> 8;
+    val = (val & 0x00FF00FF00FF00FFULL) * 6553601 >> 16;
+    return static_cast<uint32_t>((val & 0x0000FFFF0000FFFFULL) * 42949672960001ULL >> 32);
+}
+
 auto parser::parse_number() -> json_result<json_value> {
+    FASTJSON_TRACE_SCOPE(number_parse);
     size_t start_pos = pos_;
     bool is_negative = false;
     bool has_decimal = false;
@@ -1352,24 +3326,42 @@ auto parser::parse_number() -> json_result<json_value> {
     std::string_view number_str = input_.substr(start_pos, pos_ - start_pos);
     size_t length = pos_ - start_pos;
 
+    // Lazy mode: the grammar above already validated the token; capture it
+    // and defer precision selection to first access
+    if (g_config.lazy_numbers) {
+        return json_value{json_raw_number{std::string(number_str)}};
+    }
+
     // For pure integers (no decimal/exponent), parse as 128-bit integer
     if (!has_decimal && !has_exponent) {
-        // Try parsing as 128-bit integer
-        thread_local std::array<char, 128> int_buffer;
-        size_t int_len = std::min(length, int_buffer.size() - 1);
-        std::memcpy(int_buffer.data(), input_.data() + start_pos, int_len);
-        int_buffer[int_len] = '\0';
-
-        // Parse manually for 128-bit
-        const char* p = int_buffer.data();
+        const char* p = input_.data() + start_pos;
+        const char* end = input_.data() + pos_;
         bool neg = (*p == '-');
         if (neg) p++;
 
+        // Fast path: up to 19 digits always fits uint64_t (max 9.99e18);
+        // consume 8 digits per SWAR step instead of one per iteration
+        if (static_cast<size_t>(end - p) <= 19) {
+            uint64_t magnitude = 0;
+            while (end - p >= 8) {
+                magnitude = magnitude * 100000000ULL + parse_eight_digits_swar(p);
+                p += 8;
+            }
+            while (p < end) {
+                magnitude = magnitude * 10 + static_cast<uint64_t>(*p++ - '0');
+            }
+            if (neg) {
+                return json_value{-static_cast<__int128>(magnitude)};
+            }
+            return json_value{static_cast<__int128>(magnitude)};
+        }
+
+        // 20+ digits: fall back to 128-bit accumulation with overflow check
         unsigned __int128 result = 0;
         bool overflow = false;
-        while (*p >= '0' && *p <= '9') {
+        while (p < end) {
             unsigned __int128 prev = result;
-            result = result * 10 + (*p - '0');
+            result = result * 10 + static_cast<unsigned>(*p - '0');
             if (result < prev) { overflow = true; break; }
             p++;
         }
@@ -1389,6 +3381,23 @@ auto parser::parse_number() -> json_result<json_value> {
         // On overflow (> 128 bits), fall through to double parsing (will lose precision)
     }
 
+    // Tier 1: FMA digit accumulation for short exponent-free decimals
+#if defined(__x86_64__) || defined(_M_X64)
+    if (g_config.enable_simd && g_simd_caps.fma && g_simd_caps.avx2) {
+        if (auto fast = parse_number_fma(number_str)) {
+            return json_value{*fast};
+        }
+    }
+#endif
+
+    // Tier 2: Eisel-Lemire 128-bit path; correctly rounded for any mantissa
+    // up to 19 digits with a decimal exponent in [-342, 308]
+    if (auto fast = fastjson::numbers::parse_double(number_str)) {
+        return json_value{*fast};
+    }
+
+    // Tier 3: strtod for the exotic leftovers (20+ digit mantissas,
+    // out-of-range exponents, ambiguous rounding)
     thread_local std::array<char, 64> buffer;
     size_t buf_len = std::min(length, buffer.size() - 1);
     std::memcpy(buffer.data(), input_.data() + start_pos, buf_len);
@@ -1406,233 +3415,49 @@ auto parser::parse_number() -> json_result<json_value> {
 }
 
 auto parser::parse_string() -> json_result<json_value> {
+    FASTJSON_TRACE_SCOPE(string_decode);
     if (!match('"')) {
         return std::unexpected(
             make_error(json_error_code::invalid_string, "Expected opening quote"));
     }
 
-    std::string value;
-    value.reserve(64);
-
-// Use SIMD to quickly scan for quotes, escapes, or control chars
-#if defined(__x86_64__) || defined(_M_X64)
-    if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
-        size_t string_start = pos_;
-
-        while (!is_at_end()) {
-            size_t special_pos = find_string_end_avx2(input_, pos_);
-#elif defined(__aarch64__) || defined(_M_ARM64)
-    if (g_config.enable_simd && g_config.enable_neon && g_simd_caps.neon) {
-        size_t string_start = pos_;
-
-        while (!is_at_end()) {
-            size_t special_pos = find_string_end_neon(input_, pos_);
-#else
-    if (false) {
-        size_t string_start = pos_;
-
-        while (!is_at_end()) {
-            size_t special_pos = pos_;  // Dummy
-#endif
-
-            // Copy all the normal characters at once
-            if (special_pos > pos_) {
-                value.append(input_.data() + pos_, special_pos - pos_);
-                pos_ = special_pos;
-            }
-
-            if (is_at_end()) {
-                break;
-            }
-
-            char c = peek();
-
-            if (c == '"') {
-                // Found end quote - validate UTF-8 before returning
-                advance();
-
-                // Validate UTF-8 encoding of the complete string
-                bool is_valid_utf8;
-#if defined(__x86_64__) || defined(_M_X64)
-                if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
-                    is_valid_utf8 = validate_utf8_avx2(
-                        std::span<const char>(value.data(), value.size()), 0, value.size());
-                } else {
-                    is_valid_utf8 = validate_utf8_scalar(
-                        std::span<const char>(value.data(), value.size()), 0, value.size());
-                }
-#elif defined(__aarch64__) || defined(_M_ARM64)
-                if (g_config.enable_simd && g_config.enable_neon && g_simd_caps.neon) {
-                    is_valid_utf8 = validate_utf8_neon(
-                        std::span<const char>(value.data(), value.size()), 0, value.size());
-                } else {
-                    is_valid_utf8 = validate_utf8_scalar(
-                        std::span<const char>(value.data(), value.size()), 0, value.size());
-                }
-#else
-                is_valid_utf8 = validate_utf8_scalar(
-                    std::span<const char>(value.data(), value.size()), 0, value.size());
-#endif
-
-                if (!is_valid_utf8) {
-                    return std::unexpected(make_error(json_error_code::invalid_string,
-                                                      "Invalid UTF-8 encoding in string"));
-                }
-
-                return json_value{std::move(value)};
-            } else if (c == '\\') {
-                // Handle escape sequence
-                advance();  // Skip backslash
-
-                if (is_at_end()) {
-                    return std::unexpected(make_error(json_error_code::invalid_string,
-                                                      "Unterminated escape sequence"));
-                }
-
-                char escaped = advance();
-                switch (escaped) {
-                    case '"':
-                        value += '"';
-                        break;
-                    case '\\':
-                        value += '\\';
-                        break;
-                    case '/':
-                        value += '/';
-                        break;
-                    case 'b':
-                        value += '\b';
-                        break;
-                    case 'f':
-                        value += '\f';
-                        break;
-                    case 'n':
-                        value += '\n';
-                        break;
-                    case 'r':
-                        value += '\r';
-                        break;
-                    case 't':
-                        value += '\t';
-                        break;
-                    case 'u': {
-                        // Use unicode module for proper UTF-16 surrogate pair handling
-                        size_t remaining = input_.size() - pos_;
-                        auto result = unicode::decode_json_unicode_escape(input_.data() + pos_,
-                                                                          remaining, value);
-
-                        if (!result.has_value()) {
-                            return std::unexpected(
-                                make_error(json_error_code::invalid_unicode, result.error()));
-                        }
-
-                        // Advance position by number of bytes consumed
-                        pos_ += result.value();
-                        break;
-                    }
-                    default:
-                        return std::unexpected(
-                            make_error(json_error_code::invalid_escape, "Invalid escape sequence"));
-                }
-            } else if (static_cast<unsigned char>(c) < 0x20) {
-                return std::unexpected(
-                    make_error(json_error_code::invalid_string, "Control character in string"));
-            }
-
-            if (value.size() > g_config.max_string_length) {
-                return std::unexpected(
-                    make_error(json_error_code::invalid_string, "String exceeds maximum length"));
-            }
-        }
-
-        return std::unexpected(make_error(json_error_code::invalid_string, "Unterminated string"));
+    // Build into the recycled scratch buffer: growth reallocations happen at
+    // most once per parser lifetime instead of once per string, and the final
+    // json_value copy allocates exactly the needed size
+    std::pmr::string& value = string_scratch_;
+    value.clear();
+    if (value.capacity() < 64) {
+        value.reserve(64);
     }
 
-    // Fallback: scalar string parsing
-    while (!is_at_end() && peek() != '"') {
-        char c = advance();
-
-        if (c == '\\') {
-            if (is_at_end()) {
-                return std::unexpected(
-                    make_error(json_error_code::invalid_string, "Unterminated escape sequence"));
-            }
-
-            char escaped = advance();
-            switch (escaped) {
-                case '"':
-                    value += '"';
-                    break;
-                case '\\':
-                    value += '\\';
-                    break;
-                case '/':
-                    value += '/';
-                    break;
-                case 'b':
-                    value += '\b';
-                    break;
-                case 'f':
-                    value += '\f';
-                    break;
-                case 'n':
-                    value += '\n';
-                    break;
-                case 'r':
-                    value += '\r';
-                    break;
-                case 't':
-                    value += '\t';
-                    break;
-                case 'u': {
-                    // Use unicode module for proper UTF-16 surrogate pair handling
-                    size_t remaining = input_.size() - pos_;
-                    auto result =
-                        unicode::decode_json_unicode_escape(input_.data() + pos_, remaining, value);
-
-                    if (!result.has_value()) {
-                        return std::unexpected(
-                            make_error(json_error_code::invalid_unicode, result.error()));
-                    }
+    // Vectorized unescape: bulk-copies clean runs, scalar only at escapes.
+    // The AVX2 path validates UTF-8 in the same pass.
+    bool utf8_validated = false;
+    auto end_pos = unescape_string_simd(input_, pos_, value, utf8_validated);
+    if (!end_pos) {
+        json_error err = end_pos.error();
+        err.line = line_;
+        err.column = column_;
+        return std::unexpected(err);
+    }
+    pos_ = *end_pos;
 
-                    // Advance position by number of bytes consumed
-                    pos_ += result.value();
-                    break;
-                }
-                default:
-                    return std::unexpected(
-                        make_error(json_error_code::invalid_escape, "Invalid escape sequence"));
-            }
-        } else if (static_cast<unsigned char>(c) < 0x20) {
-            return std::unexpected(
-                make_error(json_error_code::invalid_string, "Control character in string"));
-        } else {
-            value += c;
-        }
+    if (!utf8_validated) {
+        // Validate UTF-8 encoding of the complete string
+        bool is_valid_utf8 = g_kernels.validate_utf8(
+            std::span<const char>(value.data(), value.size()), 0, value.size());
 
-        if (value.size() > g_config.max_string_length) {
+        if (!is_valid_utf8) {
             return std::unexpected(
-                make_error(json_error_code::invalid_string, "String exceeds maximum length"));
+                make_error(json_error_code::invalid_string, "Invalid UTF-8 encoding in string"));
         }
     }
 
-    if (!match('"')) {
-        return std::unexpected(make_error(json_error_code::invalid_string, "Unterminated string"));
-    }
-
-    // Validate UTF-8 encoding of the complete string
-    bool is_valid_utf8 =
-        validate_utf8_scalar(std::span<const char>(value.data(), value.size()), 0, value.size());
-
-    if (!is_valid_utf8) {
-        return std::unexpected(
-            make_error(json_error_code::invalid_string, "Invalid UTF-8 encoding in string"));
-    }
-
-    return json_value{std::move(value)};
+    return json_value{std::string(value.data(), value.size())};
 }
 
 auto parser::parse_array() -> json_result<json_value> {
+    FASTJSON_TRACE_SCOPE(container_build);
     if (!match('[')) {
         return std::unexpected(make_error(json_error_code::invalid_syntax, "Expected '['"));
     }
@@ -1911,6 +3736,7 @@ parallel_parse:
                 element_input.remove_suffix(1);
             }
 
+            detail::thread_scratch_arena().reset();
             parser element_parser(element_input);
             auto result = element_parser.parse_value();
 
@@ -1942,61 +3768,82 @@ parallel_parse:
         }
     }
 
-#pragma omp parallel for schedule(dynamic) if (element_spans.size() >= 4)
-    for (size_t i = 0; i < element_spans.size(); ++i) {
-        // Bind thread to NUMA node on first iteration
-        if (g_config.enable_numa && g_config.bind_threads_to_numa
-            && g_numa_topo.is_numa_available) {
-#ifdef _OPENMP
-            static thread_local bool thread_bound = false;
-            if (!thread_bound) {
-                int thread_id = omp_get_thread_num();
-                int num_threads = omp_get_num_threads();
-                int node = numa::get_optimal_node_for_thread(thread_id, num_threads,
-                                                             g_numa_topo.num_nodes);
-                numa::bind_thread_to_numa_node(node);
-                thread_bound = true;
+    auto parse_task = [&](size_t i) {
+            // Bind thread to NUMA node on first iteration
+            if (g_config.enable_numa && g_config.bind_threads_to_numa
+                && g_numa_topo.is_numa_available) {
+    #ifdef _OPENMP
+                static thread_local bool thread_bound = false;
+                if (!thread_bound) {
+                    int thread_id = omp_get_thread_num();
+                    int num_threads = omp_get_num_threads();
+                    int node = numa::get_optimal_node_for_thread(thread_id, num_threads,
+                                                                 g_numa_topo.num_nodes);
+                    numa::bind_thread_to_numa_node(node);
+                    thread_bound = true;
+                }
+    #endif
             }
-#endif
-        }
 
-        if (has_error.load(std::memory_order_relaxed)) {
-            continue;  // Skip if another thread hit an error
-        }
+            if (has_error.load(std::memory_order_relaxed)) {
+                return;  // Skip if another thread hit an error
+            }
 
-        // Prefetch next element's data (3-4 cache lines ahead)
-        if (i + 3 < element_spans.size()) {
-            const auto& next_span = element_spans[i + 3];
-            __builtin_prefetch(input_.data() + next_span.start, 0,
-                               3);  // Read, high temporal locality
-            // Prefetch middle of the span too if it's large
-            if (next_span.end - next_span.start > 128) {
-                __builtin_prefetch(input_.data() + (next_span.start + next_span.end) / 2, 0, 3);
+            // Rewind this worker's scratch arena: the element parser's
+            // temporaries then bump-allocate from offset zero instead of
+            // hitting the global allocator per value
+            detail::thread_scratch_arena().reset();
+
+            // Prefetch an upcoming element's data (configurable lookahead)
+            size_t ahead = g_config.prefetch_spans_ahead;
+            if (ahead != 0 && i + ahead < element_spans.size()) {
+                const auto& next_span = element_spans[i + ahead];
+                __builtin_prefetch(input_.data() + next_span.start, 0,
+                                   3);  // Read, high temporal locality
+                // Prefetch middle of the span too if it's large
+                if (next_span.end - next_span.start > 128) {
+                    __builtin_prefetch(input_.data() + (next_span.start + next_span.end) / 2, 0, 3);
+                }
             }
-        }
 
-        // Create a thread-local parser for this element
-        auto& span = element_spans[i];
-        std::string_view element_input = input_.substr(span.start, span.end - span.start);
+            // Create a thread-local parser for this element
+            auto& span = element_spans[i];
+            std::string_view element_input = input_.substr(span.start, span.end - span.start);
 
-        // Trim whitespace from element
-        while (!element_input.empty() && std::isspace(element_input.front())) {
-            element_input.remove_prefix(1);
-        }
-        while (!element_input.empty() && std::isspace(element_input.back())) {
-            element_input.remove_suffix(1);
-        }
+            // Trim whitespace from element
+            while (!element_input.empty() && std::isspace(element_input.front())) {
+                element_input.remove_prefix(1);
+            }
+            while (!element_input.empty() && std::isspace(element_input.back())) {
+                element_input.remove_suffix(1);
+            }
 
-        parser element_parser(element_input);
-        auto result = element_parser.parse_value();
+            parser element_parser(element_input);
+            auto result = element_parser.parse_value();
 
-        if (!result) {
-            bool expected = false;
-            if (has_error.compare_exchange_strong(expected, true)) {
-                first_error = result.error();
+            if (!result) {
+                bool expected = false;
+                if (has_error.compare_exchange_strong(expected, true)) {
+                    first_error = result.error();
+                }
+            } else {
+                array[i] = std::move(*result);
             }
-        } else {
-            array[i] = std::move(*result);
+    };
+
+#if defined(FASTJSON_USE_PARALLEL_STL)
+    if (g_config.use_work_stealing) {
+        // TBB work-stealing pool via Parallel STL: dynamic load balancing for
+        // skewed payloads where one element holds a deeply nested subtree
+        std::vector<size_t> order(element_spans.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::for_each(std::execution::par, order.begin(), order.end(), parse_task);
+    } else
+#endif
+    {
+#pragma omp parallel for schedule(dynamic) if (element_spans.size() >= 4)
+        for (size_t i = 0; i < element_spans.size(); ++i) {
+            parse_task(i);
         }
     }
 
@@ -2014,113 +3861,45 @@ parallel_parse:
 
 // Sequential fallback is handled by calling parse_array() directly
 
-auto parser::parse_object() -> json_result<json_value> {
-    if (!match('{')) {
-        return std::unexpected(make_error(json_error_code::invalid_syntax, "Expected '{'"));
-    }
-
-    ++depth_;
-
-    skip_whitespace();
-
-    if (match('}')) {
-        --depth_;
-        return json_value{json_object{}};
-    }
-
-    json_object object;
-
-    while (true) {
-        skip_whitespace();
-
-        if (peek() != '"') {
-            --depth_;
-            return std::unexpected(
-                make_error(json_error_code::invalid_syntax, "Expected string key in object"));
-        }
-
-        auto key_result = parse_string();
-        if (!key_result) {
-            --depth_;
-            return std::unexpected(key_result.error());
-        }
-
-        std::string key = key_result->as_string();
-
-        skip_whitespace();
-
-        if (!match(':')) {
-            --depth_;
-            return std::unexpected(
-                make_error(json_error_code::invalid_syntax, "Expected ':' after object key"));
-        }
-
-        auto value_result = parse_value();
-        if (!value_result) {
-            --depth_;
-            return std::unexpected(value_result.error());
-        }
-
-        object[std::move(key)] = std::move(*value_result);
-
-        skip_whitespace();
-
-        if (match('}')) {
-            break;
-        } else if (match(',')) {
-            skip_whitespace();
-            continue;
-        } else {
-            --depth_;
-            return std::unexpected(
-                make_error(json_error_code::invalid_syntax, "Expected ',' or '}' in object"));
-        }
-    }
-
-    --depth_;
-    return json_value{std::move(object)};
-}
+// ============================================================================
+// Structural Pre-Scan for Capacity Pre-Sizing
+// ============================================================================
+// Filling a large container one element at a time pays repeated rehash or
+// reallocate-and-move cycles. Counting the separators at the current depth
+// (commas for arrays, colons for objects) first is far cheaper than any one
+// of those cycles and lets the container reserve() exact capacity before the
+// first insert. Same traversal as the boundary scanners above, but nothing
+// is materialized - just one counter.
 
-// SIMD-accelerated object boundary scanner
 __attribute__((target("avx2"))) static auto
-scan_object_boundaries_simd(std::span<const char> input, size_t start_pos,
-                            std::vector<std::tuple<size_t, size_t, size_t, size_t>>& kv_pairs,
-                            size_t& object_end) -> bool {
-    // Use AVX2 to quickly find structural characters
-    const __m256i left_brace = _mm256_set1_epi8('{');
-    const __m256i right_brace = _mm256_set1_epi8('}');
+count_separators_avx2(std::span<const char> input, size_t start_pos, char separator,
+                      char close_char, size_t& count) -> bool {
     const __m256i left_bracket = _mm256_set1_epi8('[');
     const __m256i right_bracket = _mm256_set1_epi8(']');
-    const __m256i comma = _mm256_set1_epi8(',');
-    const __m256i colon = _mm256_set1_epi8(':');
+    const __m256i left_brace = _mm256_set1_epi8('{');
+    const __m256i right_brace = _mm256_set1_epi8('}');
+    const __m256i sep = _mm256_set1_epi8(separator);
     const __m256i quote = _mm256_set1_epi8('"');
     const __m256i backslash = _mm256_set1_epi8('\\');
 
     size_t pos = start_pos;
-    size_t key_start = 0, key_end = 0, value_start = 0;
     int depth = 0;
     bool in_string = false;
-    enum class state_t { need_key, need_colon, need_value, need_comma };
-    state_t state = state_t::need_key;
+    // Position-based escape skip instead of the bit++ idiom: a backslash in
+    // the last lane must still suppress the first byte of the next chunk
+    size_t skip_pos = SIZE_MAX;
 
-    // Process 32 bytes at a time
     while (pos + 32 <= input.size()) {
         __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
 
-        __m256i is_left_brace = _mm256_cmpeq_epi8(chunk, left_brace);
-        __m256i is_right_brace = _mm256_cmpeq_epi8(chunk, right_brace);
-        __m256i is_left_bracket = _mm256_cmpeq_epi8(chunk, left_bracket);
-        __m256i is_right_bracket = _mm256_cmpeq_epi8(chunk, right_bracket);
-        __m256i is_comma = _mm256_cmpeq_epi8(chunk, comma);
-        __m256i is_colon = _mm256_cmpeq_epi8(chunk, colon);
-        __m256i is_quote = _mm256_cmpeq_epi8(chunk, quote);
-        __m256i is_backslash = _mm256_cmpeq_epi8(chunk, backslash);
-
-        __m256i structural =
-            _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(is_left_brace, is_right_brace),
-                                            _mm256_or_si256(is_left_bracket, is_right_bracket)),
-                            _mm256_or_si256(_mm256_or_si256(is_comma, is_colon),
-                                            _mm256_or_si256(is_quote, is_backslash)));
+        __m256i structural = _mm256_or_si256(
+            _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, left_bracket),
+                                            _mm256_cmpeq_epi8(chunk, right_bracket)),
+                            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, left_brace),
+                                            _mm256_cmpeq_epi8(chunk, right_brace))),
+            _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, sep),
+                                            _mm256_cmpeq_epi8(chunk, quote)),
+                            _mm256_cmpeq_epi8(chunk, backslash)));
 
         uint32_t mask = _mm256_movemask_epi8(structural);
 
@@ -2129,149 +3908,65 @@ scan_object_boundaries_simd(std::span<const char> input, size_t start_pos,
             continue;
         }
 
-        // Process structural characters
         for (int bit = 0; bit < 32 && mask; ++bit, mask >>= 1) {
             if (!(mask & 1))
                 continue;
 
             size_t char_pos = pos + bit;
+            if (char_pos == skip_pos)
+                continue;
             char c = input[char_pos];
 
             if (in_string) {
-                if (c == '\\' && char_pos + 1 < input.size()) {
-                    bit++;
-                    mask >>= 1;
+                if (c == '\\') {
+                    skip_pos = char_pos + 1;
                 } else if (c == '"') {
                     in_string = false;
-                    if (state == state_t::need_key) {
-                        key_end = char_pos;
-                        state = state_t::need_colon;
-                    }
                 }
-            } else {
-                switch (c) {
-                    case '"':
-                        in_string = true;
-                        if (state == state_t::need_key) {
-                            key_start = char_pos + 1;
-                        }
-                        break;
-                    case ':':
-                        if (state == state_t::need_colon && depth == 0) {
-                            value_start = char_pos + 1;
-                            state = state_t::need_value;
-                        }
-                        break;
-                    case '[':
-                    case '{':
-                        if (state == state_t::need_value) {
-                            depth++;
-                        }
-                        break;
-                    case ']':
-                    case '}':
-                        if (state == state_t::need_value && depth > 0) {
-                            depth--;
-                        } else if (c == '}' && depth == 0 && state == state_t::need_comma) {
-                            object_end = char_pos;
-                            return true;
-                        } else if (c == '}' && depth == 0) {
-                            // End of last value
-                            if (state == state_t::need_value) {
-                                kv_pairs.push_back({key_start, key_end, value_start, char_pos});
-                            }
-                            object_end = char_pos;
-                            return true;
-                        }
-                        break;
-                    case ',':
-                        if (depth == 0 && state == state_t::need_comma) {
-                            state = state_t::need_key;
-                        } else if (depth == 0 && state == state_t::need_value) {
-                            kv_pairs.push_back({key_start, key_end, value_start, char_pos});
-                            state = state_t::need_key;
-                        }
-                        break;
-                }
-
-                // Transition from need_value to need_comma
-                if (state == state_t::need_value && depth == 0 && c != ':' && c != '[' && c != '{'
-                    && c != '"' && !std::isspace(c)) {
-                    // We're in a value (primitive), scan to end
-                    size_t value_end = char_pos;
-                    while (value_end < input.size() && input[value_end] != ','
-                           && input[value_end] != '}') {
-                        value_end++;
-                    }
-                    if (value_end < input.size()) {
-                        kv_pairs.push_back({key_start, key_end, value_start, value_end});
-                        state = state_t::need_comma;
-                        pos = value_end - 1;
-                        break;
-                    }
+            } else if (c == '"') {
+                in_string = true;
+            } else if (c == '[' || c == '{') {
+                depth++;
+            } else if (c == ']' || c == '}') {
+                if (depth == 0) {
+                    return c == close_char;
                 }
+                depth--;
+            } else if (c == separator && depth == 0) {
+                count++;
             }
         }
 
         pos += 32;
     }
 
-    // Scalar fallback for remaining bytes
+    // Process remaining bytes with scalar code
     while (pos < input.size()) {
+        if (pos == skip_pos) {
+            pos++;
+            continue;
+        }
         char c = input[pos];
 
         if (in_string) {
-            if (c == '\\' && pos + 1 < input.size()) {
+            if (c == '\\') {
                 pos += 2;
                 continue;
-            } else if (c == '"') {
+            }
+            if (c == '"') {
                 in_string = false;
-                if (state == state_t::need_key) {
-                    key_end = pos;
-                    state = state_t::need_colon;
-                }
             }
-        } else {
-            if (!std::isspace(c)) {
-                switch (c) {
-                    case '"':
-                        in_string = true;
-                        if (state == state_t::need_key) {
-                            key_start = pos + 1;
-                        }
-                        break;
-                    case ':':
-                        if (state == state_t::need_colon && depth == 0) {
-                            value_start = pos + 1;
-                            state = state_t::need_value;
-                        }
-                        break;
-                    case '[':
-                    case '{':
-                        if (state == state_t::need_value) {
-                            depth++;
-                        }
-                        break;
-                    case ']':
-                    case '}':
-                        if (state == state_t::need_value && depth > 0) {
-                            depth--;
-                        } else if (c == '}' && depth == 0) {
-                            if (state == state_t::need_value) {
-                                kv_pairs.push_back({key_start, key_end, value_start, pos});
-                            }
-                            object_end = pos;
-                            return true;
-                        }
-                        break;
-                    case ',':
-                        if (depth == 0 && state == state_t::need_value) {
-                            kv_pairs.push_back({key_start, key_end, value_start, pos});
-                            state = state_t::need_key;
-                        }
-                        break;
-                }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == '[' || c == '{') {
+            depth++;
+        } else if (c == ']' || c == '}') {
+            if (depth == 0) {
+                return c == close_char;
             }
+            depth--;
+        } else if (c == separator && depth == 0) {
+            count++;
         }
         pos++;
     }
@@ -2279,243 +3974,5397 @@ scan_object_boundaries_simd(std::span<const char> input, size_t start_pos,
     return false;
 }
 
-auto parser::parse_object_parallel(size_t estimated_size) -> json_result<json_value> {
-    // Phase 1: Scan to find key-value pair boundaries using SIMD
-    struct kv_span {
-        size_t key_start;
-        size_t key_end;
-        size_t value_start;
-        size_t value_end;
-    };
-
-    std::vector<kv_span> kv_spans;
-    kv_spans.reserve(estimated_size);
-    size_t object_end_pos = pos_;
+static auto count_separators_scalar(std::span<const char> input, size_t start_pos, char separator,
+                                    char close_char, size_t& count) -> bool {
+    size_t pos = start_pos;
+    int depth = 0;
+    bool in_string = false;
+    bool escape_next = false;
 
-    // Try SIMD-accelerated scan first
-    bool use_simd = g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2;
-    bool simd_success = false;
+    while (pos < input.size()) {
+        char c = input[pos];
 
-    if (use_simd) {
-        std::vector<std::tuple<size_t, size_t, size_t, size_t>> simd_kvs;
-        if (scan_object_boundaries_simd(input_, pos_, simd_kvs, object_end_pos)) {
-            for (const auto& [ks, ke, vs, ve] : simd_kvs) {
-                kv_spans.push_back({ks, ke, vs, ve});
+        if (in_string) {
+            if (escape_next) {
+                escape_next = false;
+            } else if (c == '\\') {
+                escape_next = true;
+            } else if (c == '"') {
+                in_string = false;
             }
-            simd_success = true;
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == '[' || c == '{') {
+            depth++;
+        } else if (c == ']' || c == '}') {
+            if (depth == 0) {
+                return c == close_char;
+            }
+            depth--;
+        } else if (c == separator && depth == 0) {
+            count++;
         }
+        pos++;
     }
 
-    // Fallback: Scan forward to find key-value boundaries
-    if (!simd_success) {
-        size_t scan_pos = pos_;
-        int depth = 0;
-        bool in_string = false;
-        bool escape_next = false;
+    return false;
+}
 
-        size_t key_start = 0, key_end = 0, value_start = 0;
-        enum class scan_state { need_key, need_colon, need_value, need_comma };
-        scan_state state = scan_state::need_key;
+// Count of separators at the current depth, or nullopt when the container's
+// end was never found (the parse itself will report the real error)
+static auto prescan_separator_count(std::span<const char> input, size_t start_pos, char separator,
+                                    char close_char) -> std::optional<size_t> {
+    FASTJSON_TRACE_SCOPE(stage1_scan);
+    size_t count = 0;
+    bool found = false;
+    if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
+        found = count_separators_avx2(input, start_pos, separator, close_char, count);
+    } else {
+        found = count_separators_scalar(input, start_pos, separator, close_char, count);
+    }
+    if (!found) {
+        return std::nullopt;
+    }
+    return count;
+}
 
-        while (scan_pos < input_.size()) {
-            char c = input_[scan_pos];
+// Parses one object key (cursor on the opening quote, left after the closing
+// quote). Fast path for repeated keys: if the raw span up to the closing
+// quote contains no escapes or control characters, intern it and skip the
+// full parse_string machinery (copy, unescape, UTF-8 revalidation). The
+// escape-aware scan finds the closing quote in one pass even when the key
+// does contain escapes (saw_escape then routes it slow-path).
+auto parser::parse_object_key() -> json_result<std::string> {
+    if (peek() != '"') {
+        return std::unexpected(
+            make_error(json_error_code::invalid_syntax, "Expected string key in object"));
+    }
 
-            if (in_string) {
-                if (escape_next) {
-                    escape_next = false;
-                } else if (c == '\\') {
-                    escape_next = true;
-                } else if (c == '"') {
-                    in_string = false;
-                    if (state == scan_state::need_key) {
-                        key_end = scan_pos;
-                        state = scan_state::need_colon;
-                    }
+    if (g_config.intern_keys) {
+        bool saw_escape = false;
+        size_t key_scan = detail::find_closing_quote(
+            std::span<const char>(input_.data(), input_.size()), pos_ + 1, saw_escape);
+        if (key_scan < input_.size() && input_[key_scan] == '"' && !saw_escape) {
+            std::string_view raw = input_.substr(pos_ + 1, key_scan - pos_ - 1);
+            // Non-ASCII keys still go through full validation
+            bool ascii_only = true;
+            for (char c : raw) {
+                if (static_cast<unsigned char>(c) >= 0x80) {
+                    ascii_only = false;
+                    break;
                 }
+            }
+            if (ascii_only) {
+                std::string key = detail::g_key_pool.intern(raw);
+                pos_ = key_scan + 1;
+                return key;
+            }
+        }
+    }
+
+    auto key_result = parse_string();
+    if (!key_result) {
+        return std::unexpected(key_result.error());
+    }
+    return key_result->as_string();
+}
+
+auto parser::parse_object() -> json_result<json_value> {
+    FASTJSON_TRACE_SCOPE(container_build);
+    if (!match('{')) {
+        return std::unexpected(make_error(json_error_code::invalid_syntax, "Expected '{'"));
+    }
+
+    ++depth_;
+
+    skip_whitespace();
+
+    const bool flat = g_config.use_flat_objects;
+
+    if (match('}')) {
+        --depth_;
+        if (flat) {
+            flat_json_object empty_flat;
+            empty_flat.finalize();
+            return json_value{std::move(empty_flat)};
+        }
+        return json_value{json_object{}};
+    }
+
+    json_object object;
+    flat_json_object flat_object;
+
+    // Pre-size from a colon count at this depth: one rehash (or vector
+    // regrow) costs more than the whole counting pass
+    if (g_config.presize_containers) {
+        if (auto pairs = prescan_separator_count(
+                std::span<const char>(input_.data(), input_.size()), pos_, ':', '}')) {
+            if (flat) {
+                flat_object.reserve(*pairs);
             } else {
-                if (std::isspace(c)) {
-                    scan_pos++;
-                    continue;
-                }
+                object.reserve(*pairs);
+            }
+        }
+    }
 
-                switch (c) {
-                    case '"':
-                        in_string = true;
-                        if (state == scan_state::need_key) {
-                            key_start = scan_pos + 1;
-                        }
-                        break;
-                    case ':':
-                        if (state == scan_state::need_colon && depth == 0) {
-                            value_start = scan_pos + 1;
-                            state = scan_state::need_value;
-                        }
-                        break;
-                    case '[':
-                    case '{':
-                        depth++;
-                        break;
-                    case ']':
-                        depth--;
-                        break;
-                    case '}':
-                        if (depth == 0) {
-                            // End of object
-                            if (state == scan_state::need_value
-                                || state == scan_state::need_comma) {
-                                kv_spans.push_back({key_start, key_end, value_start, scan_pos});
-                            }
-                            object_end_pos = scan_pos;
-                            break;
-                        }
-                        depth--;
-                        break;
-                    case ',':
-                        if (depth == 0 && state == scan_state::need_value) {
-                            kv_spans.push_back({key_start, key_end, value_start, scan_pos});
-                            state = scan_state::need_key;
-                        }
-                        break;
+    while (true) {
+        skip_whitespace();
+
+        auto key_result = parse_object_key();
+        if (!key_result) {
+            --depth_;
+            return std::unexpected(key_result.error());
+        }
+        std::string key = std::move(*key_result);
+
+        skip_whitespace();
+
+        if (!match(':')) {
+            --depth_;
+            return std::unexpected(
+                make_error(json_error_code::invalid_syntax, "Expected ':' after object key"));
+        }
+
+        auto value_result = parse_value();
+        if (!value_result) {
+            --depth_;
+            return std::unexpected(value_result.error());
+        }
+
+        if (flat) {
+            flat_object.emplace(std::move(key), std::move(*value_result));
+        } else if (g_config.reject_duplicate_keys) {
+            auto [it, inserted] = object.try_emplace(std::move(key), std::move(*value_result));
+            if (!inserted) {
+                --depth_;
+                return std::unexpected(
+                    make_error(json_error_code::duplicate_key, "Duplicate object key"));
+            }
+        } else {
+            object[std::move(key)] = std::move(*value_result);
+        }
+
+        skip_whitespace();
+
+        if (match('}')) {
+            break;
+        } else if (match(',')) {
+            skip_whitespace();
+            continue;
+        } else {
+            --depth_;
+            return std::unexpected(
+                make_error(json_error_code::invalid_syntax, "Expected ',' or '}' in object"));
+        }
+    }
+
+    --depth_;
+    if (flat) {
+        flat_object.finalize();
+        if (g_config.reject_duplicate_keys && flat_object.has_duplicate_key()) {
+            return std::unexpected(
+                make_error(json_error_code::duplicate_key, "Duplicate object key"));
+        }
+        return json_value{std::move(flat_object)};
+    }
+    return json_value{std::move(object)};
+}
+
+// ============================================================================
+// Iterative Parser Engine (parse_config::use_iterative_parser)
+// ============================================================================
+// Drives container nesting from an explicit frame stack instead of the
+// parse_object/parse_array call recursion. Nesting cost becomes one heap
+// frame instead of one C++ stack frame, so max_depth bounds memory rather
+// than guarding against stack overflow and callers with legitimately deep
+// payloads can raise it to whatever they can afford. Scalars reuse the
+// single-token parsers above; containers are built sequentially (the
+// parallel splitters assume the recursive engine's reentrancy).
+auto parser::parse_value_iterative() -> json_result<json_value> {
+    // One frame per open container. Only the alternative matching is_object
+    // (and the config's object representation) is touched on each frame.
+    struct frame {
+        json_array array;
+        json_object object;
+        flat_json_object flat;
+        std::string pending_key;  // Key awaiting its value (objects only)
+        bool is_object = false;
+    };
+
+    std::vector<frame> stack;
+    stack.reserve(64);  // Deeper documents grow the vector, not the call stack
+
+    const bool flat = g_config.use_flat_objects;
+    json_value value;  // Completed value awaiting attachment to the open frame
+
+    while (true) {
+        // Produce the next value: open a container frame or parse a scalar
+        skip_whitespace();
+        if (is_at_end()) {
+            return std::unexpected(
+                make_error(json_error_code::unexpected_end, "Unexpected end of input"));
+        }
+
+        bool opened = false;
+        switch (peek()) {
+            case '[': {
+                if (stack.size() >= g_config.max_depth) {
+                    return std::unexpected(make_error(json_error_code::max_depth_exceeded,
+                                                      "Maximum nesting depth exceeded"));
+                }
+                advance();
+                skip_whitespace();
+                if (match(']')) {
+                    value = json_value{json_array{}};
+                    break;
+                }
+                frame f;
+                if (g_config.presize_containers) {
+                    if (auto commas = prescan_separator_count(
+                            std::span<const char>(input_.data(), input_.size()), pos_, ',',
+                            ']')) {
+                        f.array.reserve(*commas + 1);
+                    }
+                }
+                stack.push_back(std::move(f));
+                opened = true;
+                break;
+            }
+            case '{': {
+                if (stack.size() >= g_config.max_depth) {
+                    return std::unexpected(make_error(json_error_code::max_depth_exceeded,
+                                                      "Maximum nesting depth exceeded"));
+                }
+                advance();
+                skip_whitespace();
+                if (match('}')) {
+                    if (flat) {
+                        flat_json_object empty_flat;
+                        empty_flat.finalize();
+                        value = json_value{std::move(empty_flat)};
+                    } else {
+                        value = json_value{json_object{}};
+                    }
+                    break;
+                }
+                frame f;
+                f.is_object = true;
+                if (g_config.presize_containers) {
+                    if (auto pairs = prescan_separator_count(
+                            std::span<const char>(input_.data(), input_.size()), pos_, ':',
+                            '}')) {
+                        if (flat) {
+                            f.flat.reserve(*pairs);
+                        } else {
+                            f.object.reserve(*pairs);
+                        }
+                    }
+                }
+                auto key = parse_object_key();
+                if (!key) {
+                    return std::unexpected(key.error());
+                }
+                skip_whitespace();
+                if (!match(':')) {
+                    return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                      "Expected ':' after object key"));
+                }
+                f.pending_key = std::move(*key);
+                stack.push_back(std::move(f));
+                opened = true;
+                break;
+            }
+            default: {
+                json_result<json_value> scalar = [&]() -> json_result<json_value> {
+                    switch (peek()) {
+                        case 'n': return parse_null();
+                        case 't':
+                        case 'f': return parse_boolean();
+                        case '"': return parse_string();
+                        case '-':
+                        case '0': case '1': case '2': case '3': case '4':
+                        case '5': case '6': case '7': case '8': case '9':
+                            return parse_number();
+                        default:
+                            return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                              "Unexpected character"));
+                    }
+                }();
+                if (!scalar) {
+                    return std::unexpected(scalar.error());
+                }
+                value = std::move(*scalar);
+                break;
+            }
+        }
+        if (opened) {
+            continue;  // Descend: next iteration parses the frame's first value
+        }
+
+        // Attach the completed value upward, closing as many containers as
+        // this value terminates
+        while (true) {
+            if (stack.empty()) {
+                return value;  // Whole document parsed; parse() checks trailing text
+            }
+            frame& top = stack.back();
+            if (top.is_object) {
+                if (flat) {
+                    top.flat.emplace(std::move(top.pending_key), std::move(value));
+                } else if (g_config.reject_duplicate_keys) {
+                    auto [it, inserted] =
+                        top.object.try_emplace(std::move(top.pending_key), std::move(value));
+                    if (!inserted) {
+                        return std::unexpected(make_error(json_error_code::duplicate_key,
+                                                          "Duplicate object key"));
+                    }
+                } else {
+                    top.object[std::move(top.pending_key)] = std::move(value);
+                }
+            } else {
+                top.array.emplace_back(std::move(value));
+            }
+
+            skip_whitespace();
+            if (top.is_object) {
+                if (match('}')) {
+                    if (flat) {
+                        top.flat.finalize();
+                        if (g_config.reject_duplicate_keys && top.flat.has_duplicate_key()) {
+                            return std::unexpected(make_error(json_error_code::duplicate_key,
+                                                              "Duplicate object key"));
+                        }
+                        value = json_value{std::move(top.flat)};
+                    } else {
+                        value = json_value{std::move(top.object)};
+                    }
+                    stack.pop_back();
+                    continue;  // This container is itself a completed value
+                }
+                if (!match(',')) {
+                    return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                      "Expected ',' or '}' in object"));
+                }
+                skip_whitespace();
+                auto key = parse_object_key();
+                if (!key) {
+                    return std::unexpected(key.error());
+                }
+                skip_whitespace();
+                if (!match(':')) {
+                    return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                      "Expected ':' after object key"));
+                }
+                top.pending_key = std::move(*key);
+                break;  // Parse the value for this key
+            }
+            if (match(']')) {
+                value = json_value{std::move(top.array)};
+                stack.pop_back();
+                continue;
+            }
+            if (!match(',')) {
+                return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                  "Expected ',' or ']' in array"));
+            }
+            break;  // Parse the next array element
+        }
+    }
+}
+
+// SIMD-accelerated object boundary scanner
+__attribute__((target("avx2"))) static auto
+scan_object_boundaries_simd(std::span<const char> input, size_t start_pos,
+                            std::vector<std::tuple<size_t, size_t, size_t, size_t>>& kv_pairs,
+                            size_t& object_end) -> bool {
+    // Use AVX2 to quickly find structural characters
+    const __m256i left_brace = _mm256_set1_epi8('{');
+    const __m256i right_brace = _mm256_set1_epi8('}');
+    const __m256i left_bracket = _mm256_set1_epi8('[');
+    const __m256i right_bracket = _mm256_set1_epi8(']');
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i colon = _mm256_set1_epi8(':');
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+
+    size_t pos = start_pos;
+    size_t key_start = 0, key_end = 0, value_start = 0;
+    int depth = 0;
+    bool in_string = false;
+    enum class state_t { need_key, need_colon, need_value, need_comma };
+    state_t state = state_t::need_key;
+
+    // Process 32 bytes at a time
+    while (pos + 32 <= input.size()) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
+
+        __m256i is_left_brace = _mm256_cmpeq_epi8(chunk, left_brace);
+        __m256i is_right_brace = _mm256_cmpeq_epi8(chunk, right_brace);
+        __m256i is_left_bracket = _mm256_cmpeq_epi8(chunk, left_bracket);
+        __m256i is_right_bracket = _mm256_cmpeq_epi8(chunk, right_bracket);
+        __m256i is_comma = _mm256_cmpeq_epi8(chunk, comma);
+        __m256i is_colon = _mm256_cmpeq_epi8(chunk, colon);
+        __m256i is_quote = _mm256_cmpeq_epi8(chunk, quote);
+        __m256i is_backslash = _mm256_cmpeq_epi8(chunk, backslash);
+
+        __m256i structural =
+            _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(is_left_brace, is_right_brace),
+                                            _mm256_or_si256(is_left_bracket, is_right_bracket)),
+                            _mm256_or_si256(_mm256_or_si256(is_comma, is_colon),
+                                            _mm256_or_si256(is_quote, is_backslash)));
+
+        uint32_t mask = _mm256_movemask_epi8(structural);
+
+        if (mask == 0) {
+            pos += 32;
+            continue;
+        }
+
+        // Process structural characters
+        for (int bit = 0; bit < 32 && mask; ++bit, mask >>= 1) {
+            if (!(mask & 1))
+                continue;
+
+            size_t char_pos = pos + bit;
+            char c = input[char_pos];
+
+            if (in_string) {
+                if (c == '\\' && char_pos + 1 < input.size()) {
+                    bit++;
+                    mask >>= 1;
+                } else if (c == '"') {
+                    in_string = false;
+                    if (state == state_t::need_key) {
+                        key_end = char_pos;
+                        state = state_t::need_colon;
+                    }
+                }
+            } else {
+                switch (c) {
+                    case '"':
+                        in_string = true;
+                        if (state == state_t::need_key) {
+                            key_start = char_pos + 1;
+                        }
+                        break;
+                    case ':':
+                        if (state == state_t::need_colon && depth == 0) {
+                            value_start = char_pos + 1;
+                            state = state_t::need_value;
+                        }
+                        break;
+                    case '[':
+                    case '{':
+                        if (state == state_t::need_value) {
+                            depth++;
+                        }
+                        break;
+                    case ']':
+                    case '}':
+                        if (state == state_t::need_value && depth > 0) {
+                            depth--;
+                        } else if (c == '}' && depth == 0 && state == state_t::need_comma) {
+                            object_end = char_pos;
+                            return true;
+                        } else if (c == '}' && depth == 0) {
+                            // End of last value
+                            if (state == state_t::need_value) {
+                                kv_pairs.push_back({key_start, key_end, value_start, char_pos});
+                            }
+                            object_end = char_pos;
+                            return true;
+                        }
+                        break;
+                    case ',':
+                        if (depth == 0 && state == state_t::need_comma) {
+                            state = state_t::need_key;
+                        } else if (depth == 0 && state == state_t::need_value) {
+                            kv_pairs.push_back({key_start, key_end, value_start, char_pos});
+                            state = state_t::need_key;
+                        }
+                        break;
+                }
+
+                // Transition from need_value to need_comma
+                if (state == state_t::need_value && depth == 0 && c != ':' && c != '[' && c != '{'
+                    && c != '"' && !std::isspace(c)) {
+                    // We're in a value (primitive), scan to end
+                    size_t value_end = char_pos;
+                    while (value_end < input.size() && input[value_end] != ','
+                           && input[value_end] != '}') {
+                        value_end++;
+                    }
+                    if (value_end < input.size()) {
+                        kv_pairs.push_back({key_start, key_end, value_start, value_end});
+                        state = state_t::need_comma;
+                        pos = value_end - 1;
+                        break;
+                    }
+                }
+            }
+        }
+
+        pos += 32;
+    }
+
+    // Scalar fallback for remaining bytes
+    while (pos < input.size()) {
+        char c = input[pos];
+
+        if (in_string) {
+            if (c == '\\' && pos + 1 < input.size()) {
+                pos += 2;
+                continue;
+            } else if (c == '"') {
+                in_string = false;
+                if (state == state_t::need_key) {
+                    key_end = pos;
+                    state = state_t::need_colon;
+                }
+            }
+        } else {
+            if (!std::isspace(c)) {
+                switch (c) {
+                    case '"':
+                        in_string = true;
+                        if (state == state_t::need_key) {
+                            key_start = pos + 1;
+                        }
+                        break;
+                    case ':':
+                        if (state == state_t::need_colon && depth == 0) {
+                            value_start = pos + 1;
+                            state = state_t::need_value;
+                        }
+                        break;
+                    case '[':
+                    case '{':
+                        if (state == state_t::need_value) {
+                            depth++;
+                        }
+                        break;
+                    case ']':
+                    case '}':
+                        if (state == state_t::need_value && depth > 0) {
+                            depth--;
+                        } else if (c == '}' && depth == 0) {
+                            if (state == state_t::need_value) {
+                                kv_pairs.push_back({key_start, key_end, value_start, pos});
+                            }
+                            object_end = pos;
+                            return true;
+                        }
+                        break;
+                    case ',':
+                        if (depth == 0 && state == state_t::need_value) {
+                            kv_pairs.push_back({key_start, key_end, value_start, pos});
+                            state = state_t::need_key;
+                        }
+                        break;
+                }
+            }
+        }
+        pos++;
+    }
+
+    return false;
+}
+
+auto parser::parse_object_parallel(size_t estimated_size) -> json_result<json_value> {
+    // Phase 1: Scan to find key-value pair boundaries using SIMD
+    struct kv_span {
+        size_t key_start;
+        size_t key_end;
+        size_t value_start;
+        size_t value_end;
+    };
+
+    std::vector<kv_span> kv_spans;
+    kv_spans.reserve(estimated_size);
+    size_t object_end_pos = pos_;
+
+    // Try SIMD-accelerated scan first
+    bool use_simd = g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2;
+    bool simd_success = false;
+
+    if (use_simd) {
+        std::vector<std::tuple<size_t, size_t, size_t, size_t>> simd_kvs;
+        if (scan_object_boundaries_simd(input_, pos_, simd_kvs, object_end_pos)) {
+            for (const auto& [ks, ke, vs, ve] : simd_kvs) {
+                kv_spans.push_back({ks, ke, vs, ve});
+            }
+            simd_success = true;
+        }
+    }
+
+    // Fallback: Scan forward to find key-value boundaries
+    if (!simd_success) {
+        size_t scan_pos = pos_;
+        int depth = 0;
+        bool in_string = false;
+        bool escape_next = false;
+
+        size_t key_start = 0, key_end = 0, value_start = 0;
+        enum class scan_state { need_key, need_colon, need_value, need_comma };
+        scan_state state = scan_state::need_key;
+
+        while (scan_pos < input_.size()) {
+            char c = input_[scan_pos];
+
+            if (in_string) {
+                if (escape_next) {
+                    escape_next = false;
+                } else if (c == '\\') {
+                    escape_next = true;
+                } else if (c == '"') {
+                    in_string = false;
+                    if (state == scan_state::need_key) {
+                        key_end = scan_pos;
+                        state = scan_state::need_colon;
+                    }
+                }
+            } else {
+                if (std::isspace(c)) {
+                    scan_pos++;
+                    continue;
+                }
+
+                switch (c) {
+                    case '"':
+                        in_string = true;
+                        if (state == scan_state::need_key) {
+                            key_start = scan_pos + 1;
+                        }
+                        break;
+                    case ':':
+                        if (state == scan_state::need_colon && depth == 0) {
+                            value_start = scan_pos + 1;
+                            state = scan_state::need_value;
+                        }
+                        break;
+                    case '[':
+                    case '{':
+                        depth++;
+                        break;
+                    case ']':
+                        depth--;
+                        break;
+                    case '}':
+                        if (depth == 0) {
+                            // End of object
+                            if (state == scan_state::need_value
+                                || state == scan_state::need_comma) {
+                                kv_spans.push_back({key_start, key_end, value_start, scan_pos});
+                            }
+                            object_end_pos = scan_pos;
+                            break;
+                        }
+                        depth--;
+                        break;
+                    case ',':
+                        if (depth == 0 && state == scan_state::need_value) {
+                            kv_spans.push_back({key_start, key_end, value_start, scan_pos});
+                            state = scan_state::need_key;
+                        }
+                        break;
+                }
+            }
+            scan_pos++;
+        }
+    }  // End of if (!simd_success) block
+
+    // If we found very few pairs, fall back to sequential
+    if (kv_spans.size() < static_cast<size_t>(g_config.parallel_threshold / 100)) {
+        return parse_object();  // Use sequential version
+    }
+
+    // Phase 2: Parse key-value pairs in parallel
+    json_object object;
+
+    // We need to use a vector of pairs since unordered_map isn't thread-safe for concurrent inserts
+    std::vector<std::pair<std::string, json_value>> pairs(kv_spans.size());
+
+    std::atomic<bool> has_error{false};
+    json_error first_error{};
+
+    auto parse_task = [&](size_t i) {
+            // Bind thread to NUMA node on first iteration
+            if (g_config.enable_numa && g_config.bind_threads_to_numa
+                && g_numa_topo.is_numa_available) {
+    #ifdef _OPENMP
+                static thread_local bool thread_bound = false;
+                if (!thread_bound) {
+                    int thread_id = omp_get_thread_num();
+                    int num_threads = omp_get_num_threads();
+                    int node = numa::get_optimal_node_for_thread(thread_id, num_threads,
+                                                                 g_numa_topo.num_nodes);
+                    numa::bind_thread_to_numa_node(node);
+                    thread_bound = true;
+                }
+    #endif
+            }
+
+            if (has_error.load(std::memory_order_relaxed)) {
+                return;
+            }
+
+            // Rewind this worker's scratch arena between key-value pairs
+            // (same discipline as the array workers)
+            detail::thread_scratch_arena().reset();
+
+            // Prefetch an upcoming key-value pair's data (configurable lookahead)
+            size_t ahead = g_config.prefetch_spans_ahead;
+            if (ahead != 0 && i + ahead < kv_spans.size()) {
+                const auto& next_kv = kv_spans[i + ahead];
+                // Prefetch key and value locations
+                __builtin_prefetch(input_.data() + next_kv.key_start, 0, 3);
+                __builtin_prefetch(input_.data() + next_kv.value_start, 0, 3);
+                // Prefetch middle of value if it's large (>2 cache lines)
+                if (next_kv.value_end - next_kv.value_start > 128) {
+                    __builtin_prefetch(input_.data() + (next_kv.value_start + next_kv.value_end) / 2, 0,
+                                       3);
+                }
+            }
+
+            auto& span = kv_spans[i];
+
+            // Extract key
+            std::string key = std::string(input_.substr(span.key_start, span.key_end - span.key_start));
+
+            // Parse value
+            std::string_view value_input =
+                input_.substr(span.value_start, span.value_end - span.value_start);
+
+            // Trim whitespace
+            while (!value_input.empty() && std::isspace(value_input.front())) {
+                value_input.remove_prefix(1);
+            }
+            while (!value_input.empty() && std::isspace(value_input.back())) {
+                value_input.remove_suffix(1);
+            }
+
+            parser value_parser(value_input);
+            auto result = value_parser.parse_value();
+
+            if (!result) {
+                bool expected = false;
+                if (has_error.compare_exchange_strong(expected, true)) {
+                    first_error = result.error();
+                }
+            } else {
+                pairs[i] = {std::move(key), std::move(*result)};
+            }
+    };
+
+#if defined(FASTJSON_USE_PARALLEL_STL)
+    if (g_config.use_work_stealing) {
+        // TBB work-stealing pool via Parallel STL: dynamic load balancing for
+        // skewed payloads where one element holds a deeply nested subtree
+        std::vector<size_t> order(kv_spans.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::for_each(std::execution::par, order.begin(), order.end(), parse_task);
+    } else
+#endif
+    {
+#pragma omp parallel for schedule(dynamic) if (kv_spans.size() >= 4)
+        for (size_t i = 0; i < kv_spans.size(); ++i) {
+            parse_task(i);
+        }
+    }
+
+    if (has_error) {
+        --depth_;
+        return std::unexpected(first_error);
+    }
+
+    // Update parser position
+    pos_ = object_end_pos + 1;  // +1 to skip the '}'
+    --depth_;
+
+    if (g_config.use_flat_objects) {
+        flat_json_object flat_object;
+        flat_object.reserve(pairs.size());
+        for (auto& pair : pairs) {
+            flat_object.emplace(std::move(pair.first), std::move(pair.second));
+        }
+        flat_object.finalize();
+        if (g_config.reject_duplicate_keys && flat_object.has_duplicate_key()) {
+            return std::unexpected(
+                make_error(json_error_code::duplicate_key, "Duplicate object key"));
+        }
+        return json_value{std::move(flat_object)};
+    }
+
+    // Move pairs into unordered_map
+    for (auto& pair : pairs) {
+        if (g_config.reject_duplicate_keys) {
+            auto [it, inserted] = object.try_emplace(std::move(pair.first),
+                                                     std::move(pair.second));
+            if (!inserted) {
+                return std::unexpected(
+                    make_error(json_error_code::duplicate_key, "Duplicate object key"));
+            }
+        } else {
+            object[std::move(pair.first)] = std::move(pair.second);
+        }
+    }
+
+    return json_value{std::move(object)};
+}
+
+// ============================================================================
+// PMR Arena-Backed Document Tree
+// ============================================================================
+// Alternative DOM where every string, vector and map node is allocated from
+// one monotonic arena owned by the document. Parsing becomes pointer bumps
+// instead of per-node mallocs, and teardown is a single arena release.
+// Values from the arena tree must not outlive their arena_document.
+
+export class arena_value;
+using arena_string = std::pmr::string;
+using arena_array = std::pmr::vector<arena_value>;
+using arena_object = std::pmr::unordered_map<arena_string, arena_value>;
+
+export class arena_value {
+public:
+    arena_value() : data_(nullptr) {}
+    arena_value(std::nullptr_t) : data_(nullptr) {}
+    arena_value(bool b) : data_(b) {}
+    arena_value(double d) : data_(d) {}
+    arena_value(__int128 i) : data_(i) {}
+    arena_value(arena_string&& s) : data_(std::move(s)) {}
+    arena_value(arena_array&& a) : data_(std::move(a)) {}
+    arena_value(arena_object&& o) : data_(std::move(o)) {}
+
+    arena_value(arena_value&&) noexcept = default;
+    arena_value& operator=(arena_value&&) noexcept = default;
+    arena_value(const arena_value&) = default;
+    arena_value& operator=(const arena_value&) = default;
+
+    auto is_null() const -> bool { return std::holds_alternative<std::nullptr_t>(data_); }
+    auto is_bool() const -> bool { return std::holds_alternative<bool>(data_); }
+    auto is_number() const -> bool { return std::holds_alternative<double>(data_); }
+    auto is_int() const -> bool { return std::holds_alternative<__int128>(data_); }
+    auto is_string() const -> bool { return std::holds_alternative<arena_string>(data_); }
+    auto is_array() const -> bool { return std::holds_alternative<arena_array>(data_); }
+    auto is_object() const -> bool { return std::holds_alternative<arena_object>(data_); }
+
+    auto as_bool() const -> bool { return std::get<bool>(data_); }
+    auto as_number() const -> double {
+        if (auto* i = std::get_if<__int128>(&data_)) {
+            return static_cast<double>(*i);
+        }
+        return std::get<double>(data_);
+    }
+    auto as_int() const -> __int128 { return std::get<__int128>(data_); }
+    auto as_string() const -> const arena_string& { return std::get<arena_string>(data_); }
+    auto as_array() const -> const arena_array& { return std::get<arena_array>(data_); }
+    auto as_object() const -> const arena_object& { return std::get<arena_object>(data_); }
+
+private:
+    std::variant<std::nullptr_t, bool, double, __int128, arena_string, arena_array, arena_object>
+        data_;
+};
+
+// Owns the arena; member order matters - the root tree must be destroyed
+// before the resource that backs it.
+export struct arena_document {
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+    // NUMA-parallel parses add one arena per worker; each worker's sub-tree
+    // lives in its own node-local arena, kept alive alongside the main one.
+    std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> worker_arenas;
+    arena_value root;
+};
+
+namespace detail {
+
+// Sequential recursive-descent parser writing every allocation into one
+// memory_resource. Shares the SIMD kernels with the main parser; the tree
+// parallelism of parse_array_parallel is deliberately not used here because
+// a monotonic arena is not thread-safe and the arena mode exists for the
+// allocation-bound (not CPU-bound) payload class.
+class arena_parser {
+public:
+    arena_parser(std::string_view input, std::pmr::memory_resource* mr)
+        : input_(input), mr_(mr), pos_(0), depth_(0) {}
+
+    auto parse() -> json_result<arena_value> {
+        skip_ws();
+        if (pos_ >= input_.size()) {
+            return std::unexpected(make_error(json_error_code::empty_input, "Empty input"));
+        }
+        auto result = parse_value();
+        if (!result) {
+            return result;
+        }
+        skip_ws();
+        if (pos_ < input_.size()) {
+            return std::unexpected(make_error(json_error_code::extra_tokens,
+                                              "Unexpected characters after JSON value"));
+        }
+        return result;
+    }
+
+private:
+    auto skip_ws() -> void {
+        pos_ = skip_whitespace_simd(std::span<const char>(input_.data(), input_.size()), pos_);
+    }
+
+    auto make_error(json_error_code code, const char* message) const -> json_error {
+        return json_error{code, message, 0, pos_};
+    }
+
+    auto parse_value() -> json_result<arena_value> {
+        if (depth_ >= g_config.max_depth) {
+            return std::unexpected(make_error(json_error_code::max_depth_exceeded,
+                                              "Maximum nesting depth exceeded"));
+        }
+        skip_ws();
+        if (pos_ >= input_.size()) {
+            return std::unexpected(
+                make_error(json_error_code::unexpected_end, "Unexpected end of input"));
+        }
+
+        std::span<const char> data(input_.data(), input_.size());
+        char c = input_[pos_];
+        switch (c) {
+            case '{':
+                return parse_object();
+            case '[':
+                return parse_array();
+            case '"':
+                return parse_string();
+            case 't':
+                if (match_literal_simd(data, pos_, "true", 4)) {
+                    pos_ += 4;
+                    return arena_value{true};
+                }
+                return std::unexpected(
+                    make_error(json_error_code::invalid_literal, "Invalid true literal"));
+            case 'f':
+                if (match_literal_simd(data, pos_, "false", 5)) {
+                    pos_ += 5;
+                    return arena_value{false};
+                }
+                return std::unexpected(
+                    make_error(json_error_code::invalid_literal, "Invalid false literal"));
+            case 'n':
+                if (match_literal_simd(data, pos_, "null", 4)) {
+                    pos_ += 4;
+                    return arena_value{};
+                }
+                return std::unexpected(
+                    make_error(json_error_code::invalid_literal, "Invalid null literal"));
+            default:
+                if (c == '-' || (c >= '0' && c <= '9')) {
+                    return parse_number();
+                }
+                return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                  "Unexpected character"));
+        }
+    }
+
+    auto parse_string() -> json_result<arena_value> {
+        pos_++;  // Skip opening quote
+        arena_string value(mr_);
+        value.reserve(32);
+
+        std::span<const char> data(input_.data(), input_.size());
+        while (pos_ < input_.size()) {
+            size_t special = find_string_end_dispatch(data, pos_);
+            if (special > pos_) {
+                value.append(input_.data() + pos_, special - pos_);
+                pos_ = special;
+            }
+            if (pos_ >= input_.size()) {
+                break;
+            }
+            char c = input_[pos_];
+            if (c == '"') {
+                pos_++;
+                return arena_value{std::move(value)};
+            }
+            if (c == '\\') {
+                pos_++;
+                if (pos_ >= input_.size()) {
+                    return std::unexpected(make_error(json_error_code::invalid_string,
+                                                      "Unterminated escape sequence"));
+                }
+                char escaped = input_[pos_++];
+                switch (escaped) {
+                    case '"': value += '"'; break;
+                    case '\\': value += '\\'; break;
+                    case '/': value += '/'; break;
+                    case 'b': value += '\b'; break;
+                    case 'f': value += '\f'; break;
+                    case 'n': value += '\n'; break;
+                    case 'r': value += '\r'; break;
+                    case 't': value += '\t'; break;
+                    case 'u': {
+                        // The unicode helper appends to std::string; decode
+                        // into a small scratch and copy into the arena string.
+                        std::string scratch;
+                        auto decoded = unicode::decode_json_unicode_escape(
+                            input_.data() + pos_, input_.size() - pos_, scratch);
+                        if (!decoded.has_value()) {
+                            return std::unexpected(make_error(json_error_code::invalid_unicode,
+                                                              decoded.error()));
+                        }
+                        pos_ += decoded.value();
+                        value.append(scratch);
+                        break;
+                    }
+                    default:
+                        return std::unexpected(make_error(json_error_code::invalid_escape,
+                                                          "Invalid escape sequence"));
+                }
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                return std::unexpected(make_error(json_error_code::invalid_string,
+                                                  "Control character in string"));
+            }
+            if (value.size() > g_config.max_string_length) {
+                return std::unexpected(make_error(json_error_code::invalid_string,
+                                                  "String exceeds maximum length"));
+            }
+        }
+        return std::unexpected(
+            make_error(json_error_code::invalid_string, "Unterminated string"));
+    }
+
+    auto parse_number() -> json_result<arena_value> {
+        size_t start = pos_;
+        bool integral = true;
+        if (input_[pos_] == '-') {
+            pos_++;
+        }
+        while (pos_ < input_.size()) {
+            char c = input_[pos_];
+            if (c >= '0' && c <= '9') {
+                pos_++;
+            } else if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+                integral = false;
+                pos_++;
+            } else {
+                break;
+            }
+        }
+        size_t length = pos_ - start;
+        if (length == 0 || (length == 1 && input_[start] == '-')) {
+            return std::unexpected(
+                make_error(json_error_code::invalid_number, "Invalid number format"));
+        }
+
+        if (integral && length <= 38) {
+            const char* p = input_.data() + start;
+            const char* end = input_.data() + pos_;
+            bool neg = (*p == '-');
+            if (neg) {
+                p++;
+            }
+            // Same SWAR fast path as parser::parse_number for the common
+            // <= 19 digit case
+            if (static_cast<size_t>(end - p) <= 19) {
+                uint64_t fast = 0;
+                while (end - p >= 8) {
+                    fast = fast * 100000000ULL + parse_eight_digits_swar(p);
+                    p += 8;
+                }
+                while (p < end) {
+                    fast = fast * 10 + static_cast<uint64_t>(*p++ - '0');
+                }
+                __int128 result = static_cast<__int128>(fast);
+                return arena_value{neg ? -result : result};
+            }
+            unsigned __int128 magnitude = 0;
+            bool overflow = false;
+            while (p < end) {
+                unsigned __int128 prev = magnitude;
+                magnitude = magnitude * 10 + static_cast<unsigned>(*p - '0');
+                if (magnitude < prev) {
+                    overflow = true;
+                    break;
+                }
+                p++;
+            }
+            if (!overflow) {
+                __int128 result = static_cast<__int128>(magnitude);
+                return arena_value{neg ? -result : result};
+            }
+        }
+
+        // Same double tiers as parser::parse_number: Eisel-Lemire first,
+        // strtod only for what it declines
+        std::string_view number_str = input_.substr(start, length);
+        if (auto fast = fastjson::numbers::parse_double(number_str)) {
+            return arena_value{*fast};
+        }
+
+        thread_local std::array<char, 64> buffer;
+        size_t buf_len = std::min(length, buffer.size() - 1);
+        std::memcpy(buffer.data(), input_.data() + start, buf_len);
+        buffer[buf_len] = '\0';
+        char* end_ptr;
+        double value = std::strtod(buffer.data(), &end_ptr);
+        if (end_ptr != buffer.data() + buf_len) {
+            return std::unexpected(
+                make_error(json_error_code::invalid_number, "Failed to parse number"));
+        }
+        return arena_value{value};
+    }
+
+    auto parse_array() -> json_result<arena_value> {
+        pos_++;  // Skip '['
+        ++depth_;
+        skip_ws();
+
+        arena_array array(mr_);
+        if (pos_ < input_.size() && input_[pos_] == ']') {
+            pos_++;
+            --depth_;
+            return arena_value{std::move(array)};
+        }
+
+        // Exact-capacity reserve matters twice as much here: a vector regrow
+        // inside a monotonic arena strands the old allocation for the
+        // arena's lifetime
+        if (g_config.presize_containers) {
+            if (auto commas = prescan_separator_count(
+                    std::span<const char>(input_.data(), input_.size()), pos_, ',', ']')) {
+                array.reserve(*commas + 1);
+            }
+        }
+
+        while (true) {
+            auto element = parse_value();
+            if (!element) {
+                --depth_;
+                return std::unexpected(element.error());
+            }
+            array.emplace_back(std::move(*element));
+            skip_ws();
+            if (pos_ >= input_.size()) {
+                --depth_;
+                return std::unexpected(
+                    make_error(json_error_code::unexpected_end, "Unterminated array"));
+            }
+            if (input_[pos_] == ']') {
+                pos_++;
+                break;
+            }
+            if (input_[pos_] != ',') {
+                --depth_;
+                return std::unexpected(
+                    make_error(json_error_code::invalid_syntax, "Expected ',' or ']' in array"));
+            }
+            pos_++;
+        }
+
+        --depth_;
+        return arena_value{std::move(array)};
+    }
+
+    auto parse_object() -> json_result<arena_value> {
+        pos_++;  // Skip '{'
+        ++depth_;
+        skip_ws();
+
+        arena_object object(mr_);
+        if (pos_ < input_.size() && input_[pos_] == '}') {
+            pos_++;
+            --depth_;
+            return arena_value{std::move(object)};
+        }
+
+        if (g_config.presize_containers) {
+            if (auto pairs = prescan_separator_count(
+                    std::span<const char>(input_.data(), input_.size()), pos_, ':', '}')) {
+                object.reserve(*pairs);
+            }
+        }
+
+        while (true) {
+            skip_ws();
+            if (pos_ >= input_.size() || input_[pos_] != '"') {
+                --depth_;
+                return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                  "Expected string key in object"));
+            }
+            auto key = parse_string();
+            if (!key) {
+                --depth_;
+                return std::unexpected(key.error());
+            }
+
+            skip_ws();
+            if (pos_ >= input_.size() || input_[pos_] != ':') {
+                --depth_;
+                return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                  "Expected ':' after object key"));
+            }
+            pos_++;
+
+            auto value = parse_value();
+            if (!value) {
+                --depth_;
+                return std::unexpected(value.error());
+            }
+            object.emplace(arena_string(key->as_string(), mr_), std::move(*value));
+
+            skip_ws();
+            if (pos_ >= input_.size()) {
+                --depth_;
+                return std::unexpected(
+                    make_error(json_error_code::unexpected_end, "Unterminated object"));
+            }
+            if (input_[pos_] == '}') {
+                pos_++;
+                break;
+            }
+            if (input_[pos_] != ',') {
+                --depth_;
+                return std::unexpected(
+                    make_error(json_error_code::invalid_syntax, "Expected ',' or '}' in object"));
+            }
+            pos_++;
+        }
+
+        --depth_;
+        return arena_value{std::move(object)};
+    }
+
+    std::string_view input_;
+    std::pmr::memory_resource* mr_;
+    size_t pos_;
+    size_t depth_;
+};
+
+}  // namespace detail
+
+// Parse into a single monotonic arena. The optional size hint pre-sizes the
+// first arena block (roughly 2x input size covers typical DOM expansion).
+export auto parse_arena(std::string_view input, size_t arena_size_hint = 0)
+    -> json_result<arena_document> {
+    if (arena_size_hint == 0) {
+        arena_size_hint = std::max<size_t>(4096, input.size() * 2);
+    }
+    // Large arenas get huge-page blocks so multi-GB DOMs don't thrash the dTLB
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource();
+    if (g_config.huge_page_threshold != 0 && arena_size_hint >= g_config.huge_page_threshold) {
+        upstream = &fastjson::numa::get_huge_page_resource();
+    }
+    auto arena = std::make_unique<std::pmr::monotonic_buffer_resource>(arena_size_hint, upstream);
+
+    detail::arena_parser p(input, arena.get());
+    auto result = p.parse();
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    return arena_document{std::move(arena), {}, std::move(*result)};
+}
+
+// Process-wide upstream for NUMA-aware arenas. numa_alloc_local binds pages
+// to whichever thread faults them, so one shared resource still yields
+// node-local placement per worker; a static avoids tying arena lifetime to
+// any worker thread's thread_local storage.
+static auto numa_arena_upstream() -> std::pmr::memory_resource& {
+    static fastjson::numa::numa_allocator allocator;
+    static fastjson::numa::numa_memory_resource resource(allocator);
+    return resource;
+}
+
+// Huge pages also place by first touch, so they stay NUMA-friendly; prefer
+// them once an arena is big enough to matter for the dTLB.
+static auto numa_arena_upstream_for(size_t arena_size) -> std::pmr::memory_resource& {
+    if (g_config.huge_page_threshold != 0 && arena_size >= g_config.huge_page_threshold) {
+        return fastjson::numa::get_huge_page_resource();
+    }
+    return numa_arena_upstream();
+}
+
+// NUMA-aware arena parse. Large top-level arrays are split at element
+// boundaries and each worker parses its slice into its own monotonic arena
+// whose upstream allocates node-locally, so a worker's sub-tree pages land on
+// the node that worker was bound to. Inputs that are not large arrays fall
+// back to the sequential arena parse, still node-local to the calling thread.
+// Element sub-trees reference their worker arenas, which the returned
+// document keeps alive alongside the main arena.
+export auto parse_arena_numa(std::string_view input, size_t arena_size_hint = 0)
+    -> json_result<arena_document> {
+    if (arena_size_hint == 0) {
+        arena_size_hint = std::max<size_t>(4096, input.size() * 2);
+    }
+
+    size_t pos = 0;
+    while (pos < input.size() && std::isspace(static_cast<unsigned char>(input[pos]))) {
+        pos++;
+    }
+
+    // Find top-level array element boundaries (same depth/string scan as the
+    // parallel tree parser's fallback path).
+    struct element_span {
+        size_t start;
+        size_t end;
+    };
+    std::vector<element_span> element_spans;
+    if (pos < input.size() && input[pos] == '[') {
+        size_t scan_pos = pos + 1;
+        int depth = 0;
+        bool in_string = false;
+        bool escape_next = false;
+        size_t element_start = scan_pos;
+        bool found_end = false;
+
+        while (scan_pos < input.size() && !found_end) {
+            char c = input[scan_pos];
+            if (in_string) {
+                if (escape_next) {
+                    escape_next = false;
+                } else if (c == '\\') {
+                    escape_next = true;
+                } else if (c == '"') {
+                    in_string = false;
+                }
+            } else {
+                switch (c) {
+                    case '"':
+                        in_string = true;
+                        break;
+                    case '[':
+                    case '{':
+                        depth++;
+                        break;
+                    case '}':
+                        depth--;
+                        break;
+                    case ']':
+                        if (depth == 0) {
+                            if (element_start < scan_pos) {
+                                element_spans.push_back({element_start, scan_pos});
+                            }
+                            found_end = true;
+                        } else {
+                            depth--;
+                        }
+                        break;
+                    case ',':
+                        if (depth == 0) {
+                            element_spans.push_back({element_start, scan_pos});
+                            element_start = scan_pos + 1;
+                        }
+                        break;
+                }
+            }
+            if (!found_end) {
+                scan_pos++;
+            }
+        }
+    }
+
+    if (element_spans.size() < static_cast<size_t>(g_config.parallel_threshold / 100)) {
+        auto arena = std::make_unique<std::pmr::monotonic_buffer_resource>(
+            arena_size_hint, &numa_arena_upstream_for(arena_size_hint));
+        detail::arena_parser p(input, arena.get());
+        auto result = p.parse();
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+        return arena_document{std::move(arena), {}, std::move(*result)};
+    }
+
+    // Initialize NUMA topology if enabled (once per process)
+    if (g_config.enable_numa && !g_numa_initialized.load(std::memory_order_acquire)) {
+        bool expected = false;
+        if (g_numa_initialized.compare_exchange_strong(expected, true)) {
+            g_numa_topo = numa::detect_numa_topology();
+        }
+    }
+
+    tuner::decision tune;
+    int num_workers;
+    if (g_config.auto_tune_threads) {
+        tune = tuner::pick(input.size(), element_spans.size());
+        num_workers = tune.threads;
+    } else {
+        num_workers = get_effective_num_threads(element_spans.size());
+    }
+    if (num_workers < 1) {
+        num_workers = 1;
+    }
+
+    std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> worker_arenas;
+    worker_arenas.reserve(static_cast<size_t>(num_workers));
+    size_t per_worker_hint =
+        std::max<size_t>(4096, arena_size_hint / static_cast<size_t>(num_workers));
+    for (int t = 0; t < num_workers; ++t) {
+        worker_arenas.push_back(std::make_unique<std::pmr::monotonic_buffer_resource>(
+            per_worker_hint, &numa_arena_upstream_for(per_worker_hint)));
+    }
+
+    std::vector<arena_value> elements(element_spans.size());
+    std::atomic<bool> has_error{false};
+    json_error first_error{};
+
+    uint64_t tune_start = g_config.auto_tune_threads ? tuner::now_ns() : 0;
+
+    // schedule(static) gives each worker a contiguous iteration block and
+    // therefore exclusive use of one arena; monotonic arenas are not
+    // thread-safe, so the tree parser's dynamic schedule cannot be used here.
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static) num_threads(num_workers)
+#endif
+    for (size_t i = 0; i < element_spans.size(); ++i) {
+        int slot = 0;
+#ifdef _OPENMP
+        slot = omp_get_thread_num();
+#endif
+
+        // Bind thread to NUMA node on first iteration
+        if (g_config.enable_numa && g_config.bind_threads_to_numa
+            && g_numa_topo.is_numa_available) {
+    #ifdef _OPENMP
+            static thread_local bool thread_bound = false;
+            if (!thread_bound) {
+                int node =
+                    numa::get_optimal_node_for_thread(slot, num_workers, g_numa_topo.num_nodes);
+                numa::bind_thread_to_numa_node(node);
+                thread_bound = true;
+            }
+    #endif
+        }
+
+        if (has_error.load(std::memory_order_relaxed)) {
+            continue;  // Skip if another thread hit an error
+        }
+
+        auto& span = element_spans[i];
+        std::string_view element_input = input.substr(span.start, span.end - span.start);
+        while (!element_input.empty()
+               && std::isspace(static_cast<unsigned char>(element_input.front()))) {
+            element_input.remove_prefix(1);
+        }
+        while (!element_input.empty()
+               && std::isspace(static_cast<unsigned char>(element_input.back()))) {
+            element_input.remove_suffix(1);
+        }
+
+        detail::arena_parser element_parser(element_input,
+                                            worker_arenas[static_cast<size_t>(slot)].get());
+        auto result = element_parser.parse();
+        if (!result) {
+            bool expected = false;
+            if (has_error.compare_exchange_strong(expected, true)) {
+                first_error = result.error();
+            }
+        } else {
+            elements[i] = std::move(*result);
+        }
+    }
+
+    if (g_config.auto_tune_threads && !has_error) {
+        tuner::record(tune, input.size(), tuner::now_ns() - tune_start);
+    }
+
+    if (has_error) {
+        return std::unexpected(first_error);
+    }
+
+    // The root array lives in the main arena; element sub-trees stay in
+    // their worker arenas (arena_value is not allocator-aware, so the move
+    // keeps the original allocators).
+    auto arena =
+        std::make_unique<std::pmr::monotonic_buffer_resource>(4096, &numa_arena_upstream());
+    arena_array array(arena.get());
+    array.reserve(elements.size());
+    for (auto& element : elements) {
+        array.emplace_back(std::move(element));
+    }
+    return arena_document{std::move(arena), std::move(worker_arenas),
+                          arena_value{std::move(array)}};
+}
+
+// ============================================================================
+// Compact Tagged-Node Document (16-byte nodes, inline short strings)
+// ============================================================================
+// Engine variant for memory-bound workloads: the DOM is a flat vector of
+// 16-byte tagged nodes instead of a variant over std::string, std::vector
+// and std::unordered_map. Strings of up to 14 bytes live inline in the node;
+// longer strings share one pool. Arrays and objects reference contiguous
+// index ranges in a shared child table, so a large record payload parses
+// into three flat allocations that can stay LLC-resident. Integers wider
+// than int64 degrade to double here - use the default or arena engines when
+// 128-bit integer fidelity matters.
+
+namespace detail {
+
+struct compact_node {
+    // Booleans are folded into the tag so scalar nodes need no payload
+    enum : uint8_t {
+        tag_null = 0,
+        tag_false,
+        tag_true,
+        tag_double,
+        tag_int,           // int64 in payload
+        tag_short_string,  // <= 14 bytes inline, length in short_len
+        tag_string,        // (offset, length) into the document string pool
+        tag_array,         // (offset, count) into the child table
+        tag_object         // (offset, pair count); children hold key,value node pairs
+    };
+
+    uint8_t tag = tag_null;
+    uint8_t short_len = 0;
+    char payload[14] = {};
+
+    // Payload accessors go through memcpy: the node is packed, so the 8-byte
+    // loads are unaligned by design
+    [[nodiscard]] static auto from_double(double d) -> compact_node {
+        compact_node n;
+        n.tag = tag_double;
+        std::memcpy(n.payload, &d, sizeof(d));
+        return n;
+    }
+
+    [[nodiscard]] static auto from_int(int64_t i) -> compact_node {
+        compact_node n;
+        n.tag = tag_int;
+        std::memcpy(n.payload, &i, sizeof(i));
+        return n;
+    }
+
+    [[nodiscard]] static auto from_short_string(std::string_view s) -> compact_node {
+        compact_node n;
+        n.tag = tag_short_string;
+        n.short_len = static_cast<uint8_t>(s.size());
+        std::memcpy(n.payload, s.data(), s.size());
+        return n;
+    }
+
+    [[nodiscard]] static auto from_span(uint8_t tag, uint32_t offset, uint32_t count)
+        -> compact_node {
+        compact_node n;
+        n.tag = tag;
+        std::memcpy(n.payload, &offset, sizeof(offset));
+        std::memcpy(n.payload + sizeof(offset), &count, sizeof(count));
+        return n;
+    }
+
+    [[nodiscard]] auto as_double() const -> double {
+        double d;
+        std::memcpy(&d, payload, sizeof(d));
+        return d;
+    }
+
+    [[nodiscard]] auto as_int() const -> int64_t {
+        int64_t i;
+        std::memcpy(&i, payload, sizeof(i));
+        return i;
+    }
+
+    [[nodiscard]] auto span_offset() const -> uint32_t {
+        uint32_t v;
+        std::memcpy(&v, payload, sizeof(v));
+        return v;
+    }
+
+    [[nodiscard]] auto span_count() const -> uint32_t {
+        uint32_t v;
+        std::memcpy(&v, payload + sizeof(uint32_t), sizeof(v));
+        return v;
+    }
+
+    static constexpr size_t inline_capacity = sizeof(payload);
+};
+static_assert(sizeof(compact_node) == 16, "compact nodes must stay 16 bytes");
+
+class compact_parser;
+
+}  // namespace detail
+
+export class compact_document {
+public:
+    // Lightweight cursor into the node table; views must not outlive the
+    // document. Mirrors the json_value accessor surface.
+    class view {
+    public:
+        view(const compact_document* doc, uint32_t index) : doc_(doc), index_(index) {}
+
+        auto is_null() const -> bool { return node().tag == detail::compact_node::tag_null; }
+        auto is_bool() const -> bool {
+            return node().tag == detail::compact_node::tag_false ||
+                   node().tag == detail::compact_node::tag_true;
+        }
+        auto is_number() const -> bool {
+            return node().tag == detail::compact_node::tag_double ||
+                   node().tag == detail::compact_node::tag_int;
+        }
+        auto is_int() const -> bool { return node().tag == detail::compact_node::tag_int; }
+        auto is_string() const -> bool {
+            return node().tag == detail::compact_node::tag_short_string ||
+                   node().tag == detail::compact_node::tag_string;
+        }
+        auto is_array() const -> bool { return node().tag == detail::compact_node::tag_array; }
+        auto is_object() const -> bool { return node().tag == detail::compact_node::tag_object; }
+
+        auto as_bool() const -> bool { return node().tag == detail::compact_node::tag_true; }
+
+        auto as_number() const -> double {
+            const auto& n = node();
+            return n.tag == detail::compact_node::tag_int ? static_cast<double>(n.as_int())
+                                                          : n.as_double();
+        }
+
+        auto as_int() const -> int64_t { return node().as_int(); }
+
+        auto as_string() const -> std::string_view {
+            const auto& n = node();
+            if (n.tag == detail::compact_node::tag_short_string) {
+                return {n.payload, n.short_len};
+            }
+            return {doc_->pool_.data() + n.span_offset(), n.span_count()};
+        }
+
+        // Array element count, or object pair count
+        auto size() const -> size_t { return node().span_count(); }
+
+        auto operator[](size_t i) const -> view {
+            const auto& n = node();
+            return view{doc_, doc_->children_[n.span_offset() + i]};
+        }
+
+        auto key(size_t i) const -> std::string_view {
+            const auto& n = node();
+            return view{doc_, doc_->children_[n.span_offset() + 2 * i]}.as_string();
+        }
+
+        auto value(size_t i) const -> view {
+            const auto& n = node();
+            return view{doc_, doc_->children_[n.span_offset() + 2 * i + 1]};
+        }
+
+        auto find(std::string_view k) const -> std::optional<view> {
+            for (size_t i = 0; i < size(); ++i) {
+                if (key(i) == k) {
+                    return value(i);
+                }
+            }
+            return std::nullopt;
+        }
+
+    private:
+        auto node() const -> const detail::compact_node& { return doc_->nodes_[index_]; }
+
+        const compact_document* doc_;
+        uint32_t index_;
+    };
+
+    auto root() const -> view { return view{this, root_}; }
+
+    auto node_count() const -> size_t { return nodes_.size(); }
+
+    auto memory_usage() const -> size_t {
+        return nodes_.capacity() * sizeof(detail::compact_node) +
+               children_.capacity() * sizeof(uint32_t) + pool_.capacity();
+    }
+
+private:
+    friend class detail::compact_parser;
+
+    std::vector<detail::compact_node> nodes_;
+    std::vector<uint32_t> children_;  // flattened element / key-value index lists
+    std::string pool_;                // long string bytes
+    uint32_t root_ = 0;
+};
+
+namespace detail {
+
+// Recursive-descent parser emitting compact nodes. Shares the SIMD scanning
+// kernels and number tiers with arena_parser; container children gather in a
+// mark/rewind scratch so nesting costs no per-level allocations.
+class compact_parser {
+public:
+    compact_parser(std::string_view input, compact_document& doc)
+        : input_(input), doc_(doc), pos_(0), depth_(0) {
+        doc_.nodes_.reserve(input.size() / 8 + 4);
+    }
+
+    auto parse() -> json_result<void> {
+        skip_ws();
+        if (pos_ >= input_.size()) {
+            return std::unexpected(make_error(json_error_code::empty_input, "Empty input"));
+        }
+        auto root = parse_value();
+        if (!root) {
+            return std::unexpected(root.error());
+        }
+        skip_ws();
+        if (pos_ < input_.size()) {
+            return std::unexpected(make_error(json_error_code::extra_tokens,
+                                              "Unexpected characters after JSON value"));
+        }
+        doc_.root_ = *root;
+        return {};
+    }
+
+private:
+    auto skip_ws() -> void {
+        pos_ = skip_whitespace_simd(std::span<const char>(input_.data(), input_.size()), pos_);
+    }
+
+    auto make_error(json_error_code code, const char* message) const -> json_error {
+        return json_error{code, message, 0, pos_};
+    }
+
+    auto push(compact_node node) -> uint32_t {
+        doc_.nodes_.push_back(node);
+        return static_cast<uint32_t>(doc_.nodes_.size() - 1);
+    }
+
+    auto parse_value() -> json_result<uint32_t> {
+        if (depth_ >= g_config.max_depth) {
+            return std::unexpected(make_error(json_error_code::max_depth_exceeded,
+                                              "Maximum nesting depth exceeded"));
+        }
+        skip_ws();
+        if (pos_ >= input_.size()) {
+            return std::unexpected(
+                make_error(json_error_code::unexpected_end, "Unexpected end of input"));
+        }
+
+        std::span<const char> data(input_.data(), input_.size());
+        char c = input_[pos_];
+        switch (c) {
+            case '{':
+                return parse_object();
+            case '[':
+                return parse_array();
+            case '"':
+                return parse_string();
+            case 't':
+                if (match_literal_simd(data, pos_, "true", 4)) {
+                    pos_ += 4;
+                    compact_node n;
+                    n.tag = compact_node::tag_true;
+                    return push(n);
+                }
+                return std::unexpected(
+                    make_error(json_error_code::invalid_literal, "Invalid true literal"));
+            case 'f':
+                if (match_literal_simd(data, pos_, "false", 5)) {
+                    pos_ += 5;
+                    compact_node n;
+                    n.tag = compact_node::tag_false;
+                    return push(n);
+                }
+                return std::unexpected(
+                    make_error(json_error_code::invalid_literal, "Invalid false literal"));
+            case 'n':
+                if (match_literal_simd(data, pos_, "null", 4)) {
+                    pos_ += 4;
+                    return push(compact_node{});
+                }
+                return std::unexpected(
+                    make_error(json_error_code::invalid_literal, "Invalid null literal"));
+            default:
+                if (c == '-' || (c >= '0' && c <= '9')) {
+                    return parse_number();
+                }
+                return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                  "Unexpected character"));
+        }
+    }
+
+    auto parse_string() -> json_result<uint32_t> {
+        pos_++;  // Skip opening quote
+        string_buf_.clear();
+
+        std::span<const char> data(input_.data(), input_.size());
+        while (pos_ < input_.size()) {
+            size_t special = find_string_end_dispatch(data, pos_);
+            if (special > pos_) {
+                string_buf_.append(input_.data() + pos_, special - pos_);
+                pos_ = special;
+            }
+            if (pos_ >= input_.size()) {
+                break;
+            }
+            char c = input_[pos_];
+            if (c == '"') {
+                pos_++;
+                if (string_buf_.size() <= compact_node::inline_capacity) {
+                    return push(compact_node::from_short_string(string_buf_));
+                }
+                uint32_t offset = static_cast<uint32_t>(doc_.pool_.size());
+                doc_.pool_.append(string_buf_);
+                return push(compact_node::from_span(compact_node::tag_string, offset,
+                                                    static_cast<uint32_t>(string_buf_.size())));
+            }
+            if (c == '\\') {
+                auto next = decode_one_escape(input_, pos_, string_buf_);
+                if (!next) {
+                    return std::unexpected(next.error());
+                }
+                pos_ = *next;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                return std::unexpected(make_error(json_error_code::invalid_string,
+                                                  "Control character in string"));
+            }
+            if (string_buf_.size() > g_config.max_string_length) {
+                return std::unexpected(make_error(json_error_code::invalid_string,
+                                                  "String exceeds maximum length"));
+            }
+        }
+        return std::unexpected(
+            make_error(json_error_code::invalid_string, "Unterminated string"));
+    }
+
+    auto parse_number() -> json_result<uint32_t> {
+        size_t start = pos_;
+        bool integral = true;
+        if (input_[pos_] == '-') {
+            pos_++;
+        }
+        while (pos_ < input_.size()) {
+            char c = input_[pos_];
+            if (c >= '0' && c <= '9') {
+                pos_++;
+            } else if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+                integral = false;
+                pos_++;
+            } else {
+                break;
+            }
+        }
+        size_t length = pos_ - start;
+        if (length == 0 || (length == 1 && input_[start] == '-')) {
+            return std::unexpected(
+                make_error(json_error_code::invalid_number, "Invalid number format"));
+        }
+
+        if (integral) {
+            const char* p = input_.data() + start;
+            const char* end = input_.data() + pos_;
+            bool neg = (*p == '-');
+            if (neg) {
+                p++;
+            }
+            if (static_cast<size_t>(end - p) <= 19) {
+                uint64_t fast = 0;
+                while (end - p >= 8) {
+                    fast = fast * 100000000ULL + parse_eight_digits_swar(p);
+                    p += 8;
+                }
+                while (p < end) {
+                    fast = fast * 10 + static_cast<uint64_t>(*p++ - '0');
+                }
+                // int64 when it fits; otherwise degrade to double (the node
+                // has no room for wider integers)
+                if (neg && fast <= static_cast<uint64_t>(INT64_MAX) + 1) {
+                    return push(compact_node::from_int(-static_cast<int64_t>(fast - 1) - 1));
+                }
+                if (!neg && fast <= static_cast<uint64_t>(INT64_MAX)) {
+                    return push(compact_node::from_int(static_cast<int64_t>(fast)));
+                }
+            }
+        }
+
+        std::string_view number_str = input_.substr(start, length);
+        if (auto fast = fastjson::numbers::parse_double(number_str)) {
+            return push(compact_node::from_double(*fast));
+        }
+
+        thread_local std::array<char, 64> buffer;
+        size_t buf_len = std::min(length, buffer.size() - 1);
+        std::memcpy(buffer.data(), input_.data() + start, buf_len);
+        buffer[buf_len] = '\0';
+        char* end_ptr;
+        double value = std::strtod(buffer.data(), &end_ptr);
+        if (end_ptr != buffer.data() + buf_len) {
+            return std::unexpected(
+                make_error(json_error_code::invalid_number, "Failed to parse number"));
+        }
+        return push(compact_node::from_double(value));
+    }
+
+    auto parse_array() -> json_result<uint32_t> {
+        pos_++;  // Skip '['
+        ++depth_;
+        skip_ws();
+
+        size_t mark = scratch_.size();
+        if (pos_ < input_.size() && input_[pos_] == ']') {
+            pos_++;
+            --depth_;
+            return push(compact_node::from_span(compact_node::tag_array, 0, 0));
+        }
+
+        while (true) {
+            auto element = parse_value();
+            if (!element) {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(element.error());
+            }
+            scratch_.push_back(*element);
+            skip_ws();
+            if (pos_ >= input_.size()) {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(
+                    make_error(json_error_code::unexpected_end, "Unterminated array"));
+            }
+            if (input_[pos_] == ']') {
+                pos_++;
+                break;
+            }
+            if (input_[pos_] != ',') {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(
+                    make_error(json_error_code::invalid_syntax, "Expected ',' or ']' in array"));
+            }
+            pos_++;
+        }
+
+        --depth_;
+        return push(commit_children(mark, compact_node::tag_array,
+                                    static_cast<uint32_t>(scratch_.size() - mark)));
+    }
+
+    auto parse_object() -> json_result<uint32_t> {
+        pos_++;  // Skip '{'
+        ++depth_;
+        skip_ws();
+
+        size_t mark = scratch_.size();
+        if (pos_ < input_.size() && input_[pos_] == '}') {
+            pos_++;
+            --depth_;
+            return push(compact_node::from_span(compact_node::tag_object, 0, 0));
+        }
+
+        while (true) {
+            skip_ws();
+            if (pos_ >= input_.size() || input_[pos_] != '"') {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                  "Expected string key in object"));
+            }
+            auto key = parse_string();
+            if (!key) {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(key.error());
+            }
+
+            skip_ws();
+            if (pos_ >= input_.size() || input_[pos_] != ':') {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(make_error(json_error_code::invalid_syntax,
+                                                  "Expected ':' after object key"));
+            }
+            pos_++;
+
+            auto value = parse_value();
+            if (!value) {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(value.error());
+            }
+            scratch_.push_back(*key);
+            scratch_.push_back(*value);
+
+            skip_ws();
+            if (pos_ >= input_.size()) {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(
+                    make_error(json_error_code::unexpected_end, "Unterminated object"));
+            }
+            if (input_[pos_] == '}') {
+                pos_++;
+                break;
+            }
+            if (input_[pos_] != ',') {
+                --depth_;
+                scratch_.resize(mark);
+                return std::unexpected(
+                    make_error(json_error_code::invalid_syntax, "Expected ',' or '}' in object"));
+            }
+            pos_++;
+        }
+
+        --depth_;
+        return push(commit_children(mark, compact_node::tag_object,
+                                    static_cast<uint32_t>((scratch_.size() - mark) / 2)));
+    }
+
+    // Move the child indices gathered since mark into the document's child
+    // table and build the container node referencing them
+    auto commit_children(size_t mark, uint8_t tag, uint32_t count) -> compact_node {
+        uint32_t offset = static_cast<uint32_t>(doc_.children_.size());
+        doc_.children_.insert(doc_.children_.end(), scratch_.begin() + mark, scratch_.end());
+        scratch_.resize(mark);
+        return compact_node::from_span(tag, offset, count);
+    }
+
+    std::string_view input_;
+    compact_document& doc_;
+    size_t pos_;
+    size_t depth_;
+    std::string string_buf_;
+    std::vector<uint32_t> scratch_;
+};
+
+}  // namespace detail
+
+// Parse into the compact tagged-node representation
+export auto parse_compact(std::string_view input) -> json_result<compact_document> {
+    compact_document doc;
+    detail::compact_parser p(input, doc);
+    auto result = p.parse();
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    return doc;
+}
+
+// ============================================================================
+// Streaming SAX-Style Push Parser
+// ============================================================================
+// Event-driven scan that never builds a DOM: the handler receives
+// begin/end/key/value events while the engine walks the input with the same
+// SIMD kernels as the tree parser. Memory use is O(nesting depth), so
+// arbitrarily large archives can be scanned chunk-free. String and number
+// events carry raw (still-escaped) spans into the input; consumers that need
+// unescaped text decode only the values they care about.
+
+export struct sax_handler {
+    virtual ~sax_handler() = default;
+
+    // Return false from any callback to abort the scan early (not an error).
+    virtual auto on_object_begin() -> bool { return true; }
+    virtual auto on_object_end() -> bool { return true; }
+    virtual auto on_array_begin() -> bool { return true; }
+    virtual auto on_array_end() -> bool { return true; }
+    virtual auto on_key(std::string_view raw_key) -> bool { return true; }
+    virtual auto on_string(std::string_view raw_value) -> bool { return true; }
+    virtual auto on_number(std::string_view raw_number) -> bool { return true; }
+    virtual auto on_bool(bool value) -> bool { return true; }
+    virtual auto on_null() -> bool { return true; }
+};
+
+namespace detail {
+
+// Scan a string starting at the opening quote; returns position one past the
+// closing quote, or nullopt on an unterminated string. Escapes are skipped,
+// not decoded - the raw span is what the handler sees.
+inline auto scan_raw_string(std::string_view input, size_t quote_pos)
+    -> std::optional<size_t> {
+    std::span<const char> data(input.data(), input.size());
+    size_t pos = quote_pos + 1;
+
+    while (pos < input.size()) {
+        pos = find_string_end_dispatch(data, pos);
+        if (pos >= input.size()) {
+            break;
+        }
+        char c = input[pos];
+        if (c == '"') {
+            return pos + 1;
+        }
+        if (c == '\\') {
+            pos += 2;  // Skip escape pair; \uXXXX tails are plain chars
+            continue;
+        }
+        return std::nullopt;  // Raw control character in string
+    }
+    return std::nullopt;
+}
+
+}  // namespace detail
+
+export auto parse_sax(std::string_view input, sax_handler& handler) -> json_result<void> {
+    std::span<const char> data(input.data(), input.size());
+
+    // Explicit container stack: one byte per nesting level ('{' or '[')
+    std::vector<char> stack;
+    stack.reserve(64);
+
+    auto make_sax_error = [&](json_error_code code, const char* message,
+                              size_t pos) -> json_error {
+        return json_error{code, message, 0, pos};
+    };
+
+    size_t pos = skip_whitespace_simd(data, 0);
+    if (pos >= input.size()) {
+        return std::unexpected(
+            make_sax_error(json_error_code::empty_input, "Empty input", pos));
+    }
+
+    enum class expect_t { value, key, colon, comma_or_close };
+    expect_t expect = expect_t::value;
+    bool aborted = false;
+
+    while (pos < input.size() || expect != expect_t::value || !stack.empty()) {
+        pos = skip_whitespace_simd(data, pos);
+        if (pos >= input.size()) {
+            break;
+        }
+        if (stack.size() >= g_config.max_depth) {
+            return std::unexpected(make_sax_error(json_error_code::max_depth_exceeded,
+                                                  "Maximum nesting depth exceeded", pos));
+        }
+
+        char c = input[pos];
+
+        if (expect == expect_t::key) {
+            if (c == '}') {
+                // Empty object
+                pos++;
+                stack.pop_back();
+                if (!handler.on_object_end()) { aborted = true; break; }
+                expect = expect_t::comma_or_close;
+                continue;
+            }
+            if (c != '"') {
+                return std::unexpected(make_sax_error(json_error_code::invalid_syntax,
+                                                      "Expected string key in object", pos));
+            }
+            auto key_end = detail::scan_raw_string(input, pos);
+            if (!key_end) {
+                return std::unexpected(make_sax_error(json_error_code::invalid_string,
+                                                      "Unterminated object key", pos));
+            }
+            if (!handler.on_key(input.substr(pos + 1, *key_end - pos - 2))) {
+                aborted = true;
+                break;
+            }
+            pos = *key_end;
+            expect = expect_t::colon;
+            continue;
+        }
+
+        if (expect == expect_t::colon) {
+            if (c != ':') {
+                return std::unexpected(make_sax_error(json_error_code::invalid_syntax,
+                                                      "Expected ':' after object key", pos));
+            }
+            pos++;
+            expect = expect_t::value;
+            continue;
+        }
+
+        if (expect == expect_t::comma_or_close) {
+            if (c == ',') {
+                pos++;
+                expect = stack.empty()
+                             ? expect_t::value
+                             : (stack.back() == '{' ? expect_t::key : expect_t::value);
+                if (stack.empty()) {
+                    return std::unexpected(make_sax_error(json_error_code::extra_tokens,
+                                                          "Unexpected ',' after document", pos));
+                }
+                continue;
+            }
+            if (c == '}' && !stack.empty() && stack.back() == '{') {
+                pos++;
+                stack.pop_back();
+                if (!handler.on_object_end()) { aborted = true; break; }
+                continue;  // Still comma_or_close for the parent
+            }
+            if (c == ']' && !stack.empty() && stack.back() == '[') {
+                pos++;
+                stack.pop_back();
+                if (!handler.on_array_end()) { aborted = true; break; }
+                continue;
+            }
+            return std::unexpected(make_sax_error(
+                json_error_code::extra_tokens,
+                stack.empty() ? "Unexpected characters after JSON value"
+                              : "Expected ',' or container close",
+                pos));
+        }
+
+        // expect_t::value
+        switch (c) {
+            case '{':
+                pos++;
+                stack.push_back('{');
+                if (!handler.on_object_begin()) { aborted = true; break; }
+                expect = expect_t::key;
+                continue;
+            case '[':
+                pos++;
+                stack.push_back('[');
+                if (!handler.on_array_begin()) { aborted = true; break; }
+                // Peek for empty array
+                pos = skip_whitespace_simd(data, pos);
+                if (pos < input.size() && input[pos] == ']') {
+                    pos++;
+                    stack.pop_back();
+                    if (!handler.on_array_end()) { aborted = true; break; }
+                    expect = expect_t::comma_or_close;
+                }
+                continue;
+            case '"': {
+                auto str_end = detail::scan_raw_string(input, pos);
+                if (!str_end) {
+                    return std::unexpected(make_sax_error(json_error_code::invalid_string,
+                                                          "Unterminated string", pos));
+                }
+                if (!handler.on_string(input.substr(pos + 1, *str_end - pos - 2))) {
+                    aborted = true;
+                    break;
+                }
+                pos = *str_end;
+                expect = expect_t::comma_or_close;
+                continue;
+            }
+            case 't':
+                if (!match_literal_simd(data, pos, "true", 4)) {
+                    return std::unexpected(make_sax_error(json_error_code::invalid_literal,
+                                                          "Invalid true literal", pos));
+                }
+                pos += 4;
+                if (!handler.on_bool(true)) { aborted = true; break; }
+                expect = expect_t::comma_or_close;
+                continue;
+            case 'f':
+                if (!match_literal_simd(data, pos, "false", 5)) {
+                    return std::unexpected(make_sax_error(json_error_code::invalid_literal,
+                                                          "Invalid false literal", pos));
+                }
+                pos += 5;
+                if (!handler.on_bool(false)) { aborted = true; break; }
+                expect = expect_t::comma_or_close;
+                continue;
+            case 'n':
+                if (!match_literal_simd(data, pos, "null", 4)) {
+                    return std::unexpected(make_sax_error(json_error_code::invalid_literal,
+                                                          "Invalid null literal", pos));
+                }
+                pos += 4;
+                if (!handler.on_null()) { aborted = true; break; }
+                expect = expect_t::comma_or_close;
+                continue;
+            default: {
+                if (c == '-' || (c >= '0' && c <= '9')) {
+                    size_t num_start = pos;
+                    pos++;
+                    while (pos < input.size()) {
+                        char nc = input[pos];
+                        if ((nc >= '0' && nc <= '9') || nc == '.' || nc == '-' || nc == '+'
+                            || nc == 'e' || nc == 'E') {
+                            pos++;
+                        } else {
+                            break;
+                        }
+                    }
+                    if (!handler.on_number(input.substr(num_start, pos - num_start))) {
+                        aborted = true;
+                        break;
+                    }
+                    expect = expect_t::comma_or_close;
+                    continue;
+                }
+                return std::unexpected(make_sax_error(
+                    json_error_code::invalid_syntax,
+                    "Unexpected character", pos));
+            }
+        }
+
+        if (aborted) {
+            break;
+        }
+    }
+
+    if (aborted) {
+        return {};  // Handler requested early stop
+    }
+
+    if (!stack.empty()) {
+        return std::unexpected(json_error{json_error_code::unexpected_end,
+                                          "Unexpected end of input", 0, pos});
+    }
+    if (expect == expect_t::value) {
+        return std::unexpected(
+            json_error{json_error_code::empty_input, "Empty input", 0, pos});
+    }
+
+    pos = skip_whitespace_simd(data, pos);
+    if (pos < input.size()) {
+        return std::unexpected(json_error{json_error_code::extra_tokens,
+                                          "Unexpected characters after JSON value", 0, pos});
+    }
+
+    return {};
+}
+
+// ============================================================================
+// Coroutine-Based Resumable Stream Parser
+// ============================================================================
+// For documents that arrive across multiple network reads: parsing starts on
+// the first chunk instead of waiting for the whole payload to buffer. The
+// recursive descent is expressed as coroutines that co_await more input
+// whenever the buffered bytes run out, so first-byte-to-parsed latency drops
+// by the transfer time, and the consumed prefix is discarded on every feed -
+// only the unconsumed tail stays resident. Within each contiguous buffered
+// region the scanning runs on the same SIMD kernels as the batch parser.
+
+namespace detail {
+
+// Minimal lazily-started task with symmetric transfer: enough for
+// coroutine-to-coroutine recursion without growing the native stack on
+// resume. Values move out exactly once via await_resume()/take().
+template <typename T>
+class stream_task {
+public:
+    struct promise_type {
+        std::optional<T> value_;
+        std::coroutine_handle<> continuation_;
+
+        auto get_return_object() -> stream_task {
+            return stream_task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+        auto final_suspend() noexcept {
+            struct final_awaiter {
+                auto await_ready() const noexcept -> bool { return false; }
+                auto await_suspend(std::coroutine_handle<promise_type> h) noexcept
+                    -> std::coroutine_handle<> {
+                    auto continuation = h.promise().continuation_;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                auto await_resume() const noexcept -> void {}
+            };
+            return final_awaiter{};
+        }
+        auto return_value(T value) -> void { value_ = std::move(value); }
+        auto unhandled_exception() -> void { std::terminate(); }
+    };
+
+    explicit stream_task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+    stream_task(stream_task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    stream_task(const stream_task&) = delete;
+    auto operator=(const stream_task&) -> stream_task& = delete;
+    auto operator=(stream_task&&) -> stream_task& = delete;
+    ~stream_task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    // Awaiting starts the child coroutine and transfers control into it
+    auto await_ready() const noexcept -> bool { return false; }
+    auto await_suspend(std::coroutine_handle<> caller) noexcept -> std::coroutine_handle<> {
+        handle_.promise().continuation_ = caller;
+        return handle_;
+    }
+    auto await_resume() -> T { return std::move(*handle_.promise().value_); }
+
+    // Root-task interface for stream_parser
+    auto start() -> void { handle_.resume(); }
+    [[nodiscard]] auto done() const -> bool { return handle_.done(); }
+    auto take() -> T { return std::move(*handle_.promise().value_); }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+};
+
+// State shared between the parser coroutines and the feeding side. Heap-
+// allocated by stream_parser so its address stays stable across moves.
+struct stream_state {
+    std::string buffer;
+    size_t pos = 0;        // First unconsumed byte in buffer
+    size_t consumed = 0;   // Bytes discarded before buffer[0] (absolute offsets)
+    bool finished = false;
+    std::coroutine_handle<> waiting{};  // Parser side, parked for more input
+};
+
+// Parks the parser until feed() appends new bytes or finish() is called.
+// Captures the buffer size at construction so each loop iteration waits for
+// genuinely new data instead of spinning.
+struct await_more {
+    stream_state& st;
+    size_t seen;
+
+    explicit await_more(stream_state& s) : st(s), seen(s.buffer.size()) {}
+
+    auto await_ready() const noexcept -> bool {
+        return st.finished || st.buffer.size() > seen;
+    }
+    auto await_suspend(std::coroutine_handle<> handle) noexcept -> void { st.waiting = handle; }
+    auto await_resume() const noexcept -> void {}
+};
+
+inline auto stream_error(const stream_state& st, json_error_code code, const char* message)
+    -> json_error {
+    return json_error{code, message, 0, st.consumed + st.pos};
+}
+
+// Bytes the pending escape at st.pos needs before it can be decoded whole:
+// 2 for the short forms, 6 for \uXXXX, 12 when a high surrogate must be
+// paired. Invalid hex gets the 6-byte answer and lets the decoder report it.
+inline auto stream_escape_need(const stream_state& st) -> size_t {
+    size_t avail = st.buffer.size() - st.pos;
+    if (avail < 2 || st.buffer[st.pos + 1] != 'u') {
+        return 2;
+    }
+    if (avail < 6) {
+        return 6;
+    }
+    auto hex = [&](size_t i) -> int {
+        char c = st.buffer[st.pos + i];
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    };
+    int h0 = hex(2), h1 = hex(3), h2 = hex(4), h3 = hex(5);
+    if (h0 < 0 || h1 < 0 || h2 < 0 || h3 < 0) {
+        return 6;
+    }
+    uint32_t code_unit = static_cast<uint32_t>((h0 << 12) | (h1 << 8) | (h2 << 4) | h3);
+    return (code_unit >= 0xD800 && code_unit <= 0xDBFF) ? 12 : 6;
+}
+
+// Same number tiers as arena_parser, applied to a reassembled token
+inline auto stream_number_value(std::string_view token, bool integral, const stream_state& st)
+    -> json_result<json_value> {
+    if (integral && token.size() <= 38) {
+        const char* p = token.data();
+        const char* end = token.data() + token.size();
+        bool neg = (*p == '-');
+        if (neg) {
+            p++;
+        }
+        if (static_cast<size_t>(end - p) <= 19) {
+            uint64_t fast = 0;
+            while (end - p >= 8) {
+                fast = fast * 100000000ULL + parse_eight_digits_swar(p);
+                p += 8;
+            }
+            while (p < end) {
+                fast = fast * 10 + static_cast<uint64_t>(*p++ - '0');
+            }
+            __int128 result = static_cast<__int128>(fast);
+            return json_value{neg ? -result : result};
+        }
+        unsigned __int128 magnitude = 0;
+        bool overflow = false;
+        while (p < end) {
+            unsigned __int128 prev = magnitude;
+            magnitude = magnitude * 10 + static_cast<unsigned>(*p - '0');
+            if (magnitude < prev) {
+                overflow = true;
+                break;
+            }
+            p++;
+        }
+        if (!overflow) {
+            __int128 result = static_cast<__int128>(magnitude);
+            return json_value{neg ? -result : result};
+        }
+    }
+
+    if (auto fast = fastjson::numbers::parse_double(token)) {
+        return json_value{*fast};
+    }
+
+    thread_local std::array<char, 64> buffer;
+    size_t buf_len = std::min(token.size(), buffer.size() - 1);
+    std::memcpy(buffer.data(), token.data(), buf_len);
+    buffer[buf_len] = '\0';
+    char* end_ptr;
+    double value = std::strtod(buffer.data(), &end_ptr);
+    if (end_ptr != buffer.data() + buf_len) {
+        return std::unexpected(
+            stream_error(st, json_error_code::invalid_number, "Failed to parse number"));
+    }
+    return json_value{value};
+}
+
+// Skips whitespace, waiting for more input while the buffer ends mid-run
+inline auto stream_skip_ws(stream_state& st) -> stream_task<bool> {
+    while (true) {
+        st.pos = skip_whitespace_simd(std::span<const char>(st.buffer.data(), st.buffer.size()),
+                                      st.pos);
+        if (st.pos < st.buffer.size() || st.finished) {
+            co_return true;
+        }
+        co_await await_more{st};
+    }
+}
+
+// Matches a literal, waiting until all its bytes are buffered
+inline auto stream_match_literal(stream_state& st, const char* literal, size_t len)
+    -> stream_task<bool> {
+    while (st.buffer.size() - st.pos < len && !st.finished) {
+        co_await await_more{st};
+    }
+    if (st.buffer.size() - st.pos < len) {
+        co_return false;
+    }
+    std::span<const char> data(st.buffer.data(), st.buffer.size());
+    if (!match_literal_simd(data, st.pos, literal, len)) {
+        co_return false;
+    }
+    st.pos += len;
+    co_return true;
+}
+
+inline auto stream_parse_string(stream_state& st) -> stream_task<json_result<json_value>> {
+    st.pos++;  // Skip opening quote
+    std::string value;
+
+    while (true) {
+        std::span<const char> data(st.buffer.data(), st.buffer.size());
+        size_t special = find_string_end_dispatch(data, st.pos);
+        if (special > st.pos) {
+            value.append(st.buffer, st.pos, special - st.pos);
+            st.pos = special;
+        }
+        if (value.size() > g_config.max_string_length) {
+            co_return std::unexpected(stream_error(st, json_error_code::invalid_string,
+                                                   "String exceeds maximum length"));
+        }
+        if (st.pos >= st.buffer.size()) {
+            if (st.finished) {
+                co_return std::unexpected(
+                    stream_error(st, json_error_code::invalid_string, "Unterminated string"));
+            }
+            co_await await_more{st};
+            continue;
+        }
+
+        char c = st.buffer[st.pos];
+        if (c == '"') {
+            st.pos++;
+            co_return json_value{std::move(value)};
+        }
+        if (c == '\\') {
+            // Wait until the whole escape is buffered so the shared decoder
+            // never sees a split sequence
+            while (!st.finished && st.buffer.size() - st.pos < stream_escape_need(st)) {
+                co_await await_more{st};
+            }
+            auto next = decode_one_escape(st.buffer, st.pos, value);
+            if (!next) {
+                co_return std::unexpected(next.error());
+            }
+            st.pos = *next;
+            continue;
+        }
+        co_return std::unexpected(
+            stream_error(st, json_error_code::invalid_string, "Control character in string"));
+    }
+}
+
+inline auto stream_parse_number(stream_state& st) -> stream_task<json_result<json_value>> {
+    // The token is reassembled into a scratch string because it may straddle
+    // chunk boundaries; it is complete only at a non-number byte or finish()
+    std::string token;
+    bool integral = true;
+    bool complete = false;
+
+    while (!complete) {
+        while (st.pos < st.buffer.size()) {
+            char c = st.buffer[st.pos];
+            if (c >= '0' && c <= '9') {
+                token += c;
+                st.pos++;
+            } else if (c == '-' && token.empty()) {
+                token += c;
+                st.pos++;
+            } else if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+                integral = false;
+                token += c;
+                st.pos++;
+            } else {
+                complete = true;
+                break;
+            }
+        }
+        if (!complete) {
+            if (st.finished) {
+                break;
+            }
+            co_await await_more{st};
+        }
+    }
+
+    if (token.empty() || token == "-") {
+        co_return std::unexpected(
+            stream_error(st, json_error_code::invalid_number, "Invalid number format"));
+    }
+    co_return stream_number_value(token, integral, st);
+}
+
+auto stream_parse_value(stream_state& st, size_t depth) -> stream_task<json_result<json_value>>;
+
+inline auto stream_parse_array(stream_state& st, size_t depth)
+    -> stream_task<json_result<json_value>> {
+    st.pos++;  // Skip '['
+    json_array array;
+
+    co_await stream_skip_ws(st);
+    if (st.pos < st.buffer.size() && st.buffer[st.pos] == ']') {
+        st.pos++;
+        co_return json_value{std::move(array)};
+    }
+
+    while (true) {
+        auto element = co_await stream_parse_value(st, depth);
+        if (!element) {
+            co_return std::unexpected(element.error());
+        }
+        array.emplace_back(std::move(*element));
+
+        co_await stream_skip_ws(st);
+        if (st.pos >= st.buffer.size()) {
+            co_return std::unexpected(
+                stream_error(st, json_error_code::unexpected_end, "Unterminated array"));
+        }
+        if (st.buffer[st.pos] == ']') {
+            st.pos++;
+            break;
+        }
+        if (st.buffer[st.pos] != ',') {
+            co_return std::unexpected(stream_error(st, json_error_code::invalid_syntax,
+                                                   "Expected ',' or ']' in array"));
+        }
+        st.pos++;
+    }
+
+    co_return json_value{std::move(array)};
+}
+
+inline auto stream_parse_object(stream_state& st, size_t depth)
+    -> stream_task<json_result<json_value>> {
+    st.pos++;  // Skip '{'
+    json_object object;
+
+    co_await stream_skip_ws(st);
+    if (st.pos < st.buffer.size() && st.buffer[st.pos] == '}') {
+        st.pos++;
+        co_return json_value{std::move(object)};
+    }
+
+    while (true) {
+        co_await stream_skip_ws(st);
+        if (st.pos >= st.buffer.size() || st.buffer[st.pos] != '"') {
+            co_return std::unexpected(stream_error(st, json_error_code::invalid_syntax,
+                                                   "Expected string key in object"));
+        }
+        auto key = co_await stream_parse_string(st);
+        if (!key) {
+            co_return std::unexpected(key.error());
+        }
+
+        co_await stream_skip_ws(st);
+        if (st.pos >= st.buffer.size() || st.buffer[st.pos] != ':') {
+            co_return std::unexpected(stream_error(st, json_error_code::invalid_syntax,
+                                                   "Expected ':' after object key"));
+        }
+        st.pos++;
+
+        auto value = co_await stream_parse_value(st, depth);
+        if (!value) {
+            co_return std::unexpected(value.error());
+        }
+        object[key->as_string()] = std::move(*value);
+
+        co_await stream_skip_ws(st);
+        if (st.pos >= st.buffer.size()) {
+            co_return std::unexpected(
+                stream_error(st, json_error_code::unexpected_end, "Unterminated object"));
+        }
+        if (st.buffer[st.pos] == '}') {
+            st.pos++;
+            break;
+        }
+        if (st.buffer[st.pos] != ',') {
+            co_return std::unexpected(stream_error(st, json_error_code::invalid_syntax,
+                                                   "Expected ',' or '}' in object"));
+        }
+        st.pos++;
+    }
+
+    co_return json_value{std::move(object)};
+}
+
+inline auto stream_parse_value(stream_state& st, size_t depth)
+    -> stream_task<json_result<json_value>> {
+    if (depth >= g_config.max_depth) {
+        co_return std::unexpected(stream_error(st, json_error_code::max_depth_exceeded,
+                                               "Maximum nesting depth exceeded"));
+    }
+    co_await stream_skip_ws(st);
+    if (st.pos >= st.buffer.size()) {
+        co_return std::unexpected(
+            stream_error(st, json_error_code::unexpected_end, "Unexpected end of input"));
+    }
+
+    char c = st.buffer[st.pos];
+    switch (c) {
+        case '{':
+            co_return co_await stream_parse_object(st, depth + 1);
+        case '[':
+            co_return co_await stream_parse_array(st, depth + 1);
+        case '"':
+            co_return co_await stream_parse_string(st);
+        case 't':
+            if (co_await stream_match_literal(st, "true", 4)) {
+                co_return json_value{true};
+            }
+            co_return std::unexpected(
+                stream_error(st, json_error_code::invalid_literal, "Invalid true literal"));
+        case 'f':
+            if (co_await stream_match_literal(st, "false", 5)) {
+                co_return json_value{false};
+            }
+            co_return std::unexpected(
+                stream_error(st, json_error_code::invalid_literal, "Invalid false literal"));
+        case 'n':
+            if (co_await stream_match_literal(st, "null", 4)) {
+                co_return json_value{};
+            }
+            co_return std::unexpected(
+                stream_error(st, json_error_code::invalid_literal, "Invalid null literal"));
+        default:
+            if (c == '-' || (c >= '0' && c <= '9')) {
+                co_return co_await stream_parse_number(st);
+            }
+            co_return std::unexpected(stream_error(st, json_error_code::invalid_syntax,
+                                                   "Unexpected character"));
+    }
+}
+
+// Top-level driver: value plus trailing-garbage check, same contract as
+// parser::parse()
+inline auto stream_parse_document(stream_state& st) -> stream_task<json_result<json_value>> {
+    co_await stream_skip_ws(st);
+    if (st.pos >= st.buffer.size() && st.finished) {
+        co_return std::unexpected(
+            stream_error(st, json_error_code::empty_input, "Empty input"));
+    }
+    auto result = co_await stream_parse_value(st, 0);
+    if (!result) {
+        co_return std::unexpected(result.error());
+    }
+    co_await stream_skip_ws(st);
+    if (st.pos < st.buffer.size()) {
+        co_return std::unexpected(stream_error(st, json_error_code::extra_tokens,
+                                               "Unexpected characters after JSON value"));
+    }
+    co_return std::move(*result);
+}
+
+}  // namespace detail
+
+// Incremental push interface over the coroutine descent. Typical use:
+//
+//     auto p = parse_stream();
+//     while (auto chunk = co_await socket.read()) p.feed(*chunk);
+//     p.finish();
+//     auto doc = *p.result();
+//
+// feed() runs the parser as far as the new bytes allow and returns when it
+// suspends (or completes); result() is empty until the document is done.
+export class stream_parser {
+public:
+    stream_parser()
+        : state_(std::make_unique<detail::stream_state>()),
+          root_(detail::stream_parse_document(*state_)) {
+        root_.start();  // Runs until the first input suspension
+    }
+
+    // Appends a chunk and resumes the parser. The consumed prefix is
+    // discarded first, so memory tracks the unconsumed tail, not the stream.
+    auto feed(std::string_view chunk) -> void {
+        if (root_.done()) {
+            return;
+        }
+        if (state_->pos > 0) {
+            state_->consumed += state_->pos;
+            state_->buffer.erase(0, state_->pos);
+            state_->pos = 0;
+        }
+        state_->buffer.append(chunk);
+        resume();
+    }
+
+    // Marks end of stream; pending tokens (numbers, literals) terminate here
+    auto finish() -> void {
+        state_->finished = true;
+        resume();
+    }
+
+    [[nodiscard]] auto done() const -> bool { return root_.done(); }
+
+    // Empty until the parse completes; moves the result out when it has
+    auto result() -> std::optional<json_result<json_value>> {
+        if (!root_.done()) {
+            return std::nullopt;
+        }
+        return root_.take();
+    }
+
+private:
+    auto resume() -> void {
+        if (auto handle = std::exchange(state_->waiting, std::coroutine_handle<>{})) {
+            handle.resume();
+        }
+    }
+
+    std::unique_ptr<detail::stream_state> state_;
+    detail::stream_task<json_result<json_value>> root_;
+};
+
+export auto parse_stream() -> stream_parser {
+    return stream_parser{};
+}
+
+// ============================================================================
+// MessagePack Binary Codec
+// ============================================================================
+// Binary serialization sharing the json_value model, for intra-cluster hops
+// where round-tripping through JSON text wastes cycles on number formatting
+// and string escaping. Integers that fit 64 bits use the native MessagePack
+// integer formats; the rare >64-bit values degrade to double (same precision
+// loss the text path has for them via strtod).
+
+namespace msgpack_detail {
+
+template <typename T>
+inline auto store_be(std::vector<uint8_t>& out, T value) -> void {
+    for (int shift = (sizeof(T) - 1) * 8; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<uint8_t>((value >> shift) & 0xFF));
+    }
+}
+
+template <typename T>
+inline auto load_be(const uint8_t* p) -> T {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value = static_cast<T>((value << 8) | p[i]);
+    }
+    return value;
+}
+
+inline auto encode_uint(std::vector<uint8_t>& out, uint64_t value) -> void {
+    if (value <= 0x7F) {
+        out.push_back(static_cast<uint8_t>(value));  // positive fixint
+    } else if (value <= 0xFF) {
+        out.push_back(0xCC);
+        out.push_back(static_cast<uint8_t>(value));
+    } else if (value <= 0xFFFF) {
+        out.push_back(0xCD);
+        store_be(out, static_cast<uint16_t>(value));
+    } else if (value <= 0xFFFFFFFFULL) {
+        out.push_back(0xCE);
+        store_be(out, static_cast<uint32_t>(value));
+    } else {
+        out.push_back(0xCF);
+        store_be(out, value);
+    }
+}
+
+inline auto encode_int(std::vector<uint8_t>& out, int64_t value) -> void {
+    if (value >= 0) {
+        encode_uint(out, static_cast<uint64_t>(value));
+        return;
+    }
+    if (value >= -32) {
+        out.push_back(static_cast<uint8_t>(value));  // negative fixint
+    } else if (value >= INT8_MIN) {
+        out.push_back(0xD0);
+        out.push_back(static_cast<uint8_t>(value));
+    } else if (value >= INT16_MIN) {
+        out.push_back(0xD1);
+        store_be(out, static_cast<uint16_t>(static_cast<int16_t>(value)));
+    } else if (value >= INT32_MIN) {
+        out.push_back(0xD2);
+        store_be(out, static_cast<uint32_t>(static_cast<int32_t>(value)));
+    } else {
+        out.push_back(0xD3);
+        store_be(out, static_cast<uint64_t>(value));
+    }
+}
+
+inline auto encode_double(std::vector<uint8_t>& out, double value) -> void {
+    out.push_back(0xCB);
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    store_be(out, bits);
+}
+
+inline auto encode_string(std::vector<uint8_t>& out, std::string_view s) -> void {
+    size_t len = s.size();
+    if (len <= 31) {
+        out.push_back(static_cast<uint8_t>(0xA0 | len));  // fixstr
+    } else if (len <= 0xFF) {
+        out.push_back(0xD9);
+        out.push_back(static_cast<uint8_t>(len));
+    } else if (len <= 0xFFFF) {
+        out.push_back(0xDA);
+        store_be(out, static_cast<uint16_t>(len));
+    } else {
+        out.push_back(0xDB);
+        store_be(out, static_cast<uint32_t>(len));
+    }
+    out.insert(out.end(), s.begin(), s.end());
+}
+
+inline auto encode_container_header(std::vector<uint8_t>& out, size_t count, bool map) -> void {
+    if (count <= 15) {
+        out.push_back(static_cast<uint8_t>((map ? 0x80 : 0x90) | count));
+    } else if (count <= 0xFFFF) {
+        out.push_back(map ? 0xDE : 0xDC);
+        store_be(out, static_cast<uint16_t>(count));
+    } else {
+        out.push_back(map ? 0xDF : 0xDD);
+        store_be(out, static_cast<uint32_t>(count));
+    }
+}
+
+}  // namespace msgpack_detail
+
+static auto encode_msgpack_value(const json_value& v, std::vector<uint8_t>& out) -> void {
+    using namespace msgpack_detail;
+
+    if (v.is_null()) {
+        out.push_back(0xC0);
+    } else if (v.is_bool()) {
+        out.push_back(v.as_bool() ? 0xC3 : 0xC2);
+    } else if (v.is_int128()) {
+        __int128 value = v.as_int128();
+        if (value >= INT64_MIN && value <= INT64_MAX) {
+            encode_int(out, static_cast<int64_t>(value));
+        } else {
+            encode_double(out, static_cast<double>(value));
+        }
+    } else if (v.is_uint128()) {
+        unsigned __int128 value = v.as_uint128();
+        if (value <= UINT64_MAX) {
+            encode_uint(out, static_cast<uint64_t>(value));
+        } else {
+            encode_double(out, static_cast<double>(value));
+        }
+    } else if (v.is_float128()) {
+        encode_double(out, static_cast<double>(v.as_float128()));
+    } else if (v.is_raw_number()) {
+        const auto& raw = v.as_raw_number();
+        // Integer encoding only when the digit count cannot overflow int128
+        if (raw.is_integral() && raw.token().size() <= 38) {
+            __int128 value = raw.as_int128();
+            if (value >= INT64_MIN && value <= INT64_MAX) {
+                encode_int(out, static_cast<int64_t>(value));
+            } else if (value > 0 && static_cast<unsigned __int128>(value) <= UINT64_MAX) {
+                encode_uint(out, static_cast<uint64_t>(value));
+            } else {
+                encode_double(out, raw.as_double());
+            }
+        } else {
+            encode_double(out, raw.as_double());
+        }
+    } else if (v.is_string()) {
+        encode_string(out, v.as_string());
+    } else if (v.is_array()) {
+        const auto& array = v.as_array();
+        encode_container_header(out, array.size(), false);
+        for (const auto& element : array) {
+            encode_msgpack_value(element, out);
+        }
+    } else if (v.is_flat_object()) {
+        const auto& object = v.as_flat_object();
+        encode_container_header(out, object.size(), true);
+        for (const auto& [key, value] : object) {
+            encode_string(out, key);
+            encode_msgpack_value(value, out);
+        }
+    } else if (v.is_object()) {
+        const auto& object = v.as_object();
+        encode_container_header(out, object.size(), true);
+        for (const auto& [key, value] : object) {
+            encode_string(out, key);
+            encode_msgpack_value(value, out);
+        }
+    }
+}
+
+export auto encode_msgpack(const json_value& v) -> std::vector<uint8_t> {
+    std::vector<uint8_t> out;
+    out.reserve(256);
+    encode_msgpack_value(v, out);
+    return out;
+}
+
+static auto decode_msgpack_value(std::span<const uint8_t> data, size_t& pos)
+    -> json_result<json_value>;
+
+static auto msgpack_error(const char* message, size_t pos) -> json_error {
+    return json_error{json_error_code::invalid_syntax, message, 0, pos};
+}
+
+static auto decode_msgpack_string(std::span<const uint8_t> data, size_t& pos, size_t len)
+    -> json_result<json_value> {
+    if (pos + len > data.size()) {
+        return std::unexpected(msgpack_error("Truncated msgpack string", pos));
+    }
+    std::string s(reinterpret_cast<const char*>(data.data() + pos), len);
+    pos += len;
+    return json_value{std::move(s)};
+}
+
+static auto decode_msgpack_array(std::span<const uint8_t> data, size_t& pos, size_t count)
+    -> json_result<json_value> {
+    json_array array;
+    array.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto element = decode_msgpack_value(data, pos);
+        if (!element) {
+            return element;
+        }
+        array.emplace_back(std::move(*element));
+    }
+    return json_value{std::move(array)};
+}
+
+static auto decode_msgpack_map(std::span<const uint8_t> data, size_t& pos, size_t count)
+    -> json_result<json_value> {
+    json_object object;
+    object.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto key = decode_msgpack_value(data, pos);
+        if (!key) {
+            return key;
+        }
+        if (!key->is_string()) {
+            return std::unexpected(msgpack_error("Non-string msgpack map key", pos));
+        }
+        auto value = decode_msgpack_value(data, pos);
+        if (!value) {
+            return value;
+        }
+        object[key->as_string()] = std::move(*value);
+    }
+    return json_value{std::move(object)};
+}
+
+static auto decode_msgpack_value(std::span<const uint8_t> data, size_t& pos)
+    -> json_result<json_value> {
+    using namespace msgpack_detail;
+
+    if (pos >= data.size()) {
+        return std::unexpected(msgpack_error("Truncated msgpack input", pos));
+    }
+
+    auto need = [&](size_t bytes) -> bool { return pos + bytes <= data.size(); };
+    uint8_t tag = data[pos++];
+
+    // Fix formats
+    if (tag <= 0x7F) {
+        return json_value{static_cast<int64_t>(tag)};
+    }
+    if (tag >= 0xE0) {
+        return json_value{static_cast<int64_t>(static_cast<int8_t>(tag))};
+    }
+    if ((tag & 0xE0) == 0xA0) {
+        return decode_msgpack_string(data, pos, tag & 0x1F);
+    }
+    if ((tag & 0xF0) == 0x90) {
+        return decode_msgpack_array(data, pos, tag & 0x0F);
+    }
+    if ((tag & 0xF0) == 0x80) {
+        return decode_msgpack_map(data, pos, tag & 0x0F);
+    }
+
+    switch (tag) {
+        case 0xC0:
+            return json_value{};
+        case 0xC2:
+            return json_value{false};
+        case 0xC3:
+            return json_value{true};
+        case 0xCA: {
+            if (!need(4)) break;
+            uint32_t bits = load_be<uint32_t>(data.data() + pos);
+            pos += 4;
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            return json_value{static_cast<double>(f)};
+        }
+        case 0xCB: {
+            if (!need(8)) break;
+            uint64_t bits = load_be<uint64_t>(data.data() + pos);
+            pos += 8;
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            return json_value{d};
+        }
+        case 0xCC: {
+            if (!need(1)) break;
+            return json_value{static_cast<int64_t>(data[pos++])};
+        }
+        case 0xCD: {
+            if (!need(2)) break;
+            auto value = load_be<uint16_t>(data.data() + pos);
+            pos += 2;
+            return json_value{static_cast<int64_t>(value)};
+        }
+        case 0xCE: {
+            if (!need(4)) break;
+            auto value = load_be<uint32_t>(data.data() + pos);
+            pos += 4;
+            return json_value{static_cast<int64_t>(value)};
+        }
+        case 0xCF: {
+            if (!need(8)) break;
+            auto value = load_be<uint64_t>(data.data() + pos);
+            pos += 8;
+            return json_value{value};
+        }
+        case 0xD0: {
+            if (!need(1)) break;
+            return json_value{static_cast<int64_t>(static_cast<int8_t>(data[pos++]))};
+        }
+        case 0xD1: {
+            if (!need(2)) break;
+            auto value = static_cast<int16_t>(load_be<uint16_t>(data.data() + pos));
+            pos += 2;
+            return json_value{static_cast<int64_t>(value)};
+        }
+        case 0xD2: {
+            if (!need(4)) break;
+            auto value = static_cast<int32_t>(load_be<uint32_t>(data.data() + pos));
+            pos += 4;
+            return json_value{static_cast<int64_t>(value)};
+        }
+        case 0xD3: {
+            if (!need(8)) break;
+            auto value = static_cast<int64_t>(load_be<uint64_t>(data.data() + pos));
+            pos += 8;
+            return json_value{value};
+        }
+        case 0xD9: {
+            if (!need(1)) break;
+            size_t len = data[pos++];
+            return decode_msgpack_string(data, pos, len);
+        }
+        case 0xDA: {
+            if (!need(2)) break;
+            size_t len = load_be<uint16_t>(data.data() + pos);
+            pos += 2;
+            return decode_msgpack_string(data, pos, len);
+        }
+        case 0xDB: {
+            if (!need(4)) break;
+            size_t len = load_be<uint32_t>(data.data() + pos);
+            pos += 4;
+            return decode_msgpack_string(data, pos, len);
+        }
+        case 0xDC: {
+            if (!need(2)) break;
+            size_t count = load_be<uint16_t>(data.data() + pos);
+            pos += 2;
+            return decode_msgpack_array(data, pos, count);
+        }
+        case 0xDD: {
+            if (!need(4)) break;
+            size_t count = load_be<uint32_t>(data.data() + pos);
+            pos += 4;
+            return decode_msgpack_array(data, pos, count);
+        }
+        case 0xDE: {
+            if (!need(2)) break;
+            size_t count = load_be<uint16_t>(data.data() + pos);
+            pos += 2;
+            return decode_msgpack_map(data, pos, count);
+        }
+        case 0xDF: {
+            if (!need(4)) break;
+            size_t count = load_be<uint32_t>(data.data() + pos);
+            pos += 4;
+            return decode_msgpack_map(data, pos, count);
+        }
+        default:
+            return std::unexpected(msgpack_error("Unsupported msgpack type tag", pos - 1));
+    }
+
+    return std::unexpected(msgpack_error("Truncated msgpack input", pos));
+}
+
+export auto decode_msgpack(std::span<const uint8_t> data) -> json_result<json_value> {
+    size_t pos = 0;
+    auto result = decode_msgpack_value(data, pos);
+    if (!result) {
+        return result;
+    }
+    if (pos != data.size()) {
+        return std::unexpected(msgpack_error("Trailing bytes after msgpack value", pos));
+    }
+    return result;
+}
+
+// ============================================================================
+// NDJSON / JSON Lines Batch Parser
+// ============================================================================
+// Newline boundaries are found with one SIMD pass, then whole lines are
+// distributed across the pool - one document per task, no intra-document
+// threading, so the per-record thread-pool spin-up cost is paid once per
+// batch instead of once per line.
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+__attribute__((target("avx2"))) static auto
+find_newlines_avx2(std::string_view input, std::vector<size_t>& positions) -> void {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    size_t pos = 0;
+
+    while (pos + 32 <= input.size()) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
+        uint32_t mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newline));
+        while (mask != 0) {
+            positions.push_back(pos + static_cast<size_t>(__builtin_ctz(mask)));
+            mask &= mask - 1;
+        }
+        pos += 32;
+    }
+
+    while (pos < input.size()) {
+        if (input[pos] == '\n') {
+            positions.push_back(pos);
+        }
+        pos++;
+    }
+}
+
+#endif
+
+static auto find_newlines(std::string_view input, std::vector<size_t>& positions) -> void {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
+        find_newlines_avx2(input, positions);
+        return;
+    }
+#endif
+    for (size_t pos = 0; pos < input.size(); ++pos) {
+        if (input[pos] == '\n') {
+            positions.push_back(pos);
+        }
+    }
+}
+
+export auto parse_ndjson(std::string_view input) -> std::vector<json_result<json_value>> {
+    // Phase 1: newline scan (heuristic: ~64 bytes per record)
+    std::vector<size_t> newlines;
+    newlines.reserve(input.size() / 64);
+    find_newlines(input, newlines);
+
+    // Build line spans, skipping empty lines (trailing newline, blank rows)
+    struct line_span {
+        size_t start;
+        size_t end;
+    };
+    std::vector<line_span> lines;
+    lines.reserve(newlines.size() + 1);
+
+    size_t line_start = 0;
+    auto add_line = [&](size_t start, size_t end) {
+        // Trim carriage return from CRLF input
+        if (end > start && input[end - 1] == '\r') {
+            end--;
+        }
+        while (start < end && (input[start] == ' ' || input[start] == '\t')) {
+            start++;
+        }
+        if (start < end) {
+            lines.push_back({start, end});
+        }
+    };
+    for (size_t nl : newlines) {
+        add_line(line_start, nl);
+        line_start = nl + 1;
+    }
+    add_line(line_start, input.size());
+
+    // Phase 2: one document per task across the pool. Intra-document
+    // parallelism is disabled per line - lines are small and nested OpenMP
+    // regions would oversubscribe.
+    std::vector<json_result<json_value>> results(
+        lines.size(), std::unexpected(json_error{json_error_code::empty_input, "", 0, 0}));
+
+    auto parse_line = [&](size_t i) {
+        parse_config line_config = g_config;
+        line_config.num_threads = 0;  // Single-threaded per line
+        parse_config saved = g_config;
+        g_config = line_config;
+        parser p(input.substr(lines[i].start, lines[i].end - lines[i].start));
+        results[i] = p.parse();
+        g_config = saved;
+    };
+
+#if defined(FASTJSON_USE_PARALLEL_STL)
+    if (g_config.use_work_stealing) {
+        std::vector<size_t> order(lines.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::for_each(std::execution::par, order.begin(), order.end(), parse_line);
+        return results;
+    }
+#endif
+
+#pragma omp parallel for schedule(dynamic) if (lines.size() >= 4)
+    for (size_t i = 0; i < lines.size(); ++i) {
+        parse_line(i);
+    }
+
+    return results;
+}
+
+// ============================================================================
+// Batched Small-Document Parsing
+// ============================================================================
+// Gateway workloads push tens of thousands of small independent documents per
+// second through parse(), and at ~100-byte payloads the per-call overhead -
+// capability checks, g_config thread-local reads, OpenMP region entry -
+// dwarfs the parse itself. parse_many sets dispatch up once and hands whole
+// documents to the pool, one document per task with intra-document threading
+// disabled (the parse_ndjson phase-2 recipe, but over caller-owned slices).
+
+export auto parse_many(std::span<const std::string_view> documents)
+    -> std::vector<json_result<json_value>> {
+    std::vector<json_result<json_value>> results(
+        documents.size(), std::unexpected(json_error{json_error_code::empty_input, "", 0, 0}));
+
+    auto parse_document = [&](size_t i) {
+        parse_config doc_config = g_config;
+        doc_config.num_threads = 0;  // Single-threaded per document
+        parse_config saved = g_config;
+        g_config = doc_config;
+        parser p(documents[i]);
+        results[i] = p.parse();
+        g_config = saved;
+    };
+
+    // Tiny batches: the pool costs more than it saves
+    if (documents.size() < 4) {
+        for (size_t i = 0; i < documents.size(); ++i) {
+            parse_document(i);
+        }
+        return results;
+    }
+
+#if defined(FASTJSON_USE_PARALLEL_STL)
+    if (g_config.use_work_stealing) {
+        std::vector<size_t> order(documents.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::for_each(std::execution::par, order.begin(), order.end(), parse_document);
+        return results;
+    }
+#endif
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < documents.size(); ++i) {
+        parse_document(i);
+    }
+
+    return results;
+}
+
+// ============================================================================
+// Concatenated Documents and RFC 7464 JSON Text Sequences
+// ============================================================================
+// Kafka-style topics concatenate documents with no delimiter at all, and the
+// logging stack emits RFC 7464 sequences (RS-prefixed records). Both reduce
+// to the ndjson recipe - discover boundaries cheaply, then parse the slices
+// in parallel - except plain concatenation has to find each document's end
+// structurally: a depth scan over the same quote/escape-aware traversal as
+// the pre-sizing counters.
+
+namespace detail {
+
+// Position one past the matching close of the container opening at start_pos.
+// nullopt when the container never closes.
+__attribute__((target("avx2"))) static auto
+find_container_end_avx2(std::span<const char> input, size_t start_pos) -> std::optional<size_t> {
+    const __m256i left_bracket = _mm256_set1_epi8('[');
+    const __m256i right_bracket = _mm256_set1_epi8(']');
+    const __m256i left_brace = _mm256_set1_epi8('{');
+    const __m256i right_brace = _mm256_set1_epi8('}');
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+
+    size_t pos = start_pos + 1;
+    int depth = 0;
+    bool in_string = false;
+    size_t skip_pos = SIZE_MAX;
+
+    while (pos + 32 <= input.size()) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
+
+        __m256i structural = _mm256_or_si256(
+            _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, left_bracket),
+                                            _mm256_cmpeq_epi8(chunk, right_bracket)),
+                            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, left_brace),
+                                            _mm256_cmpeq_epi8(chunk, right_brace))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote),
+                            _mm256_cmpeq_epi8(chunk, backslash)));
+
+        uint32_t mask = _mm256_movemask_epi8(structural);
+
+        if (mask == 0) {
+            pos += 32;
+            continue;
+        }
+
+        for (int bit = 0; bit < 32 && mask; ++bit, mask >>= 1) {
+            if (!(mask & 1))
+                continue;
+
+            size_t char_pos = pos + bit;
+            if (char_pos == skip_pos)
+                continue;
+            char c = input[char_pos];
+
+            if (in_string) {
+                if (c == '\\') {
+                    skip_pos = char_pos + 1;
+                } else if (c == '"') {
+                    in_string = false;
+                }
+            } else if (c == '"') {
+                in_string = true;
+            } else if (c == '[' || c == '{') {
+                depth++;
+            } else if (c == ']' || c == '}') {
+                if (depth == 0) {
+                    return char_pos + 1;
+                }
+                depth--;
+            }
+        }
+
+        pos += 32;
+    }
+
+    while (pos < input.size()) {
+        if (pos == skip_pos) {
+            pos++;
+            continue;
+        }
+        char c = input[pos];
+
+        if (in_string) {
+            if (c == '\\') {
+                pos += 2;
+                continue;
+            }
+            if (c == '"') {
+                in_string = false;
+            }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == '[' || c == '{') {
+            depth++;
+        } else if (c == ']' || c == '}') {
+            if (depth == 0) {
+                return pos + 1;
+            }
+            depth--;
+        }
+        pos++;
+    }
+
+    return std::nullopt;
+}
+
+static auto find_container_end_scalar(std::span<const char> input, size_t start_pos)
+    -> std::optional<size_t> {
+    size_t pos = start_pos + 1;
+    int depth = 0;
+    bool in_string = false;
+    bool escape_next = false;
+
+    while (pos < input.size()) {
+        char c = input[pos];
+
+        if (in_string) {
+            if (escape_next) {
+                escape_next = false;
+            } else if (c == '\\') {
+                escape_next = true;
+            } else if (c == '"') {
+                in_string = false;
+            }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == '[' || c == '{') {
+            depth++;
+        } else if (c == ']' || c == '}') {
+            if (depth == 0) {
+                return pos + 1;
+            }
+            depth--;
+        }
+        pos++;
+    }
+
+    return std::nullopt;
+}
+
+// One past the end of the document whose first token is at start_pos.
+// Containers end at their matching close, strings at the unescaped quote,
+// numbers and literals at the first whitespace or structural byte. nullopt
+// means the document never terminates - the caller hands the whole tail to
+// the parser so the error is reported with full context.
+static auto scan_document_end(std::span<const char> input, size_t start_pos)
+    -> std::optional<size_t> {
+    char c = input[start_pos];
+
+    if (c == '{' || c == '[') {
+        if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
+            return find_container_end_avx2(input, start_pos);
+        }
+        return find_container_end_scalar(input, start_pos);
+    }
+
+    if (c == '"') {
+        bool saw_escape = false;
+        size_t close = find_closing_quote(input, start_pos + 1, saw_escape);
+        if (close < input.size() && input[close] == '"') {
+            return close + 1;
+        }
+        return std::nullopt;
+    }
+
+    // Number or literal: runs to the first delimiter. Adjacent scalars with
+    // no separator at all ("12" vs "1" "2") are inherently ambiguous; the
+    // producer side always delimits scalars with whitespace.
+    size_t pos = start_pos;
+    while (pos < input.size()) {
+        char d = input[pos];
+        if (d == ' ' || d == '\t' || d == '\n' || d == '\r' || d == '{' || d == '[' || d == '"'
+            || d == 0x1E) {
+            break;
+        }
+        pos++;
+    }
+    return pos;
+}
+
+// Shared phase 2: one document slice per task across the pool, same recipe
+// as parse_ndjson
+struct doc_span {
+    size_t start;
+    size_t end;
+};
+
+static auto parse_document_spans(std::string_view input, const std::vector<doc_span>& docs)
+    -> std::vector<json_result<json_value>> {
+    std::vector<json_result<json_value>> results(
+        docs.size(), std::unexpected(json_error{json_error_code::empty_input, "", 0, 0}));
+
+    auto parse_doc = [&](size_t i) {
+        parse_config doc_config = g_config;
+        doc_config.num_threads = 0;  // Single-threaded per document
+        parse_config saved = g_config;
+        g_config = doc_config;
+        parser p(input.substr(docs[i].start, docs[i].end - docs[i].start));
+        results[i] = p.parse();
+        g_config = saved;
+    };
+
+#if defined(FASTJSON_USE_PARALLEL_STL)
+    if (g_config.use_work_stealing) {
+        std::vector<size_t> order(docs.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::for_each(std::execution::par, order.begin(), order.end(), parse_doc);
+        return results;
+    }
+#endif
+
+#pragma omp parallel for schedule(dynamic) if (docs.size() >= 4)
+    for (size_t i = 0; i < docs.size(); ++i) {
+        parse_doc(i);
+    }
+
+    return results;
+}
+
+}  // namespace detail
+
+// Concatenated documents with no delimiter (whitespace between them is fine).
+// Boundaries are discovered with the structural depth scan, then the slices
+// parse in parallel; a document that never terminates swallows the rest of
+// the input and its parse reports the actual error.
+export auto parse_many(std::string_view input) -> std::vector<json_result<json_value>> {
+    std::span<const char> data(input.data(), input.size());
+    std::vector<detail::doc_span> docs;
+
+    size_t pos = 0;
+    while (true) {
+        pos = skip_whitespace_simd(data, pos);
+        if (pos >= input.size()) {
+            break;
+        }
+        auto end = detail::scan_document_end(data, pos);
+        if (!end) {
+            docs.push_back({pos, input.size()});
+            break;
+        }
+        docs.push_back({pos, *end});
+        pos = *end;
+    }
+
+    return detail::parse_document_spans(input, docs);
+}
+
+// Parses the first document of a concatenated stream and reports how many
+// bytes it consumed (leading whitespace included), for callers that pull
+// documents incrementally instead of batching
+export auto parse_one(std::string_view input, size_t& consumed) -> json_result<json_value> {
+    std::span<const char> data(input.data(), input.size());
+    size_t pos = skip_whitespace_simd(data, 0);
+    if (pos >= input.size()) {
+        consumed = input.size();
+        return std::unexpected(json_error{json_error_code::empty_input, "Empty input", 0, pos});
+    }
+    auto end = detail::scan_document_end(data, pos).value_or(input.size());
+    consumed = end;
+    parser p(input.substr(pos, end - pos));
+    return p.parse();
+}
+
+// RFC 7464 JSON text sequences: each record is RS (0x1E) followed by the
+// document and a terminating LF. A missing leading RS or final LF is
+// tolerated; empty records are skipped.
+export auto parse_json_seq(std::string_view input) -> std::vector<json_result<json_value>> {
+    std::vector<detail::doc_span> docs;
+
+    size_t record_start = 0;
+    auto add_record = [&](size_t start, size_t end) {
+        while (start < end
+               && (input[start] == ' ' || input[start] == '\t' || input[start] == '\n'
+                   || input[start] == '\r')) {
+            start++;
+        }
+        while (end > start
+               && (input[end - 1] == ' ' || input[end - 1] == '\t' || input[end - 1] == '\n'
+                   || input[end - 1] == '\r')) {
+            end--;
+        }
+        if (start < end) {
+            docs.push_back({start, end});
+        }
+    };
+
+    for (size_t pos = 0; pos < input.size(); ++pos) {
+        if (input[pos] == 0x1E) {
+            add_record(record_start, pos);
+            record_start = pos + 1;
+        }
+    }
+    add_record(record_start, input.size());
+
+    return detail::parse_document_spans(input, docs);
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+export auto parse(std::string_view input) -> json_result<json_value> {
+    FASTJSON_PERF_HW_SAMPLE();
+    FASTJSON_PERF_SCOPE(parse_document);
+    // Per-thread parser pool: the pooled parser keeps its grown scratch
+    // buffers across documents. Reentrant calls (and only those) fall back to
+    // a fresh stack parser.
+    thread_local parser pooled;
+    thread_local bool pooled_in_use = false;
+    if (!pooled_in_use) {
+        pooled_in_use = true;
+        pooled.reset(input);
+        auto result = pooled.parse();
+        pooled_in_use = false;
+        return result;
+    }
+    parser p(input);
+    return p.parse();
+}
+
+// ============================================================================
+// Per-Document Parse Statistics
+// ============================================================================
+// Capacity planning data for callers that size arenas and caches: node
+// counts by type, nesting depth, string payload volume, a container-size
+// histogram, and the bytes an arena parse of this document would have
+// needed. One opt-in tree walk after the parse - parse() itself stays
+// untouched - and the arena estimate feeds straight into
+// parse_arena(input, stats.arena_bytes_estimate) for exact pre-sizing on
+// the next parse of a similar payload.
+
+export struct parse_stats {
+    size_t null_count = 0;
+    size_t bool_count = 0;
+    size_t number_count = 0;
+    size_t string_count = 0;
+    size_t array_count = 0;
+    size_t object_count = 0;
+
+    size_t max_depth = 0;           // Deepest nesting level (root value = 1)
+    size_t total_string_bytes = 0;  // Decoded string payload, values only
+    size_t total_key_bytes = 0;     // Decoded object key bytes
+
+    // Container element counts in log2 buckets: [empty, 1, 2-3, 4-7, 8-15,
+    // 16-31, 32-63, 64+]
+    size_t container_size_hist[8] = {};
+
+    // Bytes a pmr-arena parse of this tree would allocate (node storage,
+    // container slots, string payloads), suitable as the arena_size_hint
+    size_t arena_bytes_estimate = 0;
+
+    auto node_count() const -> size_t {
+        return null_count + bool_count + number_count + string_count + array_count
+               + object_count;
+    }
+};
+
+namespace detail {
+
+inline auto container_hist_bucket(size_t elements) -> size_t {
+    if (elements == 0) {
+        return 0;
+    }
+    return std::min<size_t>(7, static_cast<size_t>(std::bit_width(elements)));
+}
+
+inline auto collect_stats(const json_value& value, parse_stats& stats, size_t depth) -> void {
+    stats.max_depth = std::max(stats.max_depth, depth);
+    if (value.is_null()) {
+        stats.null_count++;
+        stats.arena_bytes_estimate += sizeof(arena_value);
+    } else if (value.is_bool()) {
+        stats.bool_count++;
+        stats.arena_bytes_estimate += sizeof(arena_value);
+    } else if (value.is_number()) {
+        stats.number_count++;
+        stats.arena_bytes_estimate += sizeof(arena_value);
+    } else if (value.is_string()) {
+        stats.string_count++;
+        stats.total_string_bytes += value.as_string().size();
+        stats.arena_bytes_estimate += sizeof(arena_value) + value.as_string().size() + 1;
+    } else if (value.is_array()) {
+        const auto& array = value.as_array();
+        stats.array_count++;
+        stats.container_size_hist[container_hist_bucket(array.size())]++;
+        stats.arena_bytes_estimate += sizeof(arena_value) + array.size() * sizeof(arena_value);
+        for (const auto& element : array) {
+            collect_stats(element, stats, depth + 1);
+        }
+    } else if (value.is_object()) {
+        stats.object_count++;
+        auto visit_fields = [&](const auto& object) {
+            stats.container_size_hist[container_hist_bucket(object.size())]++;
+            // Hash node per entry: key string, value slot, bucket pointer
+            stats.arena_bytes_estimate +=
+                sizeof(arena_value)
+                + object.size() * (sizeof(arena_string) + sizeof(arena_value)
+                                   + 2 * sizeof(void*));
+            for (const auto& [key, field] : object) {
+                stats.total_key_bytes += key.size();
+                stats.arena_bytes_estimate += key.size() + 1;
+                collect_stats(field, stats, depth + 1);
+            }
+        };
+        if (value.is_flat_object()) {
+            visit_fields(value.as_flat_object());
+        } else {
+            visit_fields(value.as_object());
+        }
+    }
+}
+
+}  // namespace detail
+
+// Walks an already-parsed tree; usable on any document regardless of how it
+// was produced
+export auto compute_parse_stats(const json_value& document) -> parse_stats {
+    parse_stats stats;
+    detail::collect_stats(document, stats, 1);
+    return stats;
+}
+
+export auto parse_with_stats(std::string_view input)
+    -> json_result<std::pair<json_value, parse_stats>> {
+    auto result = parse(input);
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    parse_stats stats = compute_parse_stats(*result);
+    return std::pair<json_value, parse_stats>{std::move(*result), stats};
+}
+
+// Resolve an RFC 6901 JSON Pointer and materialize only the target value.
+// The structural tape walk (fastjson_pointer.h) skips sibling values by depth
+// matching, so a single field lookup in a large document never pays full
+// parse cost for the parts it steps over.
+export auto parse_pointer(std::string_view input, std::string_view ptr)
+    -> json_result<json_value> {
+    auto raw = fastjson::pointer::at_pointer(input, ptr);
+    if (!raw) {
+        return std::unexpected(json_error{json_error_code::invalid_syntax,
+                                          "JSON Pointer not found", 0, 0});
+    }
+    return parse(*raw);  // goes through the pooled parser
+}
+
+// ============================================================================
+// Document Cache for Repeated Payloads
+// ============================================================================
+// Gateways see the same literal payload bytes over and over: client retries,
+// one message fanned out to many consumers, tight polling loops re-fetching
+// an unchanged resource. For those shapes the fastest parse is the one that
+// never runs - parse_cached() hashes the input and a byte-identical repeat of
+// a recently parsed document gets the already-built tree back as a shared
+// immutable pointer. The cache is sharded sixteen ways (each shard its own
+// mutex, map, and LRU list) so concurrent threads land on different locks;
+// every entry keeps a copy of the payload text and hits are confirmed
+// byte-for-byte, so a hash collision degrades to a miss, never to a wrong
+// document.
+
+namespace detail {
+
+// 64-bit content hash. The AVX2 and scalar paths compute the same function:
+// four 64-bit lanes absorb 32-byte blocks through a multiply-xor round built
+// on mul_epu32 semantics (low 32 bits times a 32-bit prime), so the scalar
+// replica is bit-exact; the sub-block tail goes through one zero-padded final
+// block and the length breaks padding ties in the finalizer.
+
+inline constexpr uint64_t hash_round_prime = 0x9E3779B9;  // 32-bit golden ratio
+
+static auto hash_mix64(uint64_t value) -> uint64_t {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+static auto hash_finalize(const uint64_t lanes[4], size_t length) -> uint64_t {
+    uint64_t hash = static_cast<uint64_t>(length);
+    for (int i = 0; i < 4; ++i) {
+        hash = hash_mix64(hash ^ lanes[i]);
+    }
+    return hash;
+}
+
+inline constexpr uint64_t hash_lane_seeds[4] = {0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL,
+                                                0x3C6EF372FE94F82BULL, 0xA54FF53A5F1D36F1ULL};
+
+__attribute__((target("avx2"))) static auto document_hash_avx2(std::span<const char> input)
+    -> uint64_t {
+    const __m256i prime = _mm256_set1_epi64x(static_cast<long long>(hash_round_prime));
+    __m256i acc = _mm256_set_epi64x(static_cast<long long>(hash_lane_seeds[3]),
+                                    static_cast<long long>(hash_lane_seeds[2]),
+                                    static_cast<long long>(hash_lane_seeds[1]),
+                                    static_cast<long long>(hash_lane_seeds[0]));
+
+    size_t pos = 0;
+    while (pos + 32 <= input.size()) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
+        acc = _mm256_xor_si256(acc, chunk);
+        acc = _mm256_xor_si256(_mm256_mul_epu32(acc, prime), _mm256_srli_epi64(acc, 29));
+        pos += 32;
+    }
+    if (pos < input.size()) {
+        alignas(32) char tail[32] = {};
+        std::memcpy(tail, input.data() + pos, input.size() - pos);
+        __m256i chunk = _mm256_load_si256(reinterpret_cast<const __m256i*>(tail));
+        acc = _mm256_xor_si256(acc, chunk);
+        acc = _mm256_xor_si256(_mm256_mul_epu32(acc, prime), _mm256_srli_epi64(acc, 29));
+    }
+
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return hash_finalize(lanes, input.size());
+}
+
+static auto document_hash_scalar(std::span<const char> input) -> uint64_t {
+    uint64_t lanes[4] = {hash_lane_seeds[0], hash_lane_seeds[1], hash_lane_seeds[2],
+                         hash_lane_seeds[3]};
+
+    auto absorb = [&lanes](const char* block) {
+        for (int i = 0; i < 4; ++i) {
+            uint64_t word;
+            std::memcpy(&word, block + i * 8, sizeof(word));
+            uint64_t mixed = lanes[i] ^ word;
+            lanes[i] = ((mixed & 0xFFFFFFFFULL) * hash_round_prime) ^ (mixed >> 29);
+        }
+    };
+
+    size_t pos = 0;
+    while (pos + 32 <= input.size()) {
+        absorb(input.data() + pos);
+        pos += 32;
+    }
+    if (pos < input.size()) {
+        char tail[32] = {};
+        std::memcpy(tail, input.data() + pos, input.size() - pos);
+        absorb(tail);
+    }
+
+    return hash_finalize(lanes, input.size());
+}
+
+static auto document_hash(std::span<const char> input) -> uint64_t {
+    if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
+        return document_hash_avx2(input);
+    }
+    return document_hash_scalar(input);
+}
+
+struct document_cache_entry {
+    std::string text;  // Full payload copy: hits are confirmed byte-for-byte
+    std::shared_ptr<const json_value> document;
+    std::list<uint64_t>::iterator order_pos;
+};
+
+struct document_cache_shard {
+    std::mutex mutex;
+    std::unordered_map<uint64_t, document_cache_entry> entries;
+    std::list<uint64_t> order;  // Front = most recently used
+};
+
+inline constexpr size_t document_cache_shards = 16;
+
+static std::array<document_cache_shard, document_cache_shards> g_document_cache;
+
+// High bits pick the shard; the identity-hashed map inside the shard keys off
+// the low bits, so the two selections stay independent
+static auto shard_for(uint64_t hash) -> document_cache_shard& {
+    return g_document_cache[(hash >> 60) & (document_cache_shards - 1)];
+}
+
+static auto document_cache_lookup(uint64_t hash, std::string_view input)
+    -> std::shared_ptr<const json_value> {
+    document_cache_shard& shard = shard_for(hash);
+    std::lock_guard lock(shard.mutex);
+    auto it = shard.entries.find(hash);
+    if (it == shard.entries.end() || it->second.text != input) {
+        return nullptr;  // Miss, or a colliding hash over different bytes
+    }
+    shard.order.splice(shard.order.begin(), shard.order, it->second.order_pos);
+    return it->second.document;
+}
+
+static auto document_cache_insert(uint64_t hash, std::string_view input,
+                                  std::shared_ptr<const json_value> document) -> void {
+    const size_t per_shard =
+        std::max<size_t>(1, g_config.document_cache_entries / document_cache_shards);
+    document_cache_shard& shard = shard_for(hash);
+    std::lock_guard lock(shard.mutex);
+
+    auto it = shard.entries.find(hash);
+    if (it != shard.entries.end()) {
+        // Hash already present (racing insert of the same payload, or a
+        // collision): newest content wins
+        it->second.text.assign(input);
+        it->second.document = std::move(document);
+        shard.order.splice(shard.order.begin(), shard.order, it->second.order_pos);
+        return;
+    }
+
+    while (shard.entries.size() >= per_shard && !shard.order.empty()) {
+        shard.entries.erase(shard.order.back());
+        shard.order.pop_back();
+    }
+    shard.order.push_front(hash);
+    shard.entries.emplace(
+        hash, document_cache_entry{std::string(input), std::move(document), shard.order.begin()});
+}
+
+}  // namespace detail
+
+// Cache-fronted parse. A hit returns the tree built by an earlier call as a
+// shared immutable pointer - it may be aliased by any number of threads, so
+// callers must not mutate through it. A miss parses normally and publishes
+// the result. Failures are never cached: the retry that follows a malformed
+// payload usually carries different bytes.
+export auto parse_cached(std::string_view input)
+    -> json_result<std::shared_ptr<const json_value>> {
+    auto parse_fresh = [&]() -> json_result<std::shared_ptr<const json_value>> {
+        auto result = parse(input);
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+        return std::make_shared<const json_value>(std::move(*result));
+    };
+
+    if (g_config.document_cache_entries == 0) {
+        return parse_fresh();
+    }
+
+    const uint64_t hash =
+        detail::document_hash(std::span<const char>(input.data(), input.size()));
+    if (auto hit = detail::document_cache_lookup(hash, input)) {
+        return hit;
+    }
+
+    auto fresh = parse_fresh();
+    if (fresh) {
+        detail::document_cache_insert(hash, input, *fresh);
+    }
+    return fresh;
+}
+
+// Drops every cached document (tenant isolation in tests, or releasing memory
+// after a polling burst goes quiet)
+export auto document_cache_clear() -> void {
+    for (auto& shard : detail::g_document_cache) {
+        std::lock_guard lock(shard.mutex);
+        shard.entries.clear();
+        shard.order.clear();
+    }
+}
+
+// ============================================================================
+// Validation-Only Mode
+// ============================================================================
+// Ingest gates that only ask "is this valid JSON?" were paying for a full
+// parse() and discarding the tree. validate() answers the question with one
+// pass over the input: a whole-document SIMD UTF-8 check up front, then the
+// dispatched scanning kernels (whitespace skip, string-end scan, literal
+// match) driving an iterative grammar automaton whose only state is a fixed
+// container-kind bit-stack - no DOM nodes, no string materialization, no heap
+// allocation. It checks grammar and encoding; the materialization limits in
+// parse_config (max_string_length) do not apply because nothing is built.
+
+namespace detail {
+
+// Checks one escape sequence at pos (input[pos] == '\\') without decoding it.
+// Returns the position just past the sequence. Surrogate pairing is enforced
+// to match what decode_one_escape accepts.
+static auto validate_escape(std::string_view input, size_t pos) -> json_result<size_t> {
+    auto hex4 = [&](size_t p) -> int32_t {
+        if (p + 4 > input.size()) {
+            return -1;
+        }
+        uint32_t value = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            char c = input[p + i];
+            if (c >= '0' && c <= '9') {
+                value = (value << 4) | static_cast<uint32_t>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                value = (value << 4) | static_cast<uint32_t>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                value = (value << 4) | static_cast<uint32_t>(c - 'A' + 10);
+            } else {
+                return -1;
+            }
+        }
+        return static_cast<int32_t>(value);
+    };
+
+    if (pos + 1 >= input.size()) {
+        return std::unexpected(
+            json_error{json_error_code::invalid_string, "Unterminated escape sequence", 0, pos});
+    }
+    switch (input[pos + 1]) {
+        case '"':
+        case '\\':
+        case '/':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+            return pos + 2;
+        case 'u': {
+            int32_t unit = hex4(pos + 2);
+            if (unit < 0) {
+                return std::unexpected(json_error{json_error_code::invalid_unicode,
+                                                  "Invalid unicode escape", 0, pos});
+            }
+            auto code_unit = static_cast<uint32_t>(unit);
+            if (fastjson::unicode::is_low_surrogate(code_unit)) {
+                return std::unexpected(json_error{json_error_code::invalid_unicode,
+                                                  "Unpaired low surrogate", 0, pos});
+            }
+            if (fastjson::unicode::is_high_surrogate(code_unit)) {
+                if (pos + 8 > input.size() || input[pos + 6] != '\\' || input[pos + 7] != 'u') {
+                    return std::unexpected(json_error{json_error_code::invalid_unicode,
+                                                      "Unpaired high surrogate", 0, pos});
+                }
+                int32_t low = hex4(pos + 8);
+                if (low < 0 || !fastjson::unicode::is_low_surrogate(static_cast<uint32_t>(low))) {
+                    return std::unexpected(json_error{json_error_code::invalid_unicode,
+                                                      "Invalid low surrogate", 0, pos});
+                }
+                return pos + 12;
+            }
+            return pos + 6;
+        }
+        default:
+            return std::unexpected(json_error{json_error_code::invalid_escape,
+                                              "Invalid escape character", 0, pos + 1});
+    }
+}
+
+// Scans one string token starting at the opening quote, validating escape
+// syntax in place. Non-ASCII bytes were already covered by the whole-input
+// UTF-8 pass, so clean runs are skipped at full kernel speed. Returns the
+// position after the closing quote.
+static auto validate_string_token(std::span<const char> data, size_t pos) -> json_result<size_t> {
+    std::string_view input(data.data(), data.size());
+    pos++;  // Skip opening quote
+    while (true) {
+        pos = g_kernels.find_string_end(data, pos);
+        if (pos >= data.size()) {
+            return std::unexpected(
+                json_error{json_error_code::invalid_string, "Unterminated string", 0, pos});
+        }
+        char c = data[pos];
+        if (c == '"') {
+            return pos + 1;
+        }
+        if (c == '\\') {
+            auto next = validate_escape(input, pos);
+            if (!next) {
+                return std::unexpected(next.error());
+            }
+            pos = *next;
+            continue;
+        }
+        return std::unexpected(json_error{json_error_code::invalid_string,
+                                          "Control character in string", 0, pos});
+    }
+}
+
+// Walks one number token with the same grammar as parser::parse_number,
+// producing nothing. Returns the position after the token.
+static auto validate_number_token(std::string_view input, size_t pos) -> json_result<size_t> {
+    auto fail = [&]() {
+        return std::unexpected(
+            json_error{json_error_code::invalid_number, "Invalid number format", 0, pos});
+    };
+    auto digit = [&](size_t p) { return p < input.size() && input[p] >= '0' && input[p] <= '9'; };
+
+    if (pos < input.size() && input[pos] == '-') {
+        pos++;
+    }
+    if (pos < input.size() && input[pos] == '0') {
+        pos++;
+    } else if (digit(pos)) {
+        while (digit(pos)) {
+            pos++;
+        }
+    } else {
+        return fail();
+    }
+    if (pos < input.size() && input[pos] == '.') {
+        pos++;
+        if (!digit(pos)) {
+            return fail();
+        }
+        while (digit(pos)) {
+            pos++;
+        }
+    }
+    if (pos < input.size() && (input[pos] == 'e' || input[pos] == 'E')) {
+        pos++;
+        if (pos < input.size() && (input[pos] == '+' || input[pos] == '-')) {
+            pos++;
+        }
+        if (!digit(pos)) {
+            return fail();
+        }
+        while (digit(pos)) {
+            pos++;
+        }
+    }
+    return pos;
+}
+
+}  // namespace detail
+
+export auto validate(std::string_view input) -> json_result<void> {
+    std::span<const char> data(input.data(), input.size());
+
+    // Stage 1: one streaming SIMD pass over the whole document. Everything
+    // outside strings is ASCII by grammar, so a single check covers every
+    // string body without per-string kernel calls.
+    if (!g_kernels.validate_utf8(data, 0, input.size())) {
+        return std::unexpected(
+            json_error{json_error_code::invalid_unicode, "Invalid UTF-8 encoding", 0, 0});
+    }
+
+    // Container-kind bit-stack: bit set = object, clear = array. Fixed
+    // footprint; nesting is bounded by max_depth as in the tree parsers,
+    // additionally capped by the stack's capacity.
+    constexpr size_t stack_bits = 4096;
+    std::array<uint64_t, stack_bits / 64> kinds{};
+    size_t depth = 0;
+    const size_t max_depth = std::min(g_config.max_depth, stack_bits);
+    auto in_object = [&]() { return (kinds[(depth - 1) / 64] >> ((depth - 1) % 64)) & 1u; };
+
+    size_t pos = skip_whitespace_simd(data, 0);
+    if (pos >= input.size()) {
+        return std::unexpected(json_error{json_error_code::empty_input, "Empty input", 0, pos});
+    }
+
+    while (true) {
+        // ---- one value starting at pos ----
+        if (pos >= input.size()) {
+            return std::unexpected(
+                json_error{json_error_code::unexpected_end, "Unexpected end of input", 0, pos});
+        }
+        char c = input[pos];
+        if (c == '{' || c == '[') {
+            if (depth >= max_depth) {
+                return std::unexpected(json_error{json_error_code::max_depth_exceeded,
+                                                  "Maximum nesting depth exceeded", 0, pos});
+            }
+            bool object = (c == '{');
+            if (object) {
+                kinds[depth / 64] |= uint64_t{1} << (depth % 64);
+            } else {
+                kinds[depth / 64] &= ~(uint64_t{1} << (depth % 64));
+            }
+            depth++;
+            pos = skip_whitespace_simd(data, pos + 1);
+            if (pos < input.size() && input[pos] == (object ? '}' : ']')) {
+                pos++;
+                depth--;
+                // Empty container is a completed value; fall through to the
+                // separator loop below
+            } else if (object) {
+                if (pos >= input.size() || input[pos] != '"') {
+                    return std::unexpected(json_error{json_error_code::invalid_syntax,
+                                                      "Expected string key in object", 0, pos});
+                }
+                auto after_key = detail::validate_string_token(data, pos);
+                if (!after_key) {
+                    return std::unexpected(after_key.error());
+                }
+                pos = skip_whitespace_simd(data, *after_key);
+                if (pos >= input.size() || input[pos] != ':') {
+                    return std::unexpected(json_error{json_error_code::invalid_syntax,
+                                                      "Expected ':' after object key", 0, pos});
+                }
+                pos = skip_whitespace_simd(data, pos + 1);
+                continue;  // Descend into the member value
+            } else {
+                continue;  // Descend into the first element
+            }
+        } else if (c == '"') {
+            auto end = detail::validate_string_token(data, pos);
+            if (!end) {
+                return std::unexpected(end.error());
+            }
+            pos = *end;
+        } else if (c == 't' || c == 'f' || c == 'n') {
+            const char* literal = (c == 't') ? "true" : (c == 'f') ? "false" : "null";
+            size_t len = (c == 'f') ? 5 : 4;
+            if (!g_kernels.match_literal(data, pos, literal, len)) {
+                return std::unexpected(
+                    json_error{json_error_code::invalid_literal, "Invalid literal", 0, pos});
+            }
+            pos += len;
+        } else if (c == '-' || (c >= '0' && c <= '9')) {
+            auto end = detail::validate_number_token(input, pos);
+            if (!end) {
+                return std::unexpected(end.error());
+            }
+            pos = *end;
+        } else {
+            return std::unexpected(json_error{json_error_code::invalid_syntax,
+                                              "Unexpected character", 0,
+                                              pos});
+        }
+
+        // ---- separator / close handling after a completed value ----
+        while (depth > 0) {
+            pos = skip_whitespace_simd(data, pos);
+            if (pos >= input.size()) {
+                return std::unexpected(json_error{json_error_code::unexpected_end,
+                                                  "Unterminated container", 0, pos});
+            }
+            bool object = in_object();
+            char t = input[pos];
+            if (t == ',') {
+                pos = skip_whitespace_simd(data, pos + 1);
+                if (object) {
+                    if (pos >= input.size() || input[pos] != '"') {
+                        return std::unexpected(json_error{json_error_code::invalid_syntax,
+                                                          "Expected string key in object", 0,
+                                                          pos});
+                    }
+                    auto after_key = detail::validate_string_token(data, pos);
+                    if (!after_key) {
+                        return std::unexpected(after_key.error());
+                    }
+                    pos = skip_whitespace_simd(data, *after_key);
+                    if (pos >= input.size() || input[pos] != ':') {
+                        return std::unexpected(json_error{json_error_code::invalid_syntax,
+                                                          "Expected ':' after object key", 0,
+                                                          pos});
+                    }
+                    pos = skip_whitespace_simd(data, pos + 1);
+                }
+                break;  // Next value of the current container
+            }
+            if (t == (object ? '}' : ']')) {
+                pos++;
+                depth--;
+                continue;  // Completed value one level up; keep unwinding
+            }
+            return std::unexpected(json_error{
+                json_error_code::invalid_syntax,
+                object ? "Expected ',' or '}' in object" : "Expected ',' or ']' in array", 0,
+                pos});
+        }
+        if (depth == 0) {
+            pos = skip_whitespace_simd(data, pos);
+            if (pos < input.size()) {
+                return std::unexpected(json_error{json_error_code::extra_tokens,
+                                                  "Unexpected characters after JSON value", 0,
+                                                  pos});
+            }
+            return {};
+        }
+    }
+}
+
+// ============================================================================
+// Memory-Mapped File Parsing
+// ============================================================================
+// parse_file() mmaps the input and parses straight out of the page cache,
+// avoiding the read-into-heap-buffer staging copy entirely. The returned
+// file_document keeps the mapping alive behind the parsed tree; zero-copy
+// views handed out by the on-demand variant point into the mapping.
+
+export struct file_document {
+    fastjson::io::mapped_file mapping;  // Must outlive any view into it
+    json_value document;
+};
+
+export auto parse_file(const std::string& path) -> json_result<file_document> {
+    fastjson::io::mapped_file mapping;
+    if (!mapping.open(path, g_config.huge_page_threshold)) {
+        return std::unexpected(
+            json_error{json_error_code::io_error, "Failed to mmap file", 0, 0});
+    }
+
+    auto result = parse(mapping.view());
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return file_document{std::move(mapping), std::move(*result)};
+}
+
+// On-demand variant: only the structural tape is built, and all string and
+// number views returned by navigation point directly into the page cache.
+export struct ondemand_file_document {
+    fastjson::io::mapped_file mapping;
+    fastjson::ondemand::ondemand_document document;
+};
+
+export auto parse_file_ondemand(const std::string& path)
+    -> json_result<ondemand_file_document> {
+    fastjson::io::mapped_file mapping;
+    if (!mapping.open(path, g_config.huge_page_threshold)) {
+        return std::unexpected(
+            json_error{json_error_code::io_error, "Failed to mmap file", 0, 0});
+    }
+
+    auto document = fastjson::ondemand::parse(mapping.view());
+    return ondemand_file_document{std::move(mapping), std::move(document)};
+}
+
+// Sidecar-cached variant for files parsed repeatedly: the structural index is
+// persisted next to the input (`<path>.fjsi`, keyed by content hash) so that
+// warm runs load the tape and skip stage 1 entirely. A missing, stale, or
+// corrupt sidecar falls back to a fresh scan and rewrites the cache.
+export auto parse_file_ondemand_cached(const std::string& path)
+    -> json_result<ondemand_file_document> {
+    fastjson::io::mapped_file mapping;
+    if (!mapping.open(path, g_config.huge_page_threshold)) {
+        return std::unexpected(
+            json_error{json_error_code::io_error, "Failed to mmap file", 0, 0});
+    }
+
+    auto view = mapping.view();
+    auto tape = fastjson::build_structural_index_cached(
+        std::span<const char>(view.data(), view.size()), path + ".fjsi");
+    fastjson::ondemand::ondemand_document document(view, std::move(tape));
+    return ondemand_file_document{std::move(mapping), std::move(document)};
+}
+
+// ============================================================================
+// Asynchronous File Parsing
+// ============================================================================
+// parse_file_async() targets the cold-cache ingest shape (thousands of files
+// not yet in the page cache, where parse_file's mmap stalls on major faults):
+// an async_file_reader keeps the read of chunk N+1 in flight while chunk N is
+// assembled into the document buffer, and the parse itself runs on a worker
+// so the caller can overlap many files. The returned handle is future-like:
+// ready() polls, get() blocks and yields the parse result exactly once.
+
+export class async_document {
+public:
+    explicit async_document(std::future<json_result<json_value>> future)
+        : future_(std::move(future)) {}
+
+    [[nodiscard]] auto ready() const -> bool {
+        return future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    auto get() -> json_result<json_value> { return future_.get(); }
+
+    [[nodiscard]] auto valid() const -> bool { return future_.valid(); }
+
+private:
+    std::future<json_result<json_value>> future_;
+};
+
+export auto parse_file_async(const std::string& path) -> async_document {
+    return async_document{std::async(std::launch::async, [path]() -> json_result<json_value> {
+        fastjson::io::async_file_reader reader;
+        if (!reader.open(path)) {
+            return std::unexpected(
+                json_error{json_error_code::io_error, "Failed to open file", 0, 0});
+        }
+
+        std::string content;
+        content.reserve(reader.file_size());
+        for (std::string_view chunk = reader.next_chunk(); !chunk.empty();
+             chunk = reader.next_chunk()) {
+            // Appending chunk N overlaps the in-flight read of chunk N+1
+            content.append(chunk);
+        }
+        if (reader.failed()) {
+            return std::unexpected(
+                json_error{json_error_code::io_error, "Read error in file", 0, 0});
+        }
+
+        return parse(content);
+    })};
+}
+
+// Tape-based DOM engine: the whole document on one flat vector of 64-bit
+// words with strings as spans into the input - contiguous memory for
+// iteration-heavy workloads. Input must outlive the document.
+export using tape_document = fastjson::tape::tape_document;
+export using tape_value = fastjson::tape::tape_value;
+
+export auto parse_tape(std::string_view input) -> std::optional<tape_document> {
+    return fastjson::tape::tape_document::parse(input);
+}
+
+// On-demand two-stage parsing: build only the structural tape (stage 1) and
+// materialize values lazily on navigation. The input must outlive the
+// returned document (zero-copy, same contract as the string_view parse path).
+export using ondemand_document = fastjson::ondemand::ondemand_document;
+export using ondemand_value = fastjson::ondemand::ondemand_value;
+
+export auto parse_ondemand(std::string_view input) -> ondemand_document {
+    return fastjson::ondemand::parse(input);
+}
+
+export auto parse_with_config(std::string_view input, const parse_config& config)
+    -> json_result<json_value> {
+    auto old_config = g_config;
+    g_config = config;
+    refresh_kernel_table();
+    auto result = parse(input);
+    g_config = old_config;
+    refresh_kernel_table();
+    return result;
+}
+
+// Helper functions for creating JSON values
+export auto object() -> json_value {
+    return json_value{json_object{}};
+}
+
+export auto array() -> json_value {
+    return json_value{json_array{}};
+}
+
+export auto null() -> json_value {
+    return json_value{};
+}
+
+// ============================================================================
+// Document Builders
+// ============================================================================
+// Move-emplace construction for the response path: assembling a document
+// through json_object insertions copies every key into the map and rehashes
+// as the table grows, which makes building often slower than parsing. The
+// builders append straight into the flat object representation (contiguous
+// entries, one sort in build()) and into json_array with an exact reserve, so
+// a pre-sized document is one allocation per container plus the key bytes.
+// Values arrive by-value as json_value - callers' rvalues move through - with
+// string_view / const char* overloads on top so character data takes the
+// string constructor instead of decaying to bool. build() moves the finished
+// container out and leaves the builder empty and reusable.
+
+export class object_builder;
+
+export class array_builder {
+public:
+    array_builder() = default;
+
+    auto reserve(size_t n) -> array_builder& {
+        elements_.reserve(n);
+        return *this;
+    }
+
+    auto push(json_value value) -> array_builder& {
+        elements_.push_back(std::move(value));
+        return *this;
+    }
+
+    auto push(std::string_view value) -> array_builder& {
+        elements_.emplace_back(std::string(value));
+        return *this;
+    }
+
+    auto push(const char* value) -> array_builder& { return push(std::string_view(value)); }
+
+    // Without this a literal nullptr would decay into the const char* overload
+    auto push(std::nullptr_t) -> array_builder& { return push(json_value{nullptr}); }
+
+    auto push(std::string&& value) -> array_builder& {
+        elements_.emplace_back(std::move(value));
+        return *this;
+    }
+
+    // Nested builders splice in by move and are left empty. The lvalue
+    // overloads exist because a chained temporary (builder{}.reserve(n)...)
+    // comes back as an lvalue reference; defined after object_builder
+    auto push(array_builder& nested) -> array_builder&;
+    auto push(array_builder&& nested) -> array_builder& { return push(nested); }
+    auto push(object_builder& nested) -> array_builder&;
+    auto push(object_builder&& nested) -> array_builder&;
+
+    auto size() const noexcept -> size_t { return elements_.size(); }
+    auto empty() const noexcept -> bool { return elements_.empty(); }
+
+    auto build() -> json_value { return json_value{std::move(elements_)}; }
+
+private:
+    json_array elements_;
+};
+
+export class object_builder {
+public:
+    object_builder() = default;
+
+    auto reserve(size_t n) -> object_builder& {
+        entries_.reserve(n);
+        return *this;
+    }
+
+    auto emplace(std::string_view key, json_value value) -> object_builder& {
+        entries_.emplace(std::string(key), std::move(value));
+        return *this;
+    }
+
+    auto emplace(std::string_view key, std::string_view value) -> object_builder& {
+        entries_.emplace(std::string(key), json_value{std::string(value)});
+        return *this;
+    }
+
+    auto emplace(std::string_view key, const char* value) -> object_builder& {
+        return emplace(key, std::string_view(value));
+    }
+
+    // Without this a literal nullptr would decay into the const char* overload
+    auto emplace(std::string_view key, std::nullptr_t) -> object_builder& {
+        return emplace(key, json_value{nullptr});
+    }
+
+    auto emplace(std::string_view key, std::string&& value) -> object_builder& {
+        entries_.emplace(std::string(key), json_value{std::move(value)});
+        return *this;
+    }
+
+    auto emplace(std::string_view key, array_builder& nested) -> object_builder& {
+        entries_.emplace(std::string(key), nested.build());
+        return *this;
+    }
+
+    auto emplace(std::string_view key, array_builder&& nested) -> object_builder& {
+        return emplace(key, nested);
+    }
+
+    auto emplace(std::string_view key, object_builder& nested) -> object_builder& {
+        entries_.emplace(std::string(key), nested.build());
+        return *this;
+    }
+
+    auto emplace(std::string_view key, object_builder&& nested) -> object_builder& {
+        return emplace(key, nested);
+    }
+
+    auto size() const noexcept -> size_t { return entries_.size(); }
+    auto empty() const noexcept -> bool { return entries_.empty(); }
+
+    // Sorts the entries once and moves the flat object out. Duplicate keys
+    // are kept (lookups return the first in sort order); callers that need
+    // to reject them can check has_duplicate_key() on the built object
+    auto build() -> json_value {
+        entries_.finalize();
+        flat_json_object done = std::move(entries_);
+        entries_ = flat_json_object{};
+        return json_value{std::move(done)};
+    }
+
+private:
+    flat_json_object entries_;
+};
+
+inline auto array_builder::push(array_builder& nested) -> array_builder& {
+    elements_.push_back(nested.build());
+    return *this;
+}
+
+inline auto array_builder::push(object_builder& nested) -> array_builder& {
+    elements_.push_back(nested.build());
+    return *this;
+}
+
+inline auto array_builder::push(object_builder&& nested) -> array_builder& {
+    return push(nested);
+}
+
+// ============================================================================
+// SIMD-Accelerated Serialization
+// ============================================================================
+// Two-stage write: a sizing pass over the tree pre-allocates the output
+// buffer once, then the emit pass copies clean string runs in bulk after a
+// movemask scan for characters needing escapes - mirroring the reader-side
+// kernels so serialization stops being append-at-a-time scalar work.
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// Append s with JSON escaping; clean runs found via one AVX2 scan per 32 bytes
+__attribute__((target("avx2"))) static auto append_escaped_avx2(std::string_view s,
+                                                                std::string& out) -> void {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+
+    size_t pos = 0;
+    while (pos + 32 <= s.size()) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s.data() + pos));
+        __m256i is_quote = _mm256_cmpeq_epi8(chunk, quote);
+        __m256i is_backslash = _mm256_cmpeq_epi8(chunk, backslash);
+        __m256i sub_result = _mm256_subs_epu8(chunk, _mm256_set1_epi8(0x1F));
+        __m256i is_control = _mm256_cmpeq_epi8(sub_result, _mm256_setzero_si256());
+        __m256i needs_escape =
+            _mm256_or_si256(_mm256_or_si256(is_quote, is_backslash), is_control);
+
+        uint32_t mask = _mm256_movemask_epi8(needs_escape);
+        if (mask == 0) {
+            out.append(s.data() + pos, 32);
+            pos += 32;
+            continue;
+        }
+
+        size_t chunk_pos = 0;
+        while (mask != 0) {
+            size_t esc = static_cast<size_t>(__builtin_ctz(mask));
+            if (esc > chunk_pos) {
+                out.append(s.data() + pos + chunk_pos, esc - chunk_pos);
+            }
+            char c = s[pos + esc];
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\b': out += "\\b"; break;
+                case '\f': out += "\\f"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default: {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+                    out.append(buf, 6);
+                    break;
                 }
             }
-            scan_pos++;
+            chunk_pos = esc + 1;
+            mask &= mask - 1;
         }
-    }  // End of if (!simd_success) block
+        if (chunk_pos < 32) {
+            out.append(s.data() + pos + chunk_pos, 32 - chunk_pos);
+        }
+        pos += 32;
+    }
 
-    // If we found very few pairs, fall back to sequential
-    if (kv_spans.size() < static_cast<size_t>(g_config.parallel_threshold / 100)) {
-        return parse_object();  // Use sequential version
+    // Scalar tail
+    for (; pos < s.size(); ++pos) {
+        char c = s[pos];
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+                    out.append(buf, 6);
+                } else {
+                    out += c;
+                }
+                break;
+        }
     }
+}
 
-    // Phase 2: Parse key-value pairs in parallel
-    json_object object;
+#endif
 
-    // We need to use a vector of pairs since unordered_map isn't thread-safe for concurrent inserts
-    std::vector<std::pair<std::string, json_value>> pairs(kv_spans.size());
+static auto append_escaped(std::string_view s, std::string& out) -> void {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
+        append_escaped_avx2(s, out);
+        return;
+    }
+#endif
+    for (char c : s) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+                    out.append(buf, 6);
+                } else {
+                    out += c;
+                }
+                break;
+        }
+    }
+}
 
-    std::atomic<bool> has_error{false};
-    json_error first_error{};
+// 128-bit integer formatting (no library support)
+static auto append_int128(unsigned __int128 magnitude, bool negative, std::string& out) -> void {
+    char buf[48];
+    char* p = buf + sizeof(buf);
+    if (magnitude == 0) {
+        *--p = '0';
+    }
+    while (magnitude != 0) {
+        *--p = static_cast<char>('0' + static_cast<unsigned>(magnitude % 10));
+        magnitude /= 10;
+    }
+    if (negative) {
+        *--p = '-';
+    }
+    out.append(p, static_cast<size_t>(buf + sizeof(buf) - p));
+}
 
-#pragma omp parallel for schedule(dynamic) if (kv_spans.size() >= 4)
-    for (size_t i = 0; i < kv_spans.size(); ++i) {
-        // Bind thread to NUMA node on first iteration
-        if (g_config.enable_numa && g_config.bind_threads_to_numa
-            && g_numa_topo.is_numa_available) {
-#ifdef _OPENMP
-            static thread_local bool thread_bound = false;
-            if (!thread_bound) {
-                int thread_id = omp_get_thread_num();
-                int num_threads = omp_get_num_threads();
-                int node = numa::get_optimal_node_for_thread(thread_id, num_threads,
-                                                             g_numa_topo.num_nodes);
-                numa::bind_thread_to_numa_node(node);
-                thread_bound = true;
-            }
-#endif
+// Sizing pass: exact for structure, slightly conservative for numbers
+static auto estimate_stringify_size(const json_value& v) -> size_t {
+    if (v.is_string()) {
+        // Worst-case escape expansion is 6x but 1.1x covers real payloads;
+        // the emit pass appends, so underestimation only costs a regrow
+        return v.as_string().size() + v.as_string().size() / 8 + 2;
+    }
+    if (v.is_array()) {
+        size_t total = 2;
+        for (const auto& element : v.as_array()) {
+            total += estimate_stringify_size(element) + 1;
+        }
+        return total;
+    }
+    if (v.is_flat_object()) {
+        size_t total = 2;
+        for (const auto& [key, value] : v.as_flat_object()) {
+            total += key.size() + 4 + estimate_stringify_size(value);
+        }
+        return total;
+    }
+    if (v.is_object()) {
+        size_t total = 2;
+        for (const auto& [key, value] : v.as_object()) {
+            total += key.size() + 4 + estimate_stringify_size(value);
         }
+        return total;
+    }
+    if (v.is_raw_number()) {
+        return v.as_raw_number().token().size();
+    }
+    return 40;  // Covers any number/literal incl. 128-bit integers
+}
 
-        if (has_error.load(std::memory_order_relaxed)) {
-            continue;
+// Shortest-round-trip double formatting, direct to the output buffer.
+// std::to_chars is the Ryu/Dragonbox-class backend here: it emits the
+// shortest decimal that round-trips the exact binary value, so "0.1" prints
+// as 0.1 rather than the 17-digit %.17g expansion, and runs several times
+// faster than snprintf. Integer-valued doubles in the exactly-representable
+// range (the bulk of market-data payloads) skip the binary-to-decimal
+// machinery entirely.
+static auto append_double(double value, std::string& out) -> void {
+    char buf[32];
+    if (value >= -9007199254740992.0 && value <= 9007199254740992.0) {
+        auto as_int = static_cast<int64_t>(value);
+        if (static_cast<double>(as_int) == value && !(as_int == 0 && std::signbit(value))) {
+            auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), as_int);
+            out.append(buf, static_cast<size_t>(ptr - buf));
+            return;
         }
+    }
+    auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+    if (ec != std::errc{}) {
+        // Cannot happen for double with this buffer size; keep the old
+        // formatter as the belt-and-braces path
+        int len = std::snprintf(buf, sizeof(buf), "%.17g", value);
+        out.append(buf, static_cast<size_t>(len));
+        return;
+    }
+    out.append(buf, static_cast<size_t>(ptr - buf));
+}
 
-        // Prefetch next key-value pair's data (3-4 items ahead)
-        if (i + 3 < kv_spans.size()) {
-            const auto& next_kv = kv_spans[i + 3];
-            // Prefetch key and value locations
-            __builtin_prefetch(input_.data() + next_kv.key_start, 0, 3);
-            __builtin_prefetch(input_.data() + next_kv.value_start, 0, 3);
-            // Prefetch middle of value if it's large (>2 cache lines)
-            if (next_kv.value_end - next_kv.value_start > 128) {
-                __builtin_prefetch(input_.data() + (next_kv.value_start + next_kv.value_end) / 2, 0,
-                                   3);
+static auto stringify_to(const json_value& v, std::string& out) -> void {
+    if (v.is_null()) {
+        out += "null";
+    } else if (v.is_bool()) {
+        out += v.as_bool() ? "true" : "false";
+    } else if (v.is_int128()) {
+        __int128 value = v.as_int128();
+        bool negative = value < 0;
+        unsigned __int128 magnitude =
+            negative ? static_cast<unsigned __int128>(-value) : static_cast<unsigned __int128>(value);
+        append_int128(magnitude, negative, out);
+    } else if (v.is_uint128()) {
+        append_int128(v.as_uint128(), false, out);
+    } else if (v.is_float128()) {
+        append_double(static_cast<double>(v.as_float128()), out);
+    } else if (v.is_raw_number()) {
+        out += v.as_raw_number().token();  // Verbatim round-trip, no conversion
+    } else if (v.is_number()) {
+        append_double(v.as_number(), out);
+    } else if (v.is_string()) {
+        out += '"';
+        append_escaped(v.as_string(), out);
+        out += '"';
+    } else if (v.is_array()) {
+        out += '[';
+        bool first = true;
+        for (const auto& element : v.as_array()) {
+            if (!first) {
+                out += ',';
+            }
+            first = false;
+            stringify_to(element, out);
+        }
+        out += ']';
+    } else if (v.is_flat_object()) {
+        out += '{';
+        bool first = true;
+        for (const auto& [key, value] : v.as_flat_object()) {
+            if (!first) {
+                out += ',';
+            }
+            first = false;
+            out += '"';
+            append_escaped(key, out);
+            out += "\":";
+            stringify_to(value, out);
+        }
+        out += '}';
+    } else if (v.is_object()) {
+        out += '{';
+        bool first = true;
+        for (const auto& [key, value] : v.as_object()) {
+            if (!first) {
+                out += ',';
             }
+            first = false;
+            out += '"';
+            append_escaped(key, out);
+            out += "\":";
+            stringify_to(value, out);
         }
+        out += '}';
+    }
+}
+
+export auto stringify(const json_value& v) -> std::string {
+    std::string out;
+    out.reserve(estimate_stringify_size(v));
+    stringify_to(v, out);
+    return out;
+}
 
-        auto& span = kv_spans[i];
+// Parallel serialization for large top-level arrays: each element is
+// serialized into its own buffer on the pool (the parse_array_parallel
+// chunking strategy run in reverse), then stitched with one final concat.
+// Non-array or small documents fall through to the sequential serializer.
+export auto stringify_parallel(const json_value& v) -> std::string {
+    if (!v.is_array()) {
+        return stringify(v);
+    }
+    const auto& array = v.as_array();
+    if (array.size() < static_cast<size_t>(g_config.parallel_threshold / 100)) {
+        return stringify(v);
+    }
 
-        // Extract key
-        std::string key = std::string(input_.substr(span.key_start, span.key_end - span.key_start));
+    std::vector<std::string> chunks(array.size());
 
-        // Parse value
-        std::string_view value_input =
-            input_.substr(span.value_start, span.value_end - span.value_start);
+    auto serialize_task = [&](size_t i) {
+        chunks[i].reserve(estimate_stringify_size(array[i]));
+        stringify_to(array[i], chunks[i]);
+    };
 
-        // Trim whitespace
-        while (!value_input.empty() && std::isspace(value_input.front())) {
-            value_input.remove_prefix(1);
+#if defined(FASTJSON_USE_PARALLEL_STL)
+    if (g_config.use_work_stealing) {
+        std::vector<size_t> order(array.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::for_each(std::execution::par, order.begin(), order.end(), serialize_task);
+    } else
+#endif
+    {
+#pragma omp parallel for schedule(dynamic) if (array.size() >= 4)
+        for (size_t i = 0; i < array.size(); ++i) {
+            serialize_task(i);
         }
-        while (!value_input.empty() && std::isspace(value_input.back())) {
-            value_input.remove_suffix(1);
+    }
+
+    // Stitch: exact size is known now, so the concat is one allocation
+    size_t total = 2 + (array.empty() ? 0 : array.size() - 1);
+    for (const auto& chunk : chunks) {
+        total += chunk.size();
+    }
+
+    std::string out;
+    out.reserve(total);
+    out += '[';
+    bool first = true;
+    for (const auto& chunk : chunks) {
+        if (!first) {
+            out += ',';
         }
+        first = false;
+        out += chunk;
+    }
+    out += ']';
+    return out;
+}
 
-        parser value_parser(value_input);
-        auto result = value_parser.parse_value();
+// ============================================================================
+// Pretty-Printing
+// ============================================================================
+// Same writer discipline as stringify_to: one pre-sized output buffer, scalar
+// leaves formatted in place, strings escaped through the shared append_escaped
+// path. Indentation comes from a single memoized pad buffer that grows to the
+// deepest level reached - each line appends one substring instead of building
+// depth separate spacer strings.
+
+namespace {
+
+struct prettify_writer {
+    std::string& out;
+    size_t indent;      // Spaces per nesting level
+    std::string pad;    // Grown lazily; prefix of length depth*indent is the spacer
+
+    auto newline(size_t depth) -> void {
+        out += '\n';
+        size_t width = depth * indent;
+        if (pad.size() < width) {
+            pad.resize(width, ' ');
+        }
+        out.append(pad.data(), width);
+    }
 
-        if (!result) {
-            bool expected = false;
-            if (has_error.compare_exchange_strong(expected, true)) {
-                first_error = result.error();
+    auto write(const json_value& v, size_t depth) -> void {
+        if (v.is_array()) {
+            const auto& array = v.as_array();
+            if (array.empty()) {
+                out += "[]";
+                return;
+            }
+            out += '[';
+            bool first = true;
+            for (const auto& element : array) {
+                if (!first) {
+                    out += ',';
+                }
+                first = false;
+                newline(depth + 1);
+                write(element, depth + 1);
+            }
+            newline(depth);
+            out += ']';
+        } else if (v.is_flat_object() || v.is_object()) {
+            auto write_members = [&](const auto& members) {
+                bool first = true;
+                for (const auto& [key, value] : members) {
+                    if (!first) {
+                        out += ',';
+                    }
+                    first = false;
+                    newline(depth + 1);
+                    out += '"';
+                    append_escaped(key, out);
+                    out += "\": ";
+                    write(value, depth + 1);
+                }
+            };
+            if ((v.is_flat_object() && v.as_flat_object().empty())
+                || (v.is_object() && v.as_object().empty())) {
+                out += "{}";
+                return;
+            }
+            out += '{';
+            if (v.is_flat_object()) {
+                write_members(v.as_flat_object());
+            } else {
+                write_members(v.as_object());
             }
+            newline(depth);
+            out += '}';
         } else {
-            pairs[i] = {std::move(key), std::move(*result)};
+            stringify_to(v, out);  // Scalar leaves share the compact formatter
         }
     }
+};
 
-    if (has_error) {
-        --depth_;
-        return std::unexpected(first_error);
-    }
+}  // namespace
 
-    // Move pairs into unordered_map
-    for (auto& pair : pairs) {
-        object[std::move(pair.first)] = std::move(pair.second);
+export auto prettify(const json_value& v, int indent) -> std::string {
+    if (indent <= 0) {
+        return stringify(v);  // Zero indent degenerates to the compact form
     }
 
-    // Update parser position
-    pos_ = object_end_pos + 1;  // +1 to skip the '}'
+    std::string out;
+    // Compact size plus headroom for newlines and indentation; deep documents
+    // grow past this, shallow ones never reallocate
+    out.reserve(estimate_stringify_size(v) * 2);
 
-    --depth_;
-    return json_value{std::move(object)};
+    prettify_writer writer{out, static_cast<size_t>(indent), {}};
+    writer.write(v, 0);
+    return out;
 }
 
 // ============================================================================
-// Public API
+// Text-to-Text Minify
 // ============================================================================
+// Compacting stored JSON through parse() + stringify() builds and tears down
+// a whole tree just to drop whitespace. minify() does the transform directly
+// on the input text: an AVX2 scan flags quotes, backslashes, and whitespace
+// per 32-byte block, string boundaries are tracked with the same quote/escape
+// logic as the structural pre-scan, and everything between stripped gaps is
+// copied in bulk. Invalid input is passed through rather than diagnosed -
+// minify is a transform, not a validator.
+
+__attribute__((target("avx2"))) static auto minify_avx2(std::span<const char> input,
+                                                        std::string& output) -> void {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i carriage = _mm256_set1_epi8('\r');
 
-export auto parse(std::string_view input) -> json_result<json_value> {
-    parser p(input);
-    return p.parse();
+    size_t pos = 0;
+    size_t run_start = 0;  // First byte not yet copied out
+    bool in_string = false;
+    // Position-based escape skip, as in count_separators_avx2: a backslash in
+    // the last lane must still suppress the first byte of the next chunk
+    size_t skip_pos = SIZE_MAX;
+
+    while (pos + 32 <= input.size()) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + pos));
+
+        __m256i whitespace = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, tab)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, newline), _mm256_cmpeq_epi8(chunk, carriage)));
+        __m256i interesting = _mm256_or_si256(
+            whitespace,
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)));
+
+        uint32_t mask = _mm256_movemask_epi8(interesting);
+
+        if (mask == 0) {
+            pos += 32;  // Clean block: the pending run just grows
+            continue;
+        }
+
+        for (int bit = 0; bit < 32 && mask; ++bit, mask >>= 1) {
+            if (!(mask & 1))
+                continue;
+
+            size_t char_pos = pos + bit;
+            if (char_pos == skip_pos)
+                continue;
+            char c = input[char_pos];
+
+            if (in_string) {
+                if (c == '\\') {
+                    skip_pos = char_pos + 1;
+                } else if (c == '"') {
+                    in_string = false;
+                }
+                // Whitespace inside a string is content; the run keeps it
+            } else if (c == '"') {
+                in_string = true;
+            } else if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+                output.append(input.data() + run_start, char_pos - run_start);
+                run_start = char_pos + 1;
+            }
+        }
+
+        pos += 32;
+    }
+
+    // Scalar tail
+    while (pos < input.size()) {
+        if (pos == skip_pos) {
+            pos++;
+            continue;
+        }
+        char c = input[pos];
+
+        if (in_string) {
+            if (c == '\\') {
+                pos += 2;
+                continue;
+            }
+            if (c == '"') {
+                in_string = false;
+            }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            output.append(input.data() + run_start, pos - run_start);
+            run_start = pos + 1;
+        }
+        pos++;
+    }
+
+    output.append(input.data() + run_start, input.size() - run_start);
 }
 
-export auto parse_with_config(std::string_view input, const parse_config& config)
-    -> json_result<json_value> {
-    auto old_config = g_config;
-    g_config = config;
-    auto result = parse(input);
-    g_config = old_config;
-    return result;
+static auto minify_scalar(std::span<const char> input, std::string& output) -> void {
+    size_t pos = 0;
+    size_t run_start = 0;
+    bool in_string = false;
+    bool escape_next = false;
+
+    while (pos < input.size()) {
+        char c = input[pos];
+
+        if (in_string) {
+            if (escape_next) {
+                escape_next = false;
+            } else if (c == '\\') {
+                escape_next = true;
+            } else if (c == '"') {
+                in_string = false;
+            }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            output.append(input.data() + run_start, pos - run_start);
+            run_start = pos + 1;
+        }
+        pos++;
+    }
+
+    output.append(input.data() + run_start, input.size() - run_start);
 }
 
-// Helper functions for creating JSON values
-export auto object() -> json_value {
-    return json_value{json_object{}};
+// Appends the minified text to output (callers batching many documents into
+// one buffer skip the per-document allocation)
+export auto minify(std::string_view input, std::string& output) -> void {
+    std::span<const char> data(input.data(), input.size());
+    if (g_config.enable_simd && g_config.enable_avx2 && g_simd_caps.avx2) {
+        minify_avx2(data, output);
+    } else {
+        minify_scalar(data, output);
+    }
 }
 
-export auto array() -> json_value {
-    return json_value{json_array{}};
+export auto minify(std::string_view input) -> std::string {
+    std::string output;
+    output.reserve(input.size());  // Output never exceeds the input
+    minify(input, output);
+    return output;
 }
 
-export auto null() -> json_value {
-    return json_value{};
+// ============================================================================
+// nlohmann::json Interop (migration bridge)
+// ============================================================================
+// Compiled only when <nlohmann/json.hpp> is on the include path. Incremental
+// migration means values cross the module boundary in both directions, and
+// the stringify + re-parse round trip that implies today costs more than
+// either parse did. These converters walk the trees directly, and the SAX
+// bridge feeds any nlohmann SAX consumer from an already-parsed document so
+// downstream nlohmann code keeps working at this library's parse speed.
+
+#if defined(FASTJSON_HAVE_NLOHMANN)
+
+export auto to_nlohmann(const json_value& value) -> nlohmann::json {
+    if (value.is_null()) {
+        return nullptr;
+    }
+    if (value.is_bool()) {
+        return value.as_bool();
+    }
+    if (value.is_string()) {
+        return value.as_string();
+    }
+    if (value.is_number()) {
+        // Integers survive exactly where nlohmann can hold them; 128-bit
+        // values beyond that range degrade to double, as they would have
+        // through a text round trip
+        if (value.is_int64()) {
+            return value.as_int64();
+        }
+        if (value.is_uint128()
+            && value.as_uint128()
+                   <= static_cast<json_uint_128>(std::numeric_limits<uint64_t>::max())) {
+            return static_cast<uint64_t>(value.as_uint128());
+        }
+        return value.as_number();
+    }
+    if (value.is_int128() || value.is_uint128() || value.is_float128()) {
+        return value.as_number();
+    }
+    if (value.is_array()) {
+        nlohmann::json out = nlohmann::json::array();
+        for (const auto& element : value.as_array()) {
+            out.push_back(to_nlohmann(element));
+        }
+        return out;
+    }
+    if (value.is_flat_object()) {
+        nlohmann::json out = nlohmann::json::object();
+        for (const auto& [key, field] : value.as_flat_object()) {
+            out[key] = to_nlohmann(field);
+        }
+        return out;
+    }
+    if (value.is_object()) {
+        nlohmann::json out = nlohmann::json::object();
+        for (const auto& [key, field] : value.as_object()) {
+            out[key] = to_nlohmann(field);
+        }
+        return out;
+    }
+    return nullptr;
 }
 
-// Serialization stubs (to be implemented)
-export auto stringify(const json_value& v) -> std::string {
-    return "{}";
+export auto from_nlohmann(const nlohmann::json& value) -> json_value {
+    switch (value.type()) {
+        case nlohmann::json::value_t::boolean:
+            return json_value{value.get<bool>()};
+        case nlohmann::json::value_t::number_integer:
+            return json_value{value.get<int64_t>()};
+        case nlohmann::json::value_t::number_unsigned:
+            return json_value{value.get<uint64_t>()};
+        case nlohmann::json::value_t::number_float:
+            return json_value{value.get<double>()};
+        case nlohmann::json::value_t::string:
+            return json_value{value.get<std::string>()};
+        case nlohmann::json::value_t::array: {
+            json_array out;
+            out.reserve(value.size());
+            for (const auto& element : value) {
+                out.emplace_back(from_nlohmann(element));
+            }
+            return json_value{std::move(out)};
+        }
+        case nlohmann::json::value_t::object: {
+            json_object out;
+            out.reserve(value.size());
+            for (const auto& [key, field] : value.items()) {
+                out[key] = from_nlohmann(field);
+            }
+            return json_value{std::move(out)};
+        }
+        default:
+            return json_value{};  // null, discarded, binary
+    }
 }
 
-export auto prettify(const json_value& v, int indent) -> std::string {
-    return "{}";
+// Replays a parsed tree into any nlohmann SAX consumer (json::sax_t
+// interface). Returns false as soon as the consumer does, matching
+// nlohmann::json::sax_parse semantics.
+export template <typename SaxHandler>
+auto sax_emit(const json_value& value, SaxHandler& handler) -> bool {
+    if (value.is_null()) {
+        return handler.null();
+    }
+    if (value.is_bool()) {
+        return handler.boolean(value.as_bool());
+    }
+    if (value.is_string()) {
+        std::string text = value.as_string();  // SAX interface takes string_t&
+        return handler.string(text);
+    }
+    if (value.is_number() || value.is_int128() || value.is_uint128() || value.is_float128()) {
+        if (value.is_int64()) {
+            return handler.number_integer(value.as_int64());
+        }
+        if (value.is_uint128()
+            && value.as_uint128()
+                   <= static_cast<json_uint_128>(std::numeric_limits<uint64_t>::max())) {
+            return handler.number_unsigned(static_cast<uint64_t>(value.as_uint128()));
+        }
+        return handler.number_float(value.as_number(), std::string{});
+    }
+    if (value.is_array()) {
+        const auto& array = value.as_array();
+        if (!handler.start_array(array.size())) {
+            return false;
+        }
+        for (const auto& element : array) {
+            if (!sax_emit(element, handler)) {
+                return false;
+            }
+        }
+        return handler.end_array();
+    }
+    if (value.is_object() || value.is_flat_object()) {
+        auto emit_fields = [&](const auto& object) -> bool {
+            if (!handler.start_object(object.size())) {
+                return false;
+            }
+            for (const auto& [key, field] : object) {
+                std::string key_text = key;
+                if (!handler.key(key_text)) {
+                    return false;
+                }
+                if (!sax_emit(field, handler)) {
+                    return false;
+                }
+            }
+            return handler.end_object();
+        };
+        return value.is_flat_object() ? emit_fields(value.as_flat_object())
+                                      : emit_fields(value.as_object());
+    }
+    return handler.null();
 }
 
+#endif  // FASTJSON_HAVE_NLOHMANN
+
 }  // namespace fastjson_parallel_parallel
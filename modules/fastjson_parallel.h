@@ -31,9 +31,11 @@ enum class json_error_code {
     invalid_unicode
 };
 
+// Trivially copyable: `message` points at a static string, so the reject
+// path never allocates (mirrors the module definition)
 struct json_error {
     json_error_code code;
-    std::string message;
+    const char* message;
     size_t line;
     size_t column;
 };
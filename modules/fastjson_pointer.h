@@ -0,0 +1,244 @@
+// FastestJSONInTheWest - JSON Pointer Evaluation over the Structural Index
+// Resolves an RFC 6901 pointer ("/results/0/score") by walking the structural
+// tape from build_structural_index() directly: siblings are skipped by
+// matching brace/bracket depth on the index, so extracting one field from a
+// large document never touches the bytes of the values it steps over.
+// ============================================================================
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fastjson_simd_index.h"
+
+namespace fastjson {
+namespace pointer {
+
+namespace detail {
+
+// Split an RFC 6901 pointer into unescaped reference tokens.
+// Returns std::nullopt for syntactically invalid pointers.
+inline auto split_pointer(std::string_view ptr) -> std::optional<std::vector<std::string>> {
+    std::vector<std::string> tokens;
+    if (ptr.empty()) {
+        return tokens;  // Whole document
+    }
+    if (ptr.front() != '/') {
+        return std::nullopt;
+    }
+
+    size_t pos = 1;
+    while (pos <= ptr.size()) {
+        size_t end = ptr.find('/', pos);
+        if (end == std::string_view::npos) {
+            end = ptr.size();
+        }
+
+        std::string token;
+        token.reserve(end - pos);
+        for (size_t i = pos; i < end; ++i) {
+            if (ptr[i] == '~') {
+                if (i + 1 >= end) {
+                    return std::nullopt;
+                }
+                ++i;
+                if (ptr[i] == '0') {
+                    token.push_back('~');
+                } else if (ptr[i] == '1') {
+                    token.push_back('/');
+                } else {
+                    return std::nullopt;
+                }
+            } else {
+                token.push_back(ptr[i]);
+            }
+        }
+        tokens.push_back(std::move(token));
+
+        if (end == ptr.size()) {
+            break;
+        }
+        pos = end + 1;
+    }
+    return tokens;
+}
+
+// Advance past one complete value starting at tape entry i, returning the
+// index of the first entry after it. Strings occupy an open/close quote pair;
+// containers are skipped by depth matching; primitives are single entries.
+inline auto skip_value(const std::vector<structural_index>& tape, size_t i) -> size_t {
+    if (i >= tape.size()) {
+        return i;
+    }
+    switch (tape[i].type) {
+        case structural_type::quote:
+            return i + 2;  // Open + close quote entries
+        case structural_type::left_brace:
+        case structural_type::left_bracket: {
+            int depth = 0;
+            for (; i < tape.size(); ++i) {
+                auto t = tape[i].type;
+                if (t == structural_type::left_brace || t == structural_type::left_bracket) {
+                    ++depth;
+                } else if (t == structural_type::right_brace ||
+                           t == structural_type::right_bracket) {
+                    if (--depth == 0) {
+                        return i + 1;
+                    }
+                }
+            }
+            return i;
+        }
+        default:
+            return i + 1;  // Primitive
+    }
+}
+
+// Text of the string whose opening quote is tape entry i, without quotes.
+// Raw bytes: escaped keys compare byte-for-byte against escaped tokens only,
+// which is the common case for identifier-like field names.
+inline auto string_text(std::span<const char> source, const std::vector<structural_index>& tape,
+                        size_t i) -> std::string_view {
+    size_t open = tape[i].position;
+    size_t close = tape[i + 1].position;
+    return std::string_view(source.data() + open + 1, close - open - 1);
+}
+
+// Locate the value for `name` inside the object whose '{' is tape entry i.
+// Returns the tape index of the value start, or nullopt if the key is absent.
+inline auto find_field(std::span<const char> source, const std::vector<structural_index>& tape,
+                       size_t i, std::string_view name) -> std::optional<size_t> {
+    ++i;  // Step inside the brace
+    while (i < tape.size() && tape[i].type != structural_type::right_brace) {
+        if (tape[i].type != structural_type::quote || i + 1 >= tape.size()) {
+            return std::nullopt;  // Malformed object
+        }
+        bool match = string_text(source, tape, i) == name;
+        i += 2;  // Past the key's quote pair
+
+        if (i >= tape.size() || tape[i].type != structural_type::colon) {
+            return std::nullopt;
+        }
+        ++i;
+
+        if (match) {
+            return i;
+        }
+        i = skip_value(tape, i);
+        if (i < tape.size() && tape[i].type == structural_type::comma) {
+            ++i;
+        }
+    }
+    return std::nullopt;
+}
+
+// Locate element `index` of the array whose '[' is tape entry i.
+inline auto find_element(const std::vector<structural_index>& tape, size_t i, size_t index)
+    -> std::optional<size_t> {
+    ++i;  // Step inside the bracket
+    if (i < tape.size() && tape[i].type == structural_type::right_bracket) {
+        return std::nullopt;  // Empty array
+    }
+    for (size_t n = 0; i < tape.size(); ++n) {
+        if (n == index) {
+            return i;
+        }
+        i = skip_value(tape, i);
+        if (i >= tape.size() || tape[i].type != structural_type::comma) {
+            return std::nullopt;  // Ran off the end of the array
+        }
+        ++i;
+    }
+    return std::nullopt;
+}
+
+// Exact source extent of the value starting at tape entry i.
+inline auto value_span(std::span<const char> source, const std::vector<structural_index>& tape,
+                       size_t i) -> std::string_view {
+    size_t start = tape[i].position;
+    size_t end;
+
+    switch (tape[i].type) {
+        case structural_type::quote:
+            end = tape[i + 1].position + 1;
+            break;
+        case structural_type::left_brace:
+        case structural_type::left_bracket: {
+            size_t after = skip_value(tape, i);
+            end = tape[after - 1].position + 1;
+            break;
+        }
+        default: {
+            // Primitive: runs to the next structural character, trimmed of
+            // trailing whitespace (or to end of input for a bare scalar).
+            end = (i + 1 < tape.size()) ? tape[i + 1].position : source.size();
+            while (end > start && (source[end - 1] == ' ' || source[end - 1] == '\t' ||
+                                   source[end - 1] == '\n' || source[end - 1] == '\r')) {
+                --end;
+            }
+            break;
+        }
+    }
+    return std::string_view(source.data() + start, end - start);
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+// Resolve `ptr` against `json` and return the raw text of the target value,
+// or std::nullopt if the pointer is invalid or the path does not exist.
+// Only the structural tape is walked; sibling values are never materialized.
+inline auto at_pointer(std::string_view json, std::string_view ptr)
+    -> std::optional<std::string_view> {
+    auto source = std::span<const char>(json.data(), json.size());
+    auto tape = build_structural_index(source);
+    if (tape.empty()) {
+        return std::nullopt;
+    }
+
+    auto tokens = detail::split_pointer(ptr);
+    if (!tokens) {
+        return std::nullopt;
+    }
+
+    size_t i = 0;
+    for (const auto& token : *tokens) {
+        std::optional<size_t> next;
+        if (tape[i].type == structural_type::left_brace) {
+            next = detail::find_field(source, tape, i, token);
+        } else if (tape[i].type == structural_type::left_bracket) {
+            if (token.empty() || token == "-" ||
+                token.find_first_not_of("0123456789") != std::string::npos ||
+                (token.size() > 1 && token.front() == '0')) {
+                return std::nullopt;
+            }
+            // from_chars rather than stoull: an index too large for size_t is
+            // just a path that cannot exist, never an exception
+            size_t index = 0;
+            auto [end, ec] = std::from_chars(token.data(), token.data() + token.size(), index);
+            if (ec != std::errc{} || end != token.data() + token.size()) {
+                return std::nullopt;
+            }
+            next = detail::find_element(tape, i, index);
+        } else {
+            return std::nullopt;  // Pointer descends into a scalar
+        }
+        if (!next) {
+            return std::nullopt;
+        }
+        i = *next;
+    }
+    return detail::value_span(source, tape, i);
+}
+
+}  // namespace pointer
+}  // namespace fastjson
@@ -0,0 +1,321 @@
+// FastestJSONInTheWest - Compile-Time Typed Deserialization
+// Deserializes directly from the JSONScanner token stream into user structs,
+// skipping DOM construction entirely. Callers describe their types once with a
+// member-pointer field list; parse_into<T>() then walks the tokens and writes
+// each matched field in place, so a typed RPC payload costs one pass over the
+// input instead of parse-to-json_value plus a hand-written copy loop.
+// ============================================================================
+
+#pragma once
+
+#include <charconv>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "fastjson_simd_api.h"
+
+namespace fastjson::reflect {
+
+// ============================================================================
+// Field Binding Declarations
+// ============================================================================
+// Users specialize json_bind<T> with a tuple of named member pointers:
+//
+//   struct point { double x; double y; };
+//   template <>
+//   struct fastjson::reflect::json_bind<point> {
+//       static constexpr auto fields = std::make_tuple(
+//           fastjson::reflect::field("x", &point::x),
+//           fastjson::reflect::field("y", &point::y));
+//   };
+//
+// Nested structs work automatically when the member type has its own binding.
+
+template <typename C, typename M>
+struct field_desc {
+    std::string_view name;
+    M C::* ptr;
+};
+
+template <typename C, typename M>
+[[nodiscard]] constexpr auto field(std::string_view name, M C::* ptr) -> field_desc<C, M> {
+    return {name, ptr};
+}
+
+template <typename T>
+struct json_bind;  // Primary template intentionally undefined
+
+template <typename T>
+concept bound_struct = requires { json_bind<T>::fields; };
+
+// ============================================================================
+// Error Reporting
+// ============================================================================
+
+struct reflect_error {
+    std::string message;
+    size_t position = 0;
+};
+
+template <typename T>
+using reflect_result = std::expected<T, reflect_error>;
+
+// ============================================================================
+// Token Cursor
+// ============================================================================
+
+namespace detail {
+
+using Token = simd::JSONScanner::Token;
+using TokenType = simd::JSONScanner::TokenType;
+
+// Forward cursor over the scanned token stream. Whitespace tokens, if the
+// scanner emitted any, are transparent to callers.
+class token_cursor {
+public:
+    token_cursor(std::span<const char> source, std::span<const Token> tokens)
+        : source_(source), tokens_(tokens) {}
+
+    [[nodiscard]] auto peek() -> const Token* {
+        while (pos_ < tokens_.size() && tokens_[pos_].type == TokenType::Whitespace) {
+            ++pos_;
+        }
+        return pos_ < tokens_.size() ? &tokens_[pos_] : nullptr;
+    }
+
+    [[nodiscard]] auto next() -> const Token* {
+        const Token* tok = peek();
+        if (tok != nullptr) {
+            ++pos_;
+        }
+        return tok;
+    }
+
+    [[nodiscard]] auto text(const Token& tok) const -> std::string_view {
+        return tok.extract_text(source_);
+    }
+
+    // String token text without the surrounding quotes. Escapes are left
+    // as-is: the typed RPC path carries identifier-like keys and values.
+    [[nodiscard]] auto string_text(const Token& tok) const -> std::string_view {
+        auto raw = text(tok);
+        if (raw.size() >= 2 && raw.front() == '"' && raw.back() == '"') {
+            raw.remove_prefix(1);
+            raw.remove_suffix(1);
+        }
+        return raw;
+    }
+
+    [[nodiscard]] auto position() const -> size_t {
+        return pos_ < tokens_.size() ? tokens_[pos_].position : source_.size();
+    }
+
+    // Skip one complete value (scalar or container) by depth matching.
+    [[nodiscard]] auto skip_value() -> bool {
+        const Token* tok = next();
+        if (tok == nullptr) {
+            return false;
+        }
+        if (tok->type != TokenType::OpenBrace && tok->type != TokenType::OpenBracket) {
+            return true;
+        }
+        int depth = 1;
+        while (depth > 0) {
+            tok = next();
+            if (tok == nullptr) {
+                return false;
+            }
+            if (tok->type == TokenType::OpenBrace || tok->type == TokenType::OpenBracket) {
+                ++depth;
+            } else if (tok->type == TokenType::CloseBrace ||
+                       tok->type == TokenType::CloseBracket) {
+                --depth;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::span<const char> source_;
+    std::span<const Token> tokens_;
+    size_t pos_ = 0;
+};
+
+inline auto error_at(token_cursor& cursor, std::string message) -> std::unexpected<reflect_error> {
+    return std::unexpected(reflect_error{std::move(message), cursor.position()});
+}
+
+template <typename T>
+auto read_value(token_cursor& cursor, T& out) -> reflect_result<void>;
+
+template <typename T>
+auto read_object(token_cursor& cursor, T& out) -> reflect_result<void>
+    requires bound_struct<T>
+{
+    const Token* open = cursor.next();
+    if (open == nullptr || open->type != TokenType::OpenBrace) {
+        return error_at(cursor, "Expected '{' for object");
+    }
+
+    const Token* tok = cursor.peek();
+    if (tok != nullptr && tok->type == TokenType::CloseBrace) {
+        (void)cursor.next();
+        return {};
+    }
+
+    while (true) {
+        const Token* key_tok = cursor.next();
+        if (key_tok == nullptr || key_tok->type != TokenType::String) {
+            return error_at(cursor, "Expected string key in object");
+        }
+        auto key = cursor.string_text(*key_tok);
+
+        const Token* colon = cursor.next();
+        if (colon == nullptr || colon->type != TokenType::Colon) {
+            return error_at(cursor, "Expected ':' after key");
+        }
+
+        bool matched = false;
+        reflect_result<void> field_result{};
+        std::apply(
+            [&](const auto&... fields) {
+                auto try_field = [&](const auto& f) {
+                    if (matched || key != f.name) {
+                        return;
+                    }
+                    matched = true;
+                    field_result = read_value(cursor, out.*(f.ptr));
+                };
+                (try_field(fields), ...);
+            },
+            json_bind<T>::fields);
+
+        if (matched) {
+            if (!field_result) {
+                return field_result;
+            }
+        } else if (!cursor.skip_value()) {
+            return error_at(cursor, "Unterminated value for unknown key");
+        }
+
+        const Token* sep = cursor.next();
+        if (sep == nullptr) {
+            return error_at(cursor, "Unterminated object");
+        }
+        if (sep->type == TokenType::CloseBrace) {
+            return {};
+        }
+        if (sep->type != TokenType::Comma) {
+            return error_at(cursor, "Expected ',' or '}' in object");
+        }
+    }
+}
+
+template <typename T>
+auto read_value(token_cursor& cursor, T& out) -> reflect_result<void> {
+    if constexpr (bound_struct<T>) {
+        return read_object(cursor, out);
+    } else if constexpr (std::same_as<T, bool>) {
+        const Token* tok = cursor.next();
+        if (tok == nullptr) {
+            return error_at(cursor, "Expected boolean");
+        }
+        if (tok->type == TokenType::BooleanTrue) {
+            out = true;
+        } else if (tok->type == TokenType::BooleanFalse) {
+            out = false;
+        } else {
+            return error_at(cursor, "Expected boolean");
+        }
+        return {};
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        const Token* tok = cursor.next();
+        if (tok == nullptr || tok->type != TokenType::Number) {
+            return error_at(cursor, "Expected number");
+        }
+        auto text = cursor.text(*tok);
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+        if (ec != std::errc{} || ptr != text.data() + text.size()) {
+            return error_at(cursor, "Invalid number");
+        }
+        return {};
+    } else if constexpr (std::same_as<T, std::string> || std::same_as<T, std::string_view>) {
+        const Token* tok = cursor.next();
+        if (tok == nullptr || tok->type != TokenType::String) {
+            return error_at(cursor, "Expected string");
+        }
+        out = T{cursor.string_text(*tok)};
+        return {};
+    } else {
+        // std::vector<U> of any supported element type
+        using element_type = typename T::value_type;
+        const Token* open = cursor.next();
+        if (open == nullptr || open->type != TokenType::OpenBracket) {
+            return error_at(cursor, "Expected '[' for array");
+        }
+        out.clear();
+
+        const Token* tok = cursor.peek();
+        if (tok != nullptr && tok->type == TokenType::CloseBracket) {
+            (void)cursor.next();
+            return {};
+        }
+
+        while (true) {
+            element_type element{};
+            if (auto r = read_value(cursor, element); !r) {
+                return r;
+            }
+            out.push_back(std::move(element));
+
+            const Token* sep = cursor.next();
+            if (sep == nullptr) {
+                return error_at(cursor, "Unterminated array");
+            }
+            if (sep->type == TokenType::CloseBracket) {
+                return {};
+            }
+            if (sep->type != TokenType::Comma) {
+                return error_at(cursor, "Expected ',' or ']' in array");
+            }
+        }
+    }
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+// Deserialize json_data directly into a T described by json_bind<T>.
+// Unknown keys are skipped by depth matching; missing keys leave the
+// corresponding members default-initialized.
+template <typename T>
+[[nodiscard]] auto parse_into(std::span<const char> json_data) -> reflect_result<T>
+    requires bound_struct<T>
+{
+    auto scanner = simd::factory::create_scanner();
+    auto tokens = scanner.scan_tokens(json_data);
+
+    detail::token_cursor cursor{json_data, tokens};
+    T result{};
+    if (auto r = detail::read_object(cursor, result); !r) {
+        return std::unexpected(r.error());
+    }
+    return result;
+}
+
+template <typename T>
+[[nodiscard]] auto parse_into(std::string_view json) -> reflect_result<T>
+    requires bound_struct<T>
+{
+    return parse_into<T>(std::span<const char>{json.data(), json.size()});
+}
+
+}  // namespace fastjson::reflect
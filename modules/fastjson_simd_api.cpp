@@ -50,6 +50,8 @@ auto SIMDContext::create_with_capabilities(std::span<const char> required_featur
     return std::unique_ptr<SIMDContext>(new SIMDContext(std::move(caps)));
 }
 
+#ifndef FASTJSON_STATIC_SIMD
+
 auto SIMDContext::supports_avx512() const noexcept -> bool {
     return capabilities_.avx512_detected && capabilities_.avx512_enabled;
 }
@@ -59,7 +61,7 @@ auto SIMDContext::supports_avx2() const noexcept -> bool {
 }
 
 auto SIMDContext::supports_multi_register() const noexcept -> bool {
-    return capabilities_.multi_register_enabled && 
+    return capabilities_.multi_register_enabled &&
            (capabilities_.avx2_detected || capabilities_.avx512_detected);
 }
 
@@ -68,15 +70,27 @@ auto SIMDContext::get_optimal_chunk_size() const noexcept -> size_t {
         return 512;  // 8 x 64-byte registers
     }
     if (supports_avx2()) {
-        return 128;  // 4 x 32-byte registers  
+        return 128;  // 4 x 32-byte registers
     }
     return 16;  // SSE2 fallback
 }
 
+#endif  // !FASTJSON_STATIC_SIMD
+
 auto SIMDContext::detect_capabilities() -> Capabilities {
     Capabilities caps;
-    
-#if defined(__x86_64__) || defined(_M_X64)
+
+#if defined(FASTJSON_STATIC_SIMD_AVX512)
+    // Static dispatch: the capability set is the build configuration
+    caps.avx2_detected = true;
+    caps.avx512_detected = true;
+    caps.optimal_chunk_size = 512;
+#elif defined(FASTJSON_STATIC_SIMD_AVX2)
+    caps.avx2_detected = true;
+    caps.optimal_chunk_size = 128;
+#elif defined(FASTJSON_STATIC_SIMD_SCALAR)
+    caps.optimal_chunk_size = 16;
+#elif defined(__x86_64__) || defined(_M_X64)
     // Use __builtin_cpu_supports for runtime detection
     caps.avx2_detected = __builtin_cpu_supports("avx2");
     caps.avx512_detected = __builtin_cpu_supports("avx512f") && 
@@ -160,10 +174,19 @@ auto SIMDOperations::find_structural_chars(std::span<const char> data,
 
 auto JSONScanner::scan_tokens(std::span<const char> json_data) -> std::vector<Token> {
     std::vector<Token> tokens;
-    tokens.reserve(json_data.size() / 10); // Rough estimate
-    
+    scan_tokens_into(json_data, tokens);
+    return tokens;
+}
+
+auto JSONScanner::scan_tokens_into(std::span<const char> json_data,
+                                   std::vector<Token>& tokens) -> size_t {
+    tokens.clear();
+    if (tokens.capacity() < json_data.size() / 10) {
+        tokens.reserve(json_data.size() / 10); // Rough estimate
+    }
+
     size_t position = 0;
-    
+
     while (position < json_data.size()) {
         auto token = scan_next_token(json_data, position);
         if (token) {
@@ -173,8 +196,8 @@ auto JSONScanner::scan_tokens(std::span<const char> json_data) -> std::vector<To
             ++position; // Skip unknown character
         }
     }
-    
-    return tokens;
+
+    return tokens.size();
 }
 
 auto JSONScanner::scan_next_token(std::span<const char> json_data, 
@@ -446,8 +469,101 @@ auto JSONScanner::scan_literal_token(std::span<const char> data, size_t start_po
         std::string_view{data.data() + start_pos, 4} == "null") {
         return {TokenType::Null, start_pos, 4};
     }
-    
+
     return {TokenType::Unknown, start_pos, 0};
 }
 
+// ============================================================================
+// StreamingTokenizer Implementation
+// ============================================================================
+
+auto StreamingTokenizer::feed(std::span<const char> chunk) -> void {
+    // Drop the consumed prefix before buffering more input so only the
+    // unconsumed tail of the stream is ever held
+    if (cursor_ > 0) {
+        pending_.erase(0, cursor_);
+        base_offset_ += cursor_;
+        cursor_ = 0;
+    }
+    pending_.append(chunk.data(), chunk.size());
+}
+
+auto StreamingTokenizer::next() -> std::optional<JSONScanner::Token> {
+    std::span<const char> data(pending_.data(), pending_.size());
+
+    while (cursor_ < data.size()) {
+        if (!finished_ && may_continue(data, cursor_)) {
+            return std::nullopt; // Suspend: token may straddle the chunk boundary
+        }
+
+        size_t position = cursor_;
+        auto token = scanner_.scan_next_token(data, position);
+        if (token) {
+            cursor_ = token->position + token->length;
+            return JSONScanner::Token{token->type, base_offset_ + token->position,
+                                      token->length};
+        }
+        ++cursor_; // Skip unknown character, same as scan_tokens
+    }
+
+    return std::nullopt;
+}
+
+auto StreamingTokenizer::may_continue(std::span<const char> data, size_t pos) const -> bool {
+    const size_t end = data.size();
+    auto is_ws = [](char ch) { return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r'; };
+
+    char c = data[pos];
+
+    // Whitespace run touching the end of the buffer may keep growing
+    if (is_ws(c)) {
+        while (pos < end && is_ws(data[pos])) {
+            ++pos;
+        }
+        return pos == end;
+    }
+
+    // String with no closing quote buffered yet (an escape at the boundary
+    // also lands here because the skip jumps past the end)
+    if (c == '"') {
+        ++pos;
+        while (pos < end) {
+            if (data[pos] == '\\') {
+                pos += 2;
+                continue;
+            }
+            if (data[pos] == '"') {
+                return false;
+            }
+            ++pos;
+        }
+        return true;
+    }
+
+    // Number whose character run reaches the end of the buffer
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        while (pos < end) {
+            char nc = data[pos];
+            if (!((nc >= '0' && nc <= '9') || nc == '-' || nc == '+' || nc == '.' ||
+                  nc == 'e' || nc == 'E')) {
+                return false;
+            }
+            ++pos;
+        }
+        return true;
+    }
+
+    // Partial literal: remaining bytes are a proper prefix of true/false/null
+    if (c == 't' || c == 'f' || c == 'n') {
+        std::string_view literal = (c == 't') ? "true" : (c == 'f') ? "false" : "null";
+        size_t available = end - pos;
+        if (available >= literal.size()) {
+            return false;
+        }
+        return literal.substr(0, available) == std::string_view{data.data() + pos, available};
+    }
+
+    return false;
+}
+
 } // namespace fastjson::simd
\ No newline at end of file
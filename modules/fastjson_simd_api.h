@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <concepts>
 #include <chrono>
+#include <string>
+#include <string_view>
 
 import fastjson_simd_multiregister;
 
@@ -52,11 +54,31 @@ public:
         return std::move(*this);
     }
 
-    // Query capabilities
+    // Query capabilities. In static dispatch builds (FASTJSON_STATIC_SIMD)
+    // these collapse to compile-time constants so the tier branches in
+    // SIMDOperations fold away and the selected kernels inline; runtime
+    // builds resolve them out of line against detected capabilities.
+#if defined(FASTJSON_STATIC_SIMD_AVX512)
+    [[nodiscard]] static constexpr auto supports_avx512() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto supports_avx2() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto supports_multi_register() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto get_optimal_chunk_size() noexcept -> size_t { return 512; }
+#elif defined(FASTJSON_STATIC_SIMD_AVX2)
+    [[nodiscard]] static constexpr auto supports_avx512() noexcept -> bool { return false; }
+    [[nodiscard]] static constexpr auto supports_avx2() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto supports_multi_register() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto get_optimal_chunk_size() noexcept -> size_t { return 128; }
+#elif defined(FASTJSON_STATIC_SIMD_SCALAR)
+    [[nodiscard]] static constexpr auto supports_avx512() noexcept -> bool { return false; }
+    [[nodiscard]] static constexpr auto supports_avx2() noexcept -> bool { return false; }
+    [[nodiscard]] static constexpr auto supports_multi_register() noexcept -> bool { return false; }
+    [[nodiscard]] static constexpr auto get_optimal_chunk_size() noexcept -> size_t { return 16; }
+#else
     [[nodiscard]] auto supports_avx512() const noexcept -> bool;
     [[nodiscard]] auto supports_avx2() const noexcept -> bool;
     [[nodiscard]] auto supports_multi_register() const noexcept -> bool;
     [[nodiscard]] auto get_optimal_chunk_size() const noexcept -> size_t;
+#endif
 
 private:
     struct Capabilities {
@@ -227,8 +249,15 @@ public:
 
     // Main scanning operations
     [[nodiscard]] auto scan_tokens(std::span<const char> json_data) -> std::vector<Token>;
-    
-    [[nodiscard]] auto scan_next_token(std::span<const char> json_data, 
+
+    // Arena-reuse variant: clears and refills a caller-owned token buffer so
+    // long-lived scanning services recycle the vector's capacity across
+    // documents instead of paying growth cycles per document. Returns the
+    // number of tokens scanned.
+    auto scan_tokens_into(std::span<const char> json_data,
+                          std::vector<Token>& tokens) -> size_t;
+
+    [[nodiscard]] auto scan_next_token(std::span<const char> json_data,
                                       size_t& position) -> std::optional<Token>;
 
     // Specialized scanning operations
@@ -260,6 +289,48 @@ private:
     [[nodiscard]] auto scan_literal_token(std::span<const char> data, size_t start_pos) -> Token;
 };
 
+// ============================================================================
+// Streaming Tokenizer (pull-based, suspends at buffer boundaries)
+// ============================================================================
+// Incremental interface over JSONScanner for network-streamed documents:
+// feed() appends input chunks, next() pulls complete tokens one at a time and
+// returns std::nullopt when the remaining bytes might be the prefix of a
+// token that continues in a later chunk. Only the unconsumed tail of the
+// stream is retained between chunks, so documents are tokenized without full
+// buffering. Token positions are absolute offsets into the logical stream,
+// and the token sequence matches what scan_tokens would produce on the
+// concatenated input.
+
+class StreamingTokenizer {
+public:
+    explicit StreamingTokenizer(JSONScanner& scanner) : scanner_(scanner) {}
+
+    // Append the next chunk of input
+    auto feed(std::span<const char> chunk) -> void;
+
+    // Signal end of input; next() may then emit tokens that were held back
+    // because they touched the buffer boundary
+    auto finish() -> void { finished_ = true; }
+
+    // Pull the next complete token, or std::nullopt when more input is
+    // needed (or the stream is exhausted after finish())
+    [[nodiscard]] auto next() -> std::optional<JSONScanner::Token>;
+
+    // Absolute stream offset of the next unconsumed byte
+    [[nodiscard]] auto stream_position() const -> size_t { return base_offset_ + cursor_; }
+
+private:
+    // True when the bytes at pos could be the prefix of a token that extends
+    // beyond the currently buffered data
+    [[nodiscard]] auto may_continue(std::span<const char> data, size_t pos) const -> bool;
+
+    JSONScanner& scanner_;
+    std::string pending_;    // unconsumed tail of the stream
+    size_t cursor_{0};       // scan position within pending_
+    size_t base_offset_{0};  // absolute stream offset of pending_[0]
+    bool finished_{false};
+};
+
 // ============================================================================
 // Factory Functions and Convenience APIs
 // ============================================================================
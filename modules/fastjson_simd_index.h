@@ -8,13 +8,30 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <span>
+#include <string>
 #include <vector>
 
 #include <immintrin.h>
 
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
 namespace fastjson {
 
+// ============================================================================
+// Software Prefetch Control
+// ============================================================================
+// Distance in bytes that the scan kernels fetch ahead of the block they are
+// processing. Multi-hundred-MB documents stream entirely out of DRAM, so a
+// few cache lines of lead time hides most of that latency; 0 disables
+// software prefetch throughout stage 1 and the tape builder. Wired to
+// parse_config::prefetch_distance by set_parse_config().
+
+inline size_t g_prefetch_distance = 512;
+
 // ============================================================================
 // Structural Character Types
 // ============================================================================
@@ -46,9 +63,15 @@ struct structural_index {
 // ============================================================================
 
 #if defined(__AVX2__)
+// Stateful core shared by the whole-document scan and the parallel chunk
+// scanner: positions are recorded relative to `base`, the scan starts from an
+// assumed `in_string` state, and the in-string state after the last byte is
+// returned. Callers must guarantee the byte before the chunk is not a
+// backslash (the parallel splitter shifts boundaries past backslash runs), so
+// the scan always begins with a clean escape state.
 __attribute__((target("avx2"))) inline auto
-find_structural_chars_avx2(std::span<const char> input, std::vector<structural_index>& indices)
-    -> void {
+find_structural_chars_avx2_chunk(std::span<const char> input, size_t base, bool in_string,
+                                 std::vector<structural_index>& indices) -> bool {
     const size_t len = input.size();
     const char* data = input.data();
 
@@ -65,16 +88,51 @@ find_structural_chars_avx2(std::span<const char> input, std::vector<structural_i
     const __m256i quote = _mm256_set1_epi8('"');
     const __m256i backslash = _mm256_set1_epi8('\\');
 
-    bool in_string = false;
     bool prev_escape = false;
 
     size_t pos = 0;
 
     // Process 32 bytes at a time with AVX2
     while (pos + 32 <= len) {
-        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        if (g_prefetch_distance != 0 && pos + g_prefetch_distance < len) {
+            _mm_prefetch(data + pos + g_prefetch_distance, _MM_HINT_T0);
+        }
+        // Scalar sweep over block bytes [start, 32) with full escape
+        // tracking. Used for any part of a block where string state matters:
+        // blindly toggling on every quote in the vector mask would treat an
+        // escaped \" as a closing quote.
+        auto scan_block_scalar = [&](size_t start) {
+            for (size_t i = start; i < 32; i++) {
+                char c = data[pos + i];
+
+                if (in_string) {
+                    if (prev_escape) {
+                        prev_escape = false;
+                    } else if (c == '\\') {
+                        prev_escape = true;
+                    } else if (c == '"') {
+                        in_string = false;
+                        indices.push_back({base + pos + i, structural_type::quote, {}});
+                    }
+                } else {
+                    switch (c) {
+                        case '{': case '}': case '[': case ']': case ',': case ':':
+                            indices.push_back({base + pos + i, static_cast<structural_type>(c), {}});
+                            break;
+                        case '"':
+                            in_string = true;
+                            indices.push_back({base + pos + i, structural_type::quote, {}});
+                            break;
+                        default:
+                            break;
+                    }
+                }
+            }
+        };
 
         if (!in_string) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+
             // Find all structural characters
             __m256i is_left_brace = _mm256_cmpeq_epi8(chunk, left_brace);
             __m256i is_right_brace = _mm256_cmpeq_epi8(chunk, right_brace);
@@ -92,53 +150,30 @@ find_structural_chars_avx2(std::span<const char> input, std::vector<structural_i
 
             uint32_t mask = _mm256_movemask_epi8(structural);
 
-            // Process structural characters left-to-right, tracking string state.
-            // When we encounter a quote, toggle in_string. When inside a string,
-            // skip non-quote structural chars (they're literal characters).
+            // Consume structural characters left-to-right from the mask. On an
+            // opening quote, hand the rest of the block to the scalar sweep:
+            // bytes after it are string content and may contain escaped
+            // quotes, which the mask alone cannot classify.
             while (mask != 0) {
                 int bit_pos = __builtin_ctz(mask);
                 size_t char_pos = pos + bit_pos;
                 char c = data[char_pos];
 
                 if (c == '"') {
-                    in_string = !in_string;
-                    indices.push_back({char_pos, structural_type::quote, {}});
-                } else if (!in_string) {
-                    indices.push_back({char_pos, static_cast<structural_type>(c), {}});
+                    in_string = true;
+                    indices.push_back({base + char_pos, structural_type::quote, {}});
+                    scan_block_scalar(static_cast<size_t>(bit_pos) + 1);
+                    break;
                 }
+                indices.push_back({base + char_pos, static_cast<structural_type>(c), {}});
 
                 mask &= mask - 1;
             }
         } else {
-            // In string at chunk start: scalar fallback with proper escape handling.
-            // After finding the closing quote, continue processing the rest of the
-            // chunk for structural characters (don't skip them).
-            for (size_t i = 0; i < 32 && pos + i < len; i++) {
-                char c = data[pos + i];
-
-                if (in_string) {
-                    if (prev_escape) {
-                        prev_escape = false;
-                    } else if (c == '\\') {
-                        prev_escape = true;
-                    } else if (c == '"') {
-                        in_string = false;
-                        indices.push_back({pos + i, structural_type::quote, {}});
-                    }
-                } else {
-                    switch (c) {
-                        case '{': case '}': case '[': case ']': case ',': case ':':
-                            indices.push_back({pos + i, static_cast<structural_type>(c), {}});
-                            break;
-                        case '"':
-                            in_string = true;
-                            indices.push_back({pos + i, structural_type::quote, {}});
-                            break;
-                        default:
-                            break;
-                    }
-                }
-            }
+            // In string at block start: scalar sweep with proper escape
+            // handling. After finding the closing quote it keeps processing
+            // the rest of the block for structural characters.
+            scan_block_scalar(0);
         }
 
         pos += 32;
@@ -155,7 +190,7 @@ find_structural_chars_avx2(std::span<const char> input, std::vector<structural_i
                 prev_escape = true;
             } else if (c == '"') {
                 in_string = false;
-                indices.push_back({pos, structural_type::quote, {}});
+                indices.push_back({base + pos, structural_type::quote, {}});
             }
         } else {
             switch (c) {
@@ -165,17 +200,25 @@ find_structural_chars_avx2(std::span<const char> input, std::vector<structural_i
                 case ']':
                 case ',':
                 case ':':
-                    indices.push_back({pos, static_cast<structural_type>(c), {}});
+                    indices.push_back({base + pos, static_cast<structural_type>(c), {}});
                     break;
                 case '"':
                     in_string = true;
-                    indices.push_back({pos, structural_type::quote, {}});
+                    indices.push_back({base + pos, structural_type::quote, {}});
                     break;
             }
         }
 
         pos++;
     }
+
+    return in_string;
+}
+
+__attribute__((target("avx2"))) inline auto
+find_structural_chars_avx2(std::span<const char> input, std::vector<structural_index>& indices)
+    -> void {
+    find_structural_chars_avx2_chunk(input, 0, false, indices);
 }
 #endif  // __AVX2__
 
@@ -240,14 +283,17 @@ find_structural_chars_sse42(std::span<const char> input, std::vector<structural_
 // Scalar Fallback Version
 // ============================================================================
 
-inline auto find_structural_chars_scalar(std::span<const char> input,
-                                         std::vector<structural_index>& indices) -> void {
+// Stateful core mirroring find_structural_chars_avx2_chunk: same base offset,
+// starting string state, and end-state return, so the parallel splitter can
+// dispatch to either kernel interchangeably.
+inline auto find_structural_chars_scalar_chunk(std::span<const char> input, size_t base,
+                                               bool in_string,
+                                               std::vector<structural_index>& indices) -> bool {
     const size_t len = input.size();
     const char* data = input.data();
 
     indices.reserve(len / 10);
 
-    bool in_string = false;
     bool prev_escape = false;
 
     for (size_t pos = 0; pos < len; pos++) {
@@ -260,7 +306,7 @@ inline auto find_structural_chars_scalar(std::span<const char> input,
                 prev_escape = true;
             } else if (c == '"') {
                 in_string = false;
-                indices.push_back({pos, structural_type::quote, {}});
+                indices.push_back({base + pos, structural_type::quote, {}});
             }
         } else {
             switch (c) {
@@ -270,35 +316,35 @@ inline auto find_structural_chars_scalar(std::span<const char> input,
                 case ']':
                 case ',':
                 case ':':
-                    indices.push_back({pos, static_cast<structural_type>(c), {}});
+                    indices.push_back({base + pos, static_cast<structural_type>(c), {}});
                     break;
                 case '"':
                     in_string = true;
-                    indices.push_back({pos, structural_type::quote, {}});
+                    indices.push_back({base + pos, structural_type::quote, {}});
                     break;
             }
         }
     }
+
+    return in_string;
+}
+
+inline auto find_structural_chars_scalar(std::span<const char> input,
+                                         std::vector<structural_index>& indices) -> void {
+    find_structural_chars_scalar_chunk(input, 0, false, indices);
 }
 
 // ============================================================================
 // Dispatcher - Selects Best SIMD Version
 // ============================================================================
 
-inline auto build_structural_index(std::span<const char> input) -> std::vector<structural_index> {
-    std::vector<structural_index> indices;
-
-#if defined(__AVX2__)
-    find_structural_chars_avx2(input, indices);
-#elif defined(__SSE4_2__)
-    find_structural_chars_sse42(input, indices);
-#else
-    find_structural_chars_scalar(input, indices);
-#endif
-
-    // Post-process: insert primitive value starts (numbers, booleans, null).
-    // The SIMD/scalar scanners only index structural characters ({ } [ ] , : ")
-    // but ondemand navigation needs tape entries for primitive values too.
+// Post-process: insert primitive value starts (numbers, booleans, null).
+// The SIMD/scalar scanners only index structural characters ({ } [ ] , : ")
+// but ondemand navigation needs tape entries for primitive values too.
+// Shared by the CPU scanners and the GPU stage-1 path, which both produce
+// structural-characters-only indices.
+inline auto insert_primitive_starts(std::span<const char> input,
+                                    std::vector<structural_index>& indices) -> void {
     const char* data = input.data();
     const size_t len = input.size();
     std::vector<structural_index> primitives;
@@ -339,7 +385,275 @@ inline auto build_structural_index(std::span<const char> input) -> std::vector<s
                                return a.position < b.position;
                            });
     }
+}
+
+inline auto build_structural_index_serial(std::span<const char> input)
+    -> std::vector<structural_index> {
+    std::vector<structural_index> indices;
+
+#if defined(__AVX2__)
+    find_structural_chars_avx2(input, indices);
+#elif defined(__SSE4_2__)
+    find_structural_chars_sse42(input, indices);
+#else
+    find_structural_chars_scalar(input, indices);
+#endif
+
+    insert_primitive_starts(input, indices);
+    return indices;
+}
+
+// ============================================================================
+// Parallel Stage-1 Scan
+// ============================================================================
+// Stage 1 is a sequential state machine only because of string state: whether
+// a byte is structural depends on every quote before it. To run it across
+// cores, the input is split into one chunk per thread and each chunk is
+// scanned twice speculatively - once assuming it starts outside a string,
+// once assuming inside - using the same kernels as the serial path. A cheap
+// sequential stitch then walks the chunks in order, resolves each chunk's
+// true starting state from the previous chunk's ending state, and keeps the
+// matching interpretation. Escape carry across joins is eliminated up front:
+// chunk boundaries are shifted forward past backslash runs, so no chunk
+// starts immediately after a backslash and both speculations begin with a
+// clean escape state. The 2x scan cost is paid in parallel, so the scan
+// scales to num_threads/2 effective cores - the piece stage 1 was missing
+// while stage 2 already ran in parallel.
+
+// Inputs below this size stay on the serial path: the spawn + double-scan
+// overhead only pays for itself once the document stops fitting in LLC.
+inline size_t g_parallel_index_min_bytes = 4 * 1024 * 1024;
+
+// Scan one chunk with the best available kernel from an assumed string state.
+// Returns the in-string state after the chunk.
+inline auto scan_structural_chunk(std::span<const char> chunk, size_t base, bool in_string,
+                                  std::vector<structural_index>& indices) -> bool {
+#if defined(__AVX2__)
+    return find_structural_chars_avx2_chunk(chunk, base, in_string, indices);
+#else
+    return find_structural_chars_scalar_chunk(chunk, base, in_string, indices);
+#endif
+}
+
+inline auto build_structural_index_parallel(std::span<const char> input, int num_threads = 0)
+    -> std::vector<structural_index> {
+#ifdef _OPENMP
+    if (num_threads <= 0) {
+        num_threads = omp_get_max_threads();
+    }
+#else
+    num_threads = 1;
+#endif
+
+    const size_t len = input.size();
+    if (num_threads <= 1 || len < g_parallel_index_min_bytes ||
+        len < static_cast<size_t>(num_threads) * 64) {
+        return build_structural_index_serial(input);
+    }
+
+    const char* data = input.data();
+    const size_t chunk_count = static_cast<size_t>(num_threads);
+
+    // Chunk boundaries, shifted forward past backslash runs so the byte before
+    // every boundary is a non-backslash: speculative scans never inherit
+    // escape state, only the in/out-of-string ambiguity remains.
+    std::vector<size_t> bounds(chunk_count + 1);
+    bounds[0] = 0;
+    for (size_t i = 1; i < chunk_count; ++i) {
+        size_t b = std::max(bounds[i - 1], len * i / chunk_count);
+        while (b < len && data[b - 1] == '\\') {
+            ++b;
+        }
+        bounds[i] = b;
+    }
+    bounds[chunk_count] = len;
+
+    struct chunk_scan {
+        std::vector<structural_index> indices[2];  // Indexed by assumed start state
+        bool end_in_string[2] = {false, false};
+    };
+    std::vector<chunk_scan> scans(chunk_count);
+
+#ifdef _OPENMP
+    #pragma omp parallel for num_threads(num_threads) schedule(static)
+#endif
+    for (size_t i = 0; i < chunk_count; ++i) {
+        auto chunk = input.subspan(bounds[i], bounds[i + 1] - bounds[i]);
+        scans[i].end_in_string[0] = scan_structural_chunk(chunk, bounds[i], false, scans[i].indices[0]);
+        scans[i].end_in_string[1] = scan_structural_chunk(chunk, bounds[i], true, scans[i].indices[1]);
+    }
+
+    // Stitch: the document starts outside a string; each chunk's true start
+    // state is the previous chunk's ending state under its chosen
+    // interpretation. Resolve first so the merged vector can be sized exactly.
+    std::vector<uint8_t> chosen(chunk_count);
+    bool in_string = false;
+    size_t total = 0;
+    for (size_t i = 0; i < chunk_count; ++i) {
+        chosen[i] = in_string ? 1 : 0;
+        in_string = scans[i].end_in_string[chosen[i]];
+        total += scans[i].indices[chosen[i]].size();
+    }
+
+    std::vector<structural_index> indices;
+    indices.reserve(total);
+    for (size_t i = 0; i < chunk_count; ++i) {
+        auto& src = scans[i].indices[chosen[i]];
+        indices.insert(indices.end(), src.begin(), src.end());
+    }
+
+    insert_primitive_starts(input, indices);
+    return indices;
+}
+
+inline auto build_structural_index(std::span<const char> input) -> std::vector<structural_index> {
+#ifdef _OPENMP
+    // Large top-level documents take the parallel scan automatically; callers
+    // already inside a parallel region (per-chunk parses in the parallel
+    // module) keep the serial path to avoid nested teams.
+    if (input.size() >= g_parallel_index_min_bytes && !omp_in_parallel()) {
+        return build_structural_index_parallel(input);
+    }
+#endif
+    return build_structural_index_serial(input);
+}
+
+// ============================================================================
+// Structural Index Sidecar Cache
+// ============================================================================
+// For files that are parsed repeatedly (reference datasets, hot config blobs),
+// stage 1 is pure overhead after the first run: the structural index depends
+// only on the bytes of the input. These helpers serialize the index to a
+// compact sidecar file keyed by a content hash, so a later parse can load the
+// index and skip stage 1 entirely. The sidecar is an optimization, never a
+// source of truth: any mismatch (hash, version, truncation) makes the loader
+// return false and the caller rebuilds from scratch.
+//
+// On-disk layout (little-endian, matching the only targets we build for):
+//   u32 magic 'FJSI' | u32 version | u64 content hash | u64 entry count
+//   then per entry: u32 position delta from previous entry | u8 type
+// Positions are strictly increasing, so delta coding shrinks each 16-byte
+// in-memory entry to 5 bytes on disk.
+
+inline constexpr uint32_t sidecar_magic = 0x49534A46;  // "FJSI"
+inline constexpr uint32_t sidecar_version = 1;
+
+// FNV-1a over the document bytes. Not cryptographic - the sidecar is a local
+// cache, not an integrity boundary - but a 64-bit hash makes an accidental
+// stale-index hit on a changed file vanishingly unlikely.
+inline auto content_hash(std::span<const char> input) -> uint64_t {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (char c : input) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+// Write the index to `path`. Best-effort: returns false on any I/O failure or
+// if a position delta overflows the 5-byte entry encoding (>4 GiB gap between
+// structural characters, which real JSON does not produce).
+inline auto save_structural_index(const std::string& path, uint64_t hash,
+                                  const std::vector<structural_index>& indices) -> bool {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    auto write_raw = [file](const void* data, size_t size) -> bool {
+        return std::fwrite(data, 1, size, file) == size;
+    };
+
+    const uint64_t count = indices.size();
+    bool ok = write_raw(&sidecar_magic, sizeof(sidecar_magic)) &&
+              write_raw(&sidecar_version, sizeof(sidecar_version)) &&
+              write_raw(&hash, sizeof(hash)) && write_raw(&count, sizeof(count));
+
+    size_t prev_position = 0;
+    for (size_t i = 0; ok && i < indices.size(); ++i) {
+        const size_t gap = indices[i].position - prev_position;
+        if (gap > UINT32_MAX) {
+            ok = false;
+            break;
+        }
+        const uint32_t delta = static_cast<uint32_t>(gap);
+        const uint8_t type = static_cast<uint8_t>(indices[i].type);
+        ok = write_raw(&delta, sizeof(delta)) && write_raw(&type, sizeof(type));
+        prev_position = indices[i].position;
+    }
+
+    ok = (std::fclose(file) == 0) && ok;
+    if (!ok) {
+        std::remove(path.c_str());  // Never leave a truncated sidecar behind
+    }
+    return ok;
+}
+
+// Load a sidecar into `indices`. Returns false (leaving `indices` empty) if
+// the file is missing, was written by a different format version, hashes a
+// different document, is truncated, or decodes a position past `input_size`.
+inline auto load_structural_index(const std::string& path, uint64_t expected_hash,
+                                  size_t input_size, std::vector<structural_index>& indices)
+    -> bool {
+    indices.clear();
+
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    auto read_raw = [file](void* data, size_t size) -> bool {
+        return std::fread(data, 1, size, file) == size;
+    };
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t hash = 0;
+    uint64_t count = 0;
+    bool ok = read_raw(&magic, sizeof(magic)) && magic == sidecar_magic &&
+              read_raw(&version, sizeof(version)) && version == sidecar_version &&
+              read_raw(&hash, sizeof(hash)) && hash == expected_hash &&
+              read_raw(&count, sizeof(count)) && count <= input_size;
+
+    if (ok) {
+        indices.reserve(count);
+        size_t position = 0;
+        for (uint64_t i = 0; ok && i < count; ++i) {
+            uint32_t delta = 0;
+            uint8_t type = 0;
+            ok = read_raw(&delta, sizeof(delta)) && read_raw(&type, sizeof(type));
+            position += delta;
+            if (ok && position >= input_size) {
+                ok = false;
+                break;
+            }
+            indices.push_back({position, static_cast<structural_type>(type), {}});
+        }
+    }
+
+    std::fclose(file);
+    if (!ok) {
+        indices.clear();
+    }
+    return ok;
+}
+
+// Load-or-build: returns the structural index for `input`, reusing the sidecar
+// at `sidecar_path` when it matches and refreshing it (best-effort) when it
+// does not. Save failures are ignored - the index is always correct, the
+// sidecar just will not accelerate the next run.
+inline auto build_structural_index_cached(std::span<const char> input,
+                                          const std::string& sidecar_path)
+    -> std::vector<structural_index> {
+    const uint64_t hash = content_hash(input);
+
+    std::vector<structural_index> indices;
+    if (load_structural_index(sidecar_path, hash, input.size(), indices)) {
+        return indices;
+    }
 
+    indices = build_structural_index(input);
+    save_structural_index(sidecar_path, hash, indices);
     return indices;
 }
 
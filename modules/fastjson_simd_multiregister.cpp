@@ -51,6 +51,22 @@ bool has_avx512_support() {
     return false;
 }
 
+// ============================================================================
+// Software Prefetch Control
+// ============================================================================
+
+namespace {
+size_t g_prefetch_distance = 512;
+}
+
+auto set_prefetch_distance(size_t bytes) -> void {
+    g_prefetch_distance = bytes;
+}
+
+auto get_prefetch_distance() -> size_t {
+    return g_prefetch_distance;
+}
+
 // ============================================================================
 // Multi-Register Whitespace Skipping (AVX2)
 // ============================================================================
@@ -62,6 +78,9 @@ auto skip_whitespace_4x_avx2(const char* data, size_t size, size_t start_pos) ->
     // Process 128 bytes (4 x 32-byte AVX2 registers) per iteration
     while (pos + 128 <= size) {
         // Load 4 AVX2 registers in parallel
+        if (g_prefetch_distance != 0 && pos + g_prefetch_distance < size) {
+            _mm_prefetch(data + pos + g_prefetch_distance, _MM_HINT_T0);
+        }
         __m256i chunk0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
         __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 32));
         __m256i chunk2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 64));
@@ -138,6 +157,9 @@ auto find_string_end_4x_avx2(const char* data, size_t size, size_t start_pos) ->
     
     // Process 128 bytes with 4 AVX2 registers
     while (pos + 128 <= size) {
+        if (g_prefetch_distance != 0 && pos + g_prefetch_distance < size) {
+            _mm_prefetch(data + pos + g_prefetch_distance, _MM_HINT_T0);
+        }
         __m256i chunk0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
         __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 32));
         __m256i chunk2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 64));
@@ -196,6 +218,9 @@ auto validate_number_chars_4x_avx2(const char* data, size_t start_pos, size_t en
     __m256i exp_E = _mm256_set1_epi8('E');
     
     while (pos + 128 <= end_pos) {
+        if (g_prefetch_distance != 0 && pos + g_prefetch_distance < end_pos) {
+            _mm_prefetch(data + pos + g_prefetch_distance, _MM_HINT_T0);
+        }
         __m256i chunk0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
         __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 32));
         __m256i chunk2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 64));
@@ -255,6 +280,9 @@ auto find_structural_chars_4x_avx2(const char* data, size_t size, size_t start_p
     __m256i comma = _mm256_set1_epi8(',');
     
     while (pos + 128 <= size && result.count < 60) {
+        if (g_prefetch_distance != 0 && pos + g_prefetch_distance < size) {
+            _mm_prefetch(data + pos + g_prefetch_distance, _MM_HINT_T0);
+        }
         __m256i chunk0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
         __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 32));
         __m256i chunk2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 64));
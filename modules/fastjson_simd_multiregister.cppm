@@ -37,6 +37,16 @@ export struct StructuralChars {
 export auto has_avx2_support() -> bool;
 export auto has_avx512_support() -> bool;
 
+// ============================================================================
+// Software Prefetch Control
+// ============================================================================
+
+// Distance in bytes the multi-register kernels prefetch ahead of the block
+// being processed (0 disables software prefetch). Default 512 = one 128-byte
+// iteration of lead per memory-level of latency on typical DRAM.
+export auto set_prefetch_distance(size_t bytes) -> void;
+export auto get_prefetch_distance() -> size_t;
+
 // ============================================================================
 // Multi-Register SIMD Functions with Auto-Dispatch
 // ============================================================================
@@ -559,7 +559,454 @@ auto find_structural_chars_multi(const char* data, size_t size, size_t start_pos
 #endif // HAVE_AVX2
 
 // ============================================================================
-// Auto-Dispatch Functions - Choose Best Implementation 
+// Multi-Register NEON Implementations
+// ============================================================================
+// 4x 128-bit registers (64 bytes) per iteration. NEON has no movemask, so
+// each kernel checks the two 64-bit lanes of the combined compare vector and
+// only drops to a scalar rescan of the 16-byte chunk that actually hit.
+
+#ifdef __ARM_NEON
+
+auto skip_whitespace_4x_neon(const char* data, size_t size, size_t start_pos) -> size_t {
+    size_t pos = start_pos;
+
+    const uint8x16_t space = vdupq_n_u8(' ');
+    const uint8x16_t tab = vdupq_n_u8('\t');
+    const uint8x16_t newline = vdupq_n_u8('\n');
+    const uint8x16_t carriage = vdupq_n_u8('\r');
+
+    while (pos + 64 <= size) {
+        for (int chunk_idx = 0; chunk_idx < 4; ++chunk_idx) {
+            uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos + chunk_idx * 16));
+
+            uint8x16_t is_ws = vorrq_u8(
+                vorrq_u8(vceqq_u8(chunk, space), vceqq_u8(chunk, tab)),
+                vorrq_u8(vceqq_u8(chunk, newline), vceqq_u8(chunk, carriage)));
+
+            uint64_t mask_low = vgetq_lane_u64(vreinterpretq_u64_u8(is_ws), 0);
+            uint64_t mask_high = vgetq_lane_u64(vreinterpretq_u64_u8(is_ws), 1);
+
+            if (mask_low != 0xFFFFFFFFFFFFFFFFULL || mask_high != 0xFFFFFFFFFFFFFFFFULL) {
+                // Found non-whitespace, scan this chunk for the exact position
+                size_t chunk_base = pos + chunk_idx * 16;
+                for (size_t i = 0; i < 16; ++i) {
+                    char c = data[chunk_base + i];
+                    if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+                        return chunk_base + i;
+                    }
+                }
+            }
+        }
+        pos += 64;
+    }
+
+    // Scalar fallback for remaining bytes
+    while (pos < size && (data[pos] == ' ' || data[pos] == '\t' ||
+                          data[pos] == '\n' || data[pos] == '\r')) {
+        pos++;
+    }
+    return pos;
+}
+
+auto find_string_end_4x_neon(const char* data, size_t size, size_t start_pos) -> size_t {
+    size_t pos = start_pos;
+
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t control = vdupq_n_u8(0x20);
+
+    while (pos + 64 <= size) {
+        for (int chunk_idx = 0; chunk_idx < 4; ++chunk_idx) {
+            uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos + chunk_idx * 16));
+
+            uint8x16_t special = vorrq_u8(
+                vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)),
+                vcltq_u8(chunk, control));  // chunk < 0x20
+
+            uint64_t mask_low = vgetq_lane_u64(vreinterpretq_u64_u8(special), 0);
+            uint64_t mask_high = vgetq_lane_u64(vreinterpretq_u64_u8(special), 1);
+
+            if (mask_low != 0 || mask_high != 0) {
+                size_t chunk_base = pos + chunk_idx * 16;
+                for (size_t i = 0; i < 16; ++i) {
+                    char c = data[chunk_base + i];
+                    if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+                        return chunk_base + i;
+                    }
+                }
+            }
+        }
+        pos += 64;
+    }
+
+    // Scalar fallback for remaining bytes
+    while (pos < size) {
+        char c = data[pos];
+        if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+            return pos;
+        }
+        pos++;
+    }
+    return pos;
+}
+
+auto validate_number_chars_4x_neon(const char* data, size_t start_pos, size_t end_pos) -> bool {
+    size_t pos = start_pos;
+
+    const uint8x16_t zero = vdupq_n_u8('0');
+    const uint8x16_t nine = vdupq_n_u8('9');
+    const uint8x16_t minus = vdupq_n_u8('-');
+    const uint8x16_t plus = vdupq_n_u8('+');
+    const uint8x16_t dot = vdupq_n_u8('.');
+    const uint8x16_t e_lower = vdupq_n_u8('e');
+    const uint8x16_t e_upper = vdupq_n_u8('E');
+
+    while (pos + 64 <= end_pos) {
+        for (int chunk_idx = 0; chunk_idx < 4; ++chunk_idx) {
+            uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos + chunk_idx * 16));
+
+            uint8x16_t is_digit = vandq_u8(vcgeq_u8(chunk, zero), vcleq_u8(chunk, nine));
+            uint8x16_t is_sign = vorrq_u8(vceqq_u8(chunk, minus), vceqq_u8(chunk, plus));
+            uint8x16_t is_exp = vorrq_u8(vceqq_u8(chunk, e_lower), vceqq_u8(chunk, e_upper));
+            uint8x16_t valid = vorrq_u8(vorrq_u8(is_digit, is_sign),
+                                        vorrq_u8(is_exp, vceqq_u8(chunk, dot)));
+
+            uint64_t mask_low = vgetq_lane_u64(vreinterpretq_u64_u8(valid), 0);
+            uint64_t mask_high = vgetq_lane_u64(vreinterpretq_u64_u8(valid), 1);
+
+            if (mask_low != 0xFFFFFFFFFFFFFFFFULL || mask_high != 0xFFFFFFFFFFFFFFFFULL) {
+                return false;
+            }
+        }
+        pos += 64;
+    }
+
+    // Scalar fallback for remaining bytes
+    for (; pos < end_pos; ++pos) {
+        char c = data[pos];
+        if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' ||
+              c == 'e' || c == 'E')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto find_structural_chars_4x_neon(const char* data, size_t size, size_t start_pos,
+                                   StructuralChars& result) -> size_t {
+    size_t pos = start_pos;
+    result.count = 0;
+
+    const uint8x16_t open_brace = vdupq_n_u8('{');
+    const uint8x16_t close_brace = vdupq_n_u8('}');
+    const uint8x16_t open_bracket = vdupq_n_u8('[');
+    const uint8x16_t close_bracket = vdupq_n_u8(']');
+    const uint8x16_t colon = vdupq_n_u8(':');
+    const uint8x16_t comma = vdupq_n_u8(',');
+
+    while (pos + 64 <= size && result.count < 60) {
+        for (int chunk_idx = 0; chunk_idx < 4 && result.count < 60; ++chunk_idx) {
+            uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos + chunk_idx * 16));
+
+            uint8x16_t structural = vorrq_u8(
+                vorrq_u8(vorrq_u8(vceqq_u8(chunk, open_brace), vceqq_u8(chunk, close_brace)),
+                         vorrq_u8(vceqq_u8(chunk, open_bracket), vceqq_u8(chunk, close_bracket))),
+                vorrq_u8(vceqq_u8(chunk, colon), vceqq_u8(chunk, comma)));
+
+            uint64_t mask_low = vgetq_lane_u64(vreinterpretq_u64_u8(structural), 0);
+            uint64_t mask_high = vgetq_lane_u64(vreinterpretq_u64_u8(structural), 1);
+
+            if (mask_low != 0 || mask_high != 0) {
+                // Chunk contains structural characters; record each position
+                size_t chunk_base = pos + chunk_idx * 16;
+                for (size_t i = 0; i < 16 && result.count < 64; ++i) {
+                    uint8_t type = 0;
+                    switch (data[chunk_base + i]) {
+                        case '{': type = 1; break;
+                        case '}': type = 2; break;
+                        case '[': type = 3; break;
+                        case ']': type = 4; break;
+                        case ':': type = 5; break;
+                        case ',': type = 6; break;
+                        default: continue;
+                    }
+                    result.positions[result.count] = chunk_base + i;
+                    result.types[result.count] = type;
+                    result.count++;
+                }
+            }
+        }
+        pos += 64;
+    }
+
+    return pos;
+}
+
+#endif // __ARM_NEON
+
+// ============================================================================
+// Compress-Store Transforms (VBMI2)
+// ============================================================================
+
+// Scalar minify used for vector tails and as the dispatch fallback.
+// in_string / escaped seed the state when resuming after vectorized blocks.
+static auto minify_scalar(const char* data, size_t size, char* out,
+                          bool in_string, bool escaped) -> size_t {
+    size_t out_pos = 0;
+    for (size_t pos = 0; pos < size; ++pos) {
+        char c = data[pos];
+        if (in_string) {
+            out[out_pos++] = c;
+            if (escaped) {
+                escaped = false;
+            } else if (c == '\\') {
+                escaped = true;
+            } else if (c == '"') {
+                in_string = false;
+            }
+        } else {
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+                continue;
+            }
+            out[out_pos++] = c;
+            if (c == '"') {
+                in_string = true;
+            }
+        }
+    }
+    return out_pos;
+}
+
+static auto hex_value(char c) -> int {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static auto encode_utf8(uint32_t cp, char* out, size_t& out_pos) -> void {
+    if (cp < 0x80) {
+        out[out_pos++] = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out[out_pos++] = static_cast<char>(0xC0 | (cp >> 6));
+        out[out_pos++] = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out[out_pos++] = static_cast<char>(0xE0 | (cp >> 12));
+        out[out_pos++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[out_pos++] = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out[out_pos++] = static_cast<char>(0xF0 | (cp >> 18));
+        out[out_pos++] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out[out_pos++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[out_pos++] = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// Decode escapes scalar until at least `end` input bytes are consumed. A
+// sequence straddling `end` is consumed whole, so the caller can resume
+// vectorized processing at a sequence boundary. Malformed escapes are kept
+// verbatim rather than corrupting the output.
+static auto unescape_scalar_until(const char* data, size_t size, size_t& pos,
+                                  size_t end, char* out, size_t& out_pos) -> void {
+    while (pos < end && pos < size) {
+        char c = data[pos];
+        if (c != '\\' || pos + 1 >= size) {
+            out[out_pos++] = c;
+            pos++;
+            continue;
+        }
+        char esc = data[pos + 1];
+        pos += 2;
+        switch (esc) {
+            case '"':  out[out_pos++] = '"';  break;
+            case '\\': out[out_pos++] = '\\'; break;
+            case '/':  out[out_pos++] = '/';  break;
+            case 'b':  out[out_pos++] = '\b'; break;
+            case 'f':  out[out_pos++] = '\f'; break;
+            case 'n':  out[out_pos++] = '\n'; break;
+            case 'r':  out[out_pos++] = '\r'; break;
+            case 't':  out[out_pos++] = '\t'; break;
+            case 'u': {
+                if (pos + 4 > size) {
+                    out[out_pos++] = '\\';
+                    out[out_pos++] = 'u';
+                    break;
+                }
+                int h0 = hex_value(data[pos]);
+                int h1 = hex_value(data[pos + 1]);
+                int h2 = hex_value(data[pos + 2]);
+                int h3 = hex_value(data[pos + 3]);
+                if (h0 < 0 || h1 < 0 || h2 < 0 || h3 < 0) {
+                    out[out_pos++] = '\\';
+                    out[out_pos++] = 'u';
+                    break;
+                }
+                uint32_t cp = static_cast<uint32_t>((h0 << 12) | (h1 << 8) | (h2 << 4) | h3);
+                pos += 4;
+                if (cp >= 0xD800 && cp <= 0xDBFF && pos + 6 <= size &&
+                    data[pos] == '\\' && data[pos + 1] == 'u') {
+                    int l0 = hex_value(data[pos + 2]);
+                    int l1 = hex_value(data[pos + 3]);
+                    int l2 = hex_value(data[pos + 4]);
+                    int l3 = hex_value(data[pos + 5]);
+                    if (l0 >= 0 && l1 >= 0 && l2 >= 0 && l3 >= 0) {
+                        uint32_t low = static_cast<uint32_t>((l0 << 12) | (l1 << 8) | (l2 << 4) | l3);
+                        if (low >= 0xDC00 && low <= 0xDFFF) {
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                            pos += 6;
+                        }
+                    }
+                }
+                encode_utf8(cp, out, out_pos);
+                break;
+            }
+            default:
+                out[out_pos++] = '\\';
+                out[out_pos++] = esc;
+                break;
+        }
+    }
+}
+
+#if HAVE_AVX512F && HAVE_AVX512BW && HAVE_AVX512VBMI2
+
+// Carry-less prefix XOR over a 64-bit quote mask: bit i of the result is the
+// parity of bits [0..i], i.e. "inside a string" after an odd number of
+// unescaped quotes. Six shift-xor steps; no PCLMUL dependency.
+static inline auto prefix_xor(uint64_t x) -> uint64_t {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+// Positions whose byte is preceded by an odd-length backslash run (the
+// classic odd/even-bit carry trick). prev_escaped carries a run that crosses
+// the 64-byte boundary into bit 0 of the next block.
+static inline auto find_escaped(uint64_t backslash, uint64_t& prev_escaped) -> uint64_t {
+    if (backslash == 0) {
+        uint64_t escaped = prev_escaped;
+        prev_escaped = 0;
+        return escaped;
+    }
+    constexpr uint64_t even_bits = 0x5555555555555555ULL;
+    backslash &= ~prev_escaped;
+    uint64_t follows_escape = (backslash << 1) | prev_escaped;
+    uint64_t odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+    uint64_t sequences_starting_on_even_bits;
+    prev_escaped = __builtin_add_overflow(odd_sequence_starts, backslash,
+                                          &sequences_starting_on_even_bits) ? 1 : 0;
+    uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+    return (even_bits ^ invert_mask) & follows_escape;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi2")))
+auto minify_json_vbmi2(const char* data, size_t size, char* out) -> size_t {
+    size_t pos = 0;
+    size_t out_pos = 0;
+    uint64_t prev_escaped = 0;
+    uint64_t prev_in_string = 0;  // all-ones while inside a string literal
+
+    const __m512i backslash = _mm512_set1_epi8('\\');
+    const __m512i quote = _mm512_set1_epi8('"');
+    const __m512i space = _mm512_set1_epi8(' ');
+    const __m512i tab = _mm512_set1_epi8('\t');
+    const __m512i newline = _mm512_set1_epi8('\n');
+    const __m512i carriage = _mm512_set1_epi8('\r');
+
+    while (pos + 64 <= size) {
+        __m512i chunk = _mm512_loadu_si512(reinterpret_cast<const void*>(data + pos));
+
+        uint64_t bs_mask = _mm512_cmpeq_epi8_mask(chunk, backslash);
+        uint64_t escaped = find_escaped(bs_mask, prev_escaped);
+
+        // Prefix XOR of unescaped quotes gives the in-string region; the top
+        // bit carries the open/closed state into the next block.
+        uint64_t quote_mask = _mm512_cmpeq_epi8_mask(chunk, quote) & ~escaped;
+        uint64_t in_string = prefix_xor(quote_mask) ^ prev_in_string;
+        prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+        uint64_t ws_mask = _mm512_cmpeq_epi8_mask(chunk, space) |
+                           _mm512_cmpeq_epi8_mask(chunk, tab) |
+                           _mm512_cmpeq_epi8_mask(chunk, newline) |
+                           _mm512_cmpeq_epi8_mask(chunk, carriage);
+
+        // Keep everything except whitespace outside strings; vpcompressb
+        // writes the survivors contiguously in one instruction.
+        uint64_t keep = ~(ws_mask & ~in_string);
+        _mm512_mask_compressstoreu_epi8(out + out_pos, keep, chunk);
+        out_pos += static_cast<size_t>(__builtin_popcountll(keep));
+        pos += 64;
+    }
+
+    // Scalar tail, seeded with the carried string/escape state
+    out_pos += minify_scalar(data + pos, size - pos, out + out_pos,
+                             prev_in_string != 0, (prev_escaped & 1) != 0);
+    return out_pos;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi2")))
+auto unescape_string_vbmi2(const char* data, size_t size, char* out) -> size_t {
+    size_t pos = 0;
+    size_t out_pos = 0;
+
+    const __m512i backslash = _mm512_set1_epi8('\\');
+    const __m512i quote = _mm512_set1_epi8('"');
+    const __m512i slash = _mm512_set1_epi8('/');
+
+    while (pos + 64 <= size) {
+        __m512i chunk = _mm512_loadu_si512(reinterpret_cast<const void*>(data + pos));
+        uint64_t bs_mask = _mm512_cmpeq_epi8_mask(chunk, backslash);
+
+        // Common case: no escapes at all, plain 64-byte copy
+        if (bs_mask == 0) {
+            _mm512_storeu_si512(reinterpret_cast<void*>(out + out_pos), chunk);
+            out_pos += 64;
+            pos += 64;
+            continue;
+        }
+
+        uint64_t carry = 0;  // blocks always start at a sequence boundary
+        uint64_t escaped = find_escaped(bs_mask, carry);
+
+        uint64_t valid = ~0ULL;
+        size_t block_len = 64;
+        if (carry != 0) {
+            // Block ends mid-escape; leave the trailing backslash for the
+            // next iteration so sequences never straddle a compress-store.
+            valid >>= 1;
+            escaped &= valid;
+            block_len = 63;
+        }
+
+        // Identity escapes produce their escaped byte unchanged; anything
+        // else (\n, \t, \uXXXX, ...) needs real decoding for this block.
+        uint64_t identity = _mm512_cmpeq_epi8_mask(chunk, quote) |
+                            _mm512_cmpeq_epi8_mask(chunk, backslash) |
+                            _mm512_cmpeq_epi8_mask(chunk, slash);
+        if ((escaped & ~identity) != 0) {
+            unescape_scalar_until(data, size, pos, pos + block_len, out, out_pos);
+            continue;
+        }
+
+        // Drop the escape-initiating backslashes, keep their payload bytes
+        uint64_t keep = valid & ~(bs_mask & ~escaped);
+        _mm512_mask_compressstoreu_epi8(out + out_pos, keep, chunk);
+        out_pos += static_cast<size_t>(__builtin_popcountll(keep));
+        pos += block_len;
+    }
+
+    unescape_scalar_until(data, size, pos, size, out, out_pos);
+    return out_pos;
+}
+
+#endif // HAVE_AVX512F && HAVE_AVX512BW && HAVE_AVX512VBMI2
+
+// ============================================================================
+// Auto-Dispatch Functions - Choose Best Implementation
 // ============================================================================
 
 auto skip_whitespace_multi(const char* data, size_t size, size_t start_pos) -> size_t {
@@ -572,6 +1019,9 @@ auto skip_whitespace_multi(const char* data, size_t size, size_t start_pos) -> s
     if constexpr (has_avx2_support()) {
         return skip_whitespace_4x_avx2(data, size, start_pos);
     }
+#endif
+#ifdef __ARM_NEON
+    return skip_whitespace_4x_neon(data, size, start_pos);
 #endif
     // Fallback to scalar implementation
     for (size_t pos = start_pos; pos < size; ++pos) {
@@ -593,6 +1043,9 @@ auto find_string_end_multi(const char* data, size_t size, size_t start_pos) -> s
     if constexpr (has_avx2_support()) {
         return find_string_end_4x_avx2(data, size, start_pos);
     }
+#endif
+#ifdef __ARM_NEON
+    return find_string_end_4x_neon(data, size, start_pos);
 #endif
     // Fallback to scalar implementation
     bool escaped = false;
@@ -619,6 +1072,9 @@ auto validate_number_chars_multi(const char* data, size_t start_pos, size_t end_
     if constexpr (has_avx2_support()) {
         return validate_number_chars_4x_avx2(data, start_pos, end_pos);
     }
+#endif
+#ifdef __ARM_NEON
+    return validate_number_chars_4x_neon(data, start_pos, end_pos);
 #endif
     // Fallback to scalar implementation
     for (size_t pos = start_pos; pos < end_pos; ++pos) {
@@ -631,4 +1087,66 @@ auto validate_number_chars_multi(const char* data, size_t start_pos, size_t end_
     return true;
 }
 
+#if !HAVE_AVX2
+// Without AVX2 the guarded dispatch block above is compiled out entirely;
+// provide the structural scan dispatcher here so ARM still gets the NEON tier.
+auto find_structural_chars_multi(const char* data, size_t size, size_t start_pos,
+                                 StructuralChars& result) -> size_t {
+#ifdef __ARM_NEON
+    return find_structural_chars_4x_neon(data, size, start_pos, result);
+#endif
+
+    // Scalar fallback
+    size_t pos = start_pos;
+    result.count = 0;
+
+    while (pos < size && result.count < 64) {
+        char c = data[pos];
+        uint8_t type = 0;
+
+        switch (c) {
+            case '{': type = 1; break;
+            case '}': type = 2; break;
+            case '[': type = 3; break;
+            case ']': type = 4; break;
+            case ':': type = 5; break;
+            case ',': type = 6; break;
+            default: pos++; continue;
+        }
+
+        result.positions[result.count] = pos;
+        result.types[result.count] = type;
+        result.count++;
+        pos++;
+    }
+
+    return pos;
+}
+#endif // !HAVE_AVX2
+
+auto minify_json_multi(const char* data, size_t size, char* out) -> size_t {
+#if HAVE_AVX512F && HAVE_AVX512BW && HAVE_AVX512VBMI2
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vbmi2")) {
+        return minify_json_vbmi2(data, size, out);
+    }
+#endif
+    // Fallback to scalar implementation
+    return minify_scalar(data, size, out, false, false);
+}
+
+auto unescape_string_multi(const char* data, size_t size, char* out) -> size_t {
+#if HAVE_AVX512F && HAVE_AVX512BW && HAVE_AVX512VBMI2
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vbmi2")) {
+        return unescape_string_vbmi2(data, size, out);
+    }
+#endif
+    // Fallback to scalar implementation
+    size_t pos = 0;
+    size_t out_pos = 0;
+    unescape_scalar_until(data, size, pos, size, out, out_pos);
+    return out_pos;
+}
+
 }  // namespace fastjson::simd::multi
\ No newline at end of file
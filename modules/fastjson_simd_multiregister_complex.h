@@ -20,6 +20,10 @@
     #define HAVE_AVX512BW 0
 #endif
 
+#ifndef HAVE_AVX512VBMI2
+    #define HAVE_AVX512VBMI2 0
+#endif
+
 #if defined(__x86_64__) || defined(_M_X64)
     #include <immintrin.h>
 #endif
@@ -92,6 +96,10 @@ __attribute__((target("avx512f,avx512bw")))
 auto validate_number_chars_8x_avx512(const char* data, size_t start_pos, size_t end_pos) -> bool;
 #endif
 
+#ifdef __ARM_NEON
+auto validate_number_chars_4x_neon(const char* data, size_t start_pos, size_t end_pos) -> bool;
+#endif
+
 // ============================================================================
 // Multi-Register Structural Character Detection
 // ============================================================================
@@ -115,6 +123,11 @@ auto find_structural_chars_8x_avx512(const char* data, size_t size, size_t start
                                      StructuralChars& result) -> size_t;
 #endif
 
+#ifdef __ARM_NEON
+auto find_structural_chars_4x_neon(const char* data, size_t size, size_t start_pos,
+                                   StructuralChars& result) -> size_t;
+#endif
+
 // ============================================================================
 // Multi-Register Unicode Validation
 // ============================================================================
@@ -130,6 +143,26 @@ __attribute__((target("avx512f,avx512bw,avx512vbmi")))
 auto validate_utf8_8x_avx512(const char* data, size_t size, size_t start_pos) -> bool;
 #endif
 
+// ============================================================================
+// Compress-Store Transforms (VBMI2)
+// ============================================================================
+
+#if HAVE_AVX512F && HAVE_AVX512BW && HAVE_AVX512VBMI2
+// Delete inter-token whitespace in a single pass: classify 64 bytes, build a
+// keep mask (everything except whitespace outside strings), vpcompressb the
+// survivors straight to the output. String interiors are tracked with the
+// odd-backslash escape carry, so whitespace inside string literals survives.
+__attribute__((target("avx512f,avx512bw,avx512vbmi2")))
+auto minify_json_vbmi2(const char* data, size_t size, char* out) -> size_t;
+
+// Strip escape backslashes from raw string contents with the same
+// compress-store trick. Blocks containing only identity escapes (\" \\ \/)
+// stay on the vector path; blocks with \n, \t, \uXXXX etc. fall back to
+// scalar decoding for that block only.
+__attribute__((target("avx512f,avx512bw,avx512vbmi2")))
+auto unescape_string_vbmi2(const char* data, size_t size, char* out) -> size_t;
+#endif
+
 // ============================================================================
 // Auto-Dispatch Functions
 // ============================================================================
@@ -138,6 +171,8 @@ auto validate_utf8_8x_avx512(const char* data, size_t size, size_t start_pos) ->
 auto skip_whitespace_multi(const char* data, size_t size, size_t start_pos) -> size_t;
 auto find_string_end_multi(const char* data, size_t size, size_t start_pos) -> size_t;
 auto validate_number_chars_multi(const char* data, size_t start_pos, size_t end_pos) -> bool;
+auto minify_json_multi(const char* data, size_t size, char* out) -> size_t;
+auto unescape_string_multi(const char* data, size_t size, char* out) -> size_t;
 
 } // namespace fastjson::simd::multi
 
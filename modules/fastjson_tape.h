@@ -0,0 +1,439 @@
+// FastestJSONInTheWest - Tape-Based DOM Engine
+// Alternative to the variant tree: the whole document lives on one flat
+// vector of 64-bit words (type tag + payload), with strings referenced by
+// span into the input text. Array iteration walks contiguous cache-resident
+// memory instead of pointer-chasing heap nodes, and container skip is O(1)
+// through backpatched matching-end indices.
+// ============================================================================
+
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fastjson_simd_index.h"
+
+namespace fastjson {
+namespace tape {
+
+// ============================================================================
+// Tape Word Format
+// ============================================================================
+// Each tape entry is one 64-bit word: the top 8 bits are the type tag, the
+// low 56 bits are the payload. Numbers carry their value in the following
+// word; strings pack (offset << 24 | length) into the payload for inputs up
+// to 2^32 bytes with strings up to 2^24 bytes, falling back to a follow word
+// for larger documents.
+
+enum class tape_type : uint8_t {
+    root = 0,
+    null_value,
+    true_value,
+    false_value,
+    int64_value,    // Payload unused; next word holds the int64 bits
+    double_value,   // Payload unused; next word holds the double bits
+    string_value,   // Payload: offset into input; next word: length
+    object_start,   // Payload: tape index of the matching object_end
+    object_end,     // Payload: tape index of the matching object_start
+    array_start,    // Payload: tape index of the matching array_end
+    array_end       // Payload: tape index of the matching array_start
+};
+
+constexpr uint64_t tape_payload_mask = 0x00FFFFFFFFFFFFFFULL;
+
+inline auto make_word(tape_type type, uint64_t payload) -> uint64_t {
+    return (static_cast<uint64_t>(type) << 56) | (payload & tape_payload_mask);
+}
+
+inline auto word_type(uint64_t word) -> tape_type {
+    return static_cast<tape_type>(word >> 56);
+}
+
+inline auto word_payload(uint64_t word) -> uint64_t {
+    return word & tape_payload_mask;
+}
+
+class tape_document;
+
+// ============================================================================
+// Tape Value Handle
+// ============================================================================
+
+class tape_value {
+public:
+    tape_value() : doc_(nullptr), pos_(0) {}
+    tape_value(const tape_document* doc, size_t pos) : doc_(doc), pos_(pos) {}
+
+    auto valid() const noexcept -> bool { return doc_ != nullptr; }
+
+    auto type() const noexcept -> tape_type;
+
+    auto is_null() const noexcept -> bool { return type() == tape_type::null_value; }
+    auto is_bool() const noexcept -> bool {
+        return type() == tape_type::true_value || type() == tape_type::false_value;
+    }
+    auto is_int() const noexcept -> bool { return type() == tape_type::int64_value; }
+    auto is_number() const noexcept -> bool {
+        return type() == tape_type::int64_value || type() == tape_type::double_value;
+    }
+    auto is_string() const noexcept -> bool { return type() == tape_type::string_value; }
+    auto is_object() const noexcept -> bool { return type() == tape_type::object_start; }
+    auto is_array() const noexcept -> bool { return type() == tape_type::array_start; }
+
+    auto as_bool() const -> bool { return type() == tape_type::true_value; }
+    auto as_int64() const -> int64_t;
+    auto as_number() const -> double;
+
+    // Raw (still-escaped) span into the input text - zero-copy
+    auto as_raw_string() const -> std::string_view;
+    // Unescaped copy; only allocates when the raw span contains escapes
+    auto as_string() const -> std::string;
+
+    // Container navigation
+    auto count_elements() const -> size_t;   // Arrays and objects
+    auto at(size_t index) const -> std::optional<tape_value>;
+    auto find_field(std::string_view key) const -> std::optional<tape_value>;
+
+    // Position one past this value on the tape (O(1) for containers)
+    auto next_sibling_pos() const -> size_t;
+
+private:
+    const tape_document* doc_;
+    size_t pos_;
+};
+
+// ============================================================================
+// Tape Document
+// ============================================================================
+
+class tape_document {
+public:
+    // Build the tape from input text. Returns nullopt on malformed JSON;
+    // detailed diagnostics belong to the full parser, the tape engine is the
+    // fast path for inputs expected to be valid.
+    static auto parse(std::string_view input) -> std::optional<tape_document>;
+
+    // Build the tape from an externally supplied structural index (e.g. one
+    // produced by the GPU stage-1 scan). The index must be position-sorted
+    // and include primitive starts, as build_structural_index guarantees.
+    static auto parse_with_index(std::string_view input,
+                                 const std::vector<structural_index>& indices)
+        -> std::optional<tape_document>;
+
+    auto root() const -> tape_value { return tape_value(this, 1); }  // 0 is the root marker
+
+    auto words() const noexcept -> const std::vector<uint64_t>& { return tape_; }
+    auto input() const noexcept -> std::string_view { return input_; }
+
+private:
+    friend class tape_value;
+
+    std::string_view input_;
+    std::vector<uint64_t> tape_;
+};
+
+// ============================================================================
+// Tape Construction
+// ============================================================================
+
+inline auto tape_document::parse(std::string_view input) -> std::optional<tape_document> {
+    return parse_with_index(
+        input, build_structural_index(std::span<const char>(input.data(), input.size())));
+}
+
+inline auto tape_document::parse_with_index(std::string_view input,
+                                            const std::vector<structural_index>& indices)
+    -> std::optional<tape_document> {
+    tape_document doc;
+    doc.input_ = input;
+
+    auto& tape = doc.tape_;
+    tape.reserve(indices.size() + 2);
+    tape.push_back(make_word(tape_type::root, 0));
+
+    // Stack of tape positions of currently-open container start words,
+    // backpatched with their matching end index on close.
+    std::vector<size_t> open_stack;
+
+    auto emit_number = [&](size_t text_pos) -> bool {
+        // Number extends to the next structural position or end of input
+        size_t end = input.size();
+        // Scan forward over valid number chars only
+        size_t p = text_pos;
+        if (p < end && input[p] == '-') {
+            p++;
+        }
+        bool integral = true;
+        while (p < end) {
+            char c = input[p];
+            if (c >= '0' && c <= '9') {
+                p++;
+            } else if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+                integral = false;
+                p++;
+            } else {
+                break;
+            }
+        }
+        size_t len = p - text_pos;
+        if (len == 0) {
+            return false;
+        }
+
+        char buffer[64];
+        size_t buf_len = len < sizeof(buffer) - 1 ? len : sizeof(buffer) - 1;
+        std::memcpy(buffer, input.data() + text_pos, buf_len);
+        buffer[buf_len] = '\0';
+
+        if (integral && buf_len <= 19) {
+            char* end_ptr = nullptr;
+            errno = 0;
+            long long v = std::strtoll(buffer, &end_ptr, 10);
+            // 19-digit tokens can exceed INT64_MAX, where strtoll saturates
+            // with end_ptr still at end-of-buffer; ERANGE sends those to the
+            // double path instead of recording the clamped value
+            if (end_ptr == buffer + buf_len && errno != ERANGE) {
+                tape.push_back(make_word(tape_type::int64_value, 0));
+                tape.push_back(static_cast<uint64_t>(v));
+                return true;
+            }
+        }
+        char* end_ptr = nullptr;
+        double v = std::strtod(buffer, &end_ptr);
+        if (end_ptr != buffer + buf_len) {
+            return false;
+        }
+        uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        tape.push_back(make_word(tape_type::double_value, 0));
+        tape.push_back(bits);
+        return true;
+    };
+
+    // Prefetch pipeline: the index entries stream linearly, but the input
+    // bytes they point at (string spans, number text) do not - fetch both a
+    // few entries ahead so container builds on cold documents are not bound
+    // by DRAM latency. Entry lookahead of 8 is one cache line of 16-byte
+    // structural_index records.
+    const size_t lookahead = g_prefetch_distance != 0 ? 8 : 0;
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+        if (lookahead != 0 && i + lookahead < indices.size()) {
+            const auto& ahead = indices[i + lookahead];
+            __builtin_prefetch(&indices[i + lookahead], 0, 3);
+            if (ahead.position < input.size()) {
+                __builtin_prefetch(input.data() + ahead.position, 0, 3);
+            }
+        }
+        const auto& entry = indices[i];
+        switch (entry.type) {
+            case structural_type::left_brace:
+                open_stack.push_back(tape.size());
+                tape.push_back(make_word(tape_type::object_start, 0));
+                break;
+            case structural_type::left_bracket:
+                open_stack.push_back(tape.size());
+                tape.push_back(make_word(tape_type::array_start, 0));
+                break;
+            case structural_type::right_brace:
+            case structural_type::right_bracket: {
+                if (open_stack.empty()) {
+                    return std::nullopt;  // Unbalanced
+                }
+                size_t start = open_stack.back();
+                open_stack.pop_back();
+                tape_type start_type = word_type(tape[start]);
+                bool brace = (entry.type == structural_type::right_brace);
+                if (brace != (start_type == tape_type::object_start)) {
+                    return std::nullopt;  // Mismatched container kind
+                }
+                size_t end_pos = tape.size();
+                tape.push_back(make_word(
+                    brace ? tape_type::object_end : tape_type::array_end, start));
+                tape[start] = make_word(start_type, end_pos);
+                break;
+            }
+            case structural_type::quote: {
+                // Open/close quote pairs; consume the closing entry too
+                if (i + 1 >= indices.size()
+                    || indices[i + 1].type != structural_type::quote) {
+                    return std::nullopt;
+                }
+                size_t offset = entry.position + 1;
+                size_t length = indices[i + 1].position - offset;
+                tape.push_back(make_word(tape_type::string_value, offset));
+                tape.push_back(length);
+                i++;  // Skip the closing quote entry
+                break;
+            }
+            case structural_type::true_start:
+                tape.push_back(make_word(tape_type::true_value, 0));
+                break;
+            case structural_type::false_start:
+                tape.push_back(make_word(tape_type::false_value, 0));
+                break;
+            case structural_type::null_start:
+                tape.push_back(make_word(tape_type::null_value, 0));
+                break;
+            case structural_type::number_start:
+                if (!emit_number(entry.position)) {
+                    return std::nullopt;
+                }
+                break;
+            case structural_type::comma:
+            case structural_type::colon:
+            default:
+                break;  // Separators carry no tape entry
+        }
+    }
+
+    if (!open_stack.empty()) {
+        return std::nullopt;  // Unterminated container
+    }
+
+    return doc;
+}
+
+// ============================================================================
+// tape_value Implementation
+// ============================================================================
+
+inline auto tape_value::type() const noexcept -> tape_type {
+    if (!doc_ || pos_ >= doc_->tape_.size()) {
+        return tape_type::root;
+    }
+    return word_type(doc_->tape_[pos_]);
+}
+
+inline auto tape_value::as_int64() const -> int64_t {
+    return static_cast<int64_t>(doc_->tape_[pos_ + 1]);
+}
+
+inline auto tape_value::as_number() const -> double {
+    if (type() == tape_type::int64_value) {
+        return static_cast<double>(as_int64());
+    }
+    double v;
+    uint64_t bits = doc_->tape_[pos_ + 1];
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+inline auto tape_value::as_raw_string() const -> std::string_view {
+    size_t offset = word_payload(doc_->tape_[pos_]);
+    size_t length = doc_->tape_[pos_ + 1];
+    return doc_->input_.substr(offset, length);
+}
+
+inline auto tape_value::as_string() const -> std::string {
+    std::string_view raw = as_raw_string();
+    if (raw.find('\\') == std::string_view::npos) {
+        return std::string(raw);
+    }
+    // Scalar unescape; escape-heavy access paths should prefer the full
+    // parser which shares the SIMD unescape kernel
+    std::string out;
+    out.reserve(raw.size());
+    for (size_t i = 0; i < raw.size(); ++i) {
+        char c = raw[i];
+        if (c != '\\' || i + 1 >= raw.size()) {
+            out += c;
+            continue;
+        }
+        switch (raw[++i]) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            default: out += '\\'; out += raw[i]; break;  // Incl. \u: raw passthrough
+        }
+    }
+    return out;
+}
+
+inline auto tape_value::next_sibling_pos() const -> size_t {
+    switch (type()) {
+        case tape_type::object_start:
+        case tape_type::array_start:
+            return word_payload(doc_->tape_[pos_]) + 1;  // One past matching end
+        case tape_type::int64_value:
+        case tape_type::double_value:
+        case tape_type::string_value:
+            return pos_ + 2;
+        default:
+            return pos_ + 1;
+    }
+}
+
+inline auto tape_value::count_elements() const -> size_t {
+    tape_type t = type();
+    if (t != tape_type::array_start && t != tape_type::object_start) {
+        return 0;
+    }
+    size_t end = word_payload(doc_->tape_[pos_]);
+    size_t count = 0;
+    size_t i = pos_ + 1;
+    bool object = (t == tape_type::object_start);
+    while (i < end) {
+        tape_value child(doc_, i);
+        i = child.next_sibling_pos();
+        if (object) {
+            // Skip the value paired with this key
+            tape_value value(doc_, i);
+            i = value.next_sibling_pos();
+        }
+        ++count;
+    }
+    return count;
+}
+
+inline auto tape_value::at(size_t index) const -> std::optional<tape_value> {
+    if (type() != tape_type::array_start) {
+        return std::nullopt;
+    }
+    size_t end = word_payload(doc_->tape_[pos_]);
+    size_t i = pos_ + 1;
+    size_t current = 0;
+    while (i < end) {
+        if (current == index) {
+            return tape_value(doc_, i);
+        }
+        i = tape_value(doc_, i).next_sibling_pos();
+        ++current;
+    }
+    return std::nullopt;
+}
+
+inline auto tape_value::find_field(std::string_view key) const -> std::optional<tape_value> {
+    if (type() != tape_type::object_start) {
+        return std::nullopt;
+    }
+    size_t end = word_payload(doc_->tape_[pos_]);
+    size_t i = pos_ + 1;
+    while (i < end) {
+        tape_value key_value(doc_, i);
+        if (key_value.type() != tape_type::string_value) {
+            return std::nullopt;  // Malformed tape
+        }
+        size_t value_pos = key_value.next_sibling_pos();
+        if (key_value.as_raw_string() == key) {
+            return tape_value(doc_, value_pos);
+        }
+        i = tape_value(doc_, value_pos).next_sibling_pos();
+    }
+    return std::nullopt;
+}
+
+}  // namespace tape
+}  // namespace fastjson
@@ -70,6 +70,9 @@ struct gpu_device_info {
     int compute_units;
     int max_threads_per_block;
     bool supports_cooperative_launch;
+    // APU with host-shared physical memory: input staging through
+    // gpu_buffer::copy_to_device is pure overhead, map the host pages instead
+    bool unified_memory = false;
 
     gpu_device_info() = default;
 };
@@ -106,6 +109,7 @@ inline auto detect_rocm_devices() -> gpu_result<std::vector<gpu_device_info>> {
         info.compute_units = prop.multiProcessorCount;
         info.max_threads_per_block = prop.maxThreadsPerBlock;
         info.supports_cooperative_launch = prop.cooperativeLaunch;
+        info.unified_memory = prop.integrated != 0;
 
         devices.push_back(std::move(info));
     }
@@ -199,6 +199,132 @@ __global__ void count_tokens_kernel(const uint32_t* flags, size_t size, uint32_t
     }
 }
 
+// ============================================================================
+// Column Aggregation Kernels
+// ============================================================================
+// Reduce a device-resident double column (gpu_column) in one launch: each
+// thread folds a grid-stride range, a shared-memory tree collapses the block,
+// and block leaders combine into the global result. min/max use a CAS loop
+// because doubles have no native atomic min/max; sum relies on the sm_60+
+// double atomicAdd.
+
+__device__ bool column_compare(uint8_t op, double value, double threshold) {
+    switch (op) {
+        case 0: return value < threshold;
+        case 1: return value <= threshold;
+        case 2: return value > threshold;
+        case 3: return value >= threshold;
+        case 4: return value == threshold;
+        case 5: return value != threshold;
+    }
+    return false;
+}
+
+__device__ void atomic_min_max_double(double* address, double value, bool want_max) {
+    unsigned long long* addr = reinterpret_cast<unsigned long long*>(address);
+    unsigned long long old_bits = *addr;
+    unsigned long long assumed;
+    do {
+        assumed = old_bits;
+        double current = __longlong_as_double(assumed);
+        if (want_max ? (value <= current) : (value >= current)) {
+            return;
+        }
+        old_bits = atomicCAS(addr, assumed, __double_as_longlong(value));
+    } while (old_bits != assumed);
+}
+
+__global__ void column_sum_kernel(const double* values, size_t size, uint8_t op,
+                                  double threshold, bool filtered, double* result) {
+    __shared__ double shared[256];
+
+    uint32_t tid = threadIdx.x;
+    uint32_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    uint32_t stride = gridDim.x * blockDim.x;
+
+    double sum = 0.0;
+    for (size_t i = idx; i < size; i += stride) {
+        double v = values[i];
+        if (!filtered || column_compare(op, v, threshold)) {
+            sum += v;
+        }
+    }
+
+    shared[tid] = sum;
+    __syncthreads();
+
+    for (uint32_t s = blockDim.x / 2; s > 0; s >>= 1) {
+        if (tid < s) {
+            shared[tid] += shared[tid + s];
+        }
+        __syncthreads();
+    }
+
+    if (tid == 0) {
+        atomicAdd(result, shared[0]);
+    }
+}
+
+__global__ void column_minmax_kernel(const double* values, size_t size, bool want_max,
+                                     double* result) {
+    __shared__ double shared[256];
+
+    uint32_t tid = threadIdx.x;
+    uint32_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    uint32_t stride = gridDim.x * blockDim.x;
+
+    double best = want_max ? -INFINITY : INFINITY;
+    for (size_t i = idx; i < size; i += stride) {
+        double v = values[i];
+        best = want_max ? fmax(best, v) : fmin(best, v);
+    }
+
+    shared[tid] = best;
+    __syncthreads();
+
+    for (uint32_t s = blockDim.x / 2; s > 0; s >>= 1) {
+        if (tid < s) {
+            shared[tid] = want_max ? fmax(shared[tid], shared[tid + s])
+                                   : fmin(shared[tid], shared[tid + s]);
+        }
+        __syncthreads();
+    }
+
+    if (tid == 0) {
+        atomic_min_max_double(result, shared[0], want_max);
+    }
+}
+
+__global__ void column_count_where_kernel(const double* values, size_t size, uint8_t op,
+                                          double threshold, unsigned long long* result) {
+    __shared__ unsigned long long shared[256];
+
+    uint32_t tid = threadIdx.x;
+    uint32_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    uint32_t stride = gridDim.x * blockDim.x;
+
+    unsigned long long matches = 0;
+    for (size_t i = idx; i < size; i += stride) {
+        if (column_compare(op, values[i], threshold)) {
+            ++matches;
+        }
+    }
+
+    shared[tid] = matches;
+    __syncthreads();
+
+    for (uint32_t s = blockDim.x / 2; s > 0; s >>= 1) {
+        if (tid < s) {
+            shared[tid] += shared[tid + s];
+        }
+        __syncthreads();
+    }
+
+    if (tid == 0) {
+        atomicAdd(result, shared[0]);
+    }
+}
+
 // ============================================================================
 // CUDA API Implementation
 // ============================================================================
@@ -230,6 +356,9 @@ auto get_cuda_info() -> gpu_info {
     info.compute_units = prop.multiProcessorCount;
     info.max_threads_per_block = prop.maxThreadsPerBlock;
     info.supports_concurrent_kernels = prop.concurrentKernels > 0;
+    // Integrated devices share physical memory with the host (see the
+    // gpu_info::unified_memory contract in json_gpu.h)
+    info.unified_memory = prop.integrated > 0;
     
     size_t free_mem, total_mem;
     err = cudaMemGetInfo(&free_mem, &total_mem);
@@ -315,6 +444,85 @@ auto cuda_find_structural(const char* input, size_t size, uint32_t* positions,
     return true;
 }
 
+// ============================================================================
+// Column Aggregation Wrappers
+// ============================================================================
+// The column already lives on the device (gpu_column::upload), so each
+// wrapper is one small result allocation, one launch, and an 8-byte readback.
+
+namespace {
+
+auto column_grid_size(size_t count, int block_size) -> int {
+    int grid = static_cast<int>((count + block_size - 1) / block_size);
+    return std::min(grid, 65535);
+}
+
+}  // namespace
+
+auto cuda_column_sum(const double* d_values, size_t count, double* out) -> bool {
+    double* d_result = nullptr;
+    CUDA_CHECK(cudaMalloc(&d_result, sizeof(double)));
+    CUDA_CHECK(cudaMemset(d_result, 0, sizeof(double)));
+
+    int block_size = 256;
+    column_sum_kernel<<<column_grid_size(count, block_size), block_size>>>(
+        d_values, count, 0, 0.0, /*filtered=*/false, d_result);
+    CUDA_CHECK(cudaDeviceSynchronize());
+
+    CUDA_CHECK(cudaMemcpy(out, d_result, sizeof(double), cudaMemcpyDeviceToHost));
+    cudaFree(d_result);
+    return true;
+}
+
+auto cuda_column_minmax(const double* d_values, size_t count, bool want_max, double* out)
+    -> bool {
+    double init = want_max ? -INFINITY : INFINITY;
+    double* d_result = nullptr;
+    CUDA_CHECK(cudaMalloc(&d_result, sizeof(double)));
+    CUDA_CHECK(cudaMemcpy(d_result, &init, sizeof(double), cudaMemcpyHostToDevice));
+
+    int block_size = 256;
+    column_minmax_kernel<<<column_grid_size(count, block_size), block_size>>>(
+        d_values, count, want_max, d_result);
+    CUDA_CHECK(cudaDeviceSynchronize());
+
+    CUDA_CHECK(cudaMemcpy(out, d_result, sizeof(double), cudaMemcpyDeviceToHost));
+    cudaFree(d_result);
+    return true;
+}
+
+auto cuda_column_count_where(const double* d_values, size_t count, uint8_t op, double threshold,
+                             unsigned long long* out) -> bool {
+    unsigned long long* d_result = nullptr;
+    CUDA_CHECK(cudaMalloc(&d_result, sizeof(unsigned long long)));
+    CUDA_CHECK(cudaMemset(d_result, 0, sizeof(unsigned long long)));
+
+    int block_size = 256;
+    column_count_where_kernel<<<column_grid_size(count, block_size), block_size>>>(
+        d_values, count, op, threshold, d_result);
+    CUDA_CHECK(cudaDeviceSynchronize());
+
+    CUDA_CHECK(cudaMemcpy(out, d_result, sizeof(unsigned long long), cudaMemcpyDeviceToHost));
+    cudaFree(d_result);
+    return true;
+}
+
+auto cuda_column_sum_where(const double* d_values, size_t count, uint8_t op, double threshold,
+                           double* out) -> bool {
+    double* d_result = nullptr;
+    CUDA_CHECK(cudaMalloc(&d_result, sizeof(double)));
+    CUDA_CHECK(cudaMemset(d_result, 0, sizeof(double)));
+
+    int block_size = 256;
+    column_sum_kernel<<<column_grid_size(count, block_size), block_size>>>(
+        d_values, count, op, threshold, /*filtered=*/true, d_result);
+    CUDA_CHECK(cudaDeviceSynchronize());
+
+    CUDA_CHECK(cudaMemcpy(out, d_result, sizeof(double), cudaMemcpyDeviceToHost));
+    cudaFree(d_result);
+    return true;
+}
+
 auto parse_on_cuda(std::string_view input, const gpu_parse_config& config) -> gpu_parse_result {
     gpu_parse_result result;
     
@@ -384,6 +592,181 @@ auto parse_on_cuda(std::string_view input, const gpu_parse_config& config) -> gp
     return result;
 }
 
+// ============================================================================
+// Stream-Pipelined Batch Parsing
+// ============================================================================
+// Round-robins documents over N streams: while stream S runs its kernel,
+// stream S+1 is already copying the next document up, so transfers and
+// compute overlap instead of serializing copy -> kernel -> copy per call.
+
+namespace {
+
+struct stream_slot {
+    cudaStream_t stream = nullptr;
+    char* d_input = nullptr;
+    uint32_t* d_positions = nullptr;
+    uint8_t* d_types = nullptr;
+    uint32_t* d_count = nullptr;
+    size_t capacity = 0;
+    ptrdiff_t pending = -1;  // Input index in flight on this stream
+    std::unique_ptr<pinned_block> staging;  // Pinned source of the in-flight copy
+};
+
+// Grow the slot's device buffers to hold `size` input bytes.
+auto ensure_capacity(stream_slot& slot, size_t size) -> bool {
+    if (slot.capacity >= size) {
+        return true;
+    }
+    // Null each pointer as it is freed: if a cudaMalloc below fails under
+    // device OOM, CUDA_CHECK returns with the slot in this half-built state,
+    // and the final cleanup loop (or a retry on a later wave) must not free
+    // the stale addresses again - the allocator may have already handed them
+    // to another slot. A failed cudaMalloc leaves its argument untouched, so
+    // the nulled value is what cleanup sees.
+    cudaFree(slot.d_input);
+    slot.d_input = nullptr;
+    cudaFree(slot.d_positions);
+    slot.d_positions = nullptr;
+    cudaFree(slot.d_types);
+    slot.d_types = nullptr;
+    slot.capacity = 0;
+
+    CUDA_CHECK(cudaMalloc(&slot.d_input, size));
+    CUDA_CHECK(cudaMalloc(&slot.d_positions, size * sizeof(uint32_t)));
+    CUDA_CHECK(cudaMalloc(&slot.d_types, size * sizeof(uint8_t)));
+    slot.capacity = size;
+    return true;
+}
+
+// Wait for the slot's in-flight document and copy its results out.
+auto drain_slot(stream_slot& slot, std::vector<gpu_parse_result>& results) -> void {
+    if (slot.pending < 0) {
+        return;
+    }
+    auto& result = results[slot.pending];
+    slot.pending = -1;
+
+    bool synced = cudaStreamSynchronize(slot.stream) == cudaSuccess;
+    slot.staging.reset();  // Copy consumed; recycle the pinned block
+
+    if (!synced) {
+        result.error_message = "CUDA stream synchronization failed";
+        return;
+    }
+
+    uint32_t count = 0;
+    if (cudaMemcpy(&count, slot.d_count, sizeof(uint32_t), cudaMemcpyDeviceToHost) !=
+        cudaSuccess) {
+        result.error_message = "CUDA token count readback failed";
+        return;
+    }
+
+    result.token_positions.resize(count);
+    result.token_types.resize(count);
+    if (count > 0) {
+        if (cudaMemcpy(result.token_positions.data(), slot.d_positions,
+                       count * sizeof(uint32_t), cudaMemcpyDeviceToHost) != cudaSuccess ||
+            cudaMemcpy(result.token_types.data(), slot.d_types, count * sizeof(uint8_t),
+                       cudaMemcpyDeviceToHost) != cudaSuccess) {
+            result.error_message = "CUDA result readback failed";
+            return;
+        }
+    }
+    result.success = true;
+}
+
+}  // namespace
+
+auto parse_batch_on_cuda(const std::vector<std::string_view>& inputs,
+                         const gpu_parse_config& config) -> std::vector<gpu_parse_result> {
+    std::vector<gpu_parse_result> results(inputs.size());
+    if (inputs.empty()) {
+        return results;
+    }
+
+    auto start_total = std::chrono::high_resolution_clock::now();
+
+    size_t num_streams = std::max<size_t>(1, std::min(config.num_streams, inputs.size()));
+    std::vector<stream_slot> slots(num_streams);
+    for (auto& slot : slots) {
+        if (cudaStreamCreateWithFlags(&slot.stream, cudaStreamNonBlocking) != cudaSuccess) {
+            slot.stream = nullptr;
+        }
+    }
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        auto& slot = slots[i % num_streams];
+        auto input = inputs[i];
+
+        if (slot.stream == nullptr) {
+            results[i].error_message = "CUDA stream creation failed";
+            continue;
+        }
+
+        // Finish the document previously issued on this stream before its
+        // buffers are reused.
+        drain_slot(slot, results);
+
+        if (!ensure_capacity(slot, input.size()) ||
+            (slot.d_count == nullptr && cudaMalloc(&slot.d_count, sizeof(uint32_t)) !=
+                                            cudaSuccess)) {
+            results[i].error_message = "CUDA device allocation failed";
+            continue;
+        }
+
+        // Stage through a pooled pinned block so the async copy is a true DMA
+        // that overlaps with kernels running on the other streams. The block
+        // stays owned by the slot until the stream is drained.
+        slot.staging = std::make_unique<pinned_block>(input.size(), gpu_backend::cuda);
+        const void* src = input.data();
+        if (slot.staging->valid()) {
+            memcpy(slot.staging->data(), input.data(), input.size());
+            src = slot.staging->data();
+        } else {
+            slot.staging.reset();
+        }
+
+        bool issued =
+            cudaMemsetAsync(slot.d_count, 0, sizeof(uint32_t), slot.stream) == cudaSuccess &&
+            cudaMemcpyAsync(slot.d_input, src, input.size(), cudaMemcpyHostToDevice,
+                            slot.stream) == cudaSuccess;
+        if (!issued) {
+            results[i].error_message = "CUDA async transfer failed";
+            continue;
+        }
+
+        int block_size = config.block_size;
+        int grid_size = config.grid_size > 0
+                            ? config.grid_size
+                            : static_cast<int>((input.size() + block_size - 1) / block_size);
+        grid_size = std::min(grid_size, 65535);
+
+        find_structural_kernel<<<grid_size, block_size, 0, slot.stream>>>(
+            slot.d_input, input.size(), slot.d_positions, slot.d_types, slot.d_count);
+
+        slot.pending = static_cast<ptrdiff_t>(i);
+    }
+
+    for (auto& slot : slots) {
+        drain_slot(slot, results);
+        cudaFree(slot.d_input);
+        cudaFree(slot.d_positions);
+        cudaFree(slot.d_types);
+        cudaFree(slot.d_count);
+        if (slot.stream != nullptr) {
+            cudaStreamDestroy(slot.stream);
+        }
+    }
+
+    auto end_total = std::chrono::high_resolution_clock::now();
+    double total_ms = std::chrono::duration<double, std::milli>(end_total - start_total).count();
+    for (auto& result : results) {
+        result.total_ms = total_ms;
+    }
+
+    return results;
+}
+
 } // namespace cuda
 } // namespace gpu
 } // namespace fastjson
@@ -5,7 +5,11 @@
 #include "json_gpu.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <string>
 
 #include <dlfcn.h>
 
@@ -15,6 +19,14 @@ namespace fastjson::gpu::cuda {
 auto detect_cuda() -> bool;
 auto get_cuda_info() -> gpu_info;
 auto parse_on_cuda(std::string_view input, const gpu_parse_config& config) -> gpu_parse_result;
+auto parse_batch_on_cuda(const std::vector<std::string_view>& inputs,
+                         const gpu_parse_config& config) -> std::vector<gpu_parse_result>;
+auto cuda_column_sum(const double* d_values, size_t count, double* out) -> bool;
+auto cuda_column_minmax(const double* d_values, size_t count, bool want_max, double* out) -> bool;
+auto cuda_column_count_where(const double* d_values, size_t count, uint8_t op, double threshold,
+                             unsigned long long* out) -> bool;
+auto cuda_column_sum_where(const double* d_values, size_t count, uint8_t op, double threshold,
+                           double* out) -> bool;
 }  // namespace fastjson::gpu::cuda
 #endif
 
@@ -23,6 +35,8 @@ namespace fastjson::gpu::rocm {
 auto detect_rocm() -> bool;
 auto get_rocm_info() -> gpu_info;
 auto parse_on_rocm(std::string_view input, const gpu_parse_config& config) -> gpu_parse_result;
+auto parse_batch_on_rocm(const std::vector<std::string_view>& inputs,
+                         const gpu_parse_config& config) -> std::vector<gpu_parse_result>;
 }  // namespace fastjson::gpu::rocm
 #endif
 
@@ -184,6 +198,145 @@ auto is_gpu_available() -> bool {
     return detect_gpu_backend() != gpu_backend::none;
 }
 
+// ============================================================================
+// Pinned Host Memory Pool Implementation
+// ============================================================================
+
+namespace {
+
+auto allocate_pinned(size_t size, gpu_backend backend) -> void* {
+    void* ptr = nullptr;
+
+    switch (backend) {
+        case gpu_backend::cuda:
+#ifdef __CUDACC__
+            if (detect_cuda_runtime() &&
+                cudaHostAlloc(&ptr, size, cudaHostAllocPortable) == cudaSuccess) {
+                return ptr;
+            }
+#endif
+            break;
+
+        case gpu_backend::rocm:
+#ifdef __HIP__
+            if (detect_rocm_runtime() && hipHostMalloc(&ptr, size, hipHostMallocPortable) ==
+                                             hipSuccess) {
+                return ptr;
+            }
+#endif
+            break;
+
+        default:
+            break;
+    }
+
+    // No pinned allocator compiled in: plain heap memory keeps callers
+    // working, just without the bandwidth benefit.
+    return std::malloc(size);
+}
+
+auto free_pinned(void* ptr, gpu_backend backend) -> void {
+    switch (backend) {
+        case gpu_backend::cuda:
+#ifdef __CUDACC__
+            if (detect_cuda_runtime()) {
+                cudaFreeHost(ptr);
+                return;
+            }
+#endif
+            break;
+
+        case gpu_backend::rocm:
+#ifdef __HIP__
+            if (detect_rocm_runtime()) {
+                hipHostFree(ptr);
+                return;
+            }
+#endif
+            break;
+
+        default:
+            break;
+    }
+
+    std::free(ptr);
+}
+
+}  // namespace
+
+auto pinned_host_pool::instance() -> pinned_host_pool& {
+    static pinned_host_pool pool;
+    return pool;
+}
+
+pinned_host_pool::~pinned_host_pool() { trim(); }
+
+auto pinned_host_pool::acquire(size_t size, gpu_backend backend) -> block {
+    if (backend == gpu_backend::auto_detect) {
+        backend = detect_gpu_backend();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Best-fit over the cached blocks: smallest one that still fits, to
+        // keep large pinned regions available for the 256 MB batch transfers.
+        size_t best = free_blocks_.size();
+        for (size_t i = 0; i < free_blocks_.size(); ++i) {
+            if (free_blocks_[i].backend != backend || free_blocks_[i].size < size) {
+                continue;
+            }
+            if (best == free_blocks_.size() || free_blocks_[i].size < free_blocks_[best].size) {
+                best = i;
+            }
+        }
+
+        if (best != free_blocks_.size()) {
+            block b = free_blocks_[best];
+            free_blocks_.erase(free_blocks_.begin() + static_cast<ptrdiff_t>(best));
+            cached_bytes_ -= b.size;
+            return b;
+        }
+    }
+
+    block b;
+    b.size = size;
+    b.backend = backend;
+    b.ptr = allocate_pinned(size, backend);
+    if (b.ptr == nullptr) {
+        b.size = 0;
+    }
+    return b;
+}
+
+auto pinned_host_pool::release(block&& b) -> void {
+    if (b.ptr == nullptr) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cached_bytes_ + b.size <= max_cached_bytes_) {
+            cached_bytes_ += b.size;
+            free_blocks_.push_back(b);
+            b.ptr = nullptr;
+            return;
+        }
+    }
+
+    free_pinned(b.ptr, b.backend);
+    b.ptr = nullptr;
+}
+
+auto pinned_host_pool::trim() -> void {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& b : free_blocks_) {
+        free_pinned(b.ptr, b.backend);
+    }
+    free_blocks_.clear();
+    cached_bytes_ = 0;
+}
+
 // ============================================================================
 // GPU Buffer Implementation
 // ============================================================================
@@ -357,7 +510,48 @@ auto gpu_buffer::copy_from_device(void* host_ptr, size_t size, size_t offset) ->
 }
 
 auto gpu_buffer::copy_to_device_async(const void* host_ptr, size_t size, size_t offset) -> bool {
-    // Async copy implementation similar to sync but with streams
+    if (device_ptr_ == nullptr || size + offset > size_) {
+        return false;
+    }
+
+    // Stage through a pooled pinned block so the driver issues a true async
+    // DMA instead of silently bouncing pageable memory through its own
+    // staging buffer at half bandwidth. The pool recycles the block, so
+    // repeated transfers of similar sizes pin memory once.
+#if defined(__CUDACC__) || defined(__HIP__)
+    pinned_block staging(size, backend_);
+    if (staging.valid()) {
+        std::memcpy(staging.data(), host_ptr, size);
+        char* dest = static_cast<char*>(device_ptr_) + offset;
+
+        switch (backend_) {
+            case gpu_backend::cuda:
+    #ifdef __CUDACC__
+                if (detect_cuda_runtime()) {
+                    return cudaMemcpyAsync(dest, staging.data(), size, cudaMemcpyHostToDevice,
+                                           static_cast<cudaStream_t>(stream_)) == cudaSuccess &&
+                           cudaStreamSynchronize(static_cast<cudaStream_t>(stream_)) ==
+                               cudaSuccess;
+                }
+    #endif
+                break;
+
+            case gpu_backend::rocm:
+    #ifdef __HIP__
+                if (detect_rocm_runtime()) {
+                    return hipMemcpyAsync(dest, staging.data(), size, hipMemcpyHostToDevice,
+                                          static_cast<hipStream_t>(stream_)) == hipSuccess &&
+                           hipStreamSynchronize(static_cast<hipStream_t>(stream_)) == hipSuccess;
+                }
+    #endif
+                break;
+
+            default:
+                break;
+        }
+    }
+#endif
+
     return copy_to_device(host_ptr, size, offset);
 }
 
@@ -366,6 +560,147 @@ auto gpu_buffer::copy_from_device_async(void* host_ptr, size_t size, size_t offs
     return copy_from_device(host_ptr, size, offset);
 }
 
+// ============================================================================
+// Device-Resident Column Aggregation
+// ============================================================================
+
+namespace {
+
+auto host_compare(compare_op op, double value, double threshold) -> bool {
+    switch (op) {
+        case compare_op::less:
+            return value < threshold;
+        case compare_op::less_equal:
+            return value <= threshold;
+        case compare_op::greater:
+            return value > threshold;
+        case compare_op::greater_equal:
+            return value >= threshold;
+        case compare_op::equal:
+            return value == threshold;
+        case compare_op::not_equal:
+            return value != threshold;
+    }
+    return false;
+}
+
+}  // namespace
+
+auto gpu_column::upload(std::span<const double> values, gpu_backend backend) -> gpu_column {
+    gpu_column column;
+    column.count_ = values.size();
+
+    if (backend == gpu_backend::auto_detect) {
+        backend = detect_gpu_backend();
+    }
+
+#ifdef __CUDACC__
+    // Only the CUDA backend ships aggregation kernels; other backends keep
+    // the column on the host rather than strand it in memory no kernel can
+    // reduce.
+    if (backend == gpu_backend::cuda && detect_cuda_runtime() && !values.empty()) {
+        auto buffer = std::make_unique<gpu_buffer>(values.size() * sizeof(double), backend);
+        if (buffer->device_ptr() != nullptr &&
+            buffer->copy_to_device(values.data(), values.size() * sizeof(double))) {
+            column.buffer_ = std::move(buffer);
+            return column;
+        }
+    }
+#else
+    (void)backend;
+#endif
+
+    column.host_values_.assign(values.begin(), values.end());
+    return column;
+}
+
+auto gpu_column::sum() const -> double {
+#ifdef __CUDACC__
+    if (buffer_ != nullptr) {
+        double out = 0.0;
+        if (cuda::cuda_column_sum(static_cast<const double*>(buffer_->device_ptr()), count_,
+                                  &out)) {
+            return out;
+        }
+    }
+#endif
+    double total = 0.0;
+    for (double value : host_values_) {
+        total += value;
+    }
+    return total;
+}
+
+auto gpu_column::min() const -> std::optional<double> {
+    if (count_ == 0) {
+        return std::nullopt;
+    }
+#ifdef __CUDACC__
+    if (buffer_ != nullptr) {
+        double out = 0.0;
+        if (cuda::cuda_column_minmax(static_cast<const double*>(buffer_->device_ptr()), count_,
+                                     /*want_max=*/false, &out)) {
+            return out;
+        }
+    }
+#endif
+    return *std::min_element(host_values_.begin(), host_values_.end());
+}
+
+auto gpu_column::max() const -> std::optional<double> {
+    if (count_ == 0) {
+        return std::nullopt;
+    }
+#ifdef __CUDACC__
+    if (buffer_ != nullptr) {
+        double out = 0.0;
+        if (cuda::cuda_column_minmax(static_cast<const double*>(buffer_->device_ptr()), count_,
+                                     /*want_max=*/true, &out)) {
+            return out;
+        }
+    }
+#endif
+    return *std::max_element(host_values_.begin(), host_values_.end());
+}
+
+auto gpu_column::count_where(compare_op op, double threshold) const -> size_t {
+#ifdef __CUDACC__
+    if (buffer_ != nullptr) {
+        unsigned long long out = 0;
+        if (cuda::cuda_column_count_where(static_cast<const double*>(buffer_->device_ptr()),
+                                          count_, static_cast<uint8_t>(op), threshold, &out)) {
+            return static_cast<size_t>(out);
+        }
+    }
+#endif
+    size_t matches = 0;
+    for (double value : host_values_) {
+        if (host_compare(op, value, threshold)) {
+            ++matches;
+        }
+    }
+    return matches;
+}
+
+auto gpu_column::sum_where(compare_op op, double threshold) const -> double {
+#ifdef __CUDACC__
+    if (buffer_ != nullptr) {
+        double out = 0.0;
+        if (cuda::cuda_column_sum_where(static_cast<const double*>(buffer_->device_ptr()),
+                                        count_, static_cast<uint8_t>(op), threshold, &out)) {
+            return out;
+        }
+    }
+#endif
+    double total = 0.0;
+    for (double value : host_values_) {
+        if (host_compare(op, value, threshold)) {
+            total += value;
+        }
+    }
+    return total;
+}
+
 // ============================================================================
 // GPU Parsing Interface
 // ============================================================================
@@ -444,6 +779,353 @@ auto parse_on_gpu(std::string_view input, const gpu_parse_config& config) -> gpu
     }
 }
 
+// ============================================================================
+// Hybrid GPU Stage-1 / CPU Stage-2
+// ============================================================================
+
+namespace {
+
+// Backend token type codes emitted by the structural kernels.
+constexpr uint8_t token_left_brace = 1;
+constexpr uint8_t token_right_brace = 2;
+constexpr uint8_t token_left_bracket = 3;
+constexpr uint8_t token_right_bracket = 4;
+constexpr uint8_t token_colon = 5;
+constexpr uint8_t token_comma = 6;
+constexpr uint8_t token_quote = 7;
+
+// A quote is escaped iff it is preceded by an odd run of backslashes.
+auto quote_is_escaped(std::string_view input, size_t pos) -> bool {
+    size_t backslashes = 0;
+    while (pos > backslashes && input[pos - 1 - backslashes] == '\\') {
+        ++backslashes;
+    }
+    return (backslashes % 2) == 1;
+}
+
+}  // namespace
+
+auto gpu_build_structural_index(std::string_view input, const gpu_parse_config& config)
+    -> std::optional<std::vector<structural_index>> {
+    auto gpu_result = parse_on_gpu(input, config);
+    if (!gpu_result.success) {
+        return std::nullopt;
+    }
+
+    // The kernels scan positions independently, so tokens arrive unordered
+    // (atomicAdd slot order) and without string-context filtering. Normalize
+    // on the CPU: sort by position, then walk once tracking string state to
+    // drop structural characters that are literal text inside strings.
+    std::vector<std::pair<uint32_t, uint8_t>> tokens;
+    tokens.reserve(gpu_result.token_positions.size());
+    for (size_t i = 0; i < gpu_result.token_positions.size(); ++i) {
+        tokens.emplace_back(gpu_result.token_positions[i], gpu_result.token_types[i]);
+    }
+    std::sort(tokens.begin(), tokens.end());
+
+    // A backend that never reports quotes (structural-only kernel) cannot be
+    // string-filtered on a document that contains strings; let the caller
+    // fall back to the CPU scanner rather than mis-index it.
+    bool saw_quote_token = false;
+    for (const auto& [pos, type] : tokens) {
+        if (type == token_quote) {
+            saw_quote_token = true;
+            break;
+        }
+    }
+    if (!saw_quote_token && memchr(input.data(), '"', input.size()) != nullptr) {
+        return std::nullopt;
+    }
+
+    std::vector<structural_index> indices;
+    indices.reserve(tokens.size());
+    bool in_string = false;
+
+    for (const auto& [pos, type] : tokens) {
+        if (type == token_quote) {
+            if (quote_is_escaped(input, pos)) {
+                continue;  // Literal quote inside a string
+            }
+            in_string = !in_string;
+            indices.push_back({pos, structural_type::quote, {}});
+            continue;
+        }
+        if (in_string) {
+            continue;  // Structural character inside a string is literal text
+        }
+        switch (type) {
+            case token_left_brace:
+                indices.push_back({pos, structural_type::left_brace, {}});
+                break;
+            case token_right_brace:
+                indices.push_back({pos, structural_type::right_brace, {}});
+                break;
+            case token_left_bracket:
+                indices.push_back({pos, structural_type::left_bracket, {}});
+                break;
+            case token_right_bracket:
+                indices.push_back({pos, structural_type::right_bracket, {}});
+                break;
+            case token_colon:
+                indices.push_back({pos, structural_type::colon, {}});
+                break;
+            case token_comma:
+                indices.push_back({pos, structural_type::comma, {}});
+                break;
+            default:
+                break;  // Whitespace/number tokens: primitives re-derived below
+        }
+    }
+
+    if (in_string) {
+        return std::nullopt;  // Unterminated string; let the CPU path diagnose
+    }
+
+    insert_primitive_starts(std::span<const char>(input.data(), input.size()), indices);
+    return indices;
+}
+
+auto parse_batch_on_gpu(const std::vector<std::string_view>& inputs,
+                        const gpu_parse_config& config) -> std::vector<gpu_parse_result> {
+    gpu_backend backend = config.backend;
+    if (backend == gpu_backend::auto_detect) {
+        backend = detect_gpu_backend();
+    }
+
+    switch (backend) {
+#ifdef __CUDACC__
+        case gpu_backend::cuda:
+            if (detect_cuda_runtime()) {
+                return cuda::parse_batch_on_cuda(inputs, config);
+            }
+            break;
+#endif
+
+#ifdef __HIP__
+        case gpu_backend::rocm:
+            if (detect_rocm_runtime()) {
+                return rocm::parse_batch_on_rocm(inputs, config);
+            }
+            break;
+#endif
+
+        default:
+            break;
+    }
+
+    // No pipelined backend compiled in: fall back to per-document dispatch,
+    // which also yields the per-document error results in the no-GPU case.
+    std::vector<gpu_parse_result> results;
+    results.reserve(inputs.size());
+    for (auto input : inputs) {
+        results.push_back(parse_on_gpu(input, config));
+    }
+    return results;
+}
+
+// ============================================================================
+// GPU/CPU Crossover Calibration
+// ============================================================================
+
+namespace {
+
+std::mutex g_calibration_mutex;
+gpu_calibration g_calibration;
+bool g_calibrated = false;
+
+// Array-of-objects corpus with strings, numbers and nesting - the shape the
+// scan kernels are rate-limited by.
+auto make_synthetic_document(size_t target_bytes) -> std::string {
+    std::string doc = "[";
+    doc.reserve(target_bytes + 128);
+    size_t i = 0;
+    while (doc.size() + 96 < target_bytes) {
+        if (i != 0) {
+            doc += ',';
+        }
+        doc += "{\"id\":" + std::to_string(i) + ",\"name\":\"user-" +
+               std::to_string(i * 7919 % 100000) + "\",\"score\":" +
+               std::to_string(static_cast<double>(i % 1000) / 10.0) + ",\"tags\":[1,2,3]}";
+        ++i;
+    }
+    doc += "]";
+    return doc;
+}
+
+auto now_ms() -> double {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Best of two runs: the first one pays cold caches and page faults.
+auto time_cpu_scan_ms(std::string_view doc) -> double {
+    double best = 0.0;
+    for (int run = 0; run < 2; ++run) {
+        double start = now_ms();
+        auto index = build_structural_index(std::span<const char>(doc.data(), doc.size()));
+        double elapsed = now_ms() - start;
+        if (index.empty()) {
+            return 0.0;
+        }
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+auto measure_calibration() -> gpu_calibration {
+    gpu_calibration cal;
+
+    constexpr size_t probe_sizes[] = {64 * 1024, 1024 * 1024, 8 * 1024 * 1024};
+
+    double cpu_bytes = 0.0;
+    double cpu_ms = 0.0;
+    std::vector<std::pair<double, double>> gpu_points;  // (bytes, ms)
+
+    gpu_parse_config probe_config;
+    probe_config.min_size_for_gpu = 0;  // Calibration probes every size
+
+    for (size_t size : probe_sizes) {
+        std::string doc = make_synthetic_document(size);
+
+        double scan_ms = time_cpu_scan_ms(doc);
+        if (scan_ms > 0.0) {
+            cpu_bytes += static_cast<double>(doc.size());
+            cpu_ms += scan_ms;
+        }
+
+        auto gpu_result = parse_on_gpu(doc, probe_config);
+        if (gpu_result.success) {
+            gpu_points.emplace_back(static_cast<double>(doc.size()), gpu_result.total_ms);
+        }
+    }
+
+    if (cpu_ms > 0.0) {
+        cal.cpu_bytes_per_ms = cpu_bytes / cpu_ms;
+    }
+
+    // Least-squares fit of gpu_ms = overhead + bytes / rate over the probes.
+    if (gpu_points.size() >= 2) {
+        double n = static_cast<double>(gpu_points.size());
+        double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+        for (const auto& [x, y] : gpu_points) {
+            sum_x += x;
+            sum_y += y;
+            sum_xx += x * x;
+            sum_xy += x * y;
+        }
+        double denom = n * sum_xx - sum_x * sum_x;
+        if (denom > 0.0) {
+            double slope = (n * sum_xy - sum_x * sum_y) / denom;  // ms per byte
+            double intercept = (sum_y - slope * sum_x) / n;
+            if (slope > 0.0) {
+                cal.gpu_usable = true;
+                cal.gpu_bytes_per_ms = 1.0 / slope;
+                cal.gpu_overhead_ms = std::max(0.0, intercept);
+
+                // CPU: size / cpu_rate. GPU: overhead + size / gpu_rate.
+                // Equal where size * (1/cpu - 1/gpu) = overhead; the GPU
+                // never wins if its marginal rate does not beat the CPU's.
+                if (cal.cpu_bytes_per_ms > 0.0 &&
+                    cal.gpu_bytes_per_ms > cal.cpu_bytes_per_ms) {
+                    double rate_gap =
+                        1.0 / cal.cpu_bytes_per_ms - 1.0 / cal.gpu_bytes_per_ms;
+                    cal.crossover_bytes =
+                        static_cast<size_t>(cal.gpu_overhead_ms / rate_gap);
+                }
+            }
+        }
+    }
+
+    return cal;
+}
+
+}  // namespace
+
+auto calibrate_gpu_crossover() -> const gpu_calibration& {
+    std::lock_guard<std::mutex> lock(g_calibration_mutex);
+    if (!g_calibrated) {
+        g_calibration = measure_calibration();
+        g_calibrated = true;
+    }
+    return g_calibration;
+}
+
+auto set_gpu_calibration(const gpu_calibration& profile) -> void {
+    std::lock_guard<std::mutex> lock(g_calibration_mutex);
+    g_calibration = profile;
+    g_calibrated = true;
+}
+
+auto save_gpu_calibration(const gpu_calibration& profile, const std::string& path) -> bool {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    out << "gpu_usable=" << (profile.gpu_usable ? 1 : 0) << '\n'
+        << "cpu_bytes_per_ms=" << profile.cpu_bytes_per_ms << '\n'
+        << "gpu_bytes_per_ms=" << profile.gpu_bytes_per_ms << '\n'
+        << "gpu_overhead_ms=" << profile.gpu_overhead_ms << '\n'
+        << "crossover_bytes=" << profile.crossover_bytes << '\n';
+    return static_cast<bool>(out);
+}
+
+auto load_gpu_calibration(const std::string& path) -> std::optional<gpu_calibration> {
+    std::ifstream in(path);
+    if (!in) {
+        return std::nullopt;
+    }
+
+    gpu_calibration profile;
+    int seen = 0;
+    std::string line;
+    while (std::getline(in, line)) {
+        auto eq = line.find('=');
+        if (eq == std::string::npos) {
+            continue;
+        }
+        std::string key = line.substr(0, eq);
+        std::string value = line.substr(eq + 1);
+        if (key == "gpu_usable") {
+            profile.gpu_usable = std::atoi(value.c_str()) != 0;
+            ++seen;
+        } else if (key == "cpu_bytes_per_ms") {
+            profile.cpu_bytes_per_ms = std::atof(value.c_str());
+            ++seen;
+        } else if (key == "gpu_bytes_per_ms") {
+            profile.gpu_bytes_per_ms = std::atof(value.c_str());
+            ++seen;
+        } else if (key == "gpu_overhead_ms") {
+            profile.gpu_overhead_ms = std::atof(value.c_str());
+            ++seen;
+        } else if (key == "crossover_bytes") {
+            profile.crossover_bytes = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+            ++seen;
+        }
+    }
+    if (seen != 5) {
+        return std::nullopt;
+    }
+    return profile;
+}
+
+auto parse_auto(std::string_view input, const gpu_parse_config& config)
+    -> std::vector<structural_index> {
+    const auto& cal = calibrate_gpu_crossover();
+
+    if (cal.gpu_usable && input.size() >= cal.crossover_bytes) {
+        if (auto index = gpu_build_structural_index(input, config)) {
+            return std::move(*index);
+        }
+        // GPU declined (backend gone, unnormalizable token stream): the CPU
+        // scanner below handles it
+    }
+
+    return build_structural_index(std::span<const char>(input.data(), input.size()));
+}
+
 // ============================================================================
 // GPU Kernel Operations
 // ============================================================================
@@ -552,6 +1234,15 @@ auto get_optimal_gpu_config(size_t input_size, gpu_backend backend) -> gpu_parse
         config.min_size_for_gpu = std::max(10000ul, info.total_memory / 10000);
     }
 
+    // A measured crossover beats the memory heuristic whenever calibration
+    // has already run (or a saved profile was installed)
+    {
+        std::lock_guard<std::mutex> lock(g_calibration_mutex);
+        if (g_calibrated && g_calibration.gpu_usable) {
+            config.min_size_for_gpu = g_calibration.crossover_bytes;
+        }
+    }
+
     return config;
 }
 
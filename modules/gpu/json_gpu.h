@@ -6,9 +6,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
+#include "../fastjson_simd_index.h"
+
 namespace fastjson {
 namespace gpu {
 
@@ -32,6 +37,11 @@ struct gpu_info {
     int compute_units = 0;
     int max_threads_per_block = 0;
     bool supports_concurrent_kernels = false;
+    // True on integrated GPUs (APUs) that share physical memory with the
+    // host: device pointers can alias host pages, so input staging through
+    // copy_to_device is pure overhead there. Discrete cards with managed
+    // memory still prefer staging and report false.
+    bool unified_memory = false;
 };
 
 // Detect available GPU backend
@@ -47,6 +57,73 @@ auto is_gpu_available() -> bool;
 // GPU Memory Management
 // ============================================================================
 
+// Pinned (page-locked) host memory pool. Transfers from pageable host memory
+// force the driver to stage through its own pinned bounce buffer, halving
+// effective H2D bandwidth; transfers from these blocks run at full PCIe
+// speed. Blocks are recycled across calls so repeated GPU parses of large
+// batches pin each region once instead of per transfer. Falls back to plain
+// malloc when no GPU backend is compiled in.
+class pinned_host_pool {
+public:
+    struct block {
+        void* ptr = nullptr;
+        size_t size = 0;
+        gpu_backend backend = gpu_backend::none;
+    };
+
+    static auto instance() -> pinned_host_pool&;
+
+    ~pinned_host_pool();
+
+    // Acquire a pinned block of at least `size` bytes, reusing a cached block
+    // when one is large enough. block.ptr is null on allocation failure.
+    auto acquire(size_t size, gpu_backend backend) -> block;
+
+    // Return a block to the pool for reuse. Blocks beyond the cache limit are
+    // freed immediately.
+    auto release(block&& b) -> void;
+
+    // Free every cached block (e.g. before device teardown).
+    auto trim() -> void;
+
+    // Upper bound on bytes kept cached; excess released blocks are freed.
+    auto set_max_cached_bytes(size_t bytes) -> void { max_cached_bytes_ = bytes; }
+
+private:
+    pinned_host_pool() = default;
+
+    std::mutex mutex_;
+    std::vector<block> free_blocks_;
+    size_t cached_bytes_ = 0;
+    size_t max_cached_bytes_ = 512ull * 1024 * 1024;
+};
+
+// RAII handle over a pooled pinned block: acquires on construction, returns
+// the block to the pool on destruction.
+class pinned_block {
+public:
+    pinned_block(size_t size, gpu_backend backend)
+        : block_(pinned_host_pool::instance().acquire(size, backend)) {}
+
+    ~pinned_block() {
+        if (block_.ptr != nullptr) {
+            pinned_host_pool::instance().release(std::move(block_));
+        }
+    }
+
+    pinned_block(const pinned_block&) = delete;
+    pinned_block& operator=(const pinned_block&) = delete;
+
+    auto data() -> void* { return block_.ptr; }
+
+    auto size() const -> size_t { return block_.size; }
+
+    auto valid() const -> bool { return block_.ptr != nullptr; }
+
+private:
+    pinned_host_pool::block block_;
+};
+
 class gpu_buffer {
 public:
     gpu_buffer(size_t size, gpu_backend backend);
@@ -80,10 +157,66 @@ private:
     void* stream_ = nullptr;  // CUDA stream / HIP stream / SYCL queue
 };
 
+// ============================================================================
+// Device-Resident Column Aggregation
+// ============================================================================
+// Pairs columnar::extract_column with the GPU: upload() pushes an extracted
+// numeric column to device memory once, and every aggregation afterwards is a
+// single kernel launch plus an 8-byte readback, so the PCIe transfer is
+// amortized across all queries against the column instead of paid per
+// aggregation. Without a compiled-in GPU backend, or when the upload fails,
+// the column stays host-resident and the same calls compute on the CPU -
+// callers need no fallback path of their own.
+//
+//   auto col = columnar::extract_column<double>(json, "score");
+//   auto resident = gpu::gpu_column::upload(col->values());
+//   double total = resident.sum();                            // kernel only
+//   size_t hot = resident.count_where(compare_op::greater, 0.9);
+
+// Device predicates cannot capture host lambdas, so filtered aggregations
+// take a comparison against a threshold - the shape our scoring queries use.
+enum class compare_op : uint8_t { less, less_equal, greater, greater_equal, equal, not_equal };
+
+class gpu_column {
+public:
+    // Upload a column of doubles to the device; host-resident fallback when
+    // no backend is usable.
+    static auto upload(std::span<const double> values,
+                       gpu_backend backend = gpu_backend::auto_detect) -> gpu_column;
+
+    auto sum() const -> double;
+    auto min() const -> std::optional<double>;
+    auto max() const -> std::optional<double>;
+
+    // Fused filter + reduce: the filtered column is never materialized.
+    auto count_where(compare_op op, double threshold) const -> size_t;
+    auto sum_where(compare_op op, double threshold) const -> double;
+
+    auto size() const -> size_t { return count_; }
+
+    auto device_resident() const -> bool { return buffer_ != nullptr; }
+
+private:
+    gpu_column() = default;
+
+    std::unique_ptr<gpu_buffer> buffer_;  // Device copy when resident
+    std::vector<double> host_values_;     // CPU fallback storage
+    size_t count_ = 0;
+};
+
 // ============================================================================
 // GPU JSON Parsing Interface
 // ============================================================================
 
+// Input placement policy. `staged` always copies the input into device
+// memory; `zero_copy` maps the host pages into the device address space
+// (hipHostRegister / cudaHostRegister) and lets the kernel read them in
+// place, which on APUs removes the copy entirely; `auto_detect` picks
+// zero_copy when the device reports unified memory and staged otherwise.
+// A zero_copy request on hardware that cannot map the pages falls back to
+// staging rather than failing the parse.
+enum class gpu_placement : uint8_t { auto_detect, staged, zero_copy };
+
 struct gpu_parse_config {
     gpu_backend backend = gpu_backend::auto_detect;
     size_t min_size_for_gpu = 10000;  // Minimum input size to use GPU
@@ -91,6 +224,8 @@ struct gpu_parse_config {
     int grid_size = 0;                // GPU grid size (0 = auto)
     bool async_execution = true;      // Use asynchronous GPU execution
     bool pin_host_memory = true;      // Pin host memory for faster transfers
+    size_t num_streams = 4;           // Streams for batched pipelining
+    gpu_placement placement = gpu_placement::auto_detect;  // Input staging policy
 };
 
 // Parse JSON on GPU (returns parsed structure indices and values)
@@ -113,6 +248,30 @@ struct gpu_parse_result {
 // GPU-accelerated JSON parsing
 auto parse_on_gpu(std::string_view input, const gpu_parse_config& config = {}) -> gpu_parse_result;
 
+// Batched GPU parsing with stream pipelining. Documents are distributed
+// round-robin over config.num_streams CUDA/HIP streams so the H2D copy of
+// batch N+1 overlaps kernel execution of batch N, instead of serializing
+// copy -> kernel -> copy per document. Results are returned in input order.
+auto parse_batch_on_gpu(const std::vector<std::string_view>& inputs,
+                        const gpu_parse_config& config = {}) -> std::vector<gpu_parse_result>;
+
+// ============================================================================
+// Hybrid GPU Stage-1 / CPU Stage-2 Parsing
+// ============================================================================
+// The GPU absorbs the stage-1 structural scan for very large inputs; the CPU
+// consumes the resulting index to materialize the DOM. The returned vector is
+// the same format build_structural_index produces, so it feeds directly into
+// tape::tape_document::parse_with_index:
+//
+//   if (auto index = gpu_build_structural_index(input)) {
+//       auto doc = tape::tape_document::parse_with_index(input, *index);
+//   }
+//
+// Returns std::nullopt when no GPU backend is available or the backend's
+// token stream cannot be normalized (callers fall back to the CPU scanner).
+auto gpu_build_structural_index(std::string_view input, const gpu_parse_config& config = {})
+    -> std::optional<std::vector<structural_index>>;
+
 // ============================================================================
 // GPU Kernel Operations (Low-level)
 // ============================================================================
@@ -151,5 +310,44 @@ auto benchmark_gpu_vs_cpu(size_t test_size) -> std::vector<gpu_benchmark_result>
 // Get optimal configuration for given input size
 auto get_optimal_gpu_config(size_t input_size, gpu_backend backend) -> gpu_parse_config;
 
+// ============================================================================
+// GPU/CPU Crossover Calibration
+// ============================================================================
+// Replaces the hardcoded min_size_for_gpu guess with a measured, per-machine
+// crossover. Calibration times the CPU stage-1 scan and the GPU parse over a
+// few synthetic document sizes, fits the GPU cost as fixed_overhead +
+// size/bandwidth, and solves for the input size where the GPU starts
+// winning. The fit runs once per process (first call), or a profile saved by
+// an earlier run can be loaded so startup pays nothing. parse_auto() then
+// routes each input to the CPU SIMD scanner or the GPU on the measured
+// crossover instead of any one fleet-wide threshold.
+
+struct gpu_calibration {
+    bool gpu_usable = false;           // A GPU backend ran during calibration
+    double cpu_bytes_per_ms = 0.0;     // Measured CPU stage-1 scan rate
+    double gpu_bytes_per_ms = 0.0;     // Fitted GPU marginal rate
+    double gpu_overhead_ms = 0.0;      // Fitted per-call GPU fixed cost
+    size_t crossover_bytes = SIZE_MAX; // Inputs >= this route to the GPU
+};
+
+// Measure (or return the already-measured) calibration for this machine.
+// Thread-safe; the measurement runs at most once per process.
+auto calibrate_gpu_crossover() -> const gpu_calibration&;
+
+// Install a previously saved profile, bypassing measurement.
+auto set_gpu_calibration(const gpu_calibration& profile) -> void;
+
+// Persist / restore a profile (small key=value text file). load returns
+// std::nullopt when the file is missing or malformed.
+auto save_gpu_calibration(const gpu_calibration& profile, const std::string& path) -> bool;
+auto load_gpu_calibration(const std::string& path) -> std::optional<gpu_calibration>;
+
+// Stage-1 structural scan routed by measured crossover: inputs below the
+// crossover (or when no GPU is usable) take the CPU SIMD scanner, larger
+// ones take the GPU with a CPU fallback if the GPU path declines the input.
+// The result feeds tape::tape_document::parse_with_index either way.
+auto parse_auto(std::string_view input, const gpu_parse_config& config = {})
+    -> std::vector<structural_index>;
+
 }  // namespace gpu
 }  // namespace fastjson
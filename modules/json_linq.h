@@ -1,23 +1,295 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <set>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <omp.h>
 
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
+#ifdef FASTJSON_USE_PARALLEL_STL
+    #include <execution>
+#endif
+
+#ifdef FASTJSON_LINQ_NUMA
+    #include "numa_allocator.h"
+#endif
+
 namespace fastjson {
 namespace linq {
 
+// ============================================================================
+// SIMD Horizontal Reductions
+// ============================================================================
+// Terminal aggregations over contiguous arithmetic data (a vector of numbers,
+// or a column pulled out by columnar::extract_column) were scalar
+// accumulation loops that leave most of the memory bandwidth unused. These
+// kernels reduce 256 bits per step on AVX2 hardware and fall back to the
+// scalar loop elsewhere, runtime-dispatched the same way fastjson_simd_api
+// detects capabilities (__builtin_cpu_supports). Floating-point sums are
+// reassociated by the vectorization, so the last few ulps can differ from a
+// strictly left-to-right fold; floating columns holding NaN missing-value
+// markers should be filtered before min/max.
+
+namespace simd_detail {
+
+inline auto has_avx2() -> bool {
+#if defined(__x86_64__) || defined(_M_X64)
+    static const bool detected = __builtin_cpu_supports("avx2");
+    return detected;
+#else
+    return false;
+#endif
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+__attribute__((target("avx2"))) inline auto sum_f64_avx2(const double* data, size_t n)
+    -> double {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+        acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(data + i + 4));
+    }
+    acc0 = _mm256_add_pd(acc0, acc1);
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc0);
+    double total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < n; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+// Callers guarantee n >= 4 for the min/max kernels
+__attribute__((target("avx2"))) inline auto min_f64_avx2(const double* data, size_t n)
+    -> double {
+    __m256d acc = _mm256_loadu_pd(data);
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_min_pd(acc, _mm256_loadu_pd(data + i));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    double result = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+    for (; i < n; ++i) {
+        result = std::min(result, data[i]);
+    }
+    return result;
+}
+
+__attribute__((target("avx2"))) inline auto max_f64_avx2(const double* data, size_t n)
+    -> double {
+    __m256d acc = _mm256_loadu_pd(data);
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_max_pd(acc, _mm256_loadu_pd(data + i));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    double result = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    for (; i < n; ++i) {
+        result = std::max(result, data[i]);
+    }
+    return result;
+}
+
+__attribute__((target("avx2"))) inline auto sum_i64_avx2(const int64_t* data, size_t n)
+    -> int64_t {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_add_epi64(acc,
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    }
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    int64_t total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+__attribute__((target("avx2"))) inline auto sum_i32_avx2(const int32_t* data, size_t n)
+    -> int32_t {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_add_epi32(acc,
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    }
+    alignas(32) int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    int32_t total = 0;
+    for (int32_t lane : lanes) {
+        total += lane;
+    }
+    for (; i < n; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+__attribute__((target("avx2"))) inline auto min_i32_avx2(const int32_t* data, size_t n)
+    -> int32_t {
+    __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_min_epi32(acc,
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    }
+    alignas(32) int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    int32_t result = lanes[0];
+    for (int lane = 1; lane < 8; ++lane) {
+        result = std::min(result, lanes[lane]);
+    }
+    for (; i < n; ++i) {
+        result = std::min(result, data[i]);
+    }
+    return result;
+}
+
+__attribute__((target("avx2"))) inline auto max_i32_avx2(const int32_t* data, size_t n)
+    -> int32_t {
+    __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_max_epi32(acc,
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    }
+    alignas(32) int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    int32_t result = lanes[0];
+    for (int lane = 1; lane < 8; ++lane) {
+        result = std::max(result, lanes[lane]);
+    }
+    for (; i < n; ++i) {
+        result = std::max(result, data[i]);
+    }
+    return result;
+}
+
+#endif  // x86-64
+
+// Dispatch entry points. Types without a dedicated kernel (float, short
+// integers, unsigned) take the scalar loop; int64 min/max stay scalar because
+// AVX2 has no 64-bit integer min/max instruction.
+
+template <typename T> auto sum_span(std::span<const T> values) -> T {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (has_avx2()) {
+        if constexpr (std::is_same_v<T, double>) {
+            return sum_f64_avx2(values.data(), values.size());
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            return sum_i64_avx2(values.data(), values.size());
+        } else if constexpr (std::is_same_v<T, int32_t>) {
+            return sum_i32_avx2(values.data(), values.size());
+        }
+    }
+#endif
+    T total{};
+    for (const T& value : values) {
+        total += value;
+    }
+    return total;
+}
+
+// Callers guarantee a non-empty span
+template <typename T> auto min_span(std::span<const T> values) -> T {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (has_avx2()) {
+        if constexpr (std::is_same_v<T, double>) {
+            if (values.size() >= 4) {
+                return min_f64_avx2(values.data(), values.size());
+            }
+        } else if constexpr (std::is_same_v<T, int32_t>) {
+            if (values.size() >= 8) {
+                return min_i32_avx2(values.data(), values.size());
+            }
+        }
+    }
+#endif
+    T result = values[0];
+    for (size_t i = 1; i < values.size(); ++i) {
+        result = std::min(result, values[i]);
+    }
+    return result;
+}
+
+template <typename T> auto max_span(std::span<const T> values) -> T {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (has_avx2()) {
+        if constexpr (std::is_same_v<T, double>) {
+            if (values.size() >= 4) {
+                return max_f64_avx2(values.data(), values.size());
+            }
+        } else if constexpr (std::is_same_v<T, int32_t>) {
+            if (values.size() >= 8) {
+                return max_i32_avx2(values.data(), values.size());
+            }
+        }
+    }
+#endif
+    T result = values[0];
+    for (size_t i = 1; i < values.size(); ++i) {
+        result = std::max(result, values[i]);
+    }
+    return result;
+}
+
+}  // namespace simd_detail
+
+// Reductions over a raw contiguous column, e.g.
+// columnar::extract_column<double>(json, "price")->values() - no copy into a
+// query_result, the kernel reads the aligned column buffer directly.
+template <typename T> auto sum(std::span<const T> values) -> T {
+    static_assert(std::is_arithmetic_v<T>, "sum requires a numeric column type");
+    return simd_detail::sum_span(values);
+}
+
+template <typename T> auto min(std::span<const T> values) -> std::optional<T> {
+    static_assert(std::is_arithmetic_v<T>, "min requires a numeric column type");
+    if (values.empty())
+        return std::nullopt;
+    return simd_detail::min_span(values);
+}
+
+template <typename T> auto max(std::span<const T> values) -> std::optional<T> {
+    static_assert(std::is_arithmetic_v<T>, "max requires a numeric column type");
+    if (values.empty())
+        return std::nullopt;
+    return simd_detail::max_span(values);
+}
+
+template <typename T> auto average(std::span<const T> values) -> std::optional<double> {
+    static_assert(std::is_arithmetic_v<T>, "average requires a numeric column type");
+    if (values.empty())
+        return std::nullopt;
+    return static_cast<double>(simd_detail::sum_span(values)) / values.size();
+}
+
 // ============================================================================
 // LINQ Query Result - Lazy evaluation container
 // ============================================================================
 
+template <typename T> class lazy_source;
+
 template <typename T> class query_result {
 public:
     using value_type = T;
@@ -296,6 +568,33 @@ public:
         return static_cast<double>(sum_val) / data_.size();
     }
 
+    // Selector-free aggregations: when T is itself arithmetic the elements
+    // are a contiguous column and the reduction dispatches to the SIMD
+    // kernels at the top of this header instead of a scalar fold.
+    auto sum() const -> T
+        requires std::is_arithmetic_v<T>
+    {
+        return linq::sum(std::span<const T>(data_.data(), data_.size()));
+    }
+
+    auto min() const -> std::optional<T>
+        requires std::is_arithmetic_v<T>
+    {
+        return linq::min(std::span<const T>(data_.data(), data_.size()));
+    }
+
+    auto max() const -> std::optional<T>
+        requires std::is_arithmetic_v<T>
+    {
+        return linq::max(std::span<const T>(data_.data(), data_.size()));
+    }
+
+    auto average() const -> std::optional<double>
+        requires std::is_arithmetic_v<T>
+    {
+        return linq::average(std::span<const T>(data_.data(), data_.size()));
+    }
+
     // LINQ operations - DISTINCT
     query_result<T> distinct() const {
         std::set<T> unique(data_.begin(), data_.end());
@@ -363,7 +662,11 @@ public:
         return groups;
     }
 
-    // LINQ operations - JOIN
+    // LINQ operations - JOIN (build/probe hash join)
+    // Builds the smaller side into a hash map keyed by its key selector and
+    // probes with the larger, replacing the old O(n*m) nested loop. Output
+    // order matches the nested loop: this-side major, other-side order within
+    // each match group. Keys must be hashable (std::hash) and comparable.
     template <typename TOther, typename KeySelector1, typename KeySelector2,
               typename ResultSelector>
     auto join(const query_result<TOther>& other, KeySelector1 key_selector1,
@@ -372,12 +675,44 @@ public:
         using R = decltype(result_selector(std::declval<T>(), std::declval<TOther>()));
         std::vector<R> result;
 
-        for (const auto& item1 : data_) {
-            auto key1 = key_selector1(item1);
+        if (data_.size() <= other.size()) {
+            // Build on this side, probe the other. Matches are bucketed by
+            // left index so the flattened output keeps left-major order.
+            using K = std::decay_t<decltype(key_selector1(std::declval<T>()))>;
+            std::unordered_map<K, std::vector<size_t>> build;
+            build.reserve(data_.size());
+            for (size_t i = 0; i < data_.size(); ++i) {
+                build[key_selector1(data_[i])].push_back(i);
+            }
+
+            std::vector<std::vector<R>> buckets(data_.size());
             for (const auto& item2 : other) {
-                auto key2 = key_selector2(item2);
-                if (key1 == key2) {
-                    result.push_back(result_selector(item1, item2));
+                auto it = build.find(key_selector2(item2));
+                if (it == build.end())
+                    continue;
+                for (size_t i : it->second) {
+                    buckets[i].push_back(result_selector(data_[i], item2));
+                }
+            }
+            for (auto& bucket : buckets) {
+                result.insert(result.end(), std::make_move_iterator(bucket.begin()),
+                              std::make_move_iterator(bucket.end()));
+            }
+        } else {
+            // Build on the other (smaller) side, probe with this one.
+            using K = std::decay_t<decltype(key_selector2(std::declval<TOther>()))>;
+            std::unordered_map<K, std::vector<size_t>> build;
+            build.reserve(other.size());
+            for (size_t i = 0; i < other.size(); ++i) {
+                build[key_selector2(other[i])].push_back(i);
+            }
+
+            for (const auto& item1 : data_) {
+                auto it = build.find(key_selector1(item1));
+                if (it == build.end())
+                    continue;
+                for (size_t i : it->second) {
+                    result.push_back(result_selector(item1, other[i]));
                 }
             }
         }
@@ -460,10 +795,292 @@ public:
         return Container(data_.begin(), data_.end());
     }
 
+    // Lazy entry point: returns a fused view over this result's data. Chained
+    // where/select/take stages compose without materializing intermediate
+    // vectors; only terminal operations (to_vector, sum, first, ...) run the
+    // pipeline. The view references this query_result and must not outlive it.
+    lazy_source<T> lazy() const;
+
 private:
     std::vector<T> data_;
 };
 
+// ============================================================================
+// Lazy Query Views - Fused Single-Pass Pipelines
+// ============================================================================
+// Each eager query_result stage copies its input into a fresh vector, so a
+// .where().select().take(10) over 1M elements allocates three million-element
+// vectors. These views compose the stages instead: each adaptor holds its
+// upstream by value and pushes elements through a sink, so the whole chain
+// runs as one pass with no intermediate storage and stops as soon as a
+// limiting stage (take, first) is satisfied.
+
+template <typename Prev, typename Pred> class lazy_where_view;
+template <typename Prev, typename Func> class lazy_select_view;
+template <typename Prev> class lazy_take_view;
+template <typename Prev> class lazy_skip_view;
+template <typename Prev, typename Pred> class lazy_take_while_view;
+
+// CRTP base supplying the fluent adaptors and terminal operations. Derived
+// views implement scan(sink): push each element into sink, stopping (and
+// returning false) as soon as sink returns false.
+template <typename Derived> class lazy_view {
+public:
+    template <typename Pred> lazy_where_view<Derived, Pred> where(Pred pred) const {
+        return lazy_where_view<Derived, Pred>(self(), std::move(pred));
+    }
+
+    template <typename Pred> lazy_where_view<Derived, Pred> filter(Pred pred) const {
+        return where(std::move(pred));
+    }
+
+    template <typename Func> lazy_select_view<Derived, Func> select(Func func) const {
+        return lazy_select_view<Derived, Func>(self(), std::move(func));
+    }
+
+    template <typename Func> lazy_select_view<Derived, Func> map(Func func) const {
+        return select(std::move(func));
+    }
+
+    lazy_take_view<Derived> take(size_t n) const { return lazy_take_view<Derived>(self(), n); }
+
+    lazy_skip_view<Derived> skip(size_t n) const { return lazy_skip_view<Derived>(self(), n); }
+
+    template <typename Pred> lazy_take_while_view<Derived, Pred> take_while(Pred pred) const {
+        return lazy_take_while_view<Derived, Pred>(self(), std::move(pred));
+    }
+
+    // ------------------------------------------------------------------------
+    // Terminal operations - the only points where the pipeline actually runs
+    // ------------------------------------------------------------------------
+
+    auto to_vector() const {
+        using R = typename Derived::value_type;
+        std::vector<R> result;
+        self().scan([&](const R& item) {
+            result.push_back(item);
+            return true;
+        });
+        return result;
+    }
+
+    auto to_query() const {
+        using R = typename Derived::value_type;
+        return query_result<R>(to_vector());
+    }
+
+    auto first() const {
+        using R = typename Derived::value_type;
+        std::optional<R> result;
+        self().scan([&](const R& item) {
+            result = item;
+            return false;  // One element is enough; stop the whole chain
+        });
+        return result;
+    }
+
+    size_t count() const {
+        using R = typename Derived::value_type;
+        size_t n = 0;
+        self().scan([&](const R&) {
+            ++n;
+            return true;
+        });
+        return n;
+    }
+
+    template <typename Predicate> bool any(Predicate pred) const {
+        using R = typename Derived::value_type;
+        bool found = false;
+        self().scan([&](const R& item) {
+            if (pred(item)) {
+                found = true;
+                return false;
+            }
+            return true;
+        });
+        return found;
+    }
+
+    template <typename Predicate> bool all(Predicate pred) const {
+        using R = typename Derived::value_type;
+        bool ok = true;
+        self().scan([&](const R& item) {
+            if (!pred(item)) {
+                ok = false;
+                return false;
+            }
+            return true;
+        });
+        return ok;
+    }
+
+    template <typename Selector> auto sum(Selector selector) const {
+        using R = decltype(selector(std::declval<typename Derived::value_type>()));
+        R total = R{};
+        self().scan([&](const auto& item) {
+            total += selector(item);
+            return true;
+        });
+        return total;
+    }
+
+    template <typename Acc, typename Func> Acc aggregate(Acc seed, Func func) const {
+        Acc acc = seed;
+        self().scan([&](const auto& item) {
+            acc = func(acc, item);
+            return true;
+        });
+        return acc;
+    }
+
+    template <typename Acc, typename Func> Acc reduce(Acc seed, Func func) const {
+        return aggregate(seed, func);
+    }
+
+    template <typename Action> void for_each(Action action) const {
+        self().scan([&](const auto& item) {
+            action(item);
+            return true;
+        });
+    }
+
+    template <typename Action> void forEach(Action action) const { for_each(action); }
+
+private:
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+};
+
+// Leaf view over an existing vector. Holds a pointer, not a copy: the source
+// container must outlive every pipeline built from it.
+template <typename T> class lazy_source : public lazy_view<lazy_source<T>> {
+public:
+    using value_type = T;
+
+    explicit lazy_source(const std::vector<T>& data) : data_(&data) {}
+
+    template <typename Sink> bool scan(Sink&& sink) const {
+        for (const auto& item : *data_) {
+            if (!sink(item))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    const std::vector<T>* data_;
+};
+
+template <typename Prev, typename Pred>
+class lazy_where_view : public lazy_view<lazy_where_view<Prev, Pred>> {
+public:
+    using value_type = typename Prev::value_type;
+
+    lazy_where_view(Prev prev, Pred pred) : prev_(std::move(prev)), pred_(std::move(pred)) {}
+
+    template <typename Sink> bool scan(Sink&& sink) const {
+        return prev_.scan([&](const value_type& item) {
+            if (!pred_(item))
+                return true;  // Filtered out; keep scanning
+            return static_cast<bool>(sink(item));
+        });
+    }
+
+private:
+    Prev prev_;
+    Pred pred_;
+};
+
+template <typename Prev, typename Func>
+class lazy_select_view : public lazy_view<lazy_select_view<Prev, Func>> {
+public:
+    using value_type = decltype(std::declval<Func>()(std::declval<typename Prev::value_type>()));
+
+    lazy_select_view(Prev prev, Func func) : prev_(std::move(prev)), func_(std::move(func)) {}
+
+    template <typename Sink> bool scan(Sink&& sink) const {
+        return prev_.scan([&](const typename Prev::value_type& item) {
+            return static_cast<bool>(sink(func_(item)));
+        });
+    }
+
+private:
+    Prev prev_;
+    Func func_;
+};
+
+template <typename Prev> class lazy_take_view : public lazy_view<lazy_take_view<Prev>> {
+public:
+    using value_type = typename Prev::value_type;
+
+    lazy_take_view(Prev prev, size_t n) : prev_(std::move(prev)), n_(n) {}
+
+    template <typename Sink> bool scan(Sink&& sink) const {
+        if (n_ == 0)
+            return true;
+        size_t remaining = n_;
+        return prev_.scan([&](const value_type& item) {
+            if (!sink(item))
+                return false;
+            return --remaining > 0;  // Quota reached: stop the upstream scan
+        });
+    }
+
+private:
+    Prev prev_;
+    size_t n_;
+};
+
+template <typename Prev> class lazy_skip_view : public lazy_view<lazy_skip_view<Prev>> {
+public:
+    using value_type = typename Prev::value_type;
+
+    lazy_skip_view(Prev prev, size_t n) : prev_(std::move(prev)), n_(n) {}
+
+    template <typename Sink> bool scan(Sink&& sink) const {
+        size_t to_skip = n_;
+        return prev_.scan([&](const value_type& item) {
+            if (to_skip > 0) {
+                --to_skip;
+                return true;
+            }
+            return static_cast<bool>(sink(item));
+        });
+    }
+
+private:
+    Prev prev_;
+    size_t n_;
+};
+
+template <typename Prev, typename Pred>
+class lazy_take_while_view : public lazy_view<lazy_take_while_view<Prev, Pred>> {
+public:
+    using value_type = typename Prev::value_type;
+
+    lazy_take_while_view(Prev prev, Pred pred) : prev_(std::move(prev)), pred_(std::move(pred)) {}
+
+    template <typename Sink> bool scan(Sink&& sink) const {
+        return prev_.scan([&](const value_type& item) {
+            if (!pred_(item))
+                return false;  // Predicate failed: stop the whole chain
+            return static_cast<bool>(sink(item));
+        });
+    }
+
+private:
+    Prev prev_;
+    Pred pred_;
+};
+
+template <typename T> lazy_source<T> query_result<T>::lazy() const { return lazy_source<T>(data_); }
+
+// Build a lazy pipeline directly from a vector, without an eager copy into a
+// query_result first. The vector must outlive the pipeline.
+template <typename T> lazy_source<T> lazy_from(const std::vector<T>& vec) {
+    return lazy_source<T>(vec);
+}
+
 // ============================================================================
 // Parallel LINQ Query Result - Thread-safe parallel operations
 // ============================================================================
@@ -474,14 +1091,37 @@ public:
 
     explicit parallel_query_result(std::vector<T>&& data) : data_(std::move(data)) {}
 
+    // NUMA-aware partitioning mode (builds with FASTJSON_LINQ_NUMA only;
+    // otherwise the flag is carried but ignored). The OpenMP default
+    // schedule is oblivious to where the data's pages live, so on multi-
+    // socket machines half the element loads cross the interconnect. With
+    // the mode enabled, where/select/for_each/sum split the range into one
+    // contiguous block per NUMA node, bind each worker to its node via
+    // numa::bind_thread_to_numa_node, and keep the flag across chained
+    // operations - so the pages a select result first-touches are then
+    // local to the workers the next stage runs on that node. The benefit
+    // assumes the source pages are block-distributed the same way (produced
+    // by a prior partitioned stage, or first-touched block-wise).
+    auto with_numa_partitioning(bool enable = true) const -> parallel_query_result<T> {
+        parallel_query_result<T> result{std::vector<T>(data_)};
+        result.numa_aware_ = enable;
+        return result;
+    }
+
     // Parallel WHERE
     template <typename Predicate> parallel_query_result<T> where(Predicate pred) const {
-        std::vector<T> result(data_.size());
         std::vector<bool> keep(data_.size());
 
+#ifdef FASTJSON_LINQ_NUMA
+        if (numa_aware_) {
+            numa_partitioned_for(data_.size(), [&](size_t i) { keep[i] = pred(data_[i]); });
+        } else
+#endif
+        {
 #pragma omp parallel for schedule(static)
-        for (size_t i = 0; i < data_.size(); ++i) {
-            keep[i] = pred(data_[i]);
+            for (size_t i = 0; i < data_.size(); ++i) {
+                keep[i] = pred(data_[i]);
+            }
         }
 
         // Sequential compaction
@@ -493,7 +1133,9 @@ public:
             }
         }
 
-        return parallel_query_result<T>(std::move(compacted));
+        parallel_query_result<T> result(std::move(compacted));
+        result.numa_aware_ = numa_aware_;
+        return result;
     }
 
     // Alias: filter (functional programming style)
@@ -507,12 +1149,21 @@ public:
         using R = decltype(func(std::declval<T>()));
         std::vector<R> result(data_.size());
 
+#ifdef FASTJSON_LINQ_NUMA
+        if (numa_aware_) {
+            numa_partitioned_for(data_.size(), [&](size_t i) { result[i] = func(data_[i]); });
+        } else
+#endif
+        {
 #pragma omp parallel for schedule(static)
-        for (size_t i = 0; i < data_.size(); ++i) {
-            result[i] = func(data_[i]);
+            for (size_t i = 0; i < data_.size(); ++i) {
+                result[i] = func(data_[i]);
+            }
         }
 
-        return parallel_query_result<R>(std::move(result));
+        parallel_query_result<R> mapped(std::move(result));
+        mapped.numa_aware_ = numa_aware_;
+        return mapped;
     }
 
     // Alias: map (functional programming style)
@@ -540,6 +1191,12 @@ public:
 
     // Parallel FOREACH - Execute action for each element
     template <typename Action> void for_each(Action action) const {
+#ifdef FASTJSON_LINQ_NUMA
+        if (numa_aware_) {
+            numa_partitioned_for(data_.size(), [&](size_t i) { action(data_[i]); });
+            return;
+        }
+#endif
 #pragma omp parallel for schedule(static)
         for (size_t i = 0; i < data_.size(); ++i) {
             action(data_[i]);
@@ -639,6 +1296,19 @@ public:
         using R = decltype(selector(std::declval<T>()));
         R result = R{};
 
+#ifdef FASTJSON_LINQ_NUMA
+        if (numa_aware_) {
+            std::vector<R> partials(omp_get_max_threads(), R{});
+            numa_partitioned_for(data_.size(), [&](size_t i) {
+                partials[omp_get_thread_num()] += selector(data_[i]);
+            });
+            for (const R& partial : partials) {
+                result += partial;
+            }
+            return result;
+        }
+#endif
+
 #pragma omp parallel for reduction(+ : result)
         for (size_t i = 0; i < data_.size(); ++i) {
             result += selector(data_[i]);
@@ -753,23 +1423,227 @@ public:
         return all_true;
     }
 
+    // Parallel JOIN (build/probe hash join)
+    // The smaller side is built into a hash map sequentially; the probe pass
+    // runs in parallel with per-thread result buffers. schedule(static) gives
+    // each thread a contiguous probe range, so concatenating the buffers in
+    // thread order preserves probe-side-major output order.
+    template <typename TOther, typename KeySelector1, typename KeySelector2,
+              typename ResultSelector>
+    auto join(const parallel_query_result<TOther>& other, KeySelector1 key_selector1,
+              KeySelector2 key_selector2, ResultSelector result_selector) const
+        -> parallel_query_result<
+            decltype(result_selector(std::declval<T>(), std::declval<TOther>()))> {
+        using R = decltype(result_selector(std::declval<T>(), std::declval<TOther>()));
+        using K = std::decay_t<decltype(key_selector2(std::declval<TOther>()))>;
+
+        std::unordered_map<K, std::vector<size_t>> build;
+        build.reserve(other.data_.size());
+        for (size_t i = 0; i < other.data_.size(); ++i) {
+            build[key_selector2(other.data_[i])].push_back(i);
+        }
+
+        int num_threads = omp_get_max_threads();
+        std::vector<std::vector<R>> thread_results(num_threads);
+
+#pragma omp parallel
+        {
+            auto& local = thread_results[omp_get_thread_num()];
+#pragma omp for schedule(static) nowait
+            for (size_t i = 0; i < data_.size(); ++i) {
+                auto it = build.find(key_selector1(data_[i]));
+                if (it == build.end())
+                    continue;
+                for (size_t j : it->second) {
+                    local.push_back(result_selector(data_[i], other.data_[j]));
+                }
+            }
+        }
+
+        std::vector<R> result;
+        for (auto& local : thread_results) {
+            result.insert(result.end(), std::make_move_iterator(local.begin()),
+                          std::make_move_iterator(local.end()));
+        }
+        return parallel_query_result<R>(std::move(result));
+    }
+
+    // Parallel GROUP BY
+    // Each thread groups its static-schedule chunk into a private hash map,
+    // then the per-thread maps are merged sequentially in thread order. With
+    // schedule(static) every thread owns a contiguous range of data_, so
+    // thread-order merging preserves source order within each group - the
+    // same result the sequential group_by produces. Returns the same
+    // std::map shape so the two are drop-in replacements for each other.
+    template <typename KeySelector>
+    auto group_by(KeySelector key_selector) const
+        -> std::map<std::decay_t<decltype(key_selector(std::declval<T>()))>, std::vector<T>> {
+        using K = std::decay_t<decltype(key_selector(std::declval<T>()))>;
+
+        int num_threads = omp_get_max_threads();
+        std::vector<std::unordered_map<K, std::vector<T>>> locals(num_threads);
+
+#pragma omp parallel
+        {
+            auto& local = locals[omp_get_thread_num()];
+#pragma omp for schedule(static) nowait
+            for (size_t i = 0; i < data_.size(); ++i) {
+                local[key_selector(data_[i])].push_back(data_[i]);
+            }
+        }
+
+        std::map<K, std::vector<T>> groups;
+        for (auto& local : locals) {
+            for (auto& [key, items] : local) {
+                auto& group = groups[key];
+                group.insert(group.end(), std::make_move_iterator(items.begin()),
+                             std::make_move_iterator(items.end()));
+            }
+        }
+        return groups;
+    }
+
+    // Fused GROUP BY + AGGREGATE - one parallel pass, no per-group vectors
+    // group_by(k).then-sum materializes every group before folding it; for
+    // aggregation-only queries that allocation is pure overhead. Here each
+    // thread folds its chunk directly into per-key accumulators with
+    // `accumulate(acc, item)`, and the per-thread partials are merged with
+    // `combine(acc, acc)` - the combiner must agree with the accumulator
+    // (e.g. both addition) for the result to be schedule-independent.
+    template <typename KeySelector, typename Acc, typename Accumulate, typename Combine>
+    auto group_by_aggregate(KeySelector key_selector, Acc seed, Accumulate accumulate,
+                            Combine combine) const
+        -> std::map<std::decay_t<decltype(key_selector(std::declval<T>()))>, Acc> {
+        using K = std::decay_t<decltype(key_selector(std::declval<T>()))>;
+
+        int num_threads = omp_get_max_threads();
+        std::vector<std::unordered_map<K, Acc>> locals(num_threads);
+
+#pragma omp parallel
+        {
+            auto& local = locals[omp_get_thread_num()];
+#pragma omp for schedule(static) nowait
+            for (size_t i = 0; i < data_.size(); ++i) {
+                auto [it, inserted] = local.try_emplace(key_selector(data_[i]), seed);
+                it->second = accumulate(it->second, data_[i]);
+            }
+        }
+
+        std::map<K, Acc> result;
+        for (auto& local : locals) {
+            for (auto& [key, acc] : local) {
+                auto [it, inserted] = result.try_emplace(key, std::move(acc));
+                if (!inserted) {
+                    it->second = combine(it->second, acc);
+                }
+            }
+        }
+        return result;
+    }
+
+    // Fused GROUP BY + SUM over a value selector
+    template <typename KeySelector, typename ValueSelector>
+    auto group_by_sum(KeySelector key_selector, ValueSelector value_selector) const
+        -> std::map<std::decay_t<decltype(key_selector(std::declval<T>()))>,
+                    decltype(value_selector(std::declval<T>()))> {
+        using V = decltype(value_selector(std::declval<T>()));
+        return group_by_aggregate(
+            key_selector, V{},
+            [&value_selector](const V& acc, const T& item) { return acc + value_selector(item); },
+            [](const V& a, const V& b) { return a + b; });
+    }
+
+    // Fused GROUP BY + COUNT
+    template <typename KeySelector>
+    auto group_by_count(KeySelector key_selector) const
+        -> std::map<std::decay_t<decltype(key_selector(std::declval<T>()))>, size_t> {
+        return group_by_aggregate(
+            key_selector, size_t{0}, [](size_t acc, const T&) { return acc + 1; },
+            [](size_t a, size_t b) { return a + b; });
+    }
+
     // Parallel ORDER BY (parallel sort)
+    // With the Parallel STL enabled this runs a real multi-threaded sort;
+    // otherwise it falls back to sequential std::sort.
     template <typename KeySelector>
     parallel_query_result<T> order_by(KeySelector key_selector) const {
         std::vector<T> result = data_;
+        auto cmp = [&key_selector](const T& a, const T& b) {
+            return key_selector(a) < key_selector(b);
+        };
+
+#ifdef FASTJSON_USE_PARALLEL_STL
+        std::sort(std::execution::par_unseq, result.begin(), result.end(), cmp);
+#else
+        std::sort(result.begin(), result.end(), cmp);
+#endif
+
+        return parallel_query_result<T>(std::move(result));
+    }
+
+    template <typename KeySelector>
+    parallel_query_result<T> order_by_descending(KeySelector key_selector) const {
+        std::vector<T> result = data_;
+        auto cmp = [&key_selector](const T& a, const T& b) {
+            return key_selector(a) > key_selector(b);
+        };
+
+#ifdef FASTJSON_USE_PARALLEL_STL
+        std::sort(std::execution::par_unseq, result.begin(), result.end(), cmp);
+#else
+        std::sort(result.begin(), result.end(), cmp);
+#endif
+
+        return parallel_query_result<T>(std::move(result));
+    }
+
+    // Parallel TOP-K selection (descending by selector)
+    // Partial heap selection instead of a full sort: each thread keeps a
+    // k-element min-heap over its chunk, then the num_threads*k candidates
+    // are partially sorted once. A top-100-of-10M query touches every
+    // element exactly once and never sorts the other 9,999,900.
+    template <typename Selector>
+    parallel_query_result<T> top_k(size_t k, Selector selector) const {
+        if (k == 0 || data_.empty())
+            return parallel_query_result<T>(std::vector<T>());
+        k = std::min(k, data_.size());
+
+        auto greater = [&selector](const T& a, const T& b) { return selector(a) > selector(b); };
+
+        int num_threads = omp_get_max_threads();
+        std::vector<std::vector<T>> candidates(num_threads);
 
-// Use parallel sort with OpenMP tasks
 #pragma omp parallel
         {
-#pragma omp single
-            {
-                std::sort(result.begin(), result.end(), [&key_selector](const T& a, const T& b) {
-                    return key_selector(a) < key_selector(b);
-                });
+            auto& local = candidates[omp_get_thread_num()];
+            local.reserve(k);
+
+// Min-heap by selector: local.front() is the weakest of the current top k
+#pragma omp for schedule(static) nowait
+            for (size_t i = 0; i < data_.size(); ++i) {
+                if (local.size() < k) {
+                    local.push_back(data_[i]);
+                    std::push_heap(local.begin(), local.end(), greater);
+                } else if (selector(data_[i]) > selector(local.front())) {
+                    std::pop_heap(local.begin(), local.end(), greater);
+                    local.back() = data_[i];
+                    std::push_heap(local.begin(), local.end(), greater);
+                }
             }
         }
 
-        return parallel_query_result<T>(std::move(result));
+        std::vector<T> merged;
+        merged.reserve(static_cast<size_t>(num_threads) * k);
+        for (auto& local : candidates) {
+            merged.insert(merged.end(), std::make_move_iterator(local.begin()),
+                          std::make_move_iterator(local.end()));
+        }
+
+        k = std::min(k, merged.size());
+        std::partial_sort(merged.begin(), merged.begin() + static_cast<ptrdiff_t>(k),
+                          merged.end(), greater);
+        merged.resize(k);
+        return parallel_query_result<T>(std::move(merged));
     }
 
     // Convert to sequential query
@@ -783,7 +1657,71 @@ public:
     bool empty() const { return data_.empty(); }
 
 private:
+    template <typename U> friend class parallel_query_result;
+
+#ifdef FASTJSON_LINQ_NUMA
+    // Splits [0, n) into one contiguous range per NUMA node, subdivides each
+    // range among the threads the round-robin thread->node map
+    // (numa::get_optimal_node_for_thread) places on that node, and binds each
+    // worker to its node before it touches its chunk. The bind is cached per
+    // thread so steady-state queries pay no sched_setaffinity calls. Small
+    // ranges fall back to the plain static schedule - below
+    // min_work_per_node elements per node the migration cost outweighs any
+    // locality win.
+    template <typename Body> static void numa_partitioned_for(size_t n, Body body) {
+        static const int num_nodes = [] {
+            auto topo = numa::detect_numa_topology();
+            return topo.is_numa_available ? topo.num_nodes : 1;
+        }();
+
+        size_t min_work = static_cast<size_t>(numa::numa_parallel_config{}.min_work_per_node);
+        if (num_nodes <= 1 || n < min_work * static_cast<size_t>(num_nodes)) {
+#pragma omp parallel for schedule(static)
+            for (size_t i = 0; i < n; ++i) {
+                body(i);
+            }
+            return;
+        }
+
+#pragma omp parallel
+        {
+            int tid = omp_get_thread_num();
+            int nthreads = omp_get_num_threads();
+            // With fewer threads than nodes the surplus nodes host nobody;
+            // partition over the hosted nodes only so no range is orphaned
+            int hosted_nodes = std::min(num_nodes, nthreads);
+            int node = numa::get_optimal_node_for_thread(tid, nthreads, hosted_nodes);
+
+            static thread_local int bound_node = -1;
+            if (bound_node != node) {
+                numa::bind_thread_to_numa_node(node);
+                bound_node = node;
+            }
+
+            // tid % hosted_nodes == node, so this thread's rank within its
+            // node is tid / hosted_nodes; node k hosts one extra thread
+            // while k < nthreads % hosted_nodes
+            int rank_in_node = tid / hosted_nodes;
+            int threads_on_node =
+                nthreads / hosted_nodes + (node < nthreads % hosted_nodes ? 1 : 0);
+            if (threads_on_node > 0 && rank_in_node < threads_on_node) {
+                size_t node_begin = n * static_cast<size_t>(node) / hosted_nodes;
+                size_t node_end = n * (static_cast<size_t>(node) + 1) / hosted_nodes;
+                size_t span = node_end - node_begin;
+                size_t begin =
+                    node_begin + span * static_cast<size_t>(rank_in_node) / threads_on_node;
+                size_t end = node_begin +
+                             span * (static_cast<size_t>(rank_in_node) + 1) / threads_on_node;
+                for (size_t i = begin; i < end; ++i) {
+                    body(i);
+                }
+            }
+        }
+    }
+#endif  // FASTJSON_LINQ_NUMA
+
     std::vector<T> data_;
+    bool numa_aware_ = false;
 };
 
 // ============================================================================
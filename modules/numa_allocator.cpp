@@ -14,6 +14,7 @@
 #ifdef __linux__
     #include <pthread.h>
     #include <sched.h>
+    #include <sys/mman.h>
 #endif
 
 namespace fastjson {
@@ -247,10 +248,59 @@ auto numa_allocator::allocate_local(size_t size) -> void* {
     return ptr;
 }
 
+auto numa_allocator::allocate_huge(size_t size, int preferred_node) -> void* {
+#ifdef __linux__
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    size_t rounded = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+
+    // Explicit huge pages first (needs a pre-reserved vm.nr_hugepages pool)
+    void* ptr = ::mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr == MAP_FAILED) {
+        // No reserved pool: anonymous mapping promoted by transparent huge
+        // pages. khugepaged may take a moment, but the first-pass parse
+        // touches pages sequentially, which THP handles well.
+        ptr = ::mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) {
+            return allocate(size, preferred_node);
+        }
+        ::madvise(ptr, rounded, MADV_HUGEPAGE);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(huge_mutex_);
+        huge_regions_[ptr] = rounded;
+    }
+
+    int node = preferred_node >= 0 ? preferred_node : get_current_numa_node();
+    if (node < 0 || node >= MAX_NUMA_NODES) {
+        node = 0;
+    }
+    allocated_bytes_[node].fetch_add(rounded, std::memory_order_relaxed);
+    allocation_count_[node].fetch_add(1, std::memory_order_relaxed);
+
+    return ptr;
+#else
+    return allocate(size, preferred_node);
+#endif
+}
+
 auto numa_allocator::deallocate(void* ptr, size_t size) -> void {
     if (!ptr)
         return;
 
+#ifdef __linux__
+    {
+        std::lock_guard<std::mutex> lock(huge_mutex_);
+        auto it = huge_regions_.find(ptr);
+        if (it != huge_regions_.end()) {
+            ::munmap(ptr, it->second);
+            huge_regions_.erase(it);
+            return;
+        }
+    }
+#endif
+
     if (!numa_lib_available_ || !topology_.is_numa_available) {
         std::free(ptr);
         return;
@@ -384,5 +434,16 @@ auto get_thread_local_allocator() -> numa_allocator& {
     return g_thread_local_allocator;
 }
 
+auto get_thread_local_numa_resource() -> std::pmr::memory_resource& {
+    thread_local numa_memory_resource resource(g_thread_local_allocator);
+    return resource;
+}
+
+auto get_huge_page_resource() -> std::pmr::memory_resource& {
+    static numa_allocator allocator;
+    static huge_page_memory_resource resource(allocator);
+    return resource;
+}
+
 }  // namespace numa
 }  // namespace fastjson
@@ -8,6 +8,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace fastjson {
@@ -56,6 +59,12 @@ public:
     // Allocate memory local to current thread's NUMA node
     auto allocate_local(size_t size) -> void*;
 
+    // Allocate memory backed by huge pages (2MB), for large buffers where 4K
+    // pages cause dTLB pressure. Tries MAP_HUGETLB first (pre-reserved pool),
+    // then an anonymous mapping with MADV_HUGEPAGE (transparent huge pages),
+    // then falls back to allocate(). Node placement follows first touch.
+    auto allocate_huge(size_t size, int preferred_node = -1) -> void*;
+
     // Free NUMA-allocated memory
     auto deallocate(void* ptr, size_t size) -> void;
 
@@ -76,6 +85,65 @@ private:
     std::atomic<size_t> allocated_bytes_[MAX_NUMA_NODES];
     std::atomic<size_t> allocation_count_[MAX_NUMA_NODES];
     bool numa_lib_available_ = false;
+
+    // Huge-page regions are mmap'd, not malloc'd; deallocate consults this
+    // map so the same entry point frees both kinds of allocation.
+    std::mutex huge_mutex_;
+    std::unordered_map<void*, size_t> huge_regions_;
+};
+
+// ============================================================================
+// NUMA-Local PMR Resource
+// ============================================================================
+// std::pmr adapter over numa_allocator's node-local allocation path. Used as
+// the upstream of per-worker monotonic arenas so that every arena page a
+// parser thread touches is faulted on that thread's own NUMA node.
+
+class numa_memory_resource : public std::pmr::memory_resource {
+public:
+    explicit numa_memory_resource(numa_allocator& allocator) : allocator_(&allocator) {}
+
+private:
+    auto do_allocate(size_t bytes, size_t /*alignment*/) -> void* override {
+        return allocator_->allocate_local(bytes);
+    }
+
+    auto do_deallocate(void* p, size_t bytes, size_t /*alignment*/) -> void override {
+        allocator_->deallocate(p, bytes);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+        return this == &other;
+    }
+
+    numa_allocator* allocator_;
+};
+
+// ============================================================================
+// Huge-Page PMR Resource
+// ============================================================================
+// std::pmr adapter over numa_allocator's huge-page path. Used as the upstream
+// of document arenas once they cross parse_config::huge_page_threshold, so
+// multi-GB DOM trees sit on 2MB pages instead of thrashing the dTLB.
+
+class huge_page_memory_resource : public std::pmr::memory_resource {
+public:
+    explicit huge_page_memory_resource(numa_allocator& allocator) : allocator_(&allocator) {}
+
+private:
+    auto do_allocate(size_t bytes, size_t /*alignment*/) -> void* override {
+        return allocator_->allocate_huge(bytes);
+    }
+
+    auto do_deallocate(void* p, size_t bytes, size_t /*alignment*/) -> void override {
+        allocator_->deallocate(p, bytes);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+        return this == &other;
+    }
+
+    numa_allocator* allocator_;
 };
 
 // ============================================================================
@@ -92,6 +160,17 @@ public:
         data_ = static_cast<T*>(allocator.allocate(count * sizeof(T), preferred_node));
     }
 
+    // Allocate on specific node with optional huge-page backing for large
+    // buffers (deallocate dispatches on the pointer, so teardown is uniform)
+    numa_buffer(size_t count, int preferred_node, numa_allocator& allocator, bool use_huge_pages)
+        : size_(count), allocator_(&allocator) {
+        if (use_huge_pages) {
+            data_ = static_cast<T*>(allocator.allocate_huge(count * sizeof(T), preferred_node));
+        } else {
+            data_ = static_cast<T*>(allocator.allocate(count * sizeof(T), preferred_node));
+        }
+    }
+
     // Allocate interleaved
     numa_buffer(size_t count, numa_allocator& allocator, bool interleaved = true)
         : size_(count), allocator_(&allocator) {
@@ -180,5 +259,11 @@ auto configure_openmp_numa(const numa_parallel_config& config) -> void;
 // Get thread-local allocator configured for NUMA
 auto get_thread_local_allocator() -> numa_allocator&;
 
+// Get thread-local PMR resource backed by the thread's node-local allocator
+auto get_thread_local_numa_resource() -> std::pmr::memory_resource&;
+
+// Get process-wide PMR resource backed by huge-page allocation
+auto get_huge_page_resource() -> std::pmr::memory_resource&;
+
 }  // namespace numa
 }  // namespace fastjson
@@ -10,10 +10,18 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <expected>
 #include <string>
 #include <string_view>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace fastjson {
 namespace unicode {
 
@@ -241,6 +249,474 @@ inline auto decode_json_unicode_escape(const char* input, size_t length, std::st
     return result.bytes_consumed;
 }
 
+// ============================================================================
+// Bulk Transcoding (UTF-16LE / UTF-32LE -> UTF-8)
+// ============================================================================
+// Whole-payload transcoding for inputs that arrive in UTF-16LE (Windows
+// producers) or UTF-32LE before parsing. The SIMD kernels classify each block
+// by the widest code unit it contains and emit 1-, 2- or 3-byte sequences
+// fully in-register for uniform blocks; blocks containing surrogates or
+// astral codepoints drop to the scalar path one codepoint at a time. The
+// dispatch mirrors the parser kernels: AVX2 on x86 behind a runtime CPU
+// check, NEON on ARM, scalar everywhere else.
+
+// Read one little-endian 16-bit code unit (input may be unaligned)
+inline auto load_u16le(const char* p) -> uint32_t {
+    return static_cast<uint32_t>(static_cast<unsigned char>(p[0])) |
+           (static_cast<uint32_t>(static_cast<unsigned char>(p[1])) << 8);
+}
+
+// Read one little-endian 32-bit code unit
+inline auto load_u32le(const char* p) -> uint32_t {
+    return load_u16le(p) | (load_u16le(p + 2) << 16);
+}
+
+// Write the UTF-8 encoding of a codepoint the caller already validated.
+// Returns the advanced output cursor.
+inline auto emit_utf8_unchecked(uint32_t codepoint, char* out) -> char* {
+    if (codepoint <= 0x7F) {
+        *out++ = static_cast<char>(codepoint);
+    } else if (codepoint <= 0x7FF) {
+        *out++ = static_cast<char>(0xC0 | (codepoint >> 6));
+        *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else if (codepoint <= 0xFFFF) {
+        *out++ = static_cast<char>(0xE0 | (codepoint >> 12));
+        *out++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | (codepoint >> 18));
+        *out++ = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+    return out;
+}
+
+// Transcode the code unit (or surrogate pair) at src + 2*pos to UTF-8.
+// Advances pos and out; returns nullptr on success, an error message on
+// unpaired or truncated surrogates.
+inline auto transcode_one_utf16(const char* src, size_t units, size_t& pos, char*& out)
+    -> const char* {
+    uint32_t unit = load_u16le(src + 2 * pos);
+    if (is_high_surrogate(unit)) {
+        if (pos + 1 >= units) {
+            return "Truncated surrogate pair in UTF-16 input";
+        }
+        uint32_t low = load_u16le(src + 2 * (pos + 1));
+        if (!is_low_surrogate(low)) {
+            return "Unpaired high surrogate in UTF-16 input";
+        }
+        out = emit_utf8_unchecked(decode_surrogate_pair(unit, low), out);
+        pos += 2;
+        return nullptr;
+    }
+    if (is_low_surrogate(unit)) {
+        return "Unpaired low surrogate in UTF-16 input";
+    }
+    out = emit_utf8_unchecked(unit, out);
+    pos += 1;
+    return nullptr;
+}
+
+// Transcode the code unit at src + 4*pos to UTF-8. Advances pos and out;
+// returns nullptr on success, an error message on invalid codepoints.
+inline auto transcode_one_utf32(const char* src, size_t& pos, char*& out) -> const char* {
+    uint32_t codepoint = load_u32le(src + 4 * pos);
+    if (!is_valid_codepoint(codepoint)) {
+        return "Invalid codepoint in UTF-32 input";
+    }
+    out = emit_utf8_unchecked(codepoint, out);
+    pos += 1;
+    return nullptr;
+}
+
+// Scalar UTF-16LE -> UTF-8 transcoding. Appends to output, returns bytes
+// appended or an error message (output is left unchanged on error).
+inline auto utf16le_to_utf8_scalar(std::string_view input, std::string& output)
+    -> std::expected<size_t, const char*> {
+    if (input.size() % 2 != 0) {
+        return std::unexpected("UTF-16 input is not a multiple of 2 bytes");
+    }
+    size_t units = input.size() / 2;
+    size_t out_start = output.size();
+    output.resize(out_start + units * 3);  // worst case: 3 bytes per BMP unit
+    char* out = output.data() + out_start;
+    size_t pos = 0;
+    while (pos < units) {
+        if (const char* err = transcode_one_utf16(input.data(), units, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+    size_t written = static_cast<size_t>(out - (output.data() + out_start));
+    output.resize(out_start + written);
+    return written;
+}
+
+// Scalar UTF-32LE -> UTF-8 transcoding; same contract as the UTF-16 version.
+inline auto utf32le_to_utf8_scalar(std::string_view input, std::string& output)
+    -> std::expected<size_t, const char*> {
+    if (input.size() % 4 != 0) {
+        return std::unexpected("UTF-32 input is not a multiple of 4 bytes");
+    }
+    size_t units = input.size() / 4;
+    size_t out_start = output.size();
+    output.resize(out_start + units * 4);
+    char* out = output.data() + out_start;
+    size_t pos = 0;
+    while (pos < units) {
+        if (const char* err = transcode_one_utf32(input.data(), pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+    size_t written = static_cast<size_t>(out - (output.data() + out_start));
+    output.resize(out_start + written);
+    return written;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// AVX2 UTF-16LE -> UTF-8: 16 code units per iteration. Uniform blocks
+// (all-ASCII, all 2-byte range, all 3-byte BMP range) are emitted without
+// leaving registers; a block containing surrogates or mixed widths falls back
+// to one scalar codepoint and re-enters the vector loop.
+__attribute__((target("avx2"))) inline auto
+utf16le_to_utf8_avx2(std::string_view input, std::string& output)
+    -> std::expected<size_t, const char*> {
+    if (input.size() % 2 != 0) {
+        return std::unexpected("UTF-16 input is not a multiple of 2 bytes");
+    }
+    size_t units = input.size() / 2;
+    size_t out_start = output.size();
+    output.resize(out_start + units * 3);
+    char* out = output.data() + out_start;
+    const char* src = input.data();
+    size_t pos = 0;
+
+    while (pos + 16 <= units) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * pos));
+
+        if (_mm256_testz_si256(v, _mm256_set1_epi16(static_cast<short>(0xFF80)))) {
+            // All ASCII: narrow 16 units to 16 bytes
+            __m256i packed = _mm256_packus_epi16(v, v);
+            __m256i ordered = _mm256_permute4x64_epi64(packed, 0x08);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                             _mm256_castsi256_si128(ordered));
+            out += 16;
+            pos += 16;
+            continue;
+        }
+
+        __m256i above_7ff = _mm256_and_si256(v, _mm256_set1_epi16(static_cast<short>(0xF800)));
+        if (_mm256_testz_si256(above_7ff, above_7ff)) {
+            // All units < 0x800; pure 2-byte only if none are ASCII
+            __m256i masked = _mm256_and_si256(v, _mm256_set1_epi16(static_cast<short>(0xFF80)));
+            __m256i is_ascii = _mm256_cmpeq_epi16(masked, _mm256_setzero_si256());
+            if (_mm256_movemask_epi8(is_ascii) == 0) {
+                // Per unit, low byte = 0xC0 | (u >> 6), high byte = 0x80 | (u & 0x3F);
+                // a little-endian store interleaves them in UTF-8 order
+                __m256i lead = _mm256_or_si256(_mm256_srli_epi16(v, 6),
+                                               _mm256_set1_epi16(0x00C0));
+                __m256i cont = _mm256_or_si256(
+                    _mm256_slli_epi16(_mm256_and_si256(v, _mm256_set1_epi16(0x3F)), 8),
+                    _mm256_set1_epi16(static_cast<short>(0x8000)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                                    _mm256_or_si256(lead, cont));
+                out += 32;
+                pos += 16;
+                continue;
+            }
+        } else {
+            // Any surrogates? (u & 0xF800) == 0xD800
+            __m256i is_surrogate = _mm256_cmpeq_epi16(
+                above_7ff, _mm256_set1_epi16(static_cast<short>(0xD800)));
+            __m256i below_800 = _mm256_cmpeq_epi16(above_7ff, _mm256_setzero_si256());
+            if (_mm256_movemask_epi8(_mm256_or_si256(is_surrogate, below_800)) == 0) {
+                // All units in the 3-byte BMP range: compute the three UTF-8
+                // bytes per unit in-register, interleave through a stack
+                // buffer (48 output bytes per block)
+                __m256i lead = _mm256_or_si256(_mm256_srli_epi16(v, 12),
+                                               _mm256_set1_epi16(0x00E0));
+                __m256i mid = _mm256_or_si256(
+                    _mm256_slli_epi16(
+                        _mm256_and_si256(_mm256_srli_epi16(v, 6), _mm256_set1_epi16(0x3F)), 8),
+                    _mm256_set1_epi16(static_cast<short>(0x8000)));
+                __m256i lead_mid = _mm256_or_si256(lead, mid);
+                __m256i cont = _mm256_or_si256(_mm256_and_si256(v, _mm256_set1_epi16(0x3F)),
+                                               _mm256_set1_epi16(0x0080));
+                __m256i cont_packed =
+                    _mm256_permute4x64_epi64(_mm256_packus_epi16(cont, cont), 0x08);
+
+                alignas(32) char pair_bytes[32];
+                alignas(16) char cont_bytes[16];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(pair_bytes), lead_mid);
+                _mm_store_si128(reinterpret_cast<__m128i*>(cont_bytes),
+                                _mm256_castsi256_si128(cont_packed));
+                for (int i = 0; i < 16; ++i) {
+                    out[3 * i] = pair_bytes[2 * i];
+                    out[3 * i + 1] = pair_bytes[2 * i + 1];
+                    out[3 * i + 2] = cont_bytes[i];
+                }
+                out += 48;
+                pos += 16;
+                continue;
+            }
+        }
+
+        // Mixed widths or surrogates: scalar-decode one codepoint, then try
+        // the vector loop again
+        if (const char* err = transcode_one_utf16(src, units, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+
+    while (pos < units) {
+        if (const char* err = transcode_one_utf16(src, units, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+    size_t written = static_cast<size_t>(out - (output.data() + out_start));
+    output.resize(out_start + written);
+    return written;
+}
+
+// AVX2 UTF-32LE -> UTF-8: 8 code units per iteration with an all-ASCII fast
+// path and an all 2-byte path; everything wider goes through the scalar step.
+__attribute__((target("avx2"))) inline auto
+utf32le_to_utf8_avx2(std::string_view input, std::string& output)
+    -> std::expected<size_t, const char*> {
+    if (input.size() % 4 != 0) {
+        return std::unexpected("UTF-32 input is not a multiple of 4 bytes");
+    }
+    size_t units = input.size() / 4;
+    size_t out_start = output.size();
+    output.resize(out_start + units * 4);
+    char* out = output.data() + out_start;
+    const char* src = input.data();
+    size_t pos = 0;
+
+    while (pos + 8 <= units) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4 * pos));
+
+        if (_mm256_testz_si256(v, _mm256_set1_epi32(static_cast<int>(0xFFFFFF80)))) {
+            // All ASCII: gather the low byte of each unit
+            __m256i bytes = _mm256_shuffle_epi8(
+                v, _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                    0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+            __m256i ordered = _mm256_permutevar8x32_epi32(bytes,
+                                                          _mm256_setr_epi32(0, 4, 1, 5, 2, 3, 6, 7));
+            alignas(16) char ascii[16];
+            _mm_store_si128(reinterpret_cast<__m128i*>(ascii), _mm256_castsi256_si128(ordered));
+            std::memcpy(out, ascii, 8);
+            out += 8;
+            pos += 8;
+            continue;
+        }
+
+        if (_mm256_testz_si256(v, _mm256_set1_epi32(static_cast<int>(0xFFFFF800)))) {
+            // All units < 0x800; pure 2-byte only if none are ASCII
+            __m256i masked = _mm256_and_si256(v, _mm256_set1_epi32(static_cast<int>(0xFFFFFF80)));
+            __m256i is_ascii = _mm256_cmpeq_epi32(masked, _mm256_setzero_si256());
+            if (_mm256_movemask_epi8(is_ascii) == 0) {
+                __m256i lead = _mm256_or_si256(_mm256_srli_epi32(v, 6),
+                                               _mm256_set1_epi32(0x000000C0));
+                __m256i cont = _mm256_or_si256(
+                    _mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0x3F)), 8),
+                    _mm256_set1_epi32(0x00008000));
+                __m256i pairs = _mm256_or_si256(lead, cont);
+                // Keep the two UTF-8 bytes of each unit, drop the zero halves
+                __m256i packed = _mm256_shuffle_epi8(
+                    pairs,
+                    _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+                                     0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1));
+                __m256i ordered = _mm256_permutevar8x32_epi32(
+                    packed, _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                                 _mm256_castsi256_si128(ordered));
+                out += 16;
+                pos += 8;
+                continue;
+            }
+        }
+
+        if (const char* err = transcode_one_utf32(src, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+
+    while (pos < units) {
+        if (const char* err = transcode_one_utf32(src, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+    size_t written = static_cast<size_t>(out - (output.data() + out_start));
+    output.resize(out_start + written);
+    return written;
+}
+
+#endif  // x86_64
+
+#if defined(__ARM_NEON)
+
+// NEON UTF-16LE -> UTF-8: 8 code units per iteration, same block classes as
+// the AVX2 kernel.
+inline auto utf16le_to_utf8_neon(std::string_view input, std::string& output)
+    -> std::expected<size_t, const char*> {
+    if (input.size() % 2 != 0) {
+        return std::unexpected("UTF-16 input is not a multiple of 2 bytes");
+    }
+    size_t units = input.size() / 2;
+    size_t out_start = output.size();
+    output.resize(out_start + units * 3);
+    char* out = output.data() + out_start;
+    const char* src = input.data();
+    size_t pos = 0;
+
+    while (pos + 8 <= units) {
+        uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t*>(src + 2 * pos));
+        uint16_t max_unit = vmaxvq_u16(v);
+
+        if (max_unit < 0x80) {
+            vst1_u8(reinterpret_cast<uint8_t*>(out), vmovn_u16(v));
+            out += 8;
+            pos += 8;
+            continue;
+        }
+        if (max_unit < 0x800 && vminvq_u16(v) >= 0x80) {
+            // Low byte = lead, high byte = continuation; little-endian store
+            // interleaves them in UTF-8 order
+            uint16x8_t lead = vorrq_u16(vshrq_n_u16(v, 6), vdupq_n_u16(0x00C0));
+            uint16x8_t cont = vorrq_u16(vshlq_n_u16(vandq_u16(v, vdupq_n_u16(0x3F)), 8),
+                                        vdupq_n_u16(0x8000));
+            vst1q_u8(reinterpret_cast<uint8_t*>(out),
+                     vreinterpretq_u8_u16(vorrq_u16(lead, cont)));
+            out += 16;
+            pos += 8;
+            continue;
+        }
+        if (max_unit >= 0x800 && vminvq_u16(v) >= 0x800) {
+            // All 3-byte BMP if no surrogates
+            uint16x8_t high5 = vandq_u16(v, vdupq_n_u16(0xF800));
+            uint16x8_t is_surrogate = vceqq_u16(high5, vdupq_n_u16(0xD800));
+            if (vmaxvq_u16(is_surrogate) == 0) {
+                uint16x8_t lead = vorrq_u16(vshrq_n_u16(v, 12), vdupq_n_u16(0x00E0));
+                uint16x8_t mid = vorrq_u16(
+                    vshlq_n_u16(vandq_u16(vshrq_n_u16(v, 6), vdupq_n_u16(0x3F)), 8),
+                    vdupq_n_u16(0x8000));
+                uint8x8_t cont = vmovn_u16(vorrq_u16(vandq_u16(v, vdupq_n_u16(0x3F)),
+                                                     vdupq_n_u16(0x0080)));
+                alignas(16) char pair_bytes[16];
+                alignas(8) char cont_bytes[8];
+                vst1q_u8(reinterpret_cast<uint8_t*>(pair_bytes),
+                         vreinterpretq_u8_u16(vorrq_u16(lead, mid)));
+                vst1_u8(reinterpret_cast<uint8_t*>(cont_bytes), cont);
+                for (int i = 0; i < 8; ++i) {
+                    out[3 * i] = pair_bytes[2 * i];
+                    out[3 * i + 1] = pair_bytes[2 * i + 1];
+                    out[3 * i + 2] = cont_bytes[i];
+                }
+                out += 24;
+                pos += 8;
+                continue;
+            }
+        }
+
+        if (const char* err = transcode_one_utf16(src, units, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+
+    while (pos < units) {
+        if (const char* err = transcode_one_utf16(src, units, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+    size_t written = static_cast<size_t>(out - (output.data() + out_start));
+    output.resize(out_start + written);
+    return written;
+}
+
+// NEON UTF-32LE -> UTF-8: 4 code units per iteration, ASCII fast path only;
+// wider units go through the scalar step.
+inline auto utf32le_to_utf8_neon(std::string_view input, std::string& output)
+    -> std::expected<size_t, const char*> {
+    if (input.size() % 4 != 0) {
+        return std::unexpected("UTF-32 input is not a multiple of 4 bytes");
+    }
+    size_t units = input.size() / 4;
+    size_t out_start = output.size();
+    output.resize(out_start + units * 4);
+    char* out = output.data() + out_start;
+    const char* src = input.data();
+    size_t pos = 0;
+
+    while (pos + 4 <= units) {
+        uint32x4_t v = vld1q_u32(reinterpret_cast<const uint32_t*>(src + 4 * pos));
+        if (vmaxvq_u32(v) < 0x80) {
+            uint8x8_t bytes = vmovn_u16(vcombine_u16(vmovn_u32(v), vdup_n_u16(0)));
+            alignas(8) char ascii[8];
+            vst1_u8(reinterpret_cast<uint8_t*>(ascii), bytes);
+            std::memcpy(out, ascii, 4);
+            out += 4;
+            pos += 4;
+            continue;
+        }
+        if (const char* err = transcode_one_utf32(src, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+
+    while (pos < units) {
+        if (const char* err = transcode_one_utf32(src, pos, out)) {
+            output.resize(out_start);
+            return std::unexpected(err);
+        }
+    }
+    size_t written = static_cast<size_t>(out - (output.data() + out_start));
+    output.resize(out_start + written);
+    return written;
+}
+
+#endif  // __ARM_NEON
+
+// Transcode UTF-16LE bytes to UTF-8, appending to output. Returns bytes
+// appended or an error message; output is unchanged on error.
+inline auto utf16le_to_utf8(std::string_view input, std::string& output)
+    -> std::expected<size_t, const char*> {
+#if defined(__x86_64__) || defined(_M_X64)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        return utf16le_to_utf8_avx2(input, output);
+    }
+#elif defined(__ARM_NEON)
+    return utf16le_to_utf8_neon(input, output);
+#endif
+    return utf16le_to_utf8_scalar(input, output);
+}
+
+// Transcode UTF-32LE bytes to UTF-8, appending to output. Same contract as
+// utf16le_to_utf8.
+inline auto utf32le_to_utf8(std::string_view input, std::string& output)
+    -> std::expected<size_t, const char*> {
+#if defined(__x86_64__) || defined(_M_X64)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        return utf32le_to_utf8_avx2(input, output);
+    }
+#elif defined(__ARM_NEON)
+    return utf32le_to_utf8_neon(input, output);
+#endif
+    return utf32le_to_utf8_scalar(input, output);
+}
+
 // ============================================================================
 // Statistics and Information
 // ============================================================================
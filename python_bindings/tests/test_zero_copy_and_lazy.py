@@ -0,0 +1,123 @@
+"""Tests for the zero-copy input path, lazy proxies, and the batch API.
+
+Covers the buffer-protocol acceptance of parse()/loads() (bytes,
+bytearray, memoryview, mmap), the LazyValue proxy returned by
+parse_lazy()/loads_lazy(), and loads_many() batch parsing with its
+error reporting.
+"""
+import mmap
+import os
+import tempfile
+
+import pytest
+
+try:
+    import fastjson
+except ImportError:
+    pytest.skip("fastjson module not found. Build with 'uv pip install -e .'", allow_module_level=True)
+
+DOC = '{"name": "zero", "items": [1, 2, 3], "nested": {"deep": true}}'
+
+
+def test_parse_accepts_str_and_buffers():
+    """Every C-contiguous input type must parse to the same document."""
+    expected = fastjson.parse(DOC).to_python()
+
+    assert fastjson.parse(DOC.encode()).to_python() == expected
+    assert fastjson.parse(bytearray(DOC.encode())).to_python() == expected
+    assert fastjson.parse(memoryview(DOC.encode())).to_python() == expected
+    # loads() is the drop-in alias
+    assert fastjson.loads(DOC).to_python() == expected
+
+
+def test_parse_accepts_mmap():
+    """mmap-backed input parses without an intermediate copy."""
+    with tempfile.NamedTemporaryFile(delete=False) as f:
+        f.write(DOC.encode())
+        path = f.name
+    try:
+        with open(path, "rb") as f:
+            with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as m:
+                assert fastjson.parse(m).to_python() == fastjson.parse(DOC).to_python()
+    finally:
+        os.unlink(path)
+
+
+def test_parse_rejects_non_buffer_inputs():
+    with pytest.raises(TypeError):
+        fastjson.parse(12345)
+    with pytest.raises(TypeError):
+        fastjson.parse(["not", "a", "buffer"])
+
+
+def test_parse_error_reports_position():
+    with pytest.raises(RuntimeError, match="line"):
+        fastjson.parse('{"open": [1, 2')
+
+
+def test_lazy_proxy_navigation():
+    lazy = fastjson.parse_lazy(DOC)
+    assert lazy.is_object()
+    assert "name" in lazy
+    assert "missing" not in lazy
+    assert lazy["name"] == "zero"  # scalars materialize natively
+    assert set(lazy.keys()) == {"name", "items", "nested"}
+    assert len(lazy) == 3
+
+    items = lazy["items"]  # containers stay proxies
+    assert items.is_array()
+    assert len(items) == 3
+    assert items[1] == 2.0
+    assert lazy["nested"]["deep"] is True
+
+    assert lazy.get("missing") is None
+    assert lazy.get("missing", 7) == 7
+
+    with pytest.raises(KeyError):
+        lazy["absent"]
+    with pytest.raises(IndexError):
+        items[3]
+
+    assert "LazyValue" in repr(lazy)
+
+
+def test_lazy_unwrap_matches_eager():
+    lazy = fastjson.loads_lazy(DOC)
+    assert lazy.unwrap() == fastjson.parse(DOC).to_python()
+    # Parallel unwrap takes the threaded conversion path
+    assert lazy.unwrap(threads=2) == fastjson.parse(DOC).to_python()
+
+
+def test_lazy_scalar_roots_are_native():
+    assert fastjson.parse_lazy("42") == 42.0
+    assert fastjson.parse_lazy('"plain"') == "plain"
+    assert fastjson.parse_lazy("null") is None
+
+
+def test_loads_many_order_and_types():
+    docs = ['{"i": %d}' % i for i in range(200)]
+    # Mix input types within one batch
+    docs[10] = docs[10].encode()
+    docs[20] = bytearray(docs[20] if isinstance(docs[20], bytes) else docs[20].encode())
+
+    results = fastjson.loads_many(docs)
+    assert len(results) == 200
+    for i, value in enumerate(results):
+        assert value["i"].as_int() == i
+
+
+def test_loads_many_thread_counts_agree():
+    docs = ['[%d, %d]' % (i, i * 2) for i in range(100)]
+    serial = [v.to_python() for v in fastjson.loads_many(docs, threads=1)]
+    parallel = [v.to_python() for v in fastjson.loads_many(docs, threads=4)]
+    assert serial == parallel
+
+
+def test_loads_many_reports_failing_document():
+    docs = ['{"ok": 1}', "{broken", '{"ok": 2}']
+    with pytest.raises(RuntimeError, match="document 1"):
+        fastjson.loads_many(docs)
+
+
+def test_loads_many_empty_batch():
+    assert fastjson.loads_many([]) == []
@@ -0,0 +1,141 @@
+#!/bin/bash
+
+################################################################################
+#                    PGO + BOLT TWO-PHASE OPTIMIZED BUILD                      #
+################################################################################
+#
+# Builds PGO-optimized (and optionally BOLT-optimized) core libraries:
+#
+#   Phase 1  configure with -DFASTJSON_PGO=generate, build the benchmark
+#            harness, replay the training workload, merge the raw profiles
+#            with llvm-profdata
+#   Phase 2  reconfigure with -DFASTJSON_PGO=use -DFASTJSON_BOLT=ON and
+#            rebuild against the merged profile
+#   Phase 3  (optional, needs llvm-bolt + perf) instrument the harness with
+#            llvm-bolt, replay the training workload again, and rewrite the
+#            binary with the collected layout profile
+#
+# The training workload is checked in below so the build farm reproduces it
+# bit-for-bit: deterministic corpora from tools/generate_test_file (fixed
+# seeds, one per production payload class) replayed through benchmark_harness.
+# Small documents dominate our fleet, so the small corpora get extra repeats.
+#
+# Usage:
+#   ./scripts/pgo_bolt_build.sh [build-dir]       # default: build-pgo
+#
+# Environment:
+#   CLANG_BIN   toolchain bin directory            (default /opt/clang-21/bin)
+#   TRAIN_MB    size of the large training corpora (default 256)
+#
+################################################################################
+
+set -e
+
+REPO_ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+BUILD_DIR="${1:-$REPO_ROOT/build-pgo}"
+CLANG_BIN="${CLANG_BIN:-/opt/clang-21/bin}"
+TRAIN_MB="${TRAIN_MB:-256}"
+PROFILE_DIR="$BUILD_DIR/pgo-profiles"
+CORPUS_DIR="$BUILD_DIR/training-corpora"
+HARNESS="$BUILD_DIR/benchmark_harness"
+
+# ============================================================================
+# Training workload (checked in - do not vary per machine)
+# ============================================================================
+# profile:seed:size_mb:repeats - one row per production payload class
+TRAINING_MATRIX=(
+    "records:42:${TRAIN_MB}:3"
+    "flat-numeric:42:${TRAIN_MB}:3"
+    "deep-tree:42:${TRAIN_MB}:3"
+    "wide-object:42:${TRAIN_MB}:3"
+    "escape-heavy:42:${TRAIN_MB}:3"
+    "ndjson:42:${TRAIN_MB}:3"
+    # Small-document path: the shape we care most about, replayed hardest
+    "records:7:8:11"
+    "wide-object:7:8:11"
+    "ndjson:7:8:11"
+)
+
+run_training() {
+    local harness_bin="$1"
+    for row in "${TRAINING_MATRIX[@]}"; do
+        IFS=':' read -r profile seed size_mb repeats <<< "$row"
+        local corpus="$CORPUS_DIR/${profile}-${seed}-${size_mb}mb.json"
+        if [ ! -f "$corpus" ]; then
+            "$BUILD_DIR/generate_test_file" "$corpus" "$size_mb" \
+                "--profile=$profile" "--seed=$seed"
+        fi
+        echo "--- Training: $profile seed=$seed ${size_mb}MB x$repeats"
+        # NDJSON corpora have no enclosing array; the harness needs its
+        # batch-parser mode or the single-document pre-parse rejects them
+        local extra_args=()
+        if [ "$profile" = "ndjson" ]; then
+            extra_args+=(--ndjson)
+        fi
+        "$harness_bin" --input "$corpus" --warmup 1 --repeats "$repeats" \
+            --out /dev/null "${extra_args[@]}"
+    done
+}
+
+mkdir -p "$PROFILE_DIR" "$CORPUS_DIR"
+
+# ============================================================================
+# Phase 1: instrumented build + training run
+# ============================================================================
+echo "=== Phase 1: instrumented build ==="
+cmake -S "$REPO_ROOT" -B "$BUILD_DIR" \
+    -DCMAKE_BUILD_TYPE=Release \
+    -DFASTJSON_PGO=generate \
+    -DFASTJSON_PGO_PROFILE_DIR="$PROFILE_DIR"
+cmake --build "$BUILD_DIR" --target benchmark_harness -j"$(nproc)"
+
+# The corpus generator is standalone (no module toolchain needed)
+"$CLANG_BIN/clang++" -std=c++23 -O2 -fopenmp \
+    -o "$BUILD_DIR/generate_test_file" "$REPO_ROOT/tools/generate_test_file.cpp"
+
+echo "=== Phase 1: training run ==="
+export LLVM_PROFILE_FILE="$PROFILE_DIR/%m-%p.profraw"
+run_training "$HARNESS"
+unset LLVM_PROFILE_FILE
+
+"$CLANG_BIN/llvm-profdata" merge \
+    -output="$PROFILE_DIR/fastjson.profdata" "$PROFILE_DIR"/*.profraw
+rm -f "$PROFILE_DIR"/*.profraw
+
+# ============================================================================
+# Phase 2: profile-guided rebuild (relocations kept for BOLT)
+# ============================================================================
+echo "=== Phase 2: profile-guided rebuild ==="
+cmake -S "$REPO_ROOT" -B "$BUILD_DIR" \
+    -DCMAKE_BUILD_TYPE=Release \
+    -DFASTJSON_PGO=use \
+    -DFASTJSON_PGO_PROFILE_DIR="$PROFILE_DIR" \
+    -DFASTJSON_BOLT=ON
+cmake --build "$BUILD_DIR" --target benchmark_harness -j"$(nproc)"
+
+# ============================================================================
+# Phase 3: BOLT post-link optimization (skipped when llvm-bolt is absent)
+# ============================================================================
+if [ -x "$CLANG_BIN/llvm-bolt" ]; then
+    echo "=== Phase 3: BOLT instrumentation + rewrite ==="
+    "$CLANG_BIN/llvm-bolt" "$HARNESS" -instrument \
+        -o "$HARNESS.inst" \
+        --instrumentation-file="$PROFILE_DIR/bolt.fdata"
+    run_training "$HARNESS.inst"
+    "$CLANG_BIN/llvm-bolt" "$HARNESS" \
+        -o "$HARNESS.bolt" \
+        -data="$PROFILE_DIR/bolt.fdata" \
+        -reorder-blocks=ext-tsp \
+        -reorder-functions=cdsort \
+        -split-functions \
+        -split-all-cold \
+        -icf=1
+    echo "BOLT-optimized harness: $HARNESS.bolt"
+else
+    echo "=== Phase 3 skipped: $CLANG_BIN/llvm-bolt not found ==="
+fi
+
+echo ""
+echo "PGO-optimized libraries are in $BUILD_DIR; the merged profile"
+echo "($PROFILE_DIR/fastjson.profdata) can be reused by any build with"
+echo "-DFASTJSON_PGO=use -DFASTJSON_PGO_PROFILE_DIR=$PROFILE_DIR"
@@ -0,0 +1,144 @@
+// Compatibility tests for the nlohmann::json migration bridge: direct tree
+// conversion in both directions (no text round trip), exact integer
+// preservation where nlohmann can hold them, and the SAX replay with
+// nlohmann's early-abort semantics. Skips cleanly when the bridge is
+// compiled out (<nlohmann/json.hpp> not on the include path).
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __has_include(<nlohmann/json.hpp>) && defined(FASTJSON_HAVE_NLOHMANN)
+#include <nlohmann/json.hpp>
+#define INTEROP_AVAILABLE 1
+#else
+#define INTEROP_AVAILABLE 0
+#endif
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+#if INTEROP_AVAILABLE
+
+// Event-recording SAX consumer matching the nlohmann sax interface
+struct recording_sax {
+    using number_integer_t = int64_t;
+    using number_unsigned_t = uint64_t;
+    using number_float_t = double;
+    using string_t = std::string;
+    using binary_t = std::vector<uint8_t>;
+
+    size_t nulls = 0, bools = 0, ints = 0, uints = 0, floats = 0, strings = 0;
+    size_t array_starts = 0, array_ends = 0, object_starts = 0, object_ends = 0;
+    size_t keys = 0;
+    size_t abort_after_strings = 0;  // 0 = never abort
+
+    bool null() { ++nulls; return true; }
+    bool boolean(bool) { ++bools; return true; }
+    bool number_integer(number_integer_t) { ++ints; return true; }
+    bool number_unsigned(number_unsigned_t) { ++uints; return true; }
+    bool number_float(number_float_t, const string_t&) { ++floats; return true; }
+    bool string(string_t&) {
+        ++strings;
+        return abort_after_strings == 0 || strings < abort_after_strings;
+    }
+    bool binary(binary_t&) { return true; }
+    bool start_object(size_t) { ++object_starts; return true; }
+    bool key(string_t&) { ++keys; return true; }
+    bool end_object() { ++object_ends; return true; }
+    bool start_array(size_t) { ++array_starts; return true; }
+    bool end_array() { ++array_ends; return true; }
+    bool parse_error(size_t, const std::string&, const nlohmann::json::exception&) {
+        return false;
+    }
+};
+
+static void run_interop() {
+    const std::string doc =
+        R"({"name":"bridge","n":-42,"big":9223372036854775807,"f":-2.5,)"
+        R"("flags":[true,false,null],"nested":{"k":["v",1]}})";
+
+    // fastjson -> nlohmann preserves structure and exact integers
+    {
+        auto parsed = parse(doc);
+        check(parsed.has_value(), "source document parses");
+        if (parsed) {
+            nlohmann::json converted = to_nlohmann(*parsed);
+            check(converted["name"] == "bridge", "string field converts");
+            check(converted["n"].is_number_integer() && converted["n"] == -42,
+                  "integer stays integral");
+            check(converted["big"] == INT64_MAX, "int64 max preserved exactly");
+            check(converted["f"] == -2.5, "double field converts");
+            check(converted["flags"].size() == 3 && converted["flags"][2].is_null(),
+                  "array with literals converts");
+            check(converted["nested"]["k"][1] == 1, "nested containers convert");
+
+            // Both directions compose to the identity (nlohmann's == is
+            // key-order insensitive, so object ordering differences between
+            // the two DOMs do not matter)
+            check(to_nlohmann(from_nlohmann(converted)) == converted,
+                  "round trip through both converters is the identity");
+        }
+    }
+
+    // nlohmann -> fastjson: a tree built natively on the nlohmann side
+    {
+        nlohmann::json built = {
+            {"u", uint64_t{18446744073709551615ULL}},
+            {"list", {1, 2, 3}},
+            {"empty_obj", nlohmann::json::object()},
+            {"empty_arr", nlohmann::json::array()},
+        };
+        json_value crossed = from_nlohmann(built);
+        check(crossed.get("list").as_array().size() == 3, "array crosses the boundary");
+        check(crossed.get("empty_obj").is_object() && crossed.get("empty_arr").is_array(),
+              "empty containers keep their kinds");
+        check(to_nlohmann(crossed) == built, "native nlohmann tree survives the round trip");
+    }
+
+    // SAX replay: event counts match the document, and a false return from
+    // the consumer aborts the walk like nlohmann::json::sax_parse
+    {
+        auto parsed = parse(R"({"a":[1,"x",null],"b":"y"})");
+        check(parsed.has_value(), "sax source parses");
+        if (parsed) {
+            recording_sax sax;
+            check(sax_emit(*parsed, sax), "replay completes");
+            check(sax.object_starts == 1 && sax.object_ends == 1, "object events paired");
+            check(sax.array_starts == 1 && sax.array_ends == 1, "array events paired");
+            check(sax.keys == 2 && sax.strings == 2 && sax.ints == 1 && sax.nulls == 1,
+                  "scalar events counted");
+
+            recording_sax aborting;
+            aborting.abort_after_strings = 1;
+            check(!sax_emit(*parsed, aborting), "consumer false return aborts the replay");
+            check(aborting.object_ends == 0, "no events after the abort");
+        }
+    }
+}
+
+#endif  // INTEROP_AVAILABLE
+
+auto main() -> int {
+#if INTEROP_AVAILABLE
+    run_interop();
+#else
+    std::cout << "test_nlohmann_interop: bridge compiled out "
+                 "(nlohmann/json.hpp not available); nothing to check\n";
+#endif
+
+    if (failures == 0) {
+        std::cout << "test_nlohmann_interop: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
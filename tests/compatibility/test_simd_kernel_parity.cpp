@@ -0,0 +1,117 @@
+// Compatibility tests for the SIMD kernel tiers: every instruction-set path
+// the dispatch table can select (scalar, SSE4.2, AVX2, AVX-512, NEON,
+// SVE/SVE2 - whichever the host supports) must produce byte-identical
+// results for parse, minify, and the unescape-heavy paths. The per-tier
+// kernels only run on matching hardware; disabling tiers top-down through
+// parse_config walks the same fallback ladder refresh_kernel_table uses, so
+// on any one machine this covers every tier that machine can reach.
+#include <iostream>
+#include <string>
+#include <vector>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// One config per rung of the fallback ladder. Rungs the hardware cannot
+// reach resolve to the same kernels as the rung below and cost nothing.
+static auto tier_configs() -> std::vector<std::pair<const char*, parse_config>> {
+    std::vector<std::pair<const char*, parse_config>> tiers;
+
+    parse_config full;
+    tiers.emplace_back("full", full);
+
+    parse_config no512 = full;
+    no512.enable_avx512 = false;
+    no512.enable_sve = false;
+    tiers.emplace_back("no-avx512/sve", no512);
+
+    parse_config no256 = no512;
+    no256.enable_avx2 = false;
+    no256.enable_neon = false;
+    tiers.emplace_back("no-avx2/neon", no256);
+
+    parse_config no128 = no256;
+    no128.enable_sse42 = false;
+    tiers.emplace_back("no-sse42", no128);
+
+    parse_config scalar = no128;
+    scalar.enable_simd = false;
+    tiers.emplace_back("scalar", scalar);
+
+    return tiers;
+}
+
+static auto make_fixture() -> std::string {
+    // Structural density, long strings, escape runs, unicode, and number
+    // forms - the inputs where the kernel families diverge most
+    std::string doc = R"({"header":"plain","unicode":"café 😀","records":[)";
+    for (int i = 0; i < 500; ++i) {
+        if (i) doc += ",";
+        doc += R"({"id":)" + std::to_string(i)
+               + R"(,"path":"a\/b\\c\td-)" + std::to_string(i)
+               + R"(","blob":")" + std::string(i % 97, 'x')
+               + R"(","vals":[-1.5e2,)" + std::to_string(i * 7) + "]}";
+    }
+    doc += "]}";
+    return doc;
+}
+
+auto main() -> int {
+    const std::string doc = make_fixture();
+    const std::string spaced =
+        "  {\n\t\"a\" : [ 1 ,\t2 ] , \"s\" : \" keep\\t me \"\n}  ";
+
+    // Reference results from the scalar rung
+    parse_config scalar_cfg;
+    scalar_cfg.enable_simd = false;
+    auto scalar_doc = parse_with_config(doc, scalar_cfg);
+    check(scalar_doc.has_value(), "scalar reference parse succeeds");
+    if (!scalar_doc) {
+        return 1;
+    }
+    const std::string reference = stringify(*scalar_doc);
+
+    for (const auto& [name, cfg] : tier_configs()) {
+        auto parsed = parse_with_config(doc, cfg);
+        check(parsed.has_value(), name);
+        if (parsed) {
+            check(stringify(*parsed) == reference,
+                  "tier output is byte-identical to the scalar reference");
+        }
+
+        // Error positions must not drift between tiers either
+        auto bad = parse_with_config(R"({"k": [1, 2, })", cfg);
+        check(!bad.has_value(), "malformed input rejected on every tier");
+
+        parse_config saved_cfg = cfg;  // minify reads the ambient config
+        set_parse_config(saved_cfg);
+        check(minify(spaced) == R"({"a":[1,2],"s":" keep\t me "})",
+              "minify identical across tiers");
+    }
+    set_parse_config(parse_config{});
+
+    // Validation-only pass agrees with the full parse on every tier
+    for (const auto& [name, cfg] : tier_configs()) {
+        set_parse_config(cfg);
+        check(validate(doc).has_value(), "validate accepts on every tier");
+        check(!validate(R"(["unterminated)").has_value(),
+              "validate rejects on every tier");
+    }
+    set_parse_config(parse_config{});
+
+    if (failures == 0) {
+        std::cout << "test_simd_kernel_parity: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,81 @@
+// Compatibility test over the canonical benchmark corpora (twitter.json,
+// canada.json, citm_catalog.json, gsoc-2018.json): every corpus the
+// comparison bench measures must parse, validate, and survive a
+// stringify/re-parse round trip here, so the head-to-head numbers are
+// produced over documents this library demonstrably handles. Corpora are
+// loaded from $FASTJSON_CORPUS_DIR (default benchmarks/data) and skipped
+// individually when absent, matching the bench's own loader.
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto corpus_dir() -> std::string {
+    if (const char* env = std::getenv("FASTJSON_CORPUS_DIR")) {
+        return env;
+    }
+    return "benchmarks/data";
+}
+
+auto main() -> int {
+    const char* corpora[] = {"twitter.json", "canada.json", "citm_catalog.json",
+                             "gsoc-2018.json"};
+    int tested = 0;
+
+    for (const char* name : corpora) {
+        const std::string path = corpus_dir() + "/" + name;
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            std::cout << "SKIP: " << path << " not present\n";
+            continue;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string text = buffer.str();
+        ++tested;
+
+        check(!text.empty(), "corpus is non-empty");
+        check(validate(text).has_value(), "corpus validates");
+
+        auto parsed = parse(text);
+        check(parsed.has_value(), "corpus parses");
+        if (!parsed) {
+            std::cout << "  " << name << ": " << parsed.error().to_string() << "\n";
+            continue;
+        }
+
+        // The bench's iterate pass walks every scalar; here the equivalent
+        // guarantee is a stable round trip through the serializer
+        auto reparsed = parse(stringify(*parsed));
+        check(reparsed.has_value(), "serialized corpus re-parses");
+        check(reparsed && stringify(*reparsed) == stringify(*parsed),
+              "round trip is stable");
+
+        std::cout << "  " << name << ": " << text.size() << " bytes ok\n";
+    }
+
+    if (tested == 0) {
+        std::cout << "test_standard_corpora: no corpora found (set FASTJSON_CORPUS_DIR); "
+                     "nothing to check\n";
+    }
+
+    if (failures == 0) {
+        std::cout << "test_standard_corpora: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
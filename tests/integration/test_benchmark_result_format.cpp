@@ -0,0 +1,120 @@
+// Integration test for the benchmark harness result format: the regression
+// gate re-reads an earlier run with this library, so the emitted JSON shape
+// (results array with scenario/median_ms per entry) must stay parseable and
+// the fields the comparison reads must survive a round trip. Also checks the
+// checked-in openmp_scaling_results.json stays valid, since the harness
+// format extends it.
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // A document in the shape benchmark_harness --out emits
+    const std::string harness_run = R"({
+  "benchmark": "fastjson unified harness",
+  "input_size_mb": 10.5,
+  "repeats": 11,
+  "warmup": 3,
+  "results": [
+    {
+      "scenario": "dom_parse",
+      "median_ms": 42.125,
+      "min_ms": 41.002,
+      "throughput_mbs": 249.3
+    },
+    {
+      "scenario": "validate",
+      "median_ms": 11.75,
+      "min_ms": 11.5,
+      "throughput_mbs": 893.6
+    }
+  ]
+})";
+
+    // The exact lookups compare_against_baseline performs
+    {
+        auto parsed = parse(harness_run);
+        check(parsed.has_value(), "harness output parses");
+        if (parsed) {
+            const auto* results = parsed->find("results");
+            check(results != nullptr && results->is_array(), "results array present");
+            if (results != nullptr && results->is_array()) {
+                check(results->as_array().size() == 2, "one entry per scenario");
+                bool found = false;
+                for (const auto& entry : results->as_array()) {
+                    const auto* name = entry.find("scenario");
+                    const auto* median = entry.find("median_ms");
+                    check(name != nullptr && name->is_string(), "scenario entry is named");
+                    check(median != nullptr && median->as_number() > 0.0,
+                          "scenario has a positive median");
+                    if (name != nullptr && name->as_string() == "validate") {
+                        found = median != nullptr && median->as_number() == 11.75;
+                    }
+                }
+                check(found, "baseline lookup by scenario name finds the median");
+            }
+        }
+    }
+
+    // Round trip: a re-serialized run still satisfies the same lookups, so a
+    // baseline written by one version gates a later one
+    {
+        auto parsed = parse(harness_run);
+        check(parsed.has_value(), "round-trip source parses");
+        if (parsed) {
+            auto reparsed = parse(stringify(*parsed));
+            check(reparsed.has_value(), "serialized run re-parses");
+            if (reparsed) {
+                const auto* results = reparsed->find("results");
+                check(results != nullptr && results->is_array()
+                          && results->as_array()[0].find("median_ms") != nullptr,
+                      "median_ms survives the round trip");
+            }
+        }
+    }
+
+    // The checked-in scaling results the format extends must stay valid
+    {
+        std::ifstream file("benchmarks/openmp_scaling_results.json");
+        if (!file) {
+            file.open("../benchmarks/openmp_scaling_results.json");
+        }
+        if (!file) {
+            std::cout << "SKIP: openmp_scaling_results.json not found from cwd\n";
+        } else {
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+            auto parsed = parse(buffer.str());
+            check(parsed.has_value(), "openmp_scaling_results.json parses");
+            if (parsed) {
+                const auto* results = parsed->find("results");
+                check(results != nullptr && results->is_array()
+                          && !results->as_array().empty(),
+                      "scaling results carry a non-empty results array");
+                check(results != nullptr
+                          && results->as_array()[0].find("throughput_mbs") != nullptr,
+                      "scaling entries keep the shared throughput field");
+            }
+        }
+    }
+
+    if (failures == 0) {
+        std::cout << "test_benchmark_result_format: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
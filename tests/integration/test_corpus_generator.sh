@@ -0,0 +1,78 @@
+#!/usr/bin/env bash
+# Integration test for the parallel test-corpus generator: output must be
+# byte-identical across thread counts (determinism is the whole point of the
+# fixed-index chunk scheme), seeds must actually change the bytes, and every
+# shape profile must emit valid JSON (valid per-line JSON for ndjson).
+#
+# Run from the repository root:  tests/integration/test_corpus_generator.sh
+set -u
+
+repo_root="$(cd "$(dirname "$0")/../.." && pwd)"
+workdir="$(mktemp -d)"
+trap 'rm -rf "$workdir"' EXIT
+
+failures=0
+check() {
+    if [ "$1" -ne 0 ]; then
+        echo "FAIL: $2"
+        failures=$((failures + 1))
+    fi
+}
+
+g++ -std=c++2b -O2 -fopenmp -o "$workdir/generate_test_file" \
+    "$repo_root/tools/generate_test_file.cpp"
+check $? "generator compiles"
+[ -x "$workdir/generate_test_file" ] || { echo "FAIL: no generator binary"; exit 1; }
+
+gen="$workdir/generate_test_file"
+
+for profile in records flat-numeric deep-tree wide-object escape-heavy ndjson; do
+    # Determinism: same seed, different thread counts, identical bytes
+    "$gen" "$workdir/a.json" 2 --profile="$profile" --seed=7 --threads=1 >/dev/null
+    check $? "$profile generates single-threaded"
+    "$gen" "$workdir/b.json" 2 --profile="$profile" --seed=7 --threads=8 >/dev/null
+    check $? "$profile generates with 8 threads"
+    cmp -s "$workdir/a.json" "$workdir/b.json"
+    check $? "$profile output is byte-identical across thread counts"
+
+    # A different seed changes the bytes
+    "$gen" "$workdir/c.json" 2 --profile="$profile" --seed=8 --threads=4 >/dev/null
+    check $? "$profile generates with another seed"
+    if cmp -s "$workdir/a.json" "$workdir/c.json"; then
+        echo "FAIL: $profile seed change did not change the output"
+        failures=$((failures + 1))
+    fi
+
+    # Validity: whole-document JSON, or one document per line for ndjson
+    if [ "$profile" = ndjson ]; then
+        python3 - "$workdir/a.json" <<'EOF'
+import json, sys
+with open(sys.argv[1]) as f:
+    count = sum(1 for line in f if line.strip() and json.loads(line) is not None)
+assert count > 0, "no ndjson rows"
+EOF
+        check $? "$profile rows are each valid JSON"
+    else
+        python3 -c 'import json, sys; json.load(open(sys.argv[1]))' "$workdir/a.json"
+        check $? "$profile output is valid JSON"
+    fi
+
+    # Requested size is honored to within one chunk wave
+    size=$(wc -c < "$workdir/a.json")
+    if [ "$size" -lt 1500000 ]; then
+        echo "FAIL: $profile output is far below the requested 2 MB ($size bytes)"
+        failures=$((failures + 1))
+    fi
+done
+
+# Unknown profile is rejected with usage, not a crash or an empty file
+if "$gen" "$workdir/bad.json" 1 --profile=no-such-shape >/dev/null 2>&1; then
+    echo "FAIL: unknown profile accepted"
+    failures=$((failures + 1))
+fi
+
+if [ "$failures" -eq 0 ]; then
+    echo "test_corpus_generator: all checks passed"
+    exit 0
+fi
+exit 1
@@ -0,0 +1,112 @@
+// Unit tests for the PMR arena-backed tree (parse_arena / parse_arena_numa):
+// value fidelity against the variant-tree parser, document ownership
+// semantics (the tree outlives the call, the arena travels with it), and the
+// NUMA entry point's large-array and fallback paths.
+#include <iostream>
+#include <string>
+#include <utility>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto make_record_array(size_t n) -> std::string {
+    std::string doc = "[";
+    for (size_t i = 0; i < n; ++i) {
+        if (i) doc += ",";
+        doc += R"({"id":)" + std::to_string(i) + R"(,"name":"rec-)" + std::to_string(i)
+               + R"(","ok":)" + (i % 2 ? "true" : "false") + "}";
+    }
+    return doc + "]";
+}
+
+auto main() -> int {
+    // Value fidelity on a mixed document
+    {
+        auto doc = parse_arena(R"({"s":"he\"llo","n":-2.5,"i":42,"b":true,"z":null,
+                                   "a":[1,"two",{"k":3}]})");
+        check(doc.has_value(), "arena parse succeeds");
+        if (doc) {
+            const auto& root = doc->root.as_object();
+            check(std::string(root.at("s").as_string()) == "he\"llo", "escaped string decoded");
+            check(root.at("n").as_number() == -2.5, "double value");
+            check(root.at("i").is_int() && root.at("i").as_int() == 42, "integer value");
+            check(root.at("b").as_bool(), "bool value");
+            check(root.at("z").is_null(), "null value");
+            const auto& arr = root.at("a").as_array();
+            check(arr.size() == 3 && std::string(arr[1].as_string()) == "two",
+                  "nested array");
+            check(arr[2].as_object().at("k").as_int() == 3, "object inside array");
+        }
+    }
+
+    // The document owns its arena: values stay valid after the input string
+    // is gone and after the document is moved
+    {
+        arena_document doc = [] {
+            std::string input = make_record_array(100);
+            auto parsed = parse_arena(input);
+            return std::move(*parsed);
+        }();  // input destroyed here
+        arena_document moved = std::move(doc);
+        const auto& arr = moved.root.as_array();
+        check(arr.size() == 100, "tree valid after move and input teardown");
+        check(std::string(arr[99].as_object().at("name").as_string()) == "rec-99",
+              "strings owned by the arena, not the input");
+    }
+
+    // Errors surface as json_error, same taxonomy as the main parser
+    {
+        check(!parse_arena("").has_value(), "empty input rejected");
+        check(!parse_arena("[1,2").has_value(), "unterminated array rejected");
+        check(!parse_arena("{\"k\":tru}").has_value(), "bad literal rejected");
+        auto err = parse_arena("[1,2");
+        if (!err) {
+            check(err.error().code == json_error_code::unexpected_end
+                      || err.error().code == json_error_code::invalid_syntax,
+                  "error carries a meaningful code");
+        }
+    }
+
+    // NUMA entry point: large top-level array takes the per-worker-arena
+    // path, small and non-array inputs fall back - results identical either way
+    {
+        std::string big = make_record_array(5000);
+        auto numa_doc = parse_arena_numa(big);
+        auto plain_doc = parse_arena(big);
+        check(numa_doc.has_value() && plain_doc.has_value(), "both arena parsers succeed");
+        if (numa_doc && plain_doc) {
+            const auto& a = numa_doc->root.as_array();
+            const auto& b = plain_doc->root.as_array();
+            check(a.size() == b.size(), "NUMA and sequential sizes agree");
+            bool same = true;
+            for (size_t i = 0; i < a.size() && same; ++i) {
+                const auto& ao = a[i].as_object();
+                const auto& bo = b[i].as_object();
+                same = ao.at("id").as_int() == bo.at("id").as_int()
+                       && std::string(ao.at("name").as_string())
+                              == std::string(bo.at("name").as_string());
+            }
+            check(same, "NUMA and sequential trees agree element-wise");
+        }
+
+        auto small = parse_arena_numa(R"({"fallback":1})");
+        check(small.has_value() && small->root.as_object().at("fallback").as_int() == 1,
+              "non-array input falls back to sequential arena parse");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_arena_parse: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,96 @@
+// Unit tests for columnar field extraction (fastjson_columnar.h): pulling a
+// numeric column out of a record array in one tape walk, the missing-value
+// conventions (NaN for floating columns, zero for integral ones), alignment
+// of the backing buffer, and rejection of non-array roots.
+#include "../../modules/fastjson_columnar.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+using namespace fastjson;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // Dense column: every element carries the field
+    {
+        std::string doc = "[";
+        for (int i = 0; i < 1000; ++i) {
+            if (i) doc += ",";
+            doc += R"({"price":)" + std::to_string(i) + R"(.5,"pad":"x"})";
+        }
+        doc += "]";
+        auto col = columnar::extract_column<double>(doc, "price");
+        check(col.has_value(), "dense column extracts");
+        if (col) {
+            auto v = col->values();
+            check(v.size() == 1000, "column length equals array length");
+            check(v[0] == 0.5 && v[999] == 999.5, "values decode in order");
+            check(reinterpret_cast<uintptr_t>(v.data()) % 64 == 0,
+                  "backing buffer is 64-byte aligned");
+        }
+    }
+
+    // Sparse and mixed elements: slots stay aligned with the array
+    {
+        const std::string doc =
+            R"([{"n":1},{"other":true},{"n":"text"},42,{"n":4},[5],{"n":null}])";
+
+        auto doubles = columnar::extract_column<double>(doc, "n");
+        check(doubles.has_value(), "sparse column extracts");
+        if (doubles) {
+            auto v = doubles->values();
+            check(v.size() == 7, "every element keeps its slot");
+            check(v[0] == 1.0 && v[4] == 4.0, "present fields decode");
+            check(std::isnan(v[1]) && std::isnan(v[2]) && std::isnan(v[3])
+                      && std::isnan(v[5]) && std::isnan(v[6]),
+                  "missing and non-numeric slots are NaN for floating columns");
+        }
+
+        auto ints = columnar::extract_column<int64_t>(doc, "n");
+        check(ints.has_value(), "integral column extracts");
+        if (ints) {
+            auto v = ints->values();
+            check(v[0] == 1 && v[4] == 4, "integral values decode");
+            check(v[1] == 0 && v[3] == 0, "missing slots are zero for integral columns");
+        }
+    }
+
+    // Negative and exponent forms through from_chars
+    {
+        auto col = columnar::extract_column<double>(R"([{"x":-2.5},{"x":1e3},{"x":0}])", "x");
+        check(col.has_value(), "number forms extract");
+        if (col) {
+            auto v = col->values();
+            check(v[0] == -2.5 && v[1] == 1000.0 && v[2] == 0.0, "number forms decode");
+        }
+    }
+
+    // Empty arrays and non-array roots
+    {
+        auto empty = columnar::extract_column<double>("[]", "x");
+        check(empty.has_value() && empty->values().empty(), "empty array yields empty column");
+
+        check(!columnar::extract_column<double>(R"({"x":1})", "x").has_value(),
+              "object root is rejected");
+        check(!columnar::extract_column<double>("42", "x").has_value(),
+              "scalar root is rejected");
+        check(!columnar::extract_column<double>("", "x").has_value(),
+              "empty document is rejected");
+    }
+
+    if (failures == 0) {
+        std::printf("test_columnar_extract: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
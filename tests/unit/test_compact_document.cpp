@@ -0,0 +1,120 @@
+// Unit tests for the compact 16-byte-node document (parse_compact /
+// compact_document): value fidelity through the view API, the short-string
+// inline path vs the pooled long-string path, object lookup by key, the
+// memory_usage accounting, and error behaviour shared with the main parser.
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // Mixed document through the view API
+    {
+        auto doc = parse_compact(
+            R"({"id":42,"ratio":-2.5,"name":"compact","ok":true,"none":null,
+                "items":[1,"two",{"k":"v"}]})");
+        check(doc.has_value(), "mixed document parses");
+        if (doc) {
+            auto root = doc->root();
+            check(root.is_object() && root.size() == 6, "root shape");
+
+            auto id = root.find("id");
+            check(id && id->is_int() && id->as_int() == 42, "int node");
+            check(id && id->as_number() == 42.0, "int readable as double");
+            auto ratio = root.find("ratio");
+            check(ratio && !ratio->is_int() && ratio->as_number() == -2.5, "double node");
+            check(root.find("ok")->as_bool(), "bool node");
+            check(root.find("none")->is_null(), "null node");
+
+            auto items = root.find("items");
+            check(items && items->is_array() && items->size() == 3, "array node");
+            check((*items)[0].as_number() == 1.0, "element by index");
+            check((*items)[1].as_string() == "two", "string element");
+            check((*items)[2].find("k")->as_string() == "v", "object inside array");
+            check(!root.find("missing").has_value(), "absent key is empty");
+
+            // Ordered key/value iteration
+            check(root.key(0) == "id" && root.value(0).as_int() == 42,
+                  "pairs keep document order");
+        }
+    }
+
+    // Short strings live inline in the node; longer ones go to the pool.
+    // Both must read back identically, right at the boundary.
+    {
+        std::string doc = "[";
+        for (size_t len = 0; len <= 32; ++len) {
+            if (len) doc += ",";
+            doc += "\"" + std::string(len, 'a') + "\"";
+        }
+        doc += "]";
+        auto parsed = parse_compact(doc);
+        check(parsed.has_value(), "string ladder parses");
+        if (parsed) {
+            auto root = parsed->root();
+            bool all = true;
+            for (size_t len = 0; len <= 32 && all; ++len) {
+                all = root[len].as_string() == std::string(len, 'a');
+            }
+            check(all, "every string length reads back across the inline/pool boundary");
+        }
+
+        auto escaped = parse_compact(R"(["esc\"q\n","é"])");
+        check(escaped.has_value(), "escaped strings parse");
+        if (escaped) {
+            check(escaped->root()[0].as_string() == "esc\"q\n", "escapes decoded");
+            check(escaped->root()[1].as_string() == "\xc3\xa9", "unicode escape decoded");
+        }
+    }
+
+    // Node accounting: a record array's footprint is nodes + child indices +
+    // pool, visible through node_count and memory_usage
+    {
+        std::string records = "[";
+        for (int i = 0; i < 1000; ++i) {
+            if (i) records += ",";
+            records += R"({"id":)" + std::to_string(i) + "}";
+        }
+        records += "]";
+        auto doc = parse_compact(records);
+        check(doc.has_value(), "record array parses");
+        if (doc) {
+            // 1 array + 1000 objects + 1000 keys + 1000 values
+            check(doc->node_count() == 3001, "node count matches the document shape");
+            check(doc->memory_usage() >= doc->node_count() * 16,
+                  "memory usage covers the node storage");
+            check(doc->root()[0].value(0).as_int() == 0
+                      && doc->root()[999].value(0).as_int() == 999,
+                  "values addressable through the flattened children");
+        }
+    }
+
+    // Errors share the main parser's taxonomy
+    {
+        check(!parse_compact("").has_value(), "empty input rejected");
+        check(!parse_compact("[1,2").has_value(), "unterminated array rejected");
+        check(!parse_compact(R"({"k":tru})").has_value(), "bad literal rejected");
+        auto err = parse_compact("[1,2");
+        check(!err.has_value()
+                  && (err.error().code == json_error_code::unexpected_end
+                      || err.error().code == json_error_code::invalid_syntax),
+              "error carries a meaningful code");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_compact_document: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,132 @@
+// Unit tests for the content-hash document cache (parse_cached): a repeat of
+// a byte-identical payload returns the previously built tree as a shared
+// pointer, near-miss payloads stay distinct, failures are never cached, the
+// cache can be disabled or cleared, and the per-shard LRU bound evicts.
+#include <iostream>
+#include <string>
+#include <vector>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    document_cache_clear();
+
+    const std::string payload = R"({"tenant":"a","items":[1,2,3],"poll":true})";
+
+    // A byte-identical repeat is a hit: same shared tree, same content
+    {
+        auto first = parse_cached(payload);
+        auto second = parse_cached(payload);
+        check(first.has_value() && second.has_value(), "both parses succeed");
+        if (first && second) {
+            check(first->get() == second->get(), "repeat returns the cached tree");
+            check(stringify(**second) == stringify(**first), "cached content intact");
+            check((**second).get("tenant").as_string() == "a", "tree readable through the hit");
+        }
+    }
+
+    // Near-miss payloads (same length, different bytes) do not alias
+    {
+        auto a = parse_cached(R"({"k":"aaaa"})");
+        auto b = parse_cached(R"({"k":"aaab"})");
+        check(a && b && a->get() != b->get(), "different payloads get different trees");
+        check(b && (**b).get("k").as_string() == "aaab", "near-miss parsed correctly");
+    }
+
+    // Failures pass through uncached, and the same bytes can still fail twice
+    {
+        auto bad = parse_cached("{broken");
+        check(!bad.has_value(), "malformed payload fails");
+        auto again = parse_cached("{broken");
+        check(!again.has_value() && again.error().code == bad.error().code,
+              "failure repeats instead of being served from the cache");
+    }
+
+    // document_cache_entries = 0 disables caching entirely
+    {
+        parse_config off;
+        off.document_cache_entries = 0;
+        set_parse_config(off);
+        auto a = parse_cached(payload);
+        auto b = parse_cached(payload);
+        check(a && b && a->get() != b->get(), "disabled cache parses fresh every time");
+        set_parse_config(parse_config{});
+    }
+
+    // clear() drops cached trees: the next parse builds a new one
+    {
+        document_cache_clear();
+        auto before = parse_cached(payload);
+        document_cache_clear();
+        auto after = parse_cached(payload);
+        check(before && after && before->get() != after->get(),
+              "clear() forces a rebuild");
+        check(before && stringify(**before) == stringify(**after),
+              "the evicted tree stays valid while a reference is held");
+    }
+
+    // LRU bound: with a tiny cache, a burst of distinct payloads evicts the
+    // oldest, while a recently re-used one survives
+    {
+        document_cache_clear();
+        parse_config small;
+        small.document_cache_entries = 512;  // 32 entries per shard
+        set_parse_config(small);
+
+        // Untouched entry: a burst of distinct payloads pushes it out
+        auto cold = parse_cached(R"({"cold":0})");
+        for (int i = 1; i <= 1000; ++i) {
+            auto filler = parse_cached(R"({"fill":)" + std::to_string(i) + "}");
+            check(filler.has_value(), "filler parses");
+        }
+        auto cold_again = parse_cached(R"({"cold":0})");
+        check(cold && cold_again && cold->get() != cold_again->get(),
+              "stale entry evicted by the burst");
+
+        // Re-used entry: touching it between fillers keeps it resident
+        auto keeper = parse_cached(R"({"keep":0})");
+        for (int i = 1; i <= 1000; ++i) {
+            auto again = parse_cached(R"({"keep":0})");
+            check(again.has_value(), "keeper re-parse succeeds");
+            auto filler = parse_cached(R"({"warm":)" + std::to_string(i) + "}");
+            check(filler.has_value(), "filler parses");
+        }
+        auto still = parse_cached(R"({"keep":0})");
+        check(keeper && still && keeper->get() == still->get(),
+              "recently used entry survives the burst");
+        set_parse_config(parse_config{});
+        document_cache_clear();
+    }
+
+    // Concurrent hits against one payload all see the same tree
+    {
+        document_cache_clear();
+        auto seed = parse_cached(payload);
+        check(seed.has_value(), "seed parse succeeds");
+        bool all_same = true;
+#pragma omp parallel for reduction(&& : all_same)
+        for (int i = 0; i < 64; ++i) {
+            auto hit = parse_cached(payload);
+            all_same = all_same && hit.has_value() && seed && hit->get() == seed->get();
+        }
+        check(all_same, "parallel hits share one immutable tree");
+        document_cache_clear();
+    }
+
+    if (failures == 0) {
+        std::cout << "test_document_cache: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,112 @@
+// Unit tests for the Eisel-Lemire number decoder (fastjson_eisel_lemire.h):
+// differential check against strtod over hand-picked hard cases and a large
+// randomized sweep, plus the punt contract - inputs the fast path cannot
+// guarantee correctly rounded must return nullopt, never a wrong double.
+#include "../../modules/fastjson_eisel_lemire.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+using namespace fastjson::numbers;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+// Bit-exact comparison: correctly rounded means the same binary64, including
+// the sign of zero
+static auto same_double(double a, double b) -> bool {
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+static auto check_against_strtod(const std::string& text) -> void {
+    auto fast = parse_double(text);
+    if (!fast) {
+        return;  // Punting is always allowed; wrong answers are not
+    }
+    double reference = std::strtod(text.c_str(), nullptr);
+    if (!same_double(*fast, reference)) {
+        std::printf("FAIL: mismatch on \"%s\": fast=%.17g strtod=%.17g\n", text.c_str(),
+                    *fast, reference);
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // Hard cases: Clinger boundaries, subnormals, round-to-even ties, and
+    // the largest/smallest finite magnitudes
+    {
+        const char* cases[] = {
+            "0", "-0", "1", "-1", "0.5", "2.5", "1e0", "1e22", "1e-22", "1e23",
+            "9007199254740992", "9007199254740993", "1.7976931348623157e308",
+            "4.9406564584124654e-324", "2.2250738585072014e-308",
+            "2.2250738585072011e-308",  // The famous PHP/Java hang value
+            "0.1", "0.2", "0.3", "123.456e-78", "1234567890123456789",
+            "9.999999999999999e22", "5e-324", "3.141592653589793",
+            "6.022e23", "-1.5e-5", "1E+10", "0.000001",
+        };
+        for (const char* c : cases) {
+            check_against_strtod(c);
+        }
+    }
+
+    // Punt contract: inputs outside the guarantees return nullopt
+    {
+        check(!parse_double("12345678901234567890").has_value(),
+              "20-digit mantissa punts");
+        check(!parse_double("1e309").has_value(), "overflow to infinity punts");
+        check(!parse_double("").has_value(), "empty input punts");
+        check(!parse_double("1.5x").has_value(), "trailing bytes punt");
+        check(!parse_double("1e").has_value(), "bare exponent punts");
+        check(!parse_double(".5").has_value() || same_double(*parse_double(".5"), 0.5),
+              "leading-dot either punts or is exact");
+    }
+
+    // Randomized differential sweep across the decimal shapes the parser
+    // feeds this path: integers, fixed-point, and scientific notation
+    {
+        std::mt19937_64 rng(0x5EED5EED);
+        std::uniform_int_distribution<uint64_t> mantissa(0, 999999999999999999ULL);
+        std::uniform_int_distribution<int> exponent(-30, 30);
+        std::uniform_int_distribution<int> frac_digits(0, 17);
+        std::uniform_int_distribution<int> shape(0, 2);
+        std::uniform_int_distribution<int> sign(0, 1);
+
+        for (int i = 0; i < 200000; ++i) {
+            uint64_t m = mantissa(rng);
+            std::string text = sign(rng) ? "-" : "";
+            switch (shape(rng)) {
+                case 0:
+                    text += std::to_string(m);
+                    break;
+                case 1: {
+                    std::string digits = std::to_string(m);
+                    int cut = 1 + static_cast<int>(digits.size() > 1
+                                                       ? rng() % (digits.size() - 1)
+                                                       : 0);
+                    text += digits.substr(0, cut) + "." + digits.substr(cut);
+                    break;
+                }
+                default:
+                    text += std::to_string(m) + "e" + std::to_string(exponent(rng));
+                    break;
+            }
+            check_against_strtod(text);
+        }
+        check(true, "randomized sweep ran");
+    }
+
+    if (failures == 0) {
+        std::printf("test_eisel_lemire: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
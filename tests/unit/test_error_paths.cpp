@@ -0,0 +1,110 @@
+// Unit tests for the non-allocating error path: json_error is a trivially
+// copyable record (code, static message, line, column) whose formatted
+// rendering is deferred to to_string(). Pins the code taxonomy per failure
+// class, line/column tracking across multi-line input, and the rendered
+// message shape.
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto error_of(std::string_view input) -> json_error {
+    auto r = parse(input);
+    if (r.has_value()) {
+        std::cout << "FAIL: expected failure for: " << input << "\n";
+        ++failures;
+        return json_error{};
+    }
+    return r.error();
+}
+
+auto main() -> int {
+    // The reject path hands back a POD: inspecting the code allocates nothing
+    static_assert(std::is_trivially_copyable_v<json_error>);
+    static_assert(std::is_trivially_destructible_v<json_error>);
+
+    // One representative input per error code
+    {
+        check(error_of("").code == json_error_code::empty_input, "empty_input");
+        check(error_of("   \n\t").code == json_error_code::empty_input,
+              "whitespace-only is empty_input");
+        check(error_of("{} trailing").code == json_error_code::extra_tokens, "extra_tokens");
+        check(error_of("[1,2").code == json_error_code::unexpected_end, "unexpected_end");
+        check(error_of("[1,]").code == json_error_code::invalid_syntax
+                  || error_of("[1,]").code == json_error_code::invalid_literal,
+              "dangling comma");
+        check(error_of("[tru]").code == json_error_code::invalid_literal, "invalid_literal");
+        check(error_of("[1.x]").code == json_error_code::invalid_number, "invalid_number");
+        check(error_of("{k:1}").code == json_error_code::invalid_string
+                  || error_of("{k:1}").code == json_error_code::invalid_syntax,
+              "unquoted key");
+        check(error_of(R"(["\q"])").code == json_error_code::invalid_escape,
+              "invalid_escape");
+        check(error_of(R"(["\ud800"])").code == json_error_code::invalid_unicode,
+              "lone surrogate is invalid_unicode");
+
+        parse_config strict;
+        strict.reject_duplicate_keys = true;
+        auto dup = parse_with_config(R"({"k":1,"k":2})", strict);
+        check(!dup.has_value() && dup.error().code == json_error_code::duplicate_key,
+              "duplicate_key under strict config");
+
+        parse_config shallow;
+        shallow.max_depth = 4;
+        auto deep = parse_with_config("[[[[[1]]]]]", shallow);
+        check(!deep.has_value() && deep.error().code == json_error_code::max_depth_exceeded,
+              "max_depth_exceeded");
+    }
+
+    // Every error carries a static message; rendering is explicit
+    {
+        auto err = error_of("[1,2");
+        check(err.message != nullptr && err.message[0] != '\0', "message present");
+        auto rendered = err.to_string();
+        check(rendered.find(error_code_name(err.code)) != std::string::npos,
+              "rendered message names the code");
+        check(rendered.find(err.message) != std::string::npos,
+              "rendered message includes the static text");
+        check(rendered.find("line") != std::string::npos
+                  && rendered.find("column") != std::string::npos,
+              "rendered message includes the position");
+    }
+
+    // Line/column point at the offending byte across newlines
+    {
+        auto err = error_of("{\n  \"a\": 1,\n  \"b\": tru\n}");
+        check(err.line == 3, "line tracks newlines");
+        check(err.column >= 8, "column points into the bad literal's line");
+
+        auto first_line = error_of("[1, x]");
+        check(first_line.line == 1, "single-line input stays on line 1");
+    }
+
+    // error_code_name covers the taxonomy with stable, distinct names
+    {
+        check(std::string_view(error_code_name(json_error_code::empty_input))
+                  != error_code_name(json_error_code::extra_tokens),
+              "code names are distinct");
+        check(std::string_view(error_code_name(json_error_code::invalid_number))
+                  == "invalid_number",
+              "names match the enumerator spelling");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_error_paths: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
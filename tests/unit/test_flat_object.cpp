@@ -0,0 +1,133 @@
+// Unit tests for the flat sorted-vector object representation and the object
+// access paths built on it: parse_config::use_flat_objects, heterogeneous
+// string_view lookup, the SIMD key-prefix scan (exercised through find on
+// small objects), key interning, and duplicate-key handling/rejection.
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto parse_flat(std::string_view input) -> json_result<json_value> {
+    parse_config config;
+    config.use_flat_objects = true;
+    return parse_with_config(input, config);
+}
+
+auto main() -> int {
+    // Flat objects parse to flat_json_object and find/at/get behave like the map
+    {
+        auto doc = parse_flat(R"({"id":7,"name":"flat","nested":{"x":1},"flag":true})");
+        check(doc.has_value() && doc->is_object(), "flat parse succeeds");
+        if (doc) {
+            check(doc->is_flat_object(), "representation is the flat object");
+            const auto& flat = doc->as_flat_object();
+            check(flat.size() == 4, "entry count");
+            check(flat.contains("name"), "contains by string_view");
+            check(flat.at("id").as_number() == 7.0, "at() finds entries");
+            check(flat.find("missing") == nullptr, "find on absent key is null");
+            check(doc->get("nested").get("x").as_number() == 1.0,
+                  "representation-agnostic get() traverses flat objects");
+        }
+    }
+
+    // Keys longer than the 16-byte SIMD prefix and shared-prefix keys must
+    // still resolve by full compare, not prefix alone
+    {
+        std::string doc = "{";
+        const char* keys[] = {"prefix_shared_key_alpha", "prefix_shared_key_beta",
+                              "prefix_shared_key_alpha_long_tail", "short", "shor"};
+        for (size_t i = 0; i < 5; ++i) {
+            if (i) doc += ",";
+            doc += "\"" + std::string(keys[i]) + "\":" + std::to_string(i);
+        }
+        doc += "}";
+        auto parsed = parse_flat(doc);
+        check(parsed.has_value(), "shared-prefix document parses");
+        if (parsed) {
+            const auto& flat = parsed->as_flat_object();
+            for (size_t i = 0; i < 5; ++i) {
+                const json_value* v = flat.find(keys[i]);
+                check(v != nullptr && v->as_number() == static_cast<double>(i),
+                      "prefix-colliding key resolves to its own value");
+            }
+            check(flat.find("prefix_shared_key_") == nullptr,
+                  "prefix of a real key does not match");
+        }
+    }
+
+    // Key interning: a record array with heavily repeated keys parses
+    // identically with interning on and off (the pool is a transparent cache)
+    {
+        std::string records = "[";
+        for (int i = 0; i < 2000; ++i) {
+            if (i) records += ",";
+            records += R"({"timestamp":)" + std::to_string(i) + R"(,"level":"info"})";
+        }
+        records += "]";
+
+        parse_config interned;
+        interned.intern_keys = true;
+        parse_config raw;
+        raw.intern_keys = false;
+
+        auto a = parse_with_config(records, interned);
+        auto b = parse_with_config(records, raw);
+        check(a.has_value() && b.has_value(), "both intern modes parse");
+        if (a && b) {
+            const auto& arr_a = a->as_array();
+            const auto& arr_b = b->as_array();
+            check(arr_a.size() == arr_b.size(), "intern modes agree on count");
+            check(arr_a[1999].get("timestamp").as_number() == 1999.0
+                      && arr_b[1999].get("timestamp").as_number() == 1999.0,
+                  "intern modes agree on values");
+        }
+    }
+
+    // Duplicate keys: tolerated by default, detectable on the flat object,
+    // rejected with duplicate_key when the config asks for it
+    {
+        const std::string dup = R"({"k":1,"other":2,"k":3})";
+
+        auto lenient = parse_flat(dup);
+        check(lenient.has_value(), "duplicates tolerated by default");
+        if (lenient) {
+            check(lenient->as_flat_object().has_duplicate_key(),
+                  "flat object reports the duplicate");
+        }
+
+        parse_config strict;
+        strict.use_flat_objects = true;
+        strict.reject_duplicate_keys = true;
+        auto rejected = parse_with_config(dup, strict);
+        check(!rejected.has_value(), "reject_duplicate_keys fails the parse");
+        if (!rejected) {
+            check(rejected.error().code == json_error_code::duplicate_key,
+                  "error code is duplicate_key");
+        }
+
+        parse_config strict_map;
+        strict_map.reject_duplicate_keys = true;
+        auto rejected_map = parse_with_config(dup, strict_map);
+        check(!rejected_map.has_value(), "map representation also rejects duplicates");
+
+        auto clean = parse_with_config(R"({"a":1,"b":2})", strict);
+        check(clean.has_value(), "unique keys pass under rejection mode");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_flat_object: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,132 @@
+// Unit tests for the incremental re-parse module: after any sequence of
+// updates the retained index must be indistinguishable from a fresh
+// build_structural_index of the current revision, splices must actually be
+// taken for confined edits (and counted), and the tape rebuilt from the
+// retained index must reflect the new content.
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../../modules/fastjson_incremental.h"
+
+using namespace fastjson;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+static auto matches_fresh_build(const incremental_index& index, const char* what) -> void {
+    auto input = index.input();
+    auto fresh = build_structural_index(std::span<const char>(input.data(), input.size()));
+    const auto& retained = index.indices();
+    bool same = fresh.size() == retained.size();
+    for (size_t i = 0; same && i < fresh.size(); ++i) {
+        same = fresh[i].position == retained[i].position && fresh[i].type == retained[i].type;
+    }
+    if (!same) {
+        std::printf("FAIL: %s (retained %zu entries vs fresh %zu)\n", what, retained.size(),
+                    fresh.size());
+        ++failures;
+    }
+}
+
+static auto make_config(size_t records, int changed, const char* value) -> std::string {
+    std::string doc = "[";
+    for (size_t i = 0; i < records; ++i) {
+        if (i) doc += ",";
+        const char* v = (static_cast<int>(i) == changed) ? value : "\"stable\"";
+        doc += R"({"id":)" + std::to_string(i) + R"(,"v":)" + v + "}";
+    }
+    return doc + "]";
+}
+
+auto main() -> int {
+    // Same-size in-place edit to one subtree: spliced, not rebuilt
+    {
+        incremental_index index(make_config(500, -1, ""));
+        check(index.stats().full_rebuilds == 1, "first revision is a full build");
+
+        index.update(make_config(500, 250, "\"edited\""));
+        check(index.stats().incremental_splices == 1, "confined edit splices");
+        check(index.stats().last_rescanned_bytes < index.input().size() / 10,
+              "splice re-scans a fraction of the document");
+        matches_fresh_build(index, "index after an in-place edit");
+
+        auto tape = index.tape();
+        check(tape.has_value(), "tape rebuilds from the retained index");
+    }
+
+    // Size-changing edits (subtree grows and shrinks): positions after the
+    // edit re-base correctly
+    {
+        incremental_index index(make_config(500, -1, ""));
+        index.update(make_config(500, 100, R"({"nested":[1,2,3],"grew":true})"));
+        matches_fresh_build(index, "index after a growing edit");
+
+        index.update(make_config(500, 100, "7"));
+        matches_fresh_build(index, "index after a shrinking edit");
+        check(index.stats().incremental_splices >= 1, "size-changing edits can splice");
+    }
+
+    // A byte-identical revision is recognized without any scan
+    {
+        incremental_index index(make_config(100, -1, ""));
+        index.update(make_config(100, -1, ""));
+        check(index.stats().unchanged == 1, "identical revision detected");
+        check(index.stats().last_rescanned_bytes == make_config(100, -1, "").size(),
+              "no re-scan recorded beyond the initial build");
+    }
+
+    // Edits the splicer cannot confine fall back to a full rebuild and stay
+    // correct: structural change spanning subtrees, and a changed root
+    {
+        incremental_index index(make_config(100, -1, ""));
+
+        std::string flattened = "[1,2,3]";
+        index.update(flattened);
+        matches_fresh_build(index, "index after the document is replaced");
+
+        index.update("{\"now\":\"an object\"}");
+        matches_fresh_build(index, "index after the root kind changes");
+
+        index.update("42");
+        matches_fresh_build(index, "index after the root becomes a scalar");
+        check(index.input() == "42", "retained input tracks every revision");
+    }
+
+    // Edits inside strings that add or remove structural-looking bytes
+    {
+        incremental_index index(make_config(300, 50, R"("plain")"));
+        index.update(make_config(300, 50, R"("{fake,[structure:]}")"));
+        matches_fresh_build(index, "index after structural bytes appear inside a string");
+
+        index.update(make_config(300, 50, R"("esc\\\"q")"));
+        matches_fresh_build(index, "index after an escape-heavy string edit");
+    }
+
+    // A long revision chain: every step must leave a correct index
+    {
+        incremental_index index(make_config(200, -1, ""));
+        for (int round = 0; round < 50; ++round) {
+            index.update(make_config(200, round * 3 % 200,
+                                     round % 2 ? "\"odd\"" : "[0,1]"));
+            if (index.indices().empty()) {
+                break;
+            }
+        }
+        matches_fresh_build(index, "index after a 50-revision chain");
+        check(index.stats().updates == 50, "every update counted");
+        check(index.stats().incremental_splices > 0, "the chain took splices");
+    }
+
+    if (failures == 0) {
+        std::printf("test_incremental_reparse: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
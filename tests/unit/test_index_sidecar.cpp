@@ -0,0 +1,157 @@
+// Unit tests for the structural-index sidecar cache: save/load round-trips
+// the exact index, build_structural_index_cached creates and then reuses the
+// sidecar, and every mismatch path (stale hash, wrong magic or version,
+// truncation, out-of-range position) falls back to a rebuild instead of
+// trusting the file.
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "../../modules/fastjson_simd_index.h"
+
+using namespace fastjson;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+static auto same_indices(const std::vector<structural_index>& a,
+                         const std::vector<structural_index>& b) -> bool {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].position != b[i].position || a[i].type != b[i].type) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static auto as_span(const std::string& s) -> std::span<const char> {
+    return {s.data(), s.size()};
+}
+
+auto main() -> int {
+    const std::string sidecar = "/tmp/fastjson_test_sidecar.fjsi";
+    std::remove(sidecar.c_str());
+
+    std::string doc = "[";
+    for (int i = 0; i < 2000; ++i) {
+        if (i) doc += ",";
+        doc += R"({"id":)" + std::to_string(i) + R"(,"s":"va\"l)" + std::to_string(i) + "\"}";
+    }
+    doc += "]";
+
+    // Save/load round-trips the exact index
+    {
+        auto built = build_structural_index(as_span(doc));
+        const uint64_t hash = content_hash(as_span(doc));
+        check(save_structural_index(sidecar, hash, built), "sidecar saves");
+
+        std::vector<structural_index> loaded;
+        check(load_structural_index(sidecar, hash, doc.size(), loaded), "sidecar loads");
+        check(same_indices(built, loaded), "loaded index matches the built one");
+    }
+
+    // The cached build reuses a matching sidecar and rebuilds on content change
+    {
+        std::remove(sidecar.c_str());
+        auto first = build_structural_index_cached(as_span(doc), sidecar);
+        check(same_indices(first, build_structural_index(as_span(doc))),
+              "first cached build matches a direct build");
+        std::FILE* created = std::fopen(sidecar.c_str(), "rb");
+        check(created != nullptr, "first build wrote the sidecar");
+        if (created) {
+            std::fclose(created);
+        }
+
+        auto second = build_structural_index_cached(as_span(doc), sidecar);
+        check(same_indices(first, second), "second build reuses the sidecar unchanged");
+
+        std::string changed = doc;
+        changed[changed.size() / 2] = '8';  // Keep the length, change the bytes
+        auto rebuilt = build_structural_index_cached(as_span(changed), sidecar);
+        check(same_indices(rebuilt, build_structural_index(as_span(changed))),
+              "changed content rebuilds instead of reusing the stale sidecar");
+
+        std::vector<structural_index> refreshed;
+        check(load_structural_index(sidecar, content_hash(as_span(changed)), changed.size(),
+                                    refreshed),
+              "the rebuild refreshed the sidecar to the new content");
+    }
+
+    // A hash mismatch never loads
+    {
+        std::vector<structural_index> out;
+        check(!load_structural_index(sidecar, 0xDEADBEEF, doc.size(), out),
+              "wrong hash rejected");
+        check(out.empty(), "rejected load leaves the index empty");
+    }
+
+    // Corruption paths: bad magic, truncation, position past the input
+    {
+        auto built = build_structural_index(as_span(doc));
+        const uint64_t hash = content_hash(as_span(doc));
+        save_structural_index(sidecar, hash, built);
+
+        std::FILE* f = std::fopen(sidecar.c_str(), "rb+");
+        check(f != nullptr, "sidecar reopens for corruption");
+        if (f) {
+            const uint32_t bad_magic = 0;
+            std::fwrite(&bad_magic, sizeof(bad_magic), 1, f);
+            std::fclose(f);
+        }
+        std::vector<structural_index> out;
+        check(!load_structural_index(sidecar, hash, doc.size(), out), "bad magic rejected");
+
+        save_structural_index(sidecar, hash, built);
+        f = std::fopen(sidecar.c_str(), "rb+");
+        if (f) {
+            std::fseek(f, 0, SEEK_END);
+            long size = std::ftell(f);
+            std::fclose(f);
+            (void)truncate(sidecar.c_str(), size / 2);
+        }
+        check(!load_structural_index(sidecar, hash, doc.size(), out), "truncation rejected");
+
+        // An index saved for the full document cannot be loaded against a
+        // shorter input: decoded positions run past input_size
+        save_structural_index(sidecar, hash, built);
+        check(!load_structural_index(sidecar, hash, doc.size() / 2, out),
+              "positions past the input rejected");
+    }
+
+    // Missing file is a clean miss
+    {
+        std::remove(sidecar.c_str());
+        std::vector<structural_index> out;
+        check(!load_structural_index(sidecar, 1, 1, out), "missing sidecar is a miss");
+    }
+
+    // Delta coding handles wide gaps between structural characters
+    {
+        std::string sparse = "[\"" + std::string(100000, 'x') + "\",1]";
+        auto built = build_structural_index(as_span(sparse));
+        const uint64_t hash = content_hash(as_span(sparse));
+        check(save_structural_index(sidecar, hash, built), "sparse document saves");
+        std::vector<structural_index> loaded;
+        check(load_structural_index(sidecar, hash, sparse.size(), loaded)
+                  && same_indices(built, loaded),
+              "wide position deltas round-trip");
+    }
+
+    std::remove(sidecar.c_str());
+
+    if (failures == 0) {
+        std::printf("test_index_sidecar: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,123 @@
+// Unit tests for the iterative parser engine (use_iterative_parser): results
+// and error codes must match the recursive engine everywhere both run, and
+// depth must be bounded only by parse_config - documents far past any sane
+// recursion budget parse on the explicit state stack.
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto iterative(std::string_view input, size_t max_depth = 1000)
+    -> json_result<json_value> {
+    parse_config cfg;
+    cfg.use_iterative_parser = true;
+    cfg.max_depth = max_depth;
+    return parse_with_config(input, cfg);
+}
+
+static auto recursive(std::string_view input) -> json_result<json_value> {
+    parse_config cfg;
+    cfg.use_iterative_parser = false;
+    return parse_with_config(input, cfg);
+}
+
+auto main() -> int {
+    // Engine parity: same documents, same trees, same verdicts
+    {
+        const char* inputs[] = {
+            R"({"a":[1,-2.5e3,"x\"y",true,null],"b":{"c":[[]],"d":{}}})",
+            "[]", "{}", "7", "\"s\"", "[[1],[2,[3,[4]]]]",
+            R"({"deep":{"er":{"est":[0]}}})",
+            // Malformed
+            "[1,2", "{\"k\":}", "[1,,2]", "tru", "{} extra", "",
+        };
+        for (const char* in : inputs) {
+            auto it = iterative(in);
+            auto rec = recursive(in);
+            check(it.has_value() == rec.has_value(), "engines agree on the verdict");
+            if (it && rec) {
+                check(stringify(*it) == stringify(*rec), "engines build identical trees");
+            } else if (!it && !rec) {
+                check(it.error().code == rec.error().code, "engines agree on the code");
+            }
+        }
+    }
+
+    // Deep nesting parses on the explicit stack, far past any recursion
+    // budget, and unwinds to the right value
+    {
+        const size_t depth = 200000;
+        std::string deep(depth, '[');
+        deep += "42";
+        deep += std::string(depth, ']');
+
+        auto result = iterative(deep, depth + 1);
+        check(result.has_value(), "200k-deep array parses iteratively");
+        if (result) {
+            const json_value* v = &*result;
+            size_t levels = 0;
+            while (v->is_array() && !v->as_array().empty()) {
+                v = &v->as_array()[0];
+                ++levels;
+            }
+            check(levels == depth && v->as_number() == 42.0,
+                  "every nesting level is present with the payload at the bottom");
+        }
+
+        // Mixed object/array nesting at depth
+        std::string mixed;
+        for (size_t i = 0; i < 50000; ++i) {
+            mixed += R"({"n":[)";
+        }
+        mixed += "1";
+        for (size_t i = 0; i < 50000; ++i) {
+            mixed += "]}";
+        }
+        check(iterative(mixed, 200001).has_value(), "mixed deep nesting parses");
+    }
+
+    // The depth limit still applies, with the same error code
+    {
+        auto over = iterative("[[[[[1]]]]]", 4);
+        check(!over.has_value()
+                  && over.error().code == json_error_code::max_depth_exceeded,
+              "iterative engine enforces max_depth");
+
+        // At the boundary the two engines must agree exactly, whichever side
+        // of the limit the innermost value lands on
+        parse_config shallow;
+        shallow.max_depth = 4;
+        shallow.use_iterative_parser = false;
+        auto rec = parse_with_config("[[[[1]]]]", shallow);
+        auto it = iterative("[[[[1]]]]", 4);
+        check(it.has_value() == rec.has_value(),
+              "engines agree at the depth boundary");
+    }
+
+    // Deep but malformed documents fail cleanly rather than by resource
+    // exhaustion
+    {
+        std::string unclosed(100000, '[');
+        auto result = iterative(unclosed, 200000);
+        check(!result.has_value()
+                  && result.error().code == json_error_code::unexpected_end,
+              "unclosed deep nesting reports unexpected_end");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_iterative_parser: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
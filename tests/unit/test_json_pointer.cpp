@@ -0,0 +1,93 @@
+// Unit tests for RFC 6901 JSON Pointer evaluation over the structural index
+// (fastjson_pointer.h): token unescaping (~0 / ~1), object and array
+// descent, raw-text extraction without sibling materialization, and the
+// rejection rules for malformed pointers and missing paths.
+#include "../../modules/fastjson_pointer.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace fastjson;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    const std::string doc = R"({
+        "results": [
+            {"score": 10, "tags": ["a", "b"]},
+            {"score": -2.5, "tags": []}
+        ],
+        "a/b": 1,
+        "m~n": 2,
+        "": 3,
+        "nested": {"": {"deep": true}}
+    })";
+
+    // Plain descent through objects and arrays
+    {
+        check(pointer::at_pointer(doc, "/results/0/score") == "10", "object/array descent");
+        check(pointer::at_pointer(doc, "/results/1/score") == "-2.5",
+              "second element, siblings skipped");
+        check(pointer::at_pointer(doc, "/results/0/tags/0") == "\"a\"",
+              "array of strings by index");
+    }
+
+    // Raw text spans: strings keep their quotes, containers their brackets
+    {
+        auto tag = pointer::at_pointer(doc, "/results/0/tags/1");
+        check(tag == "\"b\"", "string value includes quotes");
+        auto arr = pointer::at_pointer(doc, "/results/0/tags");
+        check(arr == R"(["a", "b"])", "container span is the raw subtree text");
+        auto empty_arr = pointer::at_pointer(doc, "/results/1/tags");
+        check(empty_arr == "[]", "empty container span");
+    }
+
+    // RFC 6901 escaping: ~1 is '/', ~0 is '~'; empty token is a real key
+    {
+        check(pointer::at_pointer(doc, "/a~1b") == "1", "~1 unescapes to slash");
+        check(pointer::at_pointer(doc, "/m~0n") == "2", "~0 unescapes to tilde");
+        check(pointer::at_pointer(doc, "/") == "3", "empty token names the empty key");
+        check(pointer::at_pointer(doc, "/nested//deep") == "true",
+              "empty token mid-path");
+    }
+
+    // Empty pointer designates the whole document
+    {
+        auto whole = pointer::at_pointer("[1,2,3]", "");
+        check(whole == "[1,2,3]", "empty pointer returns the root");
+    }
+
+    // Invalid pointers and missing paths resolve to nullopt
+    {
+        check(!pointer::at_pointer(doc, "results").has_value(), "missing leading slash");
+        check(!pointer::at_pointer(doc, "/missing").has_value(), "absent key");
+        check(!pointer::at_pointer(doc, "/results/2").has_value(), "index past the end");
+        check(!pointer::at_pointer(doc, "/results/01").has_value(),
+              "leading-zero index rejected");
+        check(!pointer::at_pointer(doc, "/results/-").has_value(),
+              "append token '-' has no value to read");
+        check(!pointer::at_pointer(doc, "/results/x").has_value(), "non-numeric index");
+        check(!pointer::at_pointer(doc, "/results/99999999999999999999").has_value(),
+              "index past uint64_t resolves to nullopt, not an exception");
+        check(!pointer::at_pointer(doc, "/results/18446744073709551615").has_value(),
+              "UINT64_MAX index is just a path that does not exist");
+        check(!pointer::at_pointer(doc, "/a~2b").has_value(), "bad escape rejected");
+        check(!pointer::at_pointer(doc, "/a~").has_value(), "dangling tilde rejected");
+        check(!pointer::at_pointer(doc, "/results/0/score/deeper").has_value(),
+              "descent into a scalar rejected");
+        check(!pointer::at_pointer("", "/a").has_value(), "empty document");
+    }
+
+    if (failures == 0) {
+        std::printf("test_json_pointer: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
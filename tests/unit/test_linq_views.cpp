@@ -0,0 +1,153 @@
+// Unit tests for the LINQ layer (json_linq.h): eager query_result operators,
+// the SIMD selector-free aggregations over arithmetic columns, grouping,
+// joins, zip, prefix sums, and the lazy view pipeline - including proof that
+// lazy chains evaluate element-at-a-time and stop early on short-circuit
+// terminals.
+#include "../../modules/json_linq.h"
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace fastjson::linq;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+struct order {
+    int id;
+    std::string region;
+    double total;
+};
+
+auto main() -> int {
+    // Eager pipeline: where / select / aggregation
+    {
+        std::vector<order> rows;
+        for (int i = 0; i < 100; ++i) {
+            rows.push_back({i, i % 2 ? "east" : "west", i * 1.5});
+        }
+        query_result<order> q(std::move(rows));
+
+        auto east_totals = q.where([](const order& o) { return o.region == "east"; })
+                               .select([](const order& o) { return o.total; });
+        check(east_totals.size() == 50, "where filters");
+        check(east_totals.sum() == 3750.0, "selector-free SIMD sum over doubles");
+        check(east_totals.min() == 1.5 && east_totals.max() == 148.5, "SIMD min/max");
+        check(east_totals.average() == 75.0, "SIMD average");
+
+        check(q.count([](const order& o) { return o.total > 100.0; }) == 33,
+              "count with predicate");
+        check(q.any([](const order& o) { return o.id == 99; }), "any finds the last row");
+        check(q.all([](const order& o) { return o.total >= 0.0; }), "all over the column");
+        check(q.find([](const order& o) { return o.id == 42; })->region == "west", "find");
+        check(!q.single().has_value(), "single on many rows is empty");
+    }
+
+    // Integer columns hit the i32/i64 SIMD kernels, remainder lanes included
+    {
+        std::vector<int32_t> narrow;
+        std::vector<int64_t> wide;
+        for (int i = 1; i <= 1001; ++i) {  // Odd count leaves a scalar tail
+            narrow.push_back(i % 2 ? i : -i);
+            wide.push_back(static_cast<int64_t>(i) * 1000000);
+        }
+        query_result<int32_t> qn(std::move(narrow));
+        query_result<int64_t> qw(std::move(wide));
+        check(qn.sum() == 501, "i32 SIMD sum with tail");
+        check(qn.min() == -1000 && qn.max() == 1001, "i32 SIMD min/max");
+        check(qw.sum() == 501501000000LL, "i64 SIMD sum");
+    }
+
+    // distinct, prefix_sum, zip
+    {
+        query_result<int> q(std::vector<int>{3, 1, 3, 2, 1});
+        check(q.distinct().size() == 3, "distinct removes repeats");
+
+        auto running = query_result<int>(std::vector<int>{1, 2, 3, 4}).prefix_sum();
+        check(running.size() == 4 && running[3] == 10, "prefix_sum cumulative");
+
+        auto seeded = query_result<int>(std::vector<int>{1, 2, 3})
+                          .prefix_sum(100, [](int acc, int v) { return acc + v; });
+        check(seeded.size() == 4 && seeded[0] == 100 && seeded[3] == 106,
+              "seeded prefix_sum includes the seed");
+
+        query_result<int> a(std::vector<int>{1, 2, 3});
+        query_result<std::string> b(std::vector<std::string>{"x", "y", "z"});
+        auto zipped = a.zip(b);
+        check(zipped.size() == 3 && zipped[1] == std::make_pair(2, std::string("y")),
+              "zip pairs in order");
+    }
+
+    // group_by and join
+    {
+        std::vector<order> rows = {{1, "east", 10}, {2, "west", 20}, {3, "east", 30}};
+        query_result<order> q(std::move(rows));
+
+        auto groups = q.group_by([](const order& o) { return o.region; });
+        check(groups.size() == 2, "group_by key count");
+        check(groups.at("east").size() == 2 && groups.at("west").size() == 1,
+              "group_by buckets by key");
+
+        query_result<std::pair<std::string, int>> regions(
+            std::vector<std::pair<std::string, int>>{{"east", 1}, {"west", 2}});
+        auto joined = q.join(
+            regions, [](const order& o) { return o.region; },
+            [](const auto& r) { return r.first; },
+            [](const order& o, const auto& r) { return o.id * 100 + r.second; });
+        check(joined.count() == 3, "join matches every row");
+        check(joined.any([](int v) { return v == 302; }) == false
+                  && joined.any([](int v) { return v == 301; }),
+              "join pairs rows with their region");
+    }
+
+    // Lazy views: adaptors defer, terminals run the chain once
+    {
+        std::vector<int> source;
+        for (int i = 1; i <= 1000; ++i) {
+            source.push_back(i);
+        }
+        query_result<int> q(std::move(source));
+
+        int evaluated = 0;
+        auto pipeline = q.lazy()
+                            .select([&](int v) {
+                                ++evaluated;
+                                return v * 2;
+                            })
+                            .where([](int v) { return v % 3 == 0; });
+        check(evaluated == 0, "building the chain evaluates nothing");
+
+        auto first = pipeline.first();
+        check(first == 6, "first finds the first passing element");
+        check(evaluated == 3, "first stops the scan at the first hit");
+
+        evaluated = 0;
+        auto taken = pipeline.take(5).to_vector();
+        check(taken == std::vector<int>{6, 12, 18, 24, 30}, "take collects in order");
+        check(evaluated == 15, "take stops the upstream scan early");
+
+        check(q.lazy().skip(990).count() == 10, "skip drops the prefix");
+        check(q.lazy().take_while([](int v) { return v < 100; }).count() == 99,
+              "take_while cuts at the first failure");
+        check(q.lazy().any([](int v) { return v > 999; }), "lazy any");
+        check(!q.lazy().all([](int v) { return v < 1000; }), "lazy all short-circuits");
+        check(q.lazy().sum([](int v) { return static_cast<long long>(v); }) == 500500LL,
+              "lazy sum with selector");
+        check(q.lazy().where([](int v) { return v % 2 == 0; }).to_query().count() == 500,
+              "to_query re-enters the eager world");
+    }
+
+    if (failures == 0) {
+        std::printf("test_linq_views: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
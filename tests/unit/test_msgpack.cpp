@@ -0,0 +1,115 @@
+// Unit tests for the MessagePack codec (encode_msgpack / decode_msgpack):
+// wire-format spot checks against the spec's tag bytes, JSON -> msgpack ->
+// JSON round-trip fidelity including integer width promotion, and decoder
+// rejection of truncated and over-long buffers.
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto encode_text(std::string_view json) -> std::vector<uint8_t> {
+    auto doc = parse(json);
+    if (!doc) {
+        return {};
+    }
+    return encode_msgpack(*doc);
+}
+
+static auto round_trip(std::string_view json, const char* what) -> void {
+    auto doc = parse(json);
+    check(doc.has_value(), what);
+    if (!doc) {
+        return;
+    }
+    auto bytes = encode_msgpack(*doc);
+    auto back = decode_msgpack(bytes);
+    check(back.has_value(), "encoded bytes decode");
+    check(back && stringify(*back) == stringify(*doc), "round trip preserves the value");
+}
+
+auto main() -> int {
+    // Spec tag bytes for the compact fixed forms
+    {
+        check(encode_text("null") == std::vector<uint8_t>{0xC0}, "nil tag");
+        check(encode_text("false") == std::vector<uint8_t>{0xC2}, "false tag");
+        check(encode_text("true") == std::vector<uint8_t>{0xC3}, "true tag");
+        check(encode_text("7") == std::vector<uint8_t>{0x07}, "positive fixint");
+        check(encode_text("-1") == std::vector<uint8_t>{0xFF}, "negative fixint");
+        check(encode_text("\"ab\"") == std::vector<uint8_t>{0xA2, 'a', 'b'}, "fixstr");
+        check(encode_text("[]") == std::vector<uint8_t>{0x90}, "empty fixarray");
+        check(encode_text("{}") == std::vector<uint8_t>{0x80}, "empty fixmap");
+
+        auto pair = encode_text("[1,2]");
+        check(pair == std::vector<uint8_t>{0x92, 0x01, 0x02}, "fixarray with count");
+    }
+
+    // Width promotion: values outside the fix ranges pick the sized forms
+    {
+        auto u8 = encode_text("200");
+        check(!u8.empty() && u8[0] == 0xCC, "uint8 form");
+        auto u16 = encode_text("40000");
+        check(!u16.empty() && u16[0] == 0xCD, "uint16 form");
+        auto i8 = encode_text("-100");
+        check(!i8.empty() && i8[0] == 0xD0, "int8 form");
+        auto f64 = encode_text("-2.5");
+        check(!f64.empty() && (f64[0] == 0xCB || f64[0] == 0xCA), "float form");
+        auto s40 = encode_text("\"" + std::string(40, 'x') + "\"");
+        check(!s40.empty() && s40[0] == 0xD9, "str8 form past fixstr");
+    }
+
+    // Round trips across the value space
+    {
+        round_trip(R"({"a":[1,-2.5,"x",true,null],"b":{"c":"nested"}})", "mixed document");
+        round_trip("[0,127,128,-32,-33,65535,65536,4294967296,9223372036854775807]",
+                   "integer width ladder");
+        round_trip(R"(["",  "short", ")" + std::string(300, 'y') + R"("])",
+                   "string length ladder");
+
+        std::string big = "[";
+        for (int i = 0; i < 100; ++i) {
+            if (i) big += ",";
+            big += R"({"id":)" + std::to_string(i) + "}";
+        }
+        big += "]";
+        round_trip(big, "array past the fixarray limit");
+    }
+
+    // Decoder rejects malformed buffers instead of reading past the end
+    {
+        auto good = encode_text(R"({"k":[1,2,3]})");
+        check(good.size() > 2, "fixture encodes");
+
+        std::vector<uint8_t> truncated(good.begin(), good.end() - 2);
+        check(!decode_msgpack(truncated).has_value(), "truncated buffer rejected");
+
+        auto padded = good;
+        padded.push_back(0xC0);
+        check(!decode_msgpack(padded).has_value(), "trailing bytes rejected");
+
+        check(!decode_msgpack(std::span<const uint8_t>{}).has_value(), "empty buffer rejected");
+
+        // str8 claiming more bytes than the buffer holds
+        std::vector<uint8_t> lying = {0xD9, 0x20, 'a', 'b'};
+        check(!decode_msgpack(lying).has_value(), "lying length header rejected");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_msgpack: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,139 @@
+// Unit tests for the multi-document entry points: parse_ndjson (line
+// splitting, CRLF, blank rows, per-line error isolation), parse_many over
+// both caller-owned slices and concatenated streams, parse_one's incremental
+// consumption contract, and RFC 7464 JSON text sequences (parse_json_seq).
+#include <iostream>
+#include <string>
+#include <vector>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // parse_ndjson: one result per non-blank line, CRLF trimmed, order kept
+    {
+        std::string feed;
+        for (int i = 0; i < 200; ++i) {
+            feed += R"({"seq":)" + std::to_string(i) + "}\n";
+        }
+        auto results = parse_ndjson(feed);
+        check(results.size() == 200, "one result per line");
+        bool ordered = true;
+        for (size_t i = 0; i < results.size() && ordered; ++i) {
+            ordered = results[i].has_value()
+                      && (*results[i]).get("seq").as_number() == static_cast<double>(i);
+        }
+        check(ordered, "results stay in line order");
+
+        auto crlf = parse_ndjson("{\"a\":1}\r\n\r\n{\"b\":2}\r\n");
+        check(crlf.size() == 2 && crlf[0].has_value() && crlf[1].has_value(),
+              "CRLF and blank rows handled");
+
+        check(parse_ndjson("").empty(), "empty feed yields no results");
+        check(parse_ndjson("\n\n\n").empty(), "blank-only feed yields no results");
+    }
+
+    // parse_ndjson: a bad line fails alone, neighbours still parse
+    {
+        auto results = parse_ndjson("{\"ok\":1}\n{broken\n{\"ok\":2}\n");
+        check(results.size() == 3, "bad line keeps its slot");
+        check(results[0].has_value() && results[2].has_value(),
+              "neighbours of a bad line still parse");
+        check(!results[1].has_value(), "bad line reports its own error");
+    }
+
+    // parse_many over caller-owned slices: results line up with the input span
+    {
+        std::vector<std::string> owned;
+        for (int i = 0; i < 50; ++i) {
+            owned.push_back(R"({"n":)" + std::to_string(i) + "}");
+        }
+        owned[25] = "{oops";
+        std::vector<std::string_view> views(owned.begin(), owned.end());
+        auto results = parse_many(std::span<const std::string_view>(views));
+        check(results.size() == 50, "one result per slice");
+        check(results[49].has_value() && (*results[49]).get("n").as_number() == 49.0,
+              "slice results line up");
+        check(!results[25].has_value(), "bad slice fails in place");
+    }
+
+    // parse_many over a concatenated stream: boundary discovery through the
+    // depth scan, whitespace between documents tolerated
+    {
+        auto results = parse_many(R"({"a":[1,2]}  {"b":"}not a brace"} 42 [true])");
+        check(results.size() == 4, "concatenated stream splits into documents");
+        if (results.size() == 4) {
+            check(results[0].has_value() && (*results[0]).get("a").is_array(),
+                  "first document");
+            check(results[1].has_value()
+                      && std::string((*results[1]).get("b").as_string()) == "}not a brace",
+                  "braces inside strings do not split");
+            check(results[2].has_value() && (*results[2]).as_number() == 42.0,
+                  "bare scalar document");
+            check(results[3].has_value(), "trailing array document");
+        }
+
+        auto unterminated = parse_many(R"({"a":1} {"never)");
+        check(unterminated.size() == 2 && !unterminated[1].has_value(),
+              "unterminated tail swallows the rest and reports its error");
+    }
+
+    // parse_one: consumed advances past exactly one document
+    {
+        std::string stream = R"(  {"first":1}{"second":2} 3 )";
+        size_t consumed = 0;
+        auto first = parse_one(stream, consumed);
+        check(first.has_value() && first->get("first").as_number() == 1.0, "first document");
+
+        auto second = parse_one(std::string_view(stream).substr(consumed), consumed);
+        check(second.has_value() && second->get("second").as_number() == 2.0,
+              "consumed resumes at the next document");
+
+        size_t ignored = 0;
+        auto empty = parse_one("   ", ignored);
+        check(!empty.has_value() && empty.error().code == json_error_code::empty_input,
+              "whitespace-only stream is empty_input");
+    }
+
+    // parse_json_seq: RS-delimited records, missing leading RS tolerated,
+    // empty records skipped
+    {
+        std::string seq;
+        seq += '\x1e';
+        seq += "{\"a\":1}\n";
+        seq += '\x1e';
+        seq += '\x1e';  // Empty record
+        seq += "[2,3]\n";
+        seq += "\x1e\"tail\"";  // No final LF
+        auto results = parse_json_seq(seq);
+        check(results.size() == 3, "empty records skipped");
+        if (results.size() == 3) {
+            check(results[0].has_value() && (*results[0]).get("a").as_number() == 1.0,
+                  "first record");
+            check(results[1].has_value() && (*results[1]).as_array().size() == 2,
+                  "second record");
+            check(results[2].has_value()
+                      && std::string((*results[2]).as_string()) == "tail",
+                  "record without final LF tolerated");
+        }
+
+        auto bare = parse_json_seq("{\"no_rs\":true}");
+        check(bare.size() == 1 && bare[0].has_value(), "missing leading RS tolerated");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_multidoc_parse: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
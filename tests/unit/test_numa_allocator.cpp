@@ -0,0 +1,113 @@
+// Unit tests for the NUMA allocation layer (numa_allocator.h): topology
+// detection on hosts with and without libnuma, plain / local / interleaved /
+// huge-page allocation paths with their fallbacks, the allocation counters,
+// numa_buffer element access, and the pmr adapters used by the parse arenas.
+#include "../../modules/numa_allocator.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace fastjson::numa;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    numa_allocator alloc;
+
+    // Topology: detection must report a coherent shape whether or not
+    // libnuma is present (single node, node 0, when it is not)
+    {
+        const auto& topo = alloc.get_topology();
+        check(topo.num_nodes >= 1, "at least one node reported");
+        check(alloc.get_num_nodes() == topo.num_nodes, "accessor agrees with topology");
+        std::printf("numa available: %s, nodes: %d\n",
+                    alloc.is_numa_available() ? "yes" : "no", topo.num_nodes);
+    }
+
+    // Plain, local, and interleaved allocations are writable and tracked
+    {
+        void* p = alloc.allocate(1 << 16);
+        check(p != nullptr, "allocate returns memory");
+        std::memset(p, 0x5A, 1 << 16);
+        check(alloc.get_allocated_bytes() >= (1 << 16), "byte counter tracks");
+        check(alloc.get_allocation_count() >= 1, "allocation counter tracks");
+        alloc.deallocate(p, 1 << 16);
+
+        void* local = alloc.allocate_local(4096);
+        check(local != nullptr, "allocate_local falls back without libnuma");
+        std::memset(local, 1, 4096);
+        alloc.deallocate(local, 4096);
+
+        void* inter = alloc.allocate_interleaved(1 << 20);
+        check(inter != nullptr, "allocate_interleaved falls back without libnuma");
+        std::memset(inter, 2, 1 << 20);
+        alloc.deallocate(inter, 1 << 20);
+
+        // Out-of-range preferred node degrades to a usable allocation
+        void* wild = alloc.allocate(4096, 4096);
+        check(wild != nullptr, "bad preferred node still allocates");
+        alloc.deallocate(wild, 4096);
+    }
+
+    // Huge-page path: 4 MB crosses the 2 MB page size; without hugetlbfs
+    // reservations it must fall back to a THP-advised anonymous mapping,
+    // never to a null pointer
+    {
+        const size_t big = 4ull << 20;
+        void* huge = alloc.allocate_huge(big);
+        check(huge != nullptr, "allocate_huge falls back when no reservation exists");
+        if (huge != nullptr) {
+            std::memset(huge, 0xCD, big);
+            check(static_cast<unsigned char*>(huge)[big - 1] == 0xCD,
+                  "huge region writable end to end");
+            alloc.deallocate(huge, big);
+        }
+
+        // Sub-page sizes are still served
+        void* small = alloc.allocate_huge(4096);
+        check(small != nullptr, "small huge-page request served");
+        alloc.deallocate(small, 4096);
+    }
+
+    // numa_buffer: typed view over node-affine (optionally huge) memory
+    {
+        numa_buffer<double> plain(1024, -1, alloc, false);
+        check(plain.data() != nullptr && plain.size() == 1024, "plain buffer allocates");
+        for (size_t i = 0; i < plain.size(); ++i) {
+            plain[i] = static_cast<double>(i);
+        }
+        check(plain[1023] == 1023.0, "element access round-trips");
+
+        numa_buffer<char> huge(3u << 20, -1, alloc, true);
+        check(huge.data() != nullptr, "huge-backed buffer allocates");
+        huge[huge.size() - 1] = 'x';
+        check(huge[huge.size() - 1] == 'x', "huge-backed buffer writable");
+    }
+
+    // pmr adapters feed the parse arenas
+    {
+        numa_memory_resource res(alloc);
+        std::pmr::vector<int> v(&res);
+        v.resize(10000, 7);
+        check(v[9999] == 7, "numa pmr resource serves a pmr container");
+
+        huge_page_memory_resource huge_res(alloc);
+        std::pmr::vector<char> h(&huge_res);
+        h.resize(1 << 20, 'h');
+        check(h[(1 << 20) - 1] == 'h', "huge-page pmr resource serves a pmr container");
+    }
+
+    if (failures == 0) {
+        std::printf("test_numa_allocator: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
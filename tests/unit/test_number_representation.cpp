@@ -0,0 +1,123 @@
+// Unit tests for the DOM number representations: native integer storage
+// without a double round-trip (64-bit IDs above 2^53 survive exactly),
+// 128-bit widening, verbatim serialization of wide integers, and the opt-in
+// lazy raw-number mode with memoized on-demand materialization.
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // Integers above 2^53 come back exactly through as_int64, where a double
+    // round-trip would round them
+    {
+        auto doc = parse("[9007199254740993,9223372036854775807,-9223372036854775808,42]");
+        check(doc.has_value(), "integer document parses");
+        if (doc) {
+            const auto& a = doc->as_array();
+            check(a[0].is_int64() && a[0].as_int64() == 9007199254740993LL,
+                  "2^53+1 survives exactly");
+            check(a[1].as_int64() == std::numeric_limits<int64_t>::max(),
+                  "INT64_MAX survives exactly");
+            check(a[2].as_int64() == std::numeric_limits<int64_t>::min(),
+                  "INT64_MIN survives exactly");
+            check(a[3].is_number() && a[3].as_number() == 42.0,
+                  "small integers still read as numbers");
+        }
+    }
+
+    // Beyond int64: 128-bit storage, is_int64 goes false, text round-trips
+    // without precision loss
+    {
+        const std::string wide = "[18446744073709551616,-170141183460469231731687303715884105728]";
+        auto doc = parse(wide);
+        check(doc.has_value(), "128-bit integers parse");
+        if (doc) {
+            const auto& a = doc->as_array();
+            check(!a[0].is_int64(), "2^64 does not claim to fit int64");
+            check(a[0].is_int128() || a[0].is_uint128() || a[0].is_raw_number(),
+                  "2^64 stored in a wide representation");
+            check(stringify(*doc) == wide, "wide integers serialize verbatim");
+        }
+    }
+
+    // Fractions and exponents stay doubles
+    {
+        auto doc = parse("[-2.5,1e3,0.1]");
+        check(doc.has_value(), "float forms parse");
+        if (doc) {
+            const auto& a = doc->as_array();
+            check(!a[0].is_int64() && a[0].as_number() == -2.5, "fraction is a double");
+            check(a[1].as_number() == 1000.0, "exponent form value");
+        }
+    }
+
+    // Lazy raw numbers: tokens are kept verbatim, materialization happens on
+    // first access and memoizes, and serialization emits the original text
+    {
+        parse_config lazy;
+        lazy.lazy_numbers = true;
+        auto doc = parse_with_config(
+            R"({"untouched":1.2300,"id":9007199254740993,"ratio":-2.5e-1})", lazy);
+        check(doc.has_value(), "lazy document parses");
+        if (doc) {
+            const auto& untouched = doc->get("untouched");
+            check(untouched.is_raw_number(), "lazy mode stores raw tokens");
+            check(untouched.as_raw_number().token() == "1.2300",
+                  "token preserved verbatim, trailing zeros included");
+            check(stringify(*doc).find("1.2300") != std::string::npos,
+                  "serialization emits the untouched token unchanged");
+
+            const auto& id = doc->get("id");
+            check(id.is_raw_number() && id.as_raw_number().is_integral(),
+                  "integral token classified without materializing");
+            check(id.is_int64() && id.as_int64() == 9007199254740993LL,
+                  "lazy integer materializes exactly");
+            check(id.as_int64() == 9007199254740993LL,
+                  "second access hits the memoized value");
+
+            const auto& ratio = doc->get("ratio");
+            check(!ratio.as_raw_number().is_integral(), "exponent token is not integral");
+            check(ratio.as_number() == -0.25, "lazy double materializes");
+        }
+
+        // Lazy and eager agree on values across a record batch
+        std::string batch = "[";
+        for (int i = 0; i < 500; ++i) {
+            if (i) batch += ",";
+            batch += R"({"v":)" + std::to_string(i) + "." + std::to_string(i % 10) + "}";
+        }
+        batch += "]";
+        auto lazy_doc = parse_with_config(batch, lazy);
+        auto eager_doc = parse(batch);
+        check(lazy_doc.has_value() && eager_doc.has_value(), "batch parses both ways");
+        if (lazy_doc && eager_doc) {
+            bool same = true;
+            const auto& la = lazy_doc->as_array();
+            const auto& ea = eager_doc->as_array();
+            for (size_t i = 0; i < la.size() && same; ++i) {
+                same = la[i].get("v").as_number() == ea[i].get("v").as_number();
+            }
+            check(same, "lazy and eager materialization agree");
+        }
+    }
+
+    if (failures == 0) {
+        std::cout << "test_number_representation: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,96 @@
+// Unit tests for the on-demand two-stage parser (fastjson_ondemand.h):
+// stage-1 structural index plus lazy value materialization - only fields the
+// caller touches are decoded, so navigation must work directly off the index.
+#include "../../modules/fastjson_ondemand.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace fastjson;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    const std::string doc = R"({
+        "name": "widget \"deluxe\"",
+        "count": 42,
+        "price": -3.25,
+        "enabled": true,
+        "extra": null,
+        "tags": ["a", "b", "c"],
+        "nested": {"deep": {"value": 7}, "list": [1, [2, 3], {"k": 4}]}
+    })";
+
+    auto parsed = ondemand::parse(doc);
+    auto root = parsed.root();
+    check(root.valid() && root.is_object(), "root is an object");
+
+    // Field lookup without touching sibling values
+    auto count = root.find_field("count");
+    check(count && count->is_number() && count->get_double() == 42.0, "integer field");
+
+    auto price = root.find_field("price");
+    check(price && price->get_double() == -3.25, "negative decimal field");
+
+    auto enabled = root.find_field("enabled");
+    check(enabled && enabled->get_bool() == true, "boolean field");
+
+    auto extra = root.find_field("extra");
+    check(extra && extra->is_null(), "null field");
+
+    // Escaped string: raw view keeps the escapes, get_string decodes them
+    auto name = root.find_field("name");
+    check(name && name->is_string(), "string field found");
+    if (name) {
+        check(name->get_raw_string() == "widget \\\"deluxe\\\"", "raw string keeps escapes");
+        check(name->get_string() == "widget \"deluxe\"", "decoded string unescapes");
+    }
+
+    // Array navigation
+    auto tags = root.find_field("tags");
+    check(tags && tags->is_array() && tags->count_elements() == 3, "array element count");
+    if (tags) {
+        auto second = tags->at(1);
+        check(second && second->get_string() == "b", "array element by index");
+        check(!tags->at(3).has_value(), "out-of-range index is empty");
+    }
+
+    // Nested containers are skipped, not parsed, while navigating past them
+    auto nested = root.find_field("nested");
+    check(nested && nested->is_object(), "nested object");
+    if (nested) {
+        auto deep = nested->find_field("deep");
+        check(deep && deep->find_field("value") &&
+                  deep->find_field("value")->get_double() == 7.0,
+              "deep field through two levels");
+        auto list = nested->find_field("list");
+        check(list && list->count_elements() == 3, "mixed list count skips subtrees");
+        auto inner = list ? list->at(2) : std::nullopt;
+        check(inner && inner->find_field("k") && inner->find_field("k")->get_double() == 4.0,
+              "object inside array");
+    }
+
+    // Absent fields and wrong-kind access return empty, never throw
+    check(!root.find_field("missing").has_value(), "missing field is empty");
+    check(count && !count->get_string().has_value(), "number as string is empty");
+    check(tags && !tags->find_field("x").has_value(), "find_field on array is empty");
+
+    // Scalar root documents
+    auto num_root = ondemand::parse("  1250  ");
+    check(num_root.root().get_double() == 1250.0, "scalar number root");
+    auto str_root = ondemand::parse("\"plain\"");
+    check(str_root.root().get_string() == "plain", "scalar string root");
+
+    if (failures == 0) {
+        std::printf("test_ondemand_parser: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,138 @@
+// Unit tests for the parallel stage-1 structural scan: the chunked scan with
+// speculative in-string/out-of-string interpretations and carry stitching
+// must produce the exact index the serial scan does, for documents designed
+// to put string state, escapes, and backslash runs on the chunk joins.
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../modules/fastjson_simd_index.h"
+
+using namespace fastjson;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+static auto same_indices(const std::vector<structural_index>& a,
+                         const std::vector<structural_index>& b) -> bool {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].position != b[i].position || a[i].type != b[i].type) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static auto differential(const std::string& doc, int threads, const char* what) -> void {
+    std::span<const char> input(doc.data(), doc.size());
+    auto serial = build_structural_index_serial(input);
+    auto parallel = build_structural_index_parallel(input, threads);
+    if (!same_indices(serial, parallel)) {
+        std::printf("FAIL: %s (%zu-byte input, %d threads: %zu serial vs %zu parallel "
+                    "entries)\n",
+                    what, doc.size(), threads, serial.size(), parallel.size());
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // Large record array: strings and structure land on every chunk join for
+    // some thread count
+    {
+        std::string doc = "[";
+        for (int i = 0; i < 30000; ++i) {
+            if (i) doc += ",";
+            doc += R"({"id":)" + std::to_string(i) + R"(,"s":"value-)" + std::to_string(i)
+                   + "\"}";
+        }
+        doc += "]";
+        for (int threads : {2, 3, 4, 8}) {
+            differential(doc, threads, "record array");
+        }
+    }
+
+    // A document dominated by one giant string: most chunks start inside it,
+    // so the speculative in-string interpretation must win the stitch
+    {
+        std::string doc = "[\"" + std::string(1 << 20, 'x') + "\",{\"k\":1}]";
+        for (int threads : {2, 4, 8}) {
+            differential(doc, threads, "giant string");
+        }
+    }
+
+    // Backslash runs placed periodically so chunk boundaries fall inside
+    // them; the splitter must shift joins past the runs
+    {
+        std::string doc = "[";
+        for (int i = 0; i < 5000; ++i) {
+            if (i) doc += ",";
+            doc += "\"p" + std::string(static_cast<size_t>(i % 97), '\\') + "\\\"q\"";
+        }
+        doc += "]";
+        for (int threads : {2, 3, 4, 8}) {
+            differential(doc, threads, "escape runs at joins");
+        }
+    }
+
+    // Structural characters inside strings: a chunk starting out-of-string
+    // by mistake would index these
+    {
+        std::string doc = "[";
+        for (int i = 0; i < 10000; ++i) {
+            if (i) doc += ",";
+            doc += R"("{not,structural}[or:this]")";
+        }
+        doc += "]";
+        for (int threads : {2, 4, 8}) {
+            differential(doc, threads, "structural chars inside strings");
+        }
+    }
+
+    // Randomized escape-dense soup across sizes around the chunking
+    // thresholds (the scanners are pure state machines, malformed is fine)
+    {
+        std::mt19937_64 rng(0x5EED0073);
+        const char alphabet[] = "\\\\\"\"{}[],: ab1";
+        std::uniform_int_distribution<size_t> pick(0, sizeof(alphabet) - 2);
+        bool all = true;
+        for (size_t size : {size_t{1}, size_t{1000}, size_t{65536}, size_t{65537},
+                            size_t{300000}}) {
+            for (int round = 0; round < 20; ++round) {
+                std::string doc(size, '\0');
+                for (char& c : doc) {
+                    c = alphabet[pick(rng)];
+                }
+                std::span<const char> input(doc.data(), doc.size());
+                auto serial = build_structural_index_serial(input);
+                for (int threads : {2, 4, 7}) {
+                    auto parallel = build_structural_index_parallel(input, threads);
+                    all = all && same_indices(serial, parallel);
+                }
+            }
+        }
+        check(all, "randomized soup agrees across sizes and thread counts");
+    }
+
+    // Tiny inputs fall back to the serial path without incident
+    {
+        differential("", 4, "empty input");
+        differential("1", 4, "single byte");
+        differential("[]", 8, "two bytes");
+    }
+
+    if (failures == 0) {
+        std::printf("test_parallel_index: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,108 @@
+// Unit tests for the per-document statistics surface (parse_with_stats /
+// compute_parse_stats): node counts by type, nesting depth, string and key
+// byte totals, the container-size histogram, and an arena estimate large
+// enough that parse_arena(input, estimate) never needs to grow.
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // Hand-countable document: every field of the stats block is exact
+    {
+        const std::string doc =
+            R"({"s":"abcde","n":1,"f":-2.5,"t":true,"nil":null,"a":[1,2,3],"o":{"k":"vv"}})";
+        auto result = parse_with_stats(doc);
+        check(result.has_value(), "document parses with stats");
+        if (result) {
+            const auto& [tree, stats] = *result;
+            check(tree.get("s").as_string() == "abcde", "tree intact alongside stats");
+
+            check(stats.null_count == 1, "null count");
+            check(stats.bool_count == 1, "bool count");
+            check(stats.number_count == 5, "numbers: two scalars plus three elements");
+            check(stats.string_count == 2, "strings: two values (keys counted separately)");
+            check(stats.array_count == 1 && stats.object_count == 2, "container counts");
+            check(stats.node_count() == 12, "node_count sums the type counts");
+
+            check(stats.max_depth == 3, "max depth: root -> o -> k");
+            check(stats.total_string_bytes == 7, "string bytes: abcde + vv");
+            check(stats.total_key_bytes == 10, "key bytes across both objects");
+
+            // Histogram: root object has 7 fields (bucket 4-7), "o" has 1
+            // (bucket 1), the array has 3 elements (bucket 2-3)
+            check(stats.container_size_hist[1] == 1, "one single-entry container");
+            check(stats.container_size_hist[2] == 1, "one 2-3 element container");
+            check(stats.container_size_hist[3] == 1, "one 4-7 field container");
+        }
+    }
+
+    // compute_parse_stats works on any tree, however produced
+    {
+        auto parsed = parse("[[],[1],[1,2,3,4,5,6,7,8]]");
+        check(parsed.has_value(), "histogram document parses");
+        if (parsed) {
+            auto stats = compute_parse_stats(*parsed);
+            check(stats.array_count == 4, "arrays counted");
+            check(stats.container_size_hist[0] == 1, "empty container bucket");
+            check(stats.container_size_hist[4] == 1, "8-15 element bucket");
+            check(stats.max_depth == 2, "depth of nested arrays");
+        }
+    }
+
+    // The arena estimate is a usable pre-size: an arena parse seeded with it
+    // produces the same document, and the estimate scales with the payload
+    {
+        std::string records = "[";
+        for (int i = 0; i < 2000; ++i) {
+            if (i) records += ",";
+            records += R"({"id":)" + std::to_string(i) + R"(,"tag":"name-)"
+                       + std::to_string(i) + "\"}";
+        }
+        records += "]";
+
+        auto result = parse_with_stats(records);
+        check(result.has_value(), "record array parses with stats");
+        if (result) {
+            const auto& stats = result->second;
+            check(stats.object_count == 2000 && stats.array_count == 1,
+                  "record array shape counted");
+            check(stats.arena_bytes_estimate > 2000 * 16,
+                  "estimate covers at least the node storage");
+
+            auto arena_doc = parse_arena(records, stats.arena_bytes_estimate);
+            check(arena_doc.has_value(), "arena parse accepts the estimate as a hint");
+        }
+
+        auto small = parse_with_stats("[1]");
+        auto large = parse_with_stats(records);
+        check(small && large
+                  && large->second.arena_bytes_estimate
+                         > small->second.arena_bytes_estimate * 100,
+              "estimate scales with document size");
+    }
+
+    // Failures carry the parser's error straight through
+    {
+        auto bad = parse_with_stats("[1,2");
+        check(!bad.has_value() && bad.error().code == json_error_code::unexpected_end,
+              "stats parse propagates errors");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_parse_stats: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
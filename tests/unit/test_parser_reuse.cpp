@@ -0,0 +1,109 @@
+// Unit tests for parser object reuse and capacity pre-sizing: the pooled
+// per-thread parser must carry no state between documents (a failed parse,
+// a huge document, then a tiny one all through the same instance), and
+// parse_config::presize_containers must be invisible in the output - only
+// in the allocation pattern.
+#include <iostream>
+#include <string>
+#include <vector>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto make_record_array(size_t n) -> std::string {
+    std::string doc = "[";
+    for (size_t i = 0; i < n; ++i) {
+        if (i) doc += ",";
+        doc += R"({"id":)" + std::to_string(i) + R"(,"tag":"t)" + std::to_string(i) + "\"}";
+    }
+    return doc + "]";
+}
+
+auto main() -> int {
+    // The pooled parser handles a long mixed sequence without bleeding state
+    {
+        for (int round = 0; round < 1000; ++round) {
+            auto ok = parse(R"({"round":)" + std::to_string(round) + "}");
+            check(ok.has_value() && ok->get("round").as_number() == round, "round parses");
+            if (!ok.has_value()) {
+                break;
+            }
+        }
+    }
+
+    // Failure then success through the same pooled instance
+    {
+        auto bad = parse(R"({"open":[1,2)");
+        check(!bad.has_value(), "malformed document fails");
+        auto good = parse(R"({"after":"failure"})");
+        check(good.has_value() && std::string(good->get("after").as_string()) == "failure",
+              "parser recovers cleanly after a failure");
+    }
+
+    // Large document grows the scratch buffers; the small one after must not
+    // see any of it
+    {
+        auto big = parse(make_record_array(50000));
+        check(big.has_value() && big->as_array().size() == 50000, "large document parses");
+        auto tiny = parse("[]");
+        check(tiny.has_value() && tiny->as_array().empty(),
+              "tiny document after a large one is empty");
+        auto scalar = parse("7");
+        check(scalar.has_value() && scalar->as_number() == 7.0,
+              "scalar after container documents");
+    }
+
+    // Reentrancy: a parse issued from inside another parse's consumer falls
+    // back to a stack parser and both results are correct
+    {
+        auto outer = parse(R"({"inner":"[1,2,3]"})");
+        check(outer.has_value(), "outer parses");
+        if (outer) {
+            auto inner = parse(outer->get("inner").as_string());
+            check(inner.has_value() && inner->as_array().size() == 3,
+                  "nested parse of an embedded document");
+        }
+    }
+
+    // presize_containers: identical output with pre-sizing on and off, for
+    // shapes that stress the separator pre-scan (nested containers, strings
+    // with commas and braces, empty containers)
+    {
+        const std::string tricky =
+            R"({"a":[1,2,3],"s":"commas, inside, strings","e":[],"o":{},)"
+            R"("n":[[1],[2,[3,4]],{"k":[5]}],"t":"{not,structural}"})";
+
+        parse_config presized;
+        presized.presize_containers = true;
+        parse_config incremental;
+        incremental.presize_containers = false;
+
+        auto a = parse_with_config(tricky, presized);
+        auto b = parse_with_config(tricky, incremental);
+        check(a.has_value() && b.has_value(), "both presize modes parse");
+        check(a && b && stringify(*a) == stringify(*b),
+              "presize modes produce identical documents");
+
+        auto big = make_record_array(5000);
+        auto ba = parse_with_config(big, presized);
+        auto bb = parse_with_config(big, incremental);
+        check(ba && bb && stringify(*ba) == stringify(*bb),
+              "presize modes agree on a large record array");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_parser_reuse: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
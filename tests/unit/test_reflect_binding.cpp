@@ -0,0 +1,127 @@
+// Unit tests for compile-time typed deserialization (fastjson_reflect.h):
+// member-pointer bindings, nested bound structs, vectors of scalars and
+// structs, unknown-key skipping, missing-key defaults, and error reporting
+// on type mismatches and malformed input.
+#include "../../modules/fastjson_reflect.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+struct endpoint {
+    std::string host;
+    int port = 0;
+    bool secure = false;
+};
+
+struct service {
+    std::string name;
+    double weight = 0.0;
+    endpoint primary;
+    std::vector<int> shards;
+    std::vector<endpoint> replicas;
+};
+
+template <>
+struct fastjson::reflect::json_bind<endpoint> {
+    static constexpr auto fields = std::make_tuple(
+        fastjson::reflect::field("host", &endpoint::host),
+        fastjson::reflect::field("port", &endpoint::port),
+        fastjson::reflect::field("secure", &endpoint::secure));
+};
+
+template <>
+struct fastjson::reflect::json_bind<service> {
+    static constexpr auto fields = std::make_tuple(
+        fastjson::reflect::field("name", &service::name),
+        fastjson::reflect::field("weight", &service::weight),
+        fastjson::reflect::field("primary", &service::primary),
+        fastjson::reflect::field("shards", &service::shards),
+        fastjson::reflect::field("replicas", &service::replicas));
+};
+
+using fastjson::reflect::parse_into;
+
+auto main() -> int {
+    // Full payload: every field kind lands in place
+    {
+        auto result = parse_into<service>(R"({
+            "name": "search",
+            "weight": 0.75,
+            "primary": {"host": "db-1", "port": 5432, "secure": true},
+            "shards": [1, 2, 3],
+            "replicas": [{"host": "db-2", "port": 5433}, {"host": "db-3", "port": 5434}]
+        })");
+        check(result.has_value(), "full payload deserializes");
+        if (result) {
+            check(result->name == "search", "string member");
+            check(result->weight == 0.75, "double member");
+            check(result->primary.host == "db-1" && result->primary.port == 5432
+                      && result->primary.secure,
+                  "nested bound struct");
+            check(result->shards == std::vector<int>{1, 2, 3}, "vector of scalars");
+            check(result->replicas.size() == 2 && result->replicas[1].host == "db-3",
+                  "vector of bound structs");
+            check(!result->replicas[0].secure, "missing key keeps the default");
+        }
+    }
+
+    // Unknown keys are skipped by depth, including whole subtrees
+    {
+        auto result = parse_into<endpoint>(R"({
+            "unknown_list": [1, [2, {"deep": true}]],
+            "host": "h",
+            "unknown_obj": {"a": {"b": "c"}},
+            "port": 80
+        })");
+        check(result.has_value(), "unknown keys skipped");
+        check(result && result->host == "h" && result->port == 80,
+              "fields around unknown keys still bind");
+    }
+
+    // Missing keys leave members default-initialized
+    {
+        auto result = parse_into<endpoint>(R"({"host":"only"})");
+        check(result.has_value(), "partial payload deserializes");
+        check(result && result->port == 0 && !result->secure, "defaults preserved");
+    }
+
+    // Empty object and empty arrays
+    {
+        auto empty = parse_into<endpoint>("{}");
+        check(empty.has_value() && empty->host.empty(), "empty object is all defaults");
+
+        auto no_shards = parse_into<service>(R"({"shards":[]})");
+        check(no_shards.has_value() && no_shards->shards.empty(), "empty array member");
+    }
+
+    // Type mismatches and malformed input surface a reflect_error
+    {
+        check(!parse_into<endpoint>(R"({"port":"not a number"})").has_value(),
+              "string into int member is an error");
+        check(!parse_into<endpoint>(R"({"secure":1})").has_value(),
+              "number into bool member is an error");
+        check(!parse_into<endpoint>(R"(["not","an","object"])").has_value(),
+              "array root is an error");
+        check(!parse_into<endpoint>(R"({"host":"h")").has_value(),
+              "unterminated object is an error");
+        auto err = parse_into<endpoint>(R"({"port":true})");
+        check(!err.has_value() && !err.error().message.empty(),
+              "error carries a message");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_reflect_binding: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,161 @@
+// Unit tests for the runtime observability and tuning controls: the
+// perf-counter snapshot (JSON in every build, enabled or not), the trace
+// dump entry points, the thread auto-tuner's snapshot/restore/reset cycle,
+// and the prefetch knobs - none of which may change parse results.
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto make_record_array(size_t n) -> std::string {
+    std::string doc = "[";
+    for (size_t i = 0; i < n; ++i) {
+        if (i) doc += ",";
+        doc += R"({"id":)" + std::to_string(i) + R"(,"v":)" + std::to_string(i * 2) + "}";
+    }
+    return doc + "]";
+}
+
+auto main() -> int {
+    // Perf counters: the snapshot is valid JSON in every build, and parsing
+    // work never changes parse results
+    {
+        perf_counters_reset();
+        auto warm = parse(make_record_array(1000));
+        check(warm.has_value(), "instrumented parse succeeds");
+
+        auto snapshot = parse(perf_counters_snapshot());
+        check(snapshot.has_value(), "counter snapshot is valid JSON");
+        if (snapshot) {
+            const auto* enabled = snapshot->find("enabled");
+            check(enabled != nullptr && enabled->is_bool(), "snapshot reports enabled flag");
+            if (enabled != nullptr && enabled->as_bool()) {
+                const auto* probes = snapshot->find("probes");
+                check(probes != nullptr && probes->is_array() && !probes->as_array().empty(),
+                      "enabled build carries per-probe stats");
+            }
+        }
+        perf_counters_reset();  // Reset is callable in every build
+    }
+
+    // Trace facility: dump and clear exist in every build; when tracing is
+    // compiled in, the dump is chrome://tracing JSON
+    {
+        const std::string path = "/tmp/fastjson_test_trace.json";
+        std::remove(path.c_str());
+        auto traced = parse(make_record_array(100));
+        check(traced.has_value(), "traced parse succeeds");
+
+        if (trace_dump(path)) {
+            std::string text;
+            {
+                std::FILE* f = std::fopen(path.c_str(), "rb");
+                check(f != nullptr, "trace file written");
+                if (f) {
+                    char buf[4096];
+                    size_t n = 0;
+                    while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) {
+                        text.append(buf, n);
+                    }
+                    std::fclose(f);
+                }
+            }
+            auto events = parse(text);
+            check(events.has_value() && events->find("traceEvents") != nullptr
+                      && events->find("traceEvents")->is_array(),
+                  "trace dump is chrome://tracing JSON");
+        } else {
+            std::cout << "note: tracing compiled out; dump correctly reports disabled\n";
+        }
+        trace_clear();
+        std::remove(path.c_str());
+    }
+
+    // Thread tuner: reset empties the learned table, restore round-trips a
+    // snapshot, and garbage is rejected
+    {
+        thread_tuner_reset();
+        auto empty = parse(thread_tuner_snapshot());
+        check(empty.has_value(), "tuner snapshot is valid JSON");
+        check(empty && empty->find("cells") != nullptr
+                  && empty->find("cells")->as_array().empty(),
+              "reset table snapshots no cells");
+
+        const std::string learned =
+            R"({"cells":[{"bucket":2,"shape":1,"threads":4,"mbps":812.500}]})";
+        check(thread_tuner_restore(learned), "hand-built snapshot restores");
+        auto after = parse(thread_tuner_snapshot());
+        check(after.has_value(), "post-restore snapshot parses");
+        if (after) {
+            const auto& cells = after->find("cells")->as_array();
+            bool found = false;
+            for (const auto& cell : cells) {
+                found = found
+                        || (cell.find("bucket")->as_number() == 2
+                            && cell.find("shape")->as_number() == 1
+                            && cell.find("threads")->as_number() == 4);
+            }
+            check(found, "restored cell survives the round trip");
+        }
+
+        check(!thread_tuner_restore("not a snapshot"), "garbage snapshot rejected");
+        check(!thread_tuner_restore(R"({"cells":[{"bucket":99,"shape":0,"threads":2}]})"),
+              "out-of-range cells rejected");
+        thread_tuner_reset();
+    }
+
+    // Auto-tuning must be invisible in results: repeated parses with tuning
+    // on match an untuned parse byte for byte
+    {
+        const std::string doc = make_record_array(20000);
+        auto reference = parse(doc);
+        check(reference.has_value(), "reference parse succeeds");
+
+        parse_config tuned;
+        tuned.auto_tune_threads = true;
+        set_parse_config(tuned);
+        bool stable = true;
+        for (int round = 0; round < 8 && stable; ++round) {
+            auto result = parse(doc);
+            stable = result.has_value() && reference
+                     && stringify(*result) == stringify(*reference);
+        }
+        check(stable, "auto-tuned parses stay byte-identical across probe rounds");
+        set_parse_config(parse_config{});
+        thread_tuner_reset();
+    }
+
+    // Prefetch knobs change scheduling only, never output
+    {
+        const std::string doc = make_record_array(5000);
+        auto reference = parse(doc);
+
+        for (size_t distance : {size_t{0}, size_t{128}, size_t{1024}}) {
+            parse_config cfg;
+            cfg.prefetch_distance = distance;
+            cfg.prefetch_spans_ahead = distance == 0 ? 0 : 2;
+            auto result = parse_with_config(doc, cfg);
+            check(result.has_value() && reference
+                      && stringify(*result) == stringify(*reference),
+                  "prefetch settings leave the document unchanged");
+        }
+    }
+
+    if (failures == 0) {
+        std::cout << "test_runtime_controls: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,111 @@
+// Unit tests for the SAX-style push parser (parse_sax): event ordering,
+// raw (undecoded) spans, early-abort from callbacks, and error reporting
+// without any DOM allocation.
+#include <iostream>
+#include <string>
+#include <vector>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// Records every event as a compact trace string for order assertions
+struct tracing_handler : sax_handler {
+    std::string trace;
+    auto on_object_begin() -> bool override { trace += "{"; return true; }
+    auto on_object_end() -> bool override { trace += "}"; return true; }
+    auto on_array_begin() -> bool override { trace += "["; return true; }
+    auto on_array_end() -> bool override { trace += "]"; return true; }
+    auto on_key(std::string_view raw_key) -> bool override {
+        trace += "k(";
+        trace += raw_key;
+        trace += ")";
+        return true;
+    }
+    auto on_string(std::string_view raw_value) -> bool override {
+        trace += "s(";
+        trace += raw_value;
+        trace += ")";
+        return true;
+    }
+    auto on_number(std::string_view raw_number) -> bool override {
+        trace += "n(";
+        trace += raw_number;
+        trace += ")";
+        return true;
+    }
+    auto on_bool(bool value) -> bool override { trace += value ? "T" : "F"; return true; }
+    auto on_null() -> bool override { trace += "N"; return true; }
+};
+
+// Stops the scan after a fixed number of values
+struct aborting_handler : sax_handler {
+    int remaining;
+    explicit aborting_handler(int n) : remaining(n) {}
+    auto on_number(std::string_view) -> bool override { return --remaining > 0; }
+};
+
+auto main() -> int {
+    // Event ordering over a document with every value kind
+    {
+        tracing_handler h;
+        auto r = parse_sax(R"({"a":[1,-2.5,"x"],"b":{"c":true,"d":null},"e":"esc\"q"})", h);
+        check(r.has_value(), "mixed document scans clean");
+        check(h.trace == "{k(a)[n(1)n(-2.5)s(x)]k(b){k(c)Tk(d)N}k(e)s(esc\\\"q)}",
+              "event trace matches document order");
+    }
+
+    // Raw spans: escapes reach the handler undecoded (no allocation)
+    {
+        tracing_handler h;
+        auto r = parse_sax(R"(["tab\tnewline\n","\u00e9"])", h);
+        check(r.has_value(), "escape-heavy strings scan clean");
+        check(h.trace == "[s(tab\\tnewline\\n)s(\\u00e9)]", "raw escape spans undecoded");
+    }
+
+    // Early abort from a callback is success, not an error
+    {
+        aborting_handler h(3);
+        auto r = parse_sax("[1,2,3,4,5,6,7,8]", h);
+        check(r.has_value(), "callback abort is not an error");
+        check(h.remaining == 0, "scan stopped at the aborting value");
+    }
+
+    // Scalar roots produce exactly one event
+    {
+        tracing_handler h;
+        check(parse_sax("42", h).has_value() && h.trace == "n(42)", "number root");
+        tracing_handler h2;
+        check(parse_sax("\"solo\"", h2).has_value() && h2.trace == "s(solo)", "string root");
+    }
+
+    // Malformed input surfaces a json_error with a position, no partial junk
+    {
+        tracing_handler h;
+        auto r = parse_sax(R"({"open":[1,2)", h);
+        check(!r.has_value(), "unterminated array is an error");
+
+        tracing_handler h2;
+        auto r2 = parse_sax(R"({"bad)", h2);
+        check(!r2.has_value(), "unterminated string is an error");
+
+        tracing_handler h3;
+        auto r3 = parse_sax("", h3);
+        check(!r3.has_value(), "empty input is an error");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_sax_parser: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,168 @@
+// Unit tests for the JSONScanner token surface (fastjson_simd_api.h): token
+// classification and spans, the arena-reuse scan_tokens_into variant
+// (capacity recycled, contents identical to a fresh scan), and the streaming
+// tokenizer - tokens pulled across arbitrary chunk boundaries must match a
+// single whole-buffer scan, with absolute stream positions.
+#include "../../modules/fastjson_simd_api.h"
+
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace fastjson::simd;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+using Token = JSONScanner::Token;
+using TokenType = JSONScanner::TokenType;
+
+static auto as_span(const std::string& s) -> std::span<const char> {
+    return {s.data(), s.size()};
+}
+
+// Drop whitespace tokens for sequence comparisons
+static auto significant(const std::vector<Token>& tokens) -> std::vector<Token> {
+    std::vector<Token> out;
+    for (const auto& t : tokens) {
+        if (t.type != TokenType::Whitespace) {
+            out.push_back(t);
+        }
+    }
+    return out;
+}
+
+static auto same_tokens(const std::vector<Token>& a, const std::vector<Token>& b) -> bool {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].type != b[i].type || a[i].position != b[i].position
+            || a[i].length != b[i].length) {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto main() -> int {
+    auto scanner = factory::create_scanner();
+    const std::string doc =
+        R"({"name":"va\"lue","count":-12.5e2,"flags":[true,false,null],"pad":"x"})";
+
+    // Token classification and extract_text spans
+    {
+        auto tokens = significant(scanner.scan_tokens(as_span(doc)));
+        check(!tokens.empty() && tokens.front().type == TokenType::OpenBrace,
+              "document opens with a brace token");
+        check(tokens.back().type == TokenType::CloseBrace, "and closes with one");
+
+        size_t strings = 0;
+        size_t numbers = 0;
+        size_t literals = 0;
+        for (const auto& t : tokens) {
+            if (t.type == TokenType::String) {
+                ++strings;
+            } else if (t.type == TokenType::Number) {
+                ++numbers;
+            } else if (t.type == TokenType::BooleanTrue || t.type == TokenType::BooleanFalse
+                       || t.type == TokenType::Null) {
+                ++literals;
+            }
+        }
+        check(strings == 6, "string tokens counted (keys and values)");
+        check(numbers == 1, "number token counted");
+        check(literals == 3, "literal tokens counted");
+
+        for (const auto& t : tokens) {
+            if (t.type == TokenType::Number) {
+                check(t.extract_text(as_span(doc)) == "-12.5e2",
+                      "number span covers sign, fraction, and exponent");
+            }
+            if (t.type == TokenType::String
+                && t.extract_text(as_span(doc)).find("va") != std::string_view::npos) {
+                check(t.extract_text(as_span(doc)) == R"("va\"lue")",
+                      "string span includes quotes and keeps the escaped quote inside");
+            }
+        }
+    }
+
+    // Arena reuse: same tokens as a fresh scan, capacity recycled
+    {
+        std::vector<Token> arena;
+        size_t n = scanner.scan_tokens_into(as_span(doc), arena);
+        check(n == arena.size(), "reported count matches the buffer");
+        check(same_tokens(arena, scanner.scan_tokens(as_span(doc))),
+              "arena scan matches a fresh scan");
+
+        arena.reserve(4096);
+        const auto capacity_before = arena.capacity();
+        const std::string small = "[1,2]";
+        scanner.scan_tokens_into(as_span(small), arena);
+        check(arena.capacity() == capacity_before,
+              "capacity survives across documents");
+        check(same_tokens(arena, scanner.scan_tokens(as_span(small))),
+              "recycled buffer holds only the new document's tokens");
+    }
+
+    // Streaming tokenizer: every chunking of the input yields the same
+    // significant token sequence as one whole-buffer scan
+    {
+        auto reference = significant(scanner.scan_tokens(as_span(doc)));
+
+        for (size_t chunk_size : {1, 2, 3, 7, 16, 64, doc.size()}) {
+            StreamingTokenizer stream(scanner);
+            std::vector<Token> pulled;
+
+            size_t fed = 0;
+            while (fed < doc.size()) {
+                size_t n = std::min(chunk_size, doc.size() - fed);
+                stream.feed(std::span<const char>(doc.data() + fed, n));
+                fed += n;
+                while (auto t = stream.next()) {
+                    if (t->type != TokenType::Whitespace) {
+                        pulled.push_back(*t);
+                    }
+                }
+            }
+            stream.finish();
+            while (auto t = stream.next()) {
+                if (t->type != TokenType::Whitespace) {
+                    pulled.push_back(*t);
+                }
+            }
+
+            check(same_tokens(pulled, reference),
+                  "streamed tokens match the whole-buffer scan");
+        }
+
+        // Positions are absolute: a number split across chunks reports its
+        // offset in the logical stream, not within the retained tail
+        StreamingTokenizer stream(scanner);
+        const std::string part1 = "[1234";
+        const std::string part2 = "56]";
+        stream.feed(as_span(part1));
+        auto open = stream.next();
+        check(open && open->type == TokenType::OpenBracket, "bracket available early");
+        check(!stream.next().has_value(), "split number held back until more input");
+        stream.feed(as_span(part2));
+        stream.finish();
+        auto number = stream.next();
+        check(number && number->type == TokenType::Number && number->position == 1
+                  && number->length == 6,
+              "split token reassembled with absolute position");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_scanner_tokens: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,120 @@
+// Unit tests for the thread-local scratch arenas behind parser temporaries:
+// per-worker unescape and digit staging must stay isolated when documents
+// are parsed concurrently from many threads and when one document's array
+// is split across OpenMP workers, and recycled scratch must never leak
+// bytes from a previous document into the next.
+#include <iostream>
+#include <omp.h>
+#include <string>
+#include <vector>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// Escape-dense payload: every string routes through the unescape scratch
+static auto make_escape_doc(int seed, size_t records) -> std::string {
+    std::string doc = "[";
+    for (size_t i = 0; i < records; ++i) {
+        if (i) doc += ",";
+        doc += R"({"path":"c:\\dir\\)" + std::to_string(seed) + R"(\\f\"ile)"
+               + std::to_string(i) + R"(","text":"line1\nline2\ttab\u00e9",)"
+               + R"("value":-)" + std::to_string(seed * 1000 + i) + ".25}";
+    }
+    return doc + "]";
+}
+
+auto main() -> int {
+    // Concurrent parses from independent threads: each worker's scratch is
+    // its own, so every thread must get exactly its own document back
+    {
+        const int documents = 64;
+        std::vector<std::string> expected(documents);
+        std::vector<bool> ok(documents, false);
+        for (int i = 0; i < documents; ++i) {
+            auto reference = parse(make_escape_doc(i, 50));
+            check(reference.has_value(), "reference parse succeeds");
+            if (reference) {
+                expected[static_cast<size_t>(i)] = stringify(*reference);
+            }
+        }
+
+#pragma omp parallel for
+        for (int i = 0; i < documents; ++i) {
+            auto result = parse(make_escape_doc(i, 50));
+            ok[static_cast<size_t>(i)] =
+                result.has_value()
+                && stringify(*result) == expected[static_cast<size_t>(i)];
+        }
+        bool all = true;
+        for (bool b : ok) {
+            all = all && b;
+        }
+        check(all, "concurrent escape-dense parses stay isolated per thread");
+    }
+
+    // One document split across OpenMP workers: the parallel array path uses
+    // per-worker scratch for unescape/number staging and must match serial
+    {
+        const std::string doc = make_escape_doc(7, 20000);
+
+        parse_config serial;
+        serial.num_threads = 1;
+        auto reference = parse_with_config(doc, serial);
+        check(reference.has_value(), "serial parse succeeds");
+
+        parse_config parallel;
+        parallel.num_threads = 8;
+        parallel.parallel_threshold = 1024;  // Force the parallel array path
+        auto split = parse_with_config(doc, parallel);
+        check(split.has_value(), "parallel parse succeeds");
+        check(reference && split && stringify(*split) == stringify(*reference),
+              "parallel workers produce the serial result");
+    }
+
+    // Scratch recycling across documents: a long string, then a short one -
+    // the short parse must not see stale bytes from the grown buffer
+    {
+        std::string long_doc = R"(["padpad)" + std::string(10000, 'z') + R"(\"end"])";
+        auto big = parse(long_doc);
+        check(big.has_value()
+                  && big->as_array()[0].as_string().size() == 10010,
+              "long escaped string parses");
+
+        auto small = parse(R"(["a\tb"])");
+        check(small.has_value() && small->as_array()[0].as_string() == "a\tb",
+              "short string after a long one is exact");
+
+        auto tiny = parse(R"([""])");
+        check(tiny.has_value() && tiny->as_array()[0].as_string().empty(),
+              "empty string reads empty after scratch growth");
+    }
+
+    // Sustained reuse: thousands of rounds alternating sizes on every worker
+    {
+        bool all = true;
+#pragma omp parallel for reduction(&& : all)
+        for (int round = 0; round < 2000; ++round) {
+            const size_t records = (round % 7 == 0) ? 200 : 3;
+            auto result = parse(make_escape_doc(round, records));
+            all = all && result.has_value()
+                  && result->as_array().size() == records;
+        }
+        check(all, "sustained alternating-size reuse stays correct");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_scratch_arena: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,129 @@
+// Unit tests for the serialization surface: stringify round-trips and
+// idempotence, escaping on the way out, stringify_parallel's byte parity
+// with the sequential writer, prettify indentation, and the SIMD minifier
+// (whitespace stripped outside strings only, byte-preserving inside them).
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// Serialize -> reparse -> serialize; a stable writer makes the two passes
+// byte-identical, and the reparse proves the output is valid JSON
+static auto round_trip_stable(std::string_view input, const char* what) -> void {
+    auto doc = parse(input);
+    check(doc.has_value(), what);
+    if (!doc) {
+        return;
+    }
+    std::string once = stringify(*doc);
+    auto again = parse(once);
+    check(again.has_value(), "serialized output reparses");
+    check(again && stringify(*again) == once, "serialize/reparse is idempotent");
+}
+
+auto main() -> int {
+    // Scalars serialize to canonical JSON text
+    {
+        check(stringify(*parse("true")) == "true", "true literal");
+        check(stringify(*parse("null")) == "null", "null literal");
+        check(stringify(*parse("\"plain\"")) == "\"plain\"", "plain string");
+        check(stringify(*parse("[]")) == "[]", "empty array");
+        check(stringify(*parse("{}")) == "{}", "empty object");
+    }
+
+    // Escapes survive the writer: reparse gives back the same decoded value
+    {
+        auto doc = parse(R"(["q\"q","b\\b","nl\n","tab\t","é"])");
+        check(doc.has_value(), "escape document parses");
+        if (doc) {
+            auto again = parse(stringify(*doc));
+            check(again.has_value(), "escaped output reparses");
+            if (again) {
+                const auto& a = again->as_array();
+                check(std::string(a[0].as_string()) == "q\"q", "quote survives");
+                check(std::string(a[1].as_string()) == "b\\b", "backslash survives");
+                check(std::string(a[2].as_string()) == "nl\n", "newline survives");
+                check(std::string(a[3].as_string()) == "tab\t", "tab survives");
+                check(std::string(a[4].as_string()) == "\xc3\xa9", "utf-8 survives");
+            }
+        }
+    }
+
+    // Mixed documents round-trip stably
+    {
+        round_trip_stable(R"({"a":[1,-2.5,"x",true,null],"b":{"c":[[1],[2,[3]]]}})",
+                          "nested mixed document");
+        round_trip_stable("[0,-0.5,1e3,42,123456789012345678]", "number forms");
+    }
+
+    // stringify_parallel: byte parity with the sequential writer on large
+    // arrays, and pass-through for non-array roots
+    {
+        std::string records = "[";
+        for (int i = 0; i < 20000; ++i) {
+            if (i) records += ",";
+            records += R"({"id":)" + std::to_string(i) + R"(,"tag":"t-)" + std::to_string(i)
+                       + "\"}";
+        }
+        records += "]";
+        auto doc = parse(records);
+        check(doc.has_value(), "large record array parses");
+        if (doc) {
+            check(stringify_parallel(*doc) == stringify(*doc),
+                  "parallel writer is byte-identical on arrays");
+        }
+
+        auto obj = parse(R"({"k":1})");
+        check(obj && stringify_parallel(*obj) == stringify(*obj),
+              "non-array root passes through the sequential writer");
+    }
+
+    // prettify: indentation is structural only, content reparses equal
+    {
+        auto doc = parse(R"({"a":[1,2],"b":"text with  spaces"})");
+        check(doc.has_value(), "prettify fixture parses");
+        if (doc) {
+            std::string pretty = prettify(*doc, 2);
+            check(pretty.find("\n") != std::string::npos, "pretty output is multi-line");
+            check(pretty.find("  ") != std::string::npos, "pretty output is indented");
+            auto again = parse(pretty);
+            check(again.has_value() && stringify(*again) == stringify(*doc),
+                  "prettified output reparses to the same value");
+            check(prettify(*doc, 0) == stringify(*doc),
+                  "zero indent degenerates to the compact form");
+        }
+    }
+
+    // minify: whitespace outside strings goes, bytes inside strings stay
+    {
+        check(minify(" { \"a\" : [ 1 , 2 ] } ") == R"({"a":[1,2]})",
+              "structural whitespace removed");
+        check(minify("{\n\t\"s\" : \" keep  me \"\n}") == R"({"s":" keep  me "})",
+              "string interiors untouched");
+        check(minify(R"({"esc":"a\" b"})") == R"({"esc":"a\" b"})",
+              "escaped quote does not end the string for the minifier");
+        check(minify("") == "", "empty input minifies to empty");
+
+        // Reusable-buffer overload appends into the caller's string
+        std::string out;
+        minify("[ 1 ]", out);
+        check(out == "[1]", "buffer overload writes the minified text");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_serializer: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
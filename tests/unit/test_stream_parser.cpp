@@ -0,0 +1,148 @@
+// Unit tests for the coroutine-based resumable parser (parse_stream): chunk
+// boundaries anywhere in the input must not change the result, tokens that
+// straddle chunks (numbers, literals, escaped strings) resume correctly,
+// finish() terminates pending tokens, and errors carry absolute stream
+// positions.
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// Feed a document in fixed-size chunks and return the parse result
+static auto feed_chunked(std::string_view doc, size_t chunk_size)
+    -> std::optional<json_result<json_value>> {
+    auto p = parse_stream();
+    for (size_t fed = 0; fed < doc.size(); fed += chunk_size) {
+        p.feed(doc.substr(fed, chunk_size));
+    }
+    p.finish();
+    return p.result();
+}
+
+auto main() -> int {
+    const std::string doc =
+        R"({"name":"str\"eam","count":-12.5e2,"ok":true,"none":null,)"
+        R"("list":[1,22,333],"nested":{"deep":[{"k":"v"}]}})";
+
+    // Every chunking agrees with the batch parser
+    {
+        auto reference = parse(doc);
+        check(reference.has_value(), "reference parse succeeds");
+        for (size_t chunk_size : {size_t{1}, size_t{2}, size_t{3}, size_t{7}, size_t{16},
+                                  doc.size()}) {
+            auto streamed = feed_chunked(doc, chunk_size);
+            check(streamed.has_value(), "stream completes");
+            if (streamed && reference) {
+                check(streamed->has_value(), "chunked parse succeeds");
+                check(streamed->has_value()
+                          && stringify(**streamed) == stringify(*reference),
+                      "chunked result matches the batch parser");
+            }
+        }
+    }
+
+    // The trailing-garbage check holds the parse open until end of stream:
+    // result() stays empty after the closing brace and fills at finish()
+    {
+        auto p = parse_stream();
+        p.feed(R"({"a":1})");
+        check(!p.done(), "parse stays open for possible trailing bytes");
+        check(!p.result().has_value(), "result empty before finish");
+        p.finish();
+        auto r = p.result();
+        check(r && r->has_value() && (**r).get("a").as_number() == 1.0,
+              "finish completes the document");
+    }
+
+    // A number at end of stream only terminates at finish()
+    {
+        auto p = parse_stream();
+        p.feed("12");
+        check(!p.done(), "bare number waits for more digits");
+        p.feed("34");
+        check(!p.done(), "still waiting: the token could continue");
+        p.finish();
+        auto r = p.result();
+        check(r && r->has_value() && (**r).as_number() == 1234.0,
+              "finish terminates the pending number");
+    }
+
+    // Literals split mid-keyword resume correctly
+    {
+        auto p = parse_stream();
+        p.feed("[tr");
+        p.feed("ue,nu");
+        p.feed("ll]");
+        p.finish();
+        auto r = p.result();
+        check(r && r->has_value(), "split literals parse");
+        if (r && r->has_value()) {
+            const auto& a = (**r).as_array();
+            check(a[0].as_bool() && a[1].is_null(), "literal values correct");
+        }
+    }
+
+    // Truncated stream is an error at finish, with the absolute position
+    {
+        auto p = parse_stream();
+        p.feed(R"({"never":[1,2)");
+        p.finish();
+        auto r = p.result();
+        check(r && !r->has_value(), "truncated stream fails at finish");
+        if (r && !r->has_value()) {
+            check(r->error().code == json_error_code::unexpected_end
+                      || r->error().code == json_error_code::invalid_syntax,
+                  "truncation reports a meaningful code");
+        }
+    }
+
+    // Trailing bytes after the document are extra_tokens
+    {
+        auto p = parse_stream();
+        p.feed("{} junk");
+        p.finish();
+        auto r = p.result();
+        check(r && !r->has_value() && r->error().code == json_error_code::extra_tokens,
+              "trailing bytes rejected");
+    }
+
+    // Empty stream
+    {
+        auto p = parse_stream();
+        p.finish();
+        auto r = p.result();
+        check(r && !r->has_value() && r->error().code == json_error_code::empty_input,
+              "empty stream is empty_input");
+    }
+
+    // A second document in the stream is extra_tokens, and once the parse
+    // has finished (here: with that error) further feeds are no-ops
+    {
+        auto p = parse_stream();
+        p.feed("[1]");
+        p.feed("[2]");  // Resumes the trailing-bytes check and fails it
+        check(p.done(), "second document ends the parse");
+        p.feed("[3]");  // Ignored: already done
+        p.finish();
+        auto r = p.result();
+        check(r && !r->has_value() && r->error().code == json_error_code::extra_tokens,
+              "second document reported as extra_tokens");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_stream_parser: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
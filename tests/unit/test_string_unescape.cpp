@@ -0,0 +1,113 @@
+// Unit tests for string unescaping through the main parser: every short
+// escape form, \uXXXX including surrogate pairs, escape-dense payloads that
+// stress the vectorized backslash scan (clean-run bulk copies with scalar
+// drops at each escape), and the invalid_escape / invalid_unicode errors.
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+static auto parse_string_value(std::string_view input) -> std::string {
+    auto doc = parse(input);
+    if (!doc || !doc->is_string()) {
+        return "<parse failed>";
+    }
+    return std::string(doc->as_string());
+}
+
+auto main() -> int {
+    // Every short escape form decodes to its control byte
+    {
+        check(parse_string_value(R"("q\"q")") == "q\"q", "escaped quote");
+        check(parse_string_value(R"("b\\b")") == "b\\b", "escaped backslash");
+        check(parse_string_value(R"("s\/s")") == "s/s", "escaped slash");
+        check(parse_string_value(R"("\b\f\n\r\t")") == "\b\f\n\r\t", "control escapes");
+    }
+
+    // \uXXXX: BMP code points decode to UTF-8, surrogate pairs re-combine
+    {
+        check(parse_string_value(R"("\u0041")") == "A", "ascii via \\u");
+        check(parse_string_value(R"("\u00e9")") == "\xc3\xa9", "two-byte utf-8");
+        check(parse_string_value(R"("\u20ac")") == "\xe2\x82\xac", "three-byte utf-8");
+        check(parse_string_value(R"("\ud83d\ude00")") == "\xf0\x9f\x98\x80",
+              "surrogate pair combines to four-byte utf-8");
+        check(parse_string_value(R"("x\u0000y")") == std::string("x\0y", 3),
+              "embedded NUL survives");
+    }
+
+    // Escape-dense payloads: backslashes at every position exercise the
+    // clean-run / escape-run boundary handling of the unescape kernel
+    {
+        // Stringified-JSON-in-JSON, the motivating workload
+        std::string inner = R"({"k":"v","n":[1,2]})";
+        std::string quoted = "\"";
+        for (char c : inner) {
+            if (c == '"' || c == '\\') quoted += '\\';
+            quoted += c;
+        }
+        quoted += "\"";
+        check(parse_string_value(quoted) == inner, "stringified JSON round-trips");
+
+        // Alternating clean bytes and escapes across several SIMD blocks
+        std::string escaped = "\"";
+        std::string expected;
+        for (int i = 0; i < 500; ++i) {
+            escaped += "ab\\n";
+            expected += "ab\n";
+        }
+        escaped += "\"";
+        check(parse_string_value(escaped) == expected, "dense escapes across blocks");
+
+        // A long clean run ending in a single trailing escape: the bulk copy
+        // must not overrun into the escape sequence
+        std::string tail = "\"" + std::string(1000, 'x') + "\\t\"";
+        check(parse_string_value(tail) == std::string(1000, 'x') + "\t",
+              "trailing escape after long clean run");
+
+        // Escape as the very first byte of the string
+        check(parse_string_value(R"("\nrest")") == "\nrest", "leading escape");
+    }
+
+    // Bad escapes are rejected with the right taxonomy
+    {
+        auto bad = parse(R"("\q")");
+        check(!bad.has_value(), "unknown escape rejected");
+        if (!bad) {
+            check(bad.error().code == json_error_code::invalid_escape,
+                  "unknown escape is invalid_escape");
+        }
+
+        auto short_hex = parse(R"("\u12")");
+        check(!short_hex.has_value(), "truncated \\u rejected");
+
+        auto lone_high = parse(R"("\ud83d")");
+        check(!lone_high.has_value(), "unpaired high surrogate rejected");
+        if (!lone_high) {
+            check(lone_high.error().code == json_error_code::invalid_unicode,
+                  "unpaired surrogate is invalid_unicode");
+        }
+
+        auto lone_low = parse(R"("\ude00")");
+        check(!lone_low.has_value(), "unpaired low surrogate rejected");
+
+        auto trailing = parse(R"("dangling\)");
+        check(!trailing.has_value(), "backslash at end of input rejected");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_string_unescape: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
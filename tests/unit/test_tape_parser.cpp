@@ -0,0 +1,133 @@
+// Unit tests for the flattened tape parser (fastjson_tape.h): tape word
+// layout through the navigation API, int64 vs double classification on the
+// number fast path - including both sides of the INT64_MAX boundary, where
+// out-of-range 19-digit tokens must land on the double path - plus string
+// handling and malformed-input rejection.
+#include "../../modules/fastjson_tape.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+
+using namespace fastjson::tape;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // Navigation over a mixed document
+    {
+        auto doc = tape_document::parse(
+            R"({"id":42,"ratio":-2.5,"name":"tape","ok":true,"none":null,
+                "list":[1,[2,3],{"k":"v"}]})");
+        check(doc.has_value(), "mixed document parses");
+        if (doc) {
+            auto root = doc->root();
+            check(root.is_object() && root.count_elements() == 6, "root object shape");
+
+            auto id = root.find_field("id");
+            check(id && id->is_int() && id->as_int64() == 42, "int64 field");
+            check(id && id->as_number() == 42.0, "int64 readable as double");
+
+            auto ratio = root.find_field("ratio");
+            check(ratio && ratio->type() == tape_type::double_value
+                      && ratio->as_number() == -2.5,
+                  "double field");
+
+            auto name = root.find_field("name");
+            check(name && name->is_string() && name->as_string() == "tape", "string field");
+
+            check(root.find_field("ok")->as_bool(), "bool field");
+            check(root.find_field("none")->is_null(), "null field");
+
+            auto list = root.find_field("list");
+            check(list && list->is_array() && list->count_elements() == 3,
+                  "array count skips nested subtrees");
+            auto inner = list->at(1);
+            check(inner && inner->is_array() && inner->at(1)->as_int64() == 3,
+                  "nested array by index");
+            check(list->at(2)->find_field("k")->as_string() == "v", "object inside array");
+            check(!list->at(3).has_value(), "out-of-range index is empty");
+            check(!root.find_field("missing").has_value(), "missing field is empty");
+        }
+    }
+
+    // Integer fast path boundaries: INT64_MAX/MIN stay int64, one past the
+    // boundary falls through to the double path instead of saturating
+    {
+        auto doc = tape_document::parse(
+            "[9223372036854775807,-123456789012345678,"
+            "9223372036854775808,-9223372036854775808,"
+            "99999999999999999999,123456789012345678]");
+        check(doc.has_value(), "boundary numbers parse");
+        if (doc) {
+            auto root = doc->root();
+            check(root.at(0)->is_int() && root.at(0)->as_int64() == INT64_MAX,
+                  "INT64_MAX stays on the int64 path");
+            check(root.at(1)->is_int() && root.at(1)->as_int64() == -123456789012345678,
+                  "signed 19-char token stays on the int64 path");
+            check(root.at(2)->type() == tape_type::double_value
+                      && root.at(2)->as_number() == 9223372036854775808.0,
+                  "INT64_MAX+1 lands on the double path, not a clamped int64");
+            // INT64_MIN's 20-char text exceeds the fast-path length cap, so
+            // it is stored as a double; the cap is what keeps the path
+            // branch-cheap, and the value survives exactly in the mantissa
+            check(root.at(3)->type() == tape_type::double_value
+                      && root.at(3)->as_number() == -9223372036854775808.0,
+                  "INT64_MIN text takes the double path by length");
+            check(root.at(4)->type() == tape_type::double_value,
+                  "20-digit token takes the double path");
+            check(root.at(5)->is_int() && root.at(5)->as_int64() == 123456789012345678,
+                  "18-digit token stays int64");
+        }
+    }
+
+    // Number forms that must never hit the integer path
+    {
+        auto doc = tape_document::parse("[1e3,2.0,-0.5,1E-2]");
+        check(doc.has_value(), "float forms parse");
+        if (doc) {
+            auto root = doc->root();
+            bool all_double = true;
+            for (size_t i = 0; i < 4; ++i) {
+                all_double = all_double && root.at(i)->type() == tape_type::double_value;
+            }
+            check(all_double, "exponent and fraction forms are doubles");
+            check(root.at(0)->as_number() == 1000.0, "exponent value");
+        }
+    }
+
+    // Strings: raw view keeps escapes, as_string decodes them
+    {
+        auto doc = tape_document::parse(R"(["esc\"q\n"])");
+        check(doc.has_value(), "escaped string parses");
+        if (doc) {
+            auto s = doc->root().at(0);
+            check(s && s->as_raw_string() == "esc\\\"q\\n", "raw view keeps escapes");
+            check(s && s->as_string() == "esc\"q\n", "as_string decodes");
+        }
+    }
+
+    // Structural malformations are rejected, not recorded as a partial tape
+    // (the tape engine validates structure from the index; literal spelling
+    // is the full parser's job)
+    {
+        check(!tape_document::parse("[1,2").has_value(), "unterminated array rejected");
+        check(!tape_document::parse("[1,2}").has_value(), "mismatched close rejected");
+        check(!tape_document::parse("1,2]").has_value(), "unopened close rejected");
+        check(!tape_document::parse("[1,,2]").has_value(), "double comma rejected");
+        check(!tape_document::parse(R"(["open)").has_value(), "unterminated string rejected");
+    }
+
+    if (failures == 0) {
+        std::printf("test_tape_parser: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,189 @@
+// Unit tests for the unicode module (unicode.h): codepoint classification,
+// UTF-8 encoding, \uXXXX escape decoding with surrogate pairs, and the
+// UTF-16LE / UTF-32LE -> UTF-8 transcoders - the dispatched (SIMD) and
+// scalar implementations must agree byte for byte, including the mixed-width
+// blocks that force the vector kernels to drop to scalar mid-stream.
+#include "../../modules/unicode.h"
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+
+using namespace fastjson::unicode;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+// Append one codepoint to a UTF-16LE byte string
+static auto push_utf16(std::string& s, uint32_t cp) -> void {
+    auto push_unit = [&](uint32_t unit) {
+        s += static_cast<char>(unit & 0xFF);
+        s += static_cast<char>((unit >> 8) & 0xFF);
+    };
+    if (needs_surrogate_pair(cp)) {
+        uint32_t v = cp - SURROGATE_OFFSET;
+        push_unit(SURROGATE_HIGH_START + (v >> 10));
+        push_unit(SURROGATE_LOW_START + (v & 0x3FF));
+    } else {
+        push_unit(cp);
+    }
+}
+
+static auto push_utf32(std::string& s, uint32_t cp) -> void {
+    for (int shift = 0; shift < 32; shift += 8) {
+        s += static_cast<char>((cp >> shift) & 0xFF);
+    }
+}
+
+auto main() -> int {
+    // Classification and surrogate math
+    {
+        check(is_high_surrogate(0xD800) && is_high_surrogate(0xDBFF), "high surrogate range");
+        check(is_low_surrogate(0xDC00) && is_low_surrogate(0xDFFF), "low surrogate range");
+        check(!is_surrogate(0xD7FF) && !is_surrogate(0xE000), "range edges excluded");
+        check(is_valid_codepoint(0x10FFFF) && !is_valid_codepoint(0x110000),
+              "UNICODE_MAX boundary");
+        check(decode_surrogate_pair(0xD83D, 0xDE00) == 0x1F600, "surrogate pair decode");
+        check(needs_surrogate_pair(0x10000) && !needs_surrogate_pair(0xFFFF),
+              "surrogate pair threshold");
+    }
+
+    // UTF-8 encoding across the width boundaries
+    {
+        std::string out;
+        check(encode_utf8(0x41, out) && out == "A", "1-byte encode");
+        out.clear();
+        check(encode_utf8(0xE9, out) && out == "\xc3\xa9", "2-byte encode");
+        out.clear();
+        check(encode_utf8(0x20AC, out) && out == "\xe2\x82\xac", "3-byte encode");
+        out.clear();
+        check(encode_utf8(0x1F600, out) && out == "\xf0\x9f\x98\x80", "4-byte encode");
+        out.clear();
+        check(!encode_utf8(0xD800, out), "surrogates rejected");
+        check(!encode_utf8(0x110000, out), "out-of-range rejected");
+    }
+
+    // \uXXXX escape decoding, surrogate pairs included
+    {
+        std::string out;
+        auto r = decode_json_unicode_escape("0041", 4, out);
+        check(r.has_value() && *r == 4 && out == "A", "BMP escape decode");
+
+        out.clear();
+        auto pair = decode_json_unicode_escape("d83d\\ude00", 10, out);
+        check(pair.has_value() && *pair == 10 && out == "\xf0\x9f\x98\x80",
+              "surrogate pair escape decode consumes both units");
+
+        out.clear();
+        check(!decode_json_unicode_escape("d83d", 4, out).has_value(),
+              "unpaired high surrogate rejected");
+        check(!decode_json_unicode_escape("zzzz", 4, out).has_value(),
+              "non-hex rejected");
+        check(!decode_json_unicode_escape("00", 2, out).has_value(),
+              "truncated escape rejected");
+    }
+
+    // Transcoders: known sequences through the dispatched entry points
+    {
+        std::string u16;
+        for (uint32_t cp : {0x48u, 0x69u, 0xE9u, 0x20ACu, 0x1F600u}) {
+            push_utf16(u16, cp);
+        }
+        std::string out;
+        auto r = utf16le_to_utf8(u16, out);
+        check(r.has_value() && out == "Hi\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80",
+              "utf16 mixed-width sequence");
+
+        std::string u32;
+        for (uint32_t cp : {0x48u, 0xE9u, 0x1F600u}) {
+            push_utf32(u32, cp);
+        }
+        out.clear();
+        auto r32 = utf32le_to_utf8(u32, out);
+        check(r32.has_value() && out == "H\xc3\xa9\xf0\x9f\x98\x80",
+              "utf32 mixed-width sequence");
+    }
+
+    // Error contract: odd lengths, lone surrogates, out-of-range UTF-32
+    {
+        std::string out;
+        check(!utf16le_to_utf8("a", out).has_value(), "odd utf16 length rejected");
+        check(!utf32le_to_utf8("abc", out).has_value(), "non-multiple-of-4 rejected");
+
+        std::string lone;
+        push_utf16(lone, 0x41);
+        lone += '\x00';
+        lone += '\xd8';  // Lone high surrogate, nothing after
+        check(!utf16le_to_utf8(lone, out).has_value(), "lone high surrogate rejected");
+
+        std::string reversed;
+        reversed += '\x00';
+        reversed += '\xdc';  // Low surrogate first
+        check(!utf16le_to_utf8(reversed, out).has_value(), "lone low surrogate rejected");
+
+        std::string too_big;
+        push_utf32(too_big, 0x110000);
+        check(!utf32le_to_utf8(too_big, out).has_value(), "utf32 out of range rejected");
+        std::string surrogate32;
+        push_utf32(surrogate32, 0xD800);
+        check(!utf32le_to_utf8(surrogate32, out).has_value(), "utf32 surrogate rejected");
+    }
+
+    // Randomized SIMD/scalar parity sweep: long mixed streams make the
+    // vector kernels hit every uniform-block fast path and every scalar
+    // fallback seam
+    {
+        std::mt19937 rng(20260827);
+        std::uniform_int_distribution<int> klass(0, 3);
+        bool parity = true;
+        for (int round = 0; round < 200 && parity; ++round) {
+            std::string u16;
+            std::string u32;
+            int run = 0;
+            uint32_t run_class = 0;
+            for (int i = 0; i < 500; ++i) {
+                if (run == 0) {  // Uniform runs with occasional width switches
+                    run = 1 + static_cast<int>(rng() % 40);
+                    run_class = static_cast<uint32_t>(klass(rng));
+                }
+                --run;
+                uint32_t cp = 0;
+                switch (run_class) {
+                    case 0: cp = 0x20 + rng() % 0x5F; break;          // ASCII
+                    case 1: cp = 0x80 + rng() % 0x780; break;         // 2-byte
+                    case 2: cp = 0x800 + rng() % 0xD000; break;       // 3-byte, no surrogates
+                    default: cp = 0x10000 + rng() % 0x10000; break;   // Astral
+                }
+                push_utf16(u16, cp);
+                push_utf32(u32, cp);
+            }
+
+            std::string dispatched16;
+            std::string scalar16;
+            auto a = utf16le_to_utf8(u16, dispatched16);
+            auto b = utf16le_to_utf8_scalar(u16, scalar16);
+            parity = a.has_value() && b.has_value() && dispatched16 == scalar16;
+
+            std::string dispatched32;
+            std::string scalar32;
+            auto c = utf32le_to_utf8(u32, dispatched32);
+            auto d = utf32le_to_utf8_scalar(u32, scalar32);
+            parity = parity && c.has_value() && d.has_value() && dispatched32 == scalar32
+                     && dispatched16 == dispatched32;
+        }
+        check(parity, "SIMD and scalar transcoders agree over randomized streams");
+    }
+
+    if (failures == 0) {
+        std::printf("test_unicode: all checks passed\n");
+        return 0;
+    }
+    return 1;
+}
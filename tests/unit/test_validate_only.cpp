@@ -0,0 +1,105 @@
+// Unit tests for validation-only mode (validate): acceptance must agree
+// with the full parser across valid and malformed inputs - same verdict,
+// same error taxonomy - while building no DOM, plus the validate-specific
+// limits (bounded container bit-stack, whole-input UTF-8 pass).
+#include <iostream>
+#include <string>
+#include <vector>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// validate() and parse() must agree on accept/reject
+static auto agree(std::string_view input, const char* what) -> void {
+    bool validated = validate(input).has_value();
+    bool parsed = parse(input).has_value();
+    if (validated != parsed) {
+        std::cout << "FAIL: " << what << " (validate=" << validated << " parse=" << parsed
+                  << ")\n";
+        ++failures;
+    }
+}
+
+auto main() -> int {
+    // Verdict agreement across the grammar
+    {
+        const char* inputs[] = {
+            R"({"a":[1,-2.5e3,"x\"y",true,null],"b":{}})",
+            "[]", "{}", "42", "-0.5", "\"scalar\"", "true", "null",
+            "[[[[[1]]]]]", R"({"":{"":[""]}})",
+            // Malformed
+            "", "   ", "[1,2", "{\"k\":1", "[1,,2]", "[1 2]", "{\"k\" 1}",
+            "{\"k\":}", "{:1}", "{1:2}", "[01]", "[1.]", "[.5]", "[1e]", "[+1]",
+            "tru", "nul", "truex", "[true false]", "{} {}", "[1]]",
+            R"(["unterminated)", R"(["bad\escape"])", R"(["bad\u12"])",
+            "\"lone", "}",
+        };
+        for (const char* in : inputs) {
+            agree(in, in[0] ? in : "<empty>");
+        }
+    }
+
+    // Error taxonomy matches the parser's codes
+    {
+        check(validate("").error().code == json_error_code::empty_input, "empty_input");
+        check(validate("[1,2").error().code == json_error_code::unexpected_end,
+              "unexpected_end");
+        check(validate("{} junk").error().code == json_error_code::extra_tokens,
+              "extra_tokens");
+        check(validate("[tru]").error().code == json_error_code::invalid_literal
+                  || validate("[tru]").error().code == json_error_code::invalid_syntax,
+              "bad literal code");
+        check(validate("[01]").error().code == json_error_code::invalid_number,
+              "invalid_number");
+        check(validate("\"\xff\xfe\"").error().code == json_error_code::invalid_unicode,
+              "invalid UTF-8 caught by the streaming pass");
+    }
+
+    // Depth limiting uses the same max_depth knob
+    {
+        std::string deep(600, '[');
+        deep += std::string(600, ']');
+        check(validate(deep).has_value(), "600 levels fit the default limit");
+
+        parse_config shallow;
+        shallow.max_depth = 16;
+        set_parse_config(shallow);
+        std::string over(17, '[');
+        over += std::string(17, ']');
+        check(!validate(over).has_value()
+                  && validate(over).error().code == json_error_code::max_depth_exceeded,
+              "max_depth enforced");
+        set_parse_config(parse_config{});
+    }
+
+    // Large structurally varied document validates fast-path clean
+    {
+        std::string doc = "[";
+        for (int i = 0; i < 20000; ++i) {
+            if (i) doc += ",";
+            doc += R"({"id":)" + std::to_string(i) + R"(,"s":"v\n)" + std::to_string(i)
+                   + "\"}";
+        }
+        doc += "]";
+        check(validate(doc).has_value(), "large document validates");
+        doc[doc.size() / 2] = '}';  // Corrupt one byte mid-document
+        check(validate(doc).has_value() == parse(doc).has_value(),
+              "verdicts agree on the corrupted document");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_validate_only: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
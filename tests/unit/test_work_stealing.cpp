@@ -0,0 +1,125 @@
+// Unit tests for the work-stealing parallel parse path: scheduling is pure
+// mechanism, so with use_work_stealing on or off, at any thread count, and
+// under the skewed element distributions stealing exists for, the document
+// must come out byte-identical to a serial parse.
+#include <iostream>
+#include <string>
+
+import fastjson_parallel;
+
+using namespace fastjson_parallel;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cout << "FAIL: " << what << "\n";
+        ++failures;
+    }
+}
+
+// Heavily skewed array: one element dwarfs the rest, the shape that stalls
+// static chunking and makes idle workers steal
+static auto make_skewed(size_t records, size_t heavy_at, size_t heavy_depth) -> std::string {
+    std::string doc = "[";
+    for (size_t i = 0; i < records; ++i) {
+        if (i) doc += ",";
+        if (i == heavy_at) {
+            for (size_t d = 0; d < heavy_depth; ++d) {
+                doc += R"({"level":[)";
+            }
+            doc += "0";
+            for (size_t d = 0; d < heavy_depth; ++d) {
+                doc += "]}";
+            }
+        } else {
+            doc += std::to_string(i);
+        }
+    }
+    return doc + "]";
+}
+
+static auto parse_mode(std::string_view doc, bool stealing, int threads)
+    -> json_result<json_value> {
+    parse_config cfg;
+    cfg.use_work_stealing = stealing;
+    cfg.num_threads = threads;
+    cfg.parallel_threshold = 256;  // Keep the parallel path engaged
+    return parse_with_config(doc, cfg);
+}
+
+auto main() -> int {
+    // Skewed arrays: heavy element at the front, middle, and back
+    {
+        for (size_t heavy_at : {size_t{0}, size_t{10000}, size_t{19999}}) {
+            const std::string doc = make_skewed(20000, heavy_at, 400);
+            auto serial = parse_mode(doc, false, 1);
+            check(serial.has_value(), "serial parse of the skewed array succeeds");
+
+            for (int threads : {2, 4, 8}) {
+                auto stolen = parse_mode(doc, true, threads);
+                check(stolen.has_value(), "work-stealing parse succeeds");
+                check(serial && stolen && stringify(*stolen) == stringify(*serial),
+                      "work-stealing result matches serial");
+
+                auto static_split = parse_mode(doc, false, threads);
+                check(serial && static_split
+                          && stringify(*static_split) == stringify(*serial),
+                      "static scheduling agrees too");
+            }
+        }
+    }
+
+    // Wide object with skewed values takes the object-parallel path
+    {
+        std::string doc = "{";
+        for (int i = 0; i < 5000; ++i) {
+            if (i) doc += ",";
+            doc += "\"k" + std::to_string(i) + "\":";
+            doc += (i == 2500) ? make_skewed(2000, 1000, 100) : std::to_string(i);
+        }
+        doc += "}";
+
+        auto serial = parse_mode(doc, false, 1);
+        auto stolen = parse_mode(doc, true, 8);
+        check(serial.has_value() && stolen.has_value(), "skewed object parses");
+        check(serial && stolen && stringify(*stolen) == stringify(*serial),
+              "object-parallel stealing matches serial");
+    }
+
+    // Uniform payloads and tiny documents: stealing must be a no-op
+    // behaviorally even when there is nothing to steal
+    {
+        std::string uniform = "[";
+        for (int i = 0; i < 50000; ++i) {
+            if (i) uniform += ",";
+            uniform += std::to_string(i);
+        }
+        uniform += "]";
+        auto serial = parse_mode(uniform, false, 1);
+        auto stolen = parse_mode(uniform, true, 8);
+        check(serial && stolen && stringify(*stolen) == stringify(*serial),
+              "uniform array unchanged under stealing");
+
+        auto tiny = parse_mode("[1,2,3]", true, 8);
+        check(tiny.has_value() && tiny->as_array().size() == 3,
+              "sub-threshold document parses with stealing enabled");
+    }
+
+    // Errors surface identically through the stealing path
+    {
+        const std::string broken = make_skewed(20000, 10000, 400).substr(0, 50000);
+        auto serial = parse_mode(broken, false, 1);
+        auto stolen = parse_mode(broken, true, 8);
+        check(!serial.has_value() && !stolen.has_value(), "truncated document fails");
+        check(!serial.has_value() && !stolen.has_value()
+                  && serial.error().code == stolen.error().code,
+              "stealing path reports the same error code");
+    }
+
+    if (failures == 0) {
+        std::cout << "test_work_stealing: all checks passed\n";
+        return 0;
+    }
+    return 1;
+}
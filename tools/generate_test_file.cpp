@@ -1,76 +1,376 @@
+// ============================================================================
+// Parallel Test-Corpus Generator
+// ============================================================================
+// Produces the large JSON corpora used to soak-test the parallel parser.
+// Records are generated in fixed-index chunks whose bytes depend only on
+// (seed, chunk index), so output is byte-identical regardless of thread
+// count; chunks are built in parallel waves (OpenMP) and written with
+// pwrite() at prefix-summed offsets, which keeps memory bounded by
+// threads x chunk size and the disk as the only bottleneck.
+//
+// Shape profiles mirror our production payload classes:
+//   records      array of user records under {"data":[...]} (legacy shape)
+//   flat-numeric one flat array of numbers (columnar / telemetry payloads)
+//   deep-tree    array of deeply nested single-key objects (config trees)
+//   wide-object  array of objects with ~200 keys each (entity snapshots)
+//   escape-heavy array of strings dense in \", \\, \n and \uXXXX escapes
+//   ndjson       one record object per line, no enclosing array
+//
+// Build: g++ -std=c++2b -O2 -fopenmp -o generate_test_file generate_test_file.cpp
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
-#include <fstream>
+#include <cstring>
 #include <iostream>
+#include <random>
 #include <string>
+#include <vector>
 
-auto generate_large_json_file(const std::string& filename, size_t size_mb) -> void {
-    std::ofstream file(filename);
-    if (!file) {
-        std::cerr << "Failed to create file: " << filename << "\n";
-        return;
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+// ============================================================================
+// Profiles
+// ============================================================================
+
+enum class profile {
+    records,
+    flat_numeric,
+    deep_tree,
+    wide_object,
+    escape_heavy,
+    ndjson,
+};
+
+struct profile_info {
+    const char* name;
+    profile value;
+    const char* open;   // Root opener, written once at offset 0
+    const char* close;  // Root closer, written after the last chunk
+    bool comma_joined;  // Elements joined by ',' (false for NDJSON lines)
+};
+
+constexpr profile_info profiles[] = {
+    {"records", profile::records, "{\"data\":[", "]}\n", true},
+    {"flat-numeric", profile::flat_numeric, "[", "]\n", true},
+    {"deep-tree", profile::deep_tree, "[", "]\n", true},
+    {"wide-object", profile::wide_object, "[", "]\n", true},
+    {"escape-heavy", profile::escape_heavy, "[", "]\n", true},
+    {"ndjson", profile::ndjson, "", "", false},
+};
+
+auto find_profile(const std::string& name) -> const profile_info* {
+    for (const auto& p : profiles) {
+        if (name == p.name) {
+            return &p;
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// Record Emitters
+// ============================================================================
+// Each emitter appends one element for global record index `id` using only
+// `rng` for randomness; determinism across thread counts follows from the
+// per-chunk seeding below.
+
+auto emit_record(std::string& out, uint64_t id, std::mt19937_64& rng) -> void {
+    out += "{\"id\":";
+    out += std::to_string(id);
+    out += ",\"name\":\"User";
+    out += std::to_string(id);
+    out += "\",\"email\":\"user";
+    out += std::to_string(id);
+    out += "@example.com\",\"age\":";
+    out += std::to_string(20 + rng() % 60);
+    out += ",\"active\":";
+    out += (rng() % 2 == 0) ? "true" : "false";
+    out += ",\"score\":";
+    out += std::to_string(100.0 + static_cast<double>(rng() % 9000) / 10.0);
+    out += ",\"tags\":[\"tag1\",\"tag2\",\"tag3\"]";
+    out += ",\"metadata\":{\"created\":\"2024-01-01\",\"updated\":\"2024-12-01\",\"version\":";
+    out += std::to_string(1 + rng() % 9);
+    out += "}}";
+}
+
+auto emit_flat_numeric(std::string& out, uint64_t id, std::mt19937_64& rng) -> void {
+    // Mix of integer and fixed-point tokens so every number-parsing tier runs
+    if (id % 3 == 0) {
+        out += std::to_string(static_cast<int64_t>(rng() % 2000000) - 1000000);
+    } else {
+        out += std::to_string(rng() % 100000);
+        out += '.';
+        out += std::to_string(1000 + rng() % 9000);
+    }
+}
+
+auto emit_deep_tree(std::string& out, uint64_t id, std::mt19937_64& rng) -> void {
+    size_t depth = 24 + rng() % 25;
+    for (size_t d = 0; d < depth; ++d) {
+        out += "{\"n";
+        out += std::to_string(d);
+        out += "\":";
+    }
+    out += std::to_string(id);
+    out.append(depth, '}');
+}
+
+auto emit_wide_object(std::string& out, uint64_t id, std::mt19937_64& rng) -> void {
+    size_t keys = 150 + rng() % 100;
+    out += '{';
+    for (size_t k = 0; k < keys; ++k) {
+        if (k != 0) {
+            out += ',';
+        }
+        out += "\"field_";
+        out += std::to_string(k);
+        out += "\":";
+        switch (k % 3) {
+            case 0: out += std::to_string(rng() % 1000000); break;
+            case 1:
+                out += "\"v";
+                out += std::to_string(rng() % 10000);
+                out += '"';
+                break;
+            default: out += (rng() % 2 == 0) ? "true" : "null"; break;
+        }
+    }
+    (void)id;
+    out += '}';
+}
+
+auto emit_escape_heavy(std::string& out, uint64_t id, std::mt19937_64& rng) -> void {
+    size_t len = 40 + rng() % 120;
+    out += '"';
+    for (size_t i = 0; i < len; ++i) {
+        switch (rng() % 8) {
+            case 0: out += "\\\""; break;
+            case 1: out += "\\\\"; break;
+            case 2: out += "\\n"; break;
+            case 3: out += "\\t"; break;
+            case 4: {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x",
+                              static_cast<unsigned>(0x20 + rng() % 0x5e));
+                out += buf;
+                break;
+            }
+            default: out += static_cast<char>('a' + rng() % 26); break;
+        }
+    }
+    (void)id;
+    out += '"';
+}
+
+auto emit_element(profile shape, std::string& out, uint64_t id, std::mt19937_64& rng) -> void {
+    switch (shape) {
+        case profile::records: emit_record(out, id, rng); break;
+        case profile::flat_numeric: emit_flat_numeric(out, id, rng); break;
+        case profile::deep_tree: emit_deep_tree(out, id, rng); break;
+        case profile::wide_object: emit_wide_object(out, id, rng); break;
+        case profile::escape_heavy: emit_escape_heavy(out, id, rng); break;
+        case profile::ndjson: emit_record(out, id, rng); break;
     }
+}
 
-    std::cout << "Generating " << size_mb << " MB JSON file: " << filename << "\n";
+// ============================================================================
+// Chunked Parallel Generation
+// ============================================================================
 
-    file << "{\"data\":[";
+// Elements per chunk, sized so a chunk lands around 8-32 MB for every profile
+auto elements_per_chunk(profile shape) -> size_t {
+    switch (shape) {
+        case profile::flat_numeric: return 1 << 20;
+        case profile::wide_object: return 4096;
+        case profile::deep_tree: return 32768;
+        default: return 65536;
+    }
+}
 
-    const size_t target_bytes = size_mb * 1024 * 1024;
-    size_t bytes_written = 12;  // Account for {"data":[ and closing ]}
+// Builds chunk `index` into `out`. The chunk's RNG is derived from the seed
+// and the chunk index alone (splitmix-style mix), never from thread identity.
+auto build_chunk(const profile_info& info, uint64_t seed, uint64_t index, std::string& out)
+    -> void {
+    uint64_t z = (seed + 0x9e3779b97f4a7c15ULL * (index + 1));
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    std::mt19937_64 rng(z ^ (z >> 31));
 
-    bool first = true;
-    size_t record_count = 0;
+    size_t per_chunk = elements_per_chunk(info.value);
+    uint64_t first = index * per_chunk;
+    out.clear();
+    for (size_t i = 0; i < per_chunk; ++i) {
+        if (info.comma_joined) {
+            if (index != 0 || i != 0) {
+                out += ',';
+            }
+        }
+        emit_element(info.value, out, first + i, rng);
+        if (!info.comma_joined) {
+            out += '\n';
+        }
+    }
+}
 
-    while (bytes_written < target_bytes) {
-        if (!first) {
-            file << ",";
-            bytes_written += 1;
+auto write_all_at(int fd, const std::string& data, off_t offset) -> bool {
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t n = ::pwrite(fd, data.data() + done, data.size() - done, offset + done);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
         }
-        first = false;
-
-        // Generate a record with various data types
-        std::string record = "{\"id\":" + std::to_string(record_count) + ",\"name\":\"User"
-                             + std::to_string(record_count) + "\",\"email\":\"user"
-                             + std::to_string(record_count) + "@example.com\""
-                             + ",\"age\":" + std::to_string(20 + (record_count % 60))
-                             + ",\"active\":" + ((record_count % 2 == 0) ? "true" : "false")
-                             + ",\"score\":" + std::to_string(100.0 + (record_count % 900) / 10.0)
-                             + ",\"tags\":[\"tag1\",\"tag2\",\"tag3\"]"
-                             + ",\"metadata\":{\"created\":\"2024-01-01\",\"updated\":\"2024-12-"
-                               "01\",\"version\":1}}";
-
-        file << record;
-        bytes_written += record.size();
-        record_count++;
-
-        if (record_count % 10000 == 0) {
-            std::cout << "Progress: " << (bytes_written / (1024.0 * 1024.0)) << " MB / " << size_mb
-                      << " MB (" << (100.0 * bytes_written / target_bytes) << "%)\n";
+        done += static_cast<size_t>(n);
+        offset += n;
+    }
+    return true;
+}
+
+auto generate(const std::string& filename, size_t size_mb, const profile_info& info,
+              uint64_t seed, int threads) -> bool {
+#ifdef _OPENMP
+    if (threads > 0) {
+        omp_set_num_threads(threads);
+    }
+#else
+    (void)threads;
+#endif
+
+    int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "Failed to create file: " << filename << "\n";
+        return false;
+    }
+
+    const uint64_t target_bytes = static_cast<uint64_t>(size_mb) * 1024 * 1024;
+    std::cout << "Generating " << size_mb << " MB (" << info.name << ", seed " << seed
+              << "): " << filename << "\n";
+
+    std::string root_open(info.open);
+    if (!root_open.empty() && !write_all_at(fd, root_open, 0)) {
+        ::close(fd);
+        return false;
+    }
+    uint64_t written = root_open.size();
+    uint64_t next_chunk = 0;
+
+#ifdef _OPENMP
+    int wave = omp_get_max_threads();
+#else
+    int wave = 1;
+#endif
+
+    std::vector<std::string> buffers(wave);
+    while (written < target_bytes) {
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < wave; ++i) {
+            build_chunk(info, seed, next_chunk + i, buffers[i]);
+        }
+        // Prefix-sum this wave's offsets, then write the chunks in parallel.
+        // Chunks past the size target still land so the document stays whole.
+        std::vector<uint64_t> offsets(wave);
+        uint64_t base = written;
+        int used = 0;
+        for (int i = 0; i < wave; ++i) {
+            offsets[i] = base;
+            base += buffers[i].size();
+            ++used;
+            if (base >= target_bytes) {
+                break;
+            }
         }
+        bool write_failed = false;
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < used; ++i) {
+            if (!write_all_at(fd, buffers[i], static_cast<off_t>(offsets[i]))) {
+#pragma omp critical
+                write_failed = true;
+            }
+        }
+        if (write_failed) {
+            std::cerr << "Write failed: " << std::strerror(errno) << "\n";
+            ::close(fd);
+            return false;
+        }
+        written = offsets[used - 1] + buffers[used - 1].size();
+        next_chunk += used;
+        std::cout << "Progress: " << (written / (1024.0 * 1024.0)) << " MB / " << size_mb
+                  << " MB (" << (100.0 * static_cast<double>(written) / target_bytes) << "%)\n";
     }
 
-    file << "]}";
+    std::string root_close(info.close);
+    if (!root_close.empty() && !write_all_at(fd, root_close, static_cast<off_t>(written))) {
+        ::close(fd);
+        return false;
+    }
+    written += root_close.size();
+    ::close(fd);
 
-    std::cout << "Generated " << record_count << " records\n";
-    std::cout << "Final size: " << (bytes_written / (1024.0 * 1024.0)) << " MB\n";
+    std::cout << "Generated " << next_chunk * elements_per_chunk(info.value) << " elements\n";
+    std::cout << "Final size: " << (written / (1024.0 * 1024.0)) << " MB\n";
     std::cout << "File saved to: " << filename << "\n";
+    return true;
 }
 
-int main(int argc, char* argv[]) {
-    if (argc != 3) {
-        std::cerr << "Usage: " << argv[0] << " <output_file> <size_in_mb>\n";
-        std::cerr << "Example: " << argv[0] << " test_2gb.json 2048\n";
+auto usage(const char* argv0) -> void {
+    std::cerr << "Usage: " << argv0
+              << " <output_file> <size_in_mb> [--profile=NAME] [--seed=N] [--threads=N]\n";
+    std::cerr << "Profiles:";
+    for (const auto& p : profiles) {
+        std::cerr << " " << p.name;
+    }
+    std::cerr << " (default: records)\n";
+    std::cerr << "Example: " << argv0 << " soak_10gb.json 10240 --profile=flat-numeric --seed=7\n";
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    if (argc < 3) {
+        usage(argv[0]);
         return 1;
     }
 
     std::string filename = argv[1];
-    size_t size_mb = std::atoi(argv[2]);
+    size_t size_mb = static_cast<size_t>(std::atoll(argv[2]));
+    const profile_info* info = find_profile("records");
+    uint64_t seed = 42;
+    int threads = 0;
 
-    if (size_mb == 0 || size_mb > 10000) {
-        std::cerr << "Size must be between 1 and 10000 MB\n";
-        return 1;
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--profile=", 0) == 0) {
+            info = find_profile(arg.substr(10));
+            if (info == nullptr) {
+                std::cerr << "Unknown profile: " << arg.substr(10) << "\n";
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (arg.rfind("--seed=", 0) == 0) {
+            seed = static_cast<uint64_t>(std::strtoull(arg.c_str() + 7, nullptr, 10));
+        } else if (arg.rfind("--threads=", 0) == 0) {
+            threads = std::atoi(arg.c_str() + 10);
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            usage(argv[0]);
+            return 1;
+        }
     }
 
-    generate_large_json_file(filename, size_mb);
+    if (size_mb == 0 || size_mb > 100000) {
+        std::cerr << "Size must be between 1 and 100000 MB\n";
+        return 1;
+    }
 
-    return 0;
+    return generate(filename, size_mb, *info, seed, threads) ? 0 : 1;
 }